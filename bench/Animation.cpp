@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <vector>
+
+#include <FMaths/Animation.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t joints = 128;
+    const size_t keys = 60;
+    const size_t frames = 240;
+    const size_t repeats = 10;
+    const float duration = 4.f;
+
+    AnimationClip clip(joints, duration);
+
+    std::vector<float> times(keys);
+    std::vector<Vector3> translations(keys), scales(keys);
+    std::vector<Quaternion> rotations(keys);
+
+    for (size_t j = 0; j < joints; j++)
+    {
+        for (size_t k = 0; k < keys; k++)
+        {
+            times[k] = duration * static_cast<float>(k) / (keys - 1);
+            translations[k] = Vector3(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f));
+            rotations[k] = Quaternion(Vector3(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), 1.f), RandomFloat(-3.f, 3.f));
+            scales[k] = Vector3(RandomFloat(0.5f, 1.5f), RandomFloat(0.5f, 1.5f), RandomFloat(0.5f, 1.5f));
+        }
+
+        clip.SetTranslations(j, times.data(), translations.data(), keys);
+        clip.SetRotations(j, times.data(), rotations.data(), keys);
+        clip.SetScales(j, times.data(), scales.data(), keys);
+    }
+
+    // Array of structures tracks, as they were stored before
+    struct Key
+    {
+        float time;
+        Vector3 translation;
+        Quaternion rotation;
+        Vector3 scale;
+    };
+
+    std::vector<std::vector<Key>> tracks(joints, std::vector<Key>(keys));
+    for (size_t j = 0; j < joints; j++)
+        for (size_t k = 0; k < keys; k++)
+        {
+            size_t i = clip.translations.offsets[j] + k;
+            tracks[j][k] = {
+                clip.translations.times[i],
+                Vector3(clip.translations.x[i], clip.translations.y[i], clip.translations.z[i]),
+                Quaternion(clip.rotations.x[i], clip.rotations.y[i], clip.rotations.z[i], clip.rotations.w[i]),
+                Vector3(clip.scales.x[i], clip.scales.y[i], clip.scales.z[i])
+            };
+        }
+
+    std::vector<Key> naive(joints);
+    Pose pose(joints);
+    PoseSampler sampler(clip);
+    std::vector<Matrix4x4> local(joints);
+
+    Bench("Binary search and scalar lerp per joint", joints * frames, repeats, [&]() {
+        for (size_t f = 0; f < frames; f++)
+        {
+            float time = duration * static_cast<float>(f) / frames;
+
+            for (size_t j = 0; j < joints; j++)
+            {
+                const std::vector<Key>& track = tracks[j];
+
+                size_t b = static_cast<size_t>(std::upper_bound(track.begin(), track.end(), time,
+                    [](float t, const Key& key) { return t < key.time; }) - track.begin());
+                b = std::min(std::max<size_t>(b, 1), keys - 1);
+
+                const Key& ka = track[b - 1];
+                const Key& kb = track[b];
+                float alpha = (time - ka.time) / (kb.time - ka.time);
+
+                Quaternion qb = (ka.rotation.Dot(kb.rotation) < 0.f) ? kb.rotation * -1.f : kb.rotation;
+
+                naive[j].translation = ka.translation + ((kb.translation - ka.translation) * alpha);
+                naive[j].rotation = (ka.rotation + ((qb - ka.rotation) * alpha)).Normalized();
+                naive[j].scale = ka.scale + ((kb.scale - ka.scale) * alpha);
+            }
+
+            DoNotOptimize(naive.data());
+        }
+    });
+
+    Bench("PoseSampler::Sample", joints * frames, repeats, [&]() {
+        sampler.Reset();
+
+        for (size_t f = 0; f < frames; f++)
+        {
+            sampler.Sample(duration * static_cast<float>(f) / frames, pose);
+            DoNotOptimize(pose.rw.data());
+        }
+    });
+
+    Bench("Matrix4x4 TRS per joint", joints * frames, repeats, [&]() {
+        for (size_t f = 0; f < frames; f++)
+        {
+            for (size_t j = 0; j < joints; j++)
+            {
+                Quaternion q = pose.Rotation(j);
+                local[j] = Matrix4x4::Translate(pose.Translation(j)) * Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w)) *
+                    Matrix4x4::Scale(pose.Scale(j));
+            }
+
+            DoNotOptimize(local.data());
+        }
+    });
+
+    Bench("LocalMatrices", joints * frames, repeats, [&]() {
+        for (size_t f = 0; f < frames; f++)
+        {
+            LocalMatrices(pose, local.data());
+            DoNotOptimize(local.data());
+        }
+    });
+}
@@ -0,0 +1,66 @@
+/**
+ * @file Bench.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Minimal timing helpers shared by the benchmarks
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <random>
+
+/**
+ * @brief Time fn over a number of repeats and print items processed per second
+ *
+ * @param name Label printed with the result
+ * @param items Items processed by a single call of fn
+ * @param repeats Times to call fn, the fastest call is reported
+ */
+template<typename Fn>
+double Bench(const char* name, size_t items, size_t repeats, Fn fn)
+{
+    using Clock = std::chrono::steady_clock;
+    double best = 1e30;
+
+    for (size_t r = 0; r < repeats; r++)
+    {
+        Clock::time_point start = Clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = Clock::now() - start;
+
+        if (elapsed.count() < best)
+            best = elapsed.count();
+    }
+
+    double rate = static_cast<double>(items) / best;
+    printf("%-40s %12.2f M/s\n", name, rate * 1e-6);
+    return rate;
+}
+
+/**
+ * @brief Prevent the optimizer from discarding a result
+ */
+template<typename T>
+void DoNotOptimize(const T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+/**
+ * @brief Uniform random float, seeded identically each run
+ */
+inline float RandomFloat(float min, float max)
+{
+    static std::mt19937 rng(1234);
+    return std::uniform_real_distribution<float>(min, max)(rng);
+}
+
+#endif
@@ -0,0 +1,134 @@
+#include <cmath>
+#include <vector>
+
+#include <FMaths/Collision.h>
+
+#include "Bench.h"
+
+namespace
+{
+
+/**
+ * @brief Textbook box-box SAT through the Vector3 operators, the separation along each of the 15 axes
+ */
+float NaiveSat(const OBB& a, const OBB& b)
+{
+    Vector3 axes[15];
+    size_t n = 0;
+
+    for (size_t i = 0; i < 3; i++)
+        axes[n++] = a.axes[i];
+
+    for (size_t j = 0; j < 3; j++)
+        axes[n++] = b.axes[j];
+
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++)
+        {
+            Vector3 axis = a.axes[i].Cross(b.axes[j]);
+            if (axis.LengthSquared() > 1e-6f)
+                axes[n++] = axis.Normalized();
+        }
+
+    Vector3 d = b.centre - a.centre;
+    float best = -1e30f;
+
+    for (size_t k = 0; k < n; k++)
+    {
+        float ra = 0.f, rb = 0.f;
+        for (size_t i = 0; i < 3; i++)
+        {
+            ra += a.halfExtents[i] * std::fabs(a.axes[i].Dot(axes[k]));
+            rb += b.halfExtents[i] * std::fabs(b.axes[i].Dot(axes[k]));
+        }
+
+        best = std::fmax(best, std::fabs(d.Dot(axes[k])) - ra - rb);
+    }
+
+    return best;
+}
+
+Quaternion RandomRotation()
+{
+    Vector3 axis(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(0.1f, 1.f));
+    return Quaternion(axis.Normalized(), RandomFloat(-3.14f, 3.14f));
+}
+
+} // namespace
+
+int main()
+{
+    const size_t shapeCount = 10000;
+    const size_t count = 100000;
+    const size_t repeats = 5;
+
+    std::vector<ConvexShape> shapes;
+    std::vector<ConvexShape> boxShapes;
+    std::vector<OBB> boxes;
+
+    for (size_t i = 0; i < shapeCount; i++)
+    {
+        Vector3 p(RandomFloat(-20.f, 20.f), RandomFloat(-20.f, 20.f), RandomFloat(-20.f, 20.f));
+        Vector3 e(RandomFloat(0.5f, 2.f), RandomFloat(0.5f, 2.f), RandomFloat(0.5f, 2.f));
+        Quaternion q = RandomRotation();
+
+        shapes.push_back(i % 2 == 0 ? ConvexShape::Capsule(e.y, e.x * 0.5f) : ConvexShape::Sphere(e.x));
+        shapes.back().SetTransform(p, q);
+
+        boxShapes.push_back(ConvexShape::Box(e));
+        boxShapes.back().SetTransform(p, q);
+
+        boxes.push_back(OBB(p, q.Apply(Vector3(1.f, 0.f, 0.f)), q.Apply(Vector3(0.f, 1.f, 0.f)), q.Apply(Vector3(0.f, 0.f, 1.f)), e));
+    }
+
+    // Broadphase style pairs, nearby shapes so around half overlap
+    std::vector<ShapePair> pairs(count);
+    for (ShapePair& pair : pairs)
+    {
+        pair.a = static_cast<uint32_t>(RandomFloat(0.f, float(shapeCount - 1)));
+        pair.b = (pair.a + 1) % shapeCount;
+        boxes[pair.b].centre = boxes[pair.a].centre + Vector3(RandomFloat(-2.f, 2.f), RandomFloat(-2.f, 2.f), RandomFloat(-2.f, 2.f));
+        boxShapes[pair.b].position = boxes[pair.b].centre;
+        shapes[pair.b].position = boxes[pair.b].centre;
+        shapes[pair.a].position = boxes[pair.a].centre;
+    }
+
+    std::vector<Contact> contacts(count);
+
+    float separation = 0.f;
+    Bench("Naive box SAT", count, repeats, [&]() {
+        for (const ShapePair& pair : pairs)
+            separation += NaiveSat(boxes[pair.a], boxes[pair.b]);
+        DoNotOptimize(separation);
+    });
+
+    Bench("Batched box SAT with contacts", count, repeats, [&]() {
+        Collide(boxes.data(), pairs.data(), count, contacts.data());
+        DoNotOptimize(contacts.data());
+    });
+
+    Bench("GJK and EPA, capsules and spheres", count, repeats, [&]() {
+        Collide(shapes.data(), pairs.data(), count, contacts.data());
+        DoNotOptimize(contacts.data());
+    });
+
+    Bench("GJK and EPA, boxes", count, repeats, [&]() {
+        Collide(boxShapes.data(), pairs.data(), count, contacts.data());
+        DoNotOptimize(contacts.data());
+    });
+
+    size_t overlaps = 0;
+    Bench("GJK overlap test, boxes", count, repeats, [&]() {
+        for (const ShapePair& pair : pairs)
+            overlaps += Overlap(boxShapes[pair.a], boxShapes[pair.b]);
+        DoNotOptimize(overlaps);
+    });
+
+    ThreadPool pool(4);
+    Bench("GJK and EPA, boxes, 4 threads", count, repeats, [&]() {
+        Collide(boxShapes.data(), pairs.data(), count, contacts.data(), pool.GetExecutor());
+        DoNotOptimize(contacts.data());
+    });
+
+    return 0;
+}
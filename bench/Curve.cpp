@@ -0,0 +1,95 @@
+#include <vector>
+
+#include <FMaths/Curve.h>
+#include <FMaths/Vector3.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 1 << 20;
+    const size_t repeats = 10;
+
+    std::vector<Vector3> points(64);
+    for (Vector3& p : points)
+        p = Vector3(RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f));
+
+    Spline<Vector3> spline(CurveBasis::CatmullRom, points.data(), points.size());
+    const float segments = static_cast<float>(spline.SegmentCount());
+
+    std::vector<float> u(count), s(count), t(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        u[i] = RandomFloat(0.f, segments);
+        s[i] = RandomFloat(0.f, spline.Length());
+        t[i] = RandomFloat(0.f, 1.f);
+    }
+
+    std::vector<Vector3> out(count);
+
+    Bench("Catmull-Rom through operators", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t seg = static_cast<size_t>(u[i]);
+            float f = u[i] - static_cast<float>(seg);
+            const Vector3* p = &points[seg];
+
+            float f2 = f * f, f3 = f2 * f;
+            out[i] = ((p[1] * 2.f) + ((p[2] - p[0]) * f) + (((p[0] * 2.f) - (p[1] * 5.f) + (p[2] * 4.f) - p[3]) * f2) +
+                ((p[3] - p[0] + ((p[1] - p[2]) * 3.f)) * f3)) * 0.5f;
+        }
+        DoNotOptimize(out.data());
+    });
+
+    Bench("Spline::Evaluate per sample", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            out[i] = spline.Evaluate(u[i]);
+        DoNotOptimize(out.data());
+    });
+
+    Bench("Spline::Evaluate batch", count, repeats, [&]() {
+        spline.Evaluate(u.data(), out.data(), count);
+        DoNotOptimize(out.data());
+    });
+
+    std::vector<float> sorted(count);
+    for (size_t i = 0; i < count; i++)
+        sorted[i] = segments * static_cast<float>(i) / count;
+
+    Bench("Spline::Evaluate batch, sorted", count, repeats, [&]() {
+        spline.Evaluate(sorted.data(), out.data(), count);
+        DoNotOptimize(out.data());
+    });
+
+    Bench("CubicCurve::Evaluate batch", count, repeats, [&]() {
+        spline.Segment(0).Evaluate(t.data(), out.data(), count);
+        DoNotOptimize(out.data());
+    });
+
+    Bench("CubicCurve::EvaluateUniform", count, repeats, [&]() {
+        spline.Segment(0).EvaluateUniform(out.data(), count);
+        DoNotOptimize(out.data());
+    });
+
+    Bench("Spline::EvaluateAtDistance", count, repeats, [&]() {
+        spline.EvaluateAtDistance(s.data(), out.data(), count);
+        DoNotOptimize(out.data());
+    });
+
+    Quaternion q0(Vector3(1.f, 0.f, 0.f), 0.3f), q1(Vector3(0.f, 1.f, 0.f), 1.2f);
+    Quaternion s0 = SquadControl(q0, q0, q1), s1 = SquadControl(q0, q1, q1);
+    std::vector<Quaternion> rotations(count);
+
+    Bench("Squad per sample", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            rotations[i] = Squad(q0, q1, s0, s1, t[i]);
+        DoNotOptimize(rotations.data());
+    });
+
+    Bench("Squad batch", count, repeats, [&]() {
+        Squad(q0, q1, s0, s1, t.data(), rotations.data(), count);
+        DoNotOptimize(rotations.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <cmath>
+#include <vector>
+
+#include <FMaths/FastMath.h>
+#include <FMaths/Quaternion.h>
+#include <FMaths/Vector3.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 1 << 16;
+    const size_t repeats = 200;
+
+    std::vector<float> x(count), s(count), c(count);
+    for (float& v : x)
+        v = RandomFloat(-10.f, 10.f);
+
+    Bench("sinf/cosf", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            s[i] = sinf(x[i]);
+            c[i] = cosf(x[i]);
+        }
+        DoNotOptimize(s[0]);
+    });
+
+    Bench("SinCos batch", count, repeats, [&]() {
+        SinCos(x.data(), s.data(), c.data(), count);
+        DoNotOptimize(s[0]);
+    });
+
+    Bench("atan2f", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            s[i] = atan2f(x[i], c[i]);
+        DoNotOptimize(s[0]);
+    });
+
+    Bench("Atan2 batch", count, repeats, [&]() {
+        Atan2(x.data(), c.data(), s.data(), count);
+        DoNotOptimize(s[0]);
+    });
+
+    std::vector<Vector3> axes(count);
+    std::vector<Quaternion> quats(count);
+    for (Vector3& a : axes)
+        a = Vector3(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f));
+
+    Bench("Quaternion(axis, r)", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            quats[i] = Quaternion(axes[i], x[i]);
+        DoNotOptimize(quats[0]);
+    });
+
+    Bench("Quaternion::FromAxisAngles", count, repeats, [&]() {
+        Quaternion::FromAxisAngles(axes.data(), x.data(), quats.data(), count);
+        DoNotOptimize(quats[0]);
+    });
+
+    Bench("Quaternion::FromEulers", count, repeats, [&]() {
+        Quaternion::FromEulers(axes.data(), quats.data(), count);
+        DoNotOptimize(quats[0]);
+    });
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <vector>
+
+#include <FMaths/FixedMatrix4x4.h>
+#include <FMaths/FixedQuaternion.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Quaternion.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 1 << 20;
+    const size_t repeats = 10;
+
+    std::vector<Vector3> a(count), b(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        a[i] = Vector3(RandomFloat(-10.f, 10.f), RandomFloat(-10.f, 10.f), RandomFloat(-10.f, 10.f));
+        b[i] = Vector3(RandomFloat(-10.f, 10.f), RandomFloat(-10.f, 10.f), RandomFloat(-10.f, 10.f));
+    }
+
+    std::vector<Vector3Q16> a16(count), b16(count), out16(count);
+    Vector3Q16::FromFloat(a.data(), a16.data(), count);
+    Vector3Q16::FromFloat(b.data(), b16.data(), count);
+
+    std::vector<float> dot(count);
+    std::vector<Q16> dot16(count);
+    std::vector<Vector3> out(count);
+
+    Bench("Dot float batch", count, repeats, [&]() {
+        Vector3::Dot(a.data(), b.data(), dot.data(), count);
+        DoNotOptimize(dot.data());
+    });
+
+    Bench("Dot Q16 per element", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            dot16[i] = a16[i].Dot(b16[i]);
+        DoNotOptimize(dot16.data());
+    });
+
+    Bench("Dot Q16 batch", count, repeats, [&]() {
+        Vector3Q16::Dot(a16.data(), b16.data(), dot16.data(), count);
+        DoNotOptimize(dot16.data());
+    });
+
+    Bench("Cross Q16 batch", count, repeats, [&]() {
+        Vector3Q16::Cross(a16.data(), b16.data(), out16.data(), count);
+        DoNotOptimize(out16.data());
+    });
+
+    Quaternion q(Vector3(1.f, 2.f, 3.f), 0.7f);
+    QuaternionQ16 q16(q);
+
+    Bench("Apply float batch", count, repeats, [&]() {
+        q.Apply(a.data(), out.data(), count);
+        DoNotOptimize(out.data());
+    });
+
+    Bench("Apply Q16 per element", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            out16[i] = q16.Apply(a16[i]);
+        DoNotOptimize(out16.data());
+    });
+
+    Bench("Apply Q16 batch", count, repeats, [&]() {
+        q16.Apply(a16.data(), out16.data(), count);
+        DoNotOptimize(out16.data());
+    });
+
+    const size_t matrices = count / 16;
+
+    std::vector<Matrix4x4> m(matrices, Matrix4x4::Translate(Vector3(1.f, 2.f, 3.f))), mOut(matrices);
+    std::vector<Matrix4x4Q16> m16(matrices), m16Out(matrices);
+    Matrix4x4Q16::FromFloat(m.data(), m16.data(), matrices);
+
+    Bench("Matrix multiply float batch", matrices, repeats, [&]() {
+        Matrix4x4::Multiply(m.data(), m.data(), mOut.data(), matrices);
+        DoNotOptimize(mOut.data());
+    });
+
+    Bench("Matrix multiply Q16 per element", matrices, repeats, [&]() {
+        for (size_t i = 0; i < matrices; i++)
+            m16Out[i] = m16[i] * m16[i];
+        DoNotOptimize(m16Out.data());
+    });
+
+    Bench("Matrix multiply Q16 batch", matrices, repeats, [&]() {
+        Matrix4x4Q16::Multiply(m16.data(), m16.data(), m16Out.data(), matrices);
+        DoNotOptimize(m16Out.data());
+    });
+
+    Bench("Convert Q16 to float", count, repeats, [&]() {
+        Vector3Q16::ToFloat(a16.data(), out.data(), count);
+        DoNotOptimize(out.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <vector>
+
+#include <FMaths/Geometry.h>
+
+#include "Bench.h"
+
+static Vector3 RandomVector(float extent)
+{
+    return Vector3(RandomFloat(-extent, extent), RandomFloat(-extent, extent), RandomFloat(-extent, extent));
+}
+
+static void Run(size_t count, size_t repeats)
+{
+    printf("%zu elements\n", count);
+
+    std::vector<Triangle> tris(count);
+    TriangleArray triArray;
+    triArray.Reserve(count);
+
+    for (Triangle& t : tris)
+    {
+        Vector3 c = RandomVector(100.f);
+        t = Triangle(c + RandomVector(2.f), c + RandomVector(2.f), c + RandomVector(2.f));
+        triArray.Push(t);
+    }
+
+    std::vector<AABB> boxes(count);
+    AABBArray boxArray;
+    boxArray.Reserve(count);
+
+    for (AABB& b : boxes)
+    {
+        Vector3 c = RandomVector(100.f);
+        Vector3 e(RandomFloat(0.1f, 2.f), RandomFloat(0.1f, 2.f), RandomFloat(0.1f, 2.f));
+        b = AABB(c - e, c + e);
+        boxArray.Push(b);
+    }
+
+    std::vector<Vector3> points(count);
+    for (Vector3& p : points)
+        p = RandomVector(100.f);
+
+    Ray ray(Vector3(-150.f, 1.f, 2.f), Vector3(1.f, 0.01f, -0.02f));
+    std::vector<uint32_t> mask((count + 31) / 32);
+    std::vector<float> dist(count);
+    std::vector<Vector3> closest(count);
+
+    Bench("Ray/Triangle scalar", count, repeats, [&]() {
+        size_t hits = 0;
+        for (size_t i = 0; i < count; i++)
+            hits += tris[i].Intersect(ray, dist[i]);
+        DoNotOptimize(hits);
+    });
+
+    Bench("Ray/Triangle batch", count, repeats, [&]() {
+        DoNotOptimize(IntersectRay(ray, triArray, mask.data(), dist.data()));
+    });
+
+    std::vector<TrianglePacket8> packets;
+    for (size_t i = 0; i < count; i += 8)
+        packets.emplace_back(&tris[i], 8);
+
+    Bench("Ray/Triangle packet 8", count, repeats, [&]() {
+        uint32_t hits = 0;
+        for (size_t i = 0; i < packets.size(); i++)
+            hits |= IntersectRay(ray, packets[i], &dist[i * 8]);
+        DoNotOptimize(hits);
+    });
+
+    Bench("Ray/AABB scalar", count, repeats, [&]() {
+        size_t hits = 0;
+        for (size_t i = 0; i < count; i++)
+            hits += boxes[i].Intersect(ray, dist[i]);
+        DoNotOptimize(hits);
+    });
+
+    Bench("Ray/AABB batch", count, repeats, [&]() {
+        DoNotOptimize(IntersectRay(ray, boxArray, mask.data(), dist.data()));
+    });
+
+    Bench("Closest point scalar", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            closest[i] = tris[i].ClosestPoint(points[i]);
+        DoNotOptimize(closest[0]);
+    });
+
+    Bench("Closest point batch", count, repeats, [&]() {
+        ClosestPoints(points.data(), triArray, closest.data());
+        DoNotOptimize(closest[0]);
+    });
+}
+
+int main()
+{
+    // Cache resident, then streaming from memory
+    Run(1 << 13, 2000);
+    Run(1 << 20, 10);
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <cstdlib>
+#include <vector>
+
+#include <FMaths/Layout.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Vector3.h>
+
+#include "Bench.h"
+
+int main()
+{
+    // 64MB of matrices, well past any cache and the streaming threshold
+    const size_t count = 1 << 20;
+    const size_t repeats = 10;
+
+    std::vector<Matrix4x4> m(count), rowMajor(count);
+    std::vector<Vector3> v(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                m[i][col][row] = RandomFloat(-1.f, 1.f);
+
+        v[i] = Vector3(m[i][0]);
+    }
+
+    // Aligned so the kernels can use non-temporal stores
+    float* soa = static_cast<float*>(std::aligned_alloc(32, count * sizeof(Matrix4x4)));
+    float* x = soa;
+    float* y = soa + count;
+    float* z = soa + (2 * count);
+
+    Bench("Transpose through operator[]", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            for (size_t col = 0; col < 4; col++)
+                for (size_t row = 0; row < 4; row++)
+                    rowMajor[i][row][col] = m[i][col][row];
+        DoNotOptimize(rowMajor[0]);
+    });
+
+    Bench("Matrix4x4::Transpose batch", count, repeats, [&]() {
+        Matrix4x4::Transpose(m.data(), rowMajor.data(), count);
+        DoNotOptimize(rowMajor[0]);
+    });
+
+    Bench("Matrix SoA through operator[]", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            for (size_t k = 0; k < 16; k++)
+                soa[(k * count) + i] = m[i][k / 4][k % 4];
+        DoNotOptimize(soa[0]);
+    });
+
+    Bench("Matrix ToSoA", count, repeats, [&]() {
+        ToSoA(m.data(), count, soa);
+        DoNotOptimize(soa[0]);
+    });
+
+    Bench("Matrix ToAoSoA", count, repeats, [&]() {
+        ToAoSoA(m.data(), count, soa);
+        DoNotOptimize(soa[0]);
+    });
+
+    Bench("Vector3 SoA loop", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            x[i] = v[i].x;
+            y[i] = v[i].y;
+            z[i] = v[i].z;
+        }
+        DoNotOptimize(x[0]);
+    });
+
+    Bench("Vector3 ToSoA", count, repeats, [&]() {
+        ToSoA(v.data(), count, x, y, z);
+        DoNotOptimize(x[0]);
+    });
+
+    std::free(soa);
+    return 0;
+}
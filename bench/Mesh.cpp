@@ -0,0 +1,96 @@
+#include <cmath>
+#include <vector>
+
+#include <FMaths/Mesh.h>
+#include <FMaths/Vector3.h>
+
+#include "Bench.h"
+
+int main()
+{
+    // Deforming 512 x 512 cloth, about half a million triangles
+    const uint32_t side = 512;
+    const size_t count = size_t(side + 1) * (side + 1);
+    const size_t repeats = 5;
+
+    std::vector<uint32_t> indices;
+    for (uint32_t j = 0; j < side; j++)
+        for (uint32_t i = 0; i < side; i++)
+        {
+            uint32_t a = (j * (side + 1)) + i, b = a + 1, c = a + side + 2, d = a + side + 1;
+            const uint32_t quad[] = {a, b, c, a, c, d};
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+
+    size_t triangles = indices.size() / 3;
+
+    std::vector<Vector3> positions(count);
+    std::vector<float> x(count), y(count), z(count), u(count), v(count);
+
+    for (uint32_t j = 0; j <= side; j++)
+        for (uint32_t i = 0; i <= side; i++)
+        {
+            size_t k = (j * (side + 1)) + i;
+            positions[k] = Vector3(float(i), float(j), std::sin(float(i) * 0.1f) + RandomFloat(-0.1f, 0.1f));
+            x[k] = positions[k].x;
+            y[k] = positions[k].y;
+            z[k] = positions[k].z;
+            u[k] = float(i) / float(side);
+            v[k] = float(j) / float(side);
+        }
+
+    // Per triangle Cross, scattered with operator+=, then Normalize
+    std::vector<Vector3> normals(count);
+    Bench("Scattered Vector3 normals", triangles, repeats, [&]() {
+        for (Vector3& n : normals)
+            n = Vector3();
+
+        for (size_t t = 0; t < indices.size(); t += 3)
+        {
+            const Vector3& p0 = positions[indices[t]];
+            Vector3 n = (positions[indices[t + 1]] - p0).Cross(positions[indices[t + 2]] - p0);
+
+            normals[indices[t]] += n;
+            normals[indices[t + 1]] += n;
+            normals[indices[t + 2]] += n;
+        }
+
+        for (Vector3& n : normals)
+            n.Normalize();
+
+        DoNotOptimize(normals.data());
+    });
+
+    Mesh mesh(indices.data(), triangles, count);
+    std::vector<float> nx(count), ny(count), nz(count);
+
+    Bench("Mesh normals", triangles, repeats, [&]() {
+        mesh.ComputeNormals(x.data(), y.data(), z.data(), nx.data(), ny.data(), nz.data());
+        DoNotOptimize(nx.data());
+    });
+
+    ThreadPool pool(4);
+    Bench("Mesh normals, 4 threads", triangles, repeats, [&]() {
+        mesh.ComputeNormals(x.data(), y.data(), z.data(), nx.data(), ny.data(), nz.data(), pool.GetExecutor());
+        DoNotOptimize(nx.data());
+    });
+
+    std::vector<float> tx(count), ty(count), tz(count), tw(count);
+    Bench("Mesh tangents", triangles, repeats, [&]() {
+        mesh.ComputeTangents(x.data(), y.data(), z.data(), nx.data(), ny.data(), nz.data(), u.data(), v.data(), tx.data(), ty.data(),
+            tz.data(), tw.data());
+        DoNotOptimize(tx.data());
+    });
+
+    Bench("Normalize, Vector3", count, repeats, [&]() {
+        Vector3::Normalize(normals.data(), count);
+        DoNotOptimize(normals.data());
+    });
+
+    Bench("Normalize, SoA", count, repeats, [&]() {
+        NormalizeSoA(tx.data(), ty.data(), tz.data(), count);
+        DoNotOptimize(tx.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <vector>
+
+#include <FMaths/Async.h>
+#include <FMaths/Geometry.h>
+#include <FMaths/Quaternion.h>
+#include <FMaths/Vector3.h>
+
+#include "Bench.h"
+
+int main()
+{
+    // Large enough that a full pass does not fit in cache
+    const size_t count = 1 << 22;
+    const size_t repeats = 20;
+
+    Quaternion q = Quaternion::FromEuler(Vector3(0.3f, 1.1f, -0.4f));
+    Plane plane(Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 0.f));
+
+    std::vector<Vector3> points(count), rotated(count);
+    std::vector<uint8_t> visible(count);
+    std::vector<float> packed(count);
+    for (size_t i = 0; i < count; i++)
+        points[i] = Vector3(RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f));
+
+    // Transform, then cull, then pack
+    BatchPipeline::Stage transform = ApplyStage(q, points.data(), rotated.data());
+    BatchPipeline::Stage cull = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            visible[i] = plane.SignedDistance(rotated[i]) >= 0.f;
+    };
+    BatchPipeline::Stage pack = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            packed[i] = visible[i] ? rotated[i].y : 0.f;
+    };
+
+    Bench("Three full passes", count, repeats, [&]() {
+        transform(0, count);
+        cull(0, count);
+        pack(0, count);
+        DoNotOptimize(packed[0]);
+    });
+
+    BatchPipeline pipeline = BatchPipeline(count).Then(transform).Then(cull).Then(pack);
+
+    Bench("Pipelined chunks, inline", count, repeats, [&]() {
+        pipeline.Run(InlineExecutor()).Wait();
+        DoNotOptimize(packed[0]);
+    });
+
+    ThreadPool pool;
+    Executor executor = pool.GetExecutor();
+
+    Bench("Pipelined chunks, thread pool", count, repeats, [&]() {
+        pipeline.Run(executor).Wait();
+        DoNotOptimize(packed[0]);
+    });
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <vector>
+
+#include <FMaths/Reduce.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 1 << 22;
+    const size_t repeats = 10;
+
+    std::vector<Vector3> points(count);
+    for (Vector3& p : points)
+        p = Vector3(RandomFloat(-100.f, 100.f), RandomFloat(-10.f, 10.f), RandomFloat(0.f, 1.f));
+
+    ThreadPool pool;
+    Executor executor = pool.GetExecutor();
+
+    Bench("Bounds through Min/Max", count, repeats, [&]() {
+        Vector3 lo = points[0], hi = points[0];
+        for (const Vector3& p : points)
+        {
+            lo = Vector3(std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z));
+            hi = Vector3(std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z));
+        }
+        DoNotOptimize(lo);
+        DoNotOptimize(hi);
+    });
+
+    Bench("Bounds", count, repeats, [&]() {
+        AABB box = Bounds(points.data(), count);
+        DoNotOptimize(box);
+    });
+
+    Bench("Bounds on pool", count, repeats, [&]() {
+        AABB box = Bounds(points.data(), count, executor);
+        DoNotOptimize(box);
+    });
+
+    Bench("Mean through operator+=", count, repeats, [&]() {
+        Vector3 sum;
+        for (const Vector3& p : points)
+            sum += p;
+        Vector3 mean = sum / static_cast<float>(count);
+        DoNotOptimize(mean);
+    });
+
+    Bench("Mean", count, repeats, [&]() {
+        Vector3 mean = Mean(points.data(), count);
+        DoNotOptimize(mean);
+    });
+
+    Bench("Mean on pool", count, repeats, [&]() {
+        Vector3 mean = Mean(points.data(), count, executor);
+        DoNotOptimize(mean);
+    });
+
+    Bench("Covariance", count, repeats, [&]() {
+        Matrix3x3 cov = Covariance(points.data(), count);
+        DoNotOptimize(cov);
+    });
+
+    Bench("Covariance on pool", count, repeats, [&]() {
+        Matrix3x3 cov = Covariance(points.data(), count, nullptr, executor);
+        DoNotOptimize(cov);
+    });
+
+    Bench("FitOBB on pool", count, repeats, [&]() {
+        OBB box = FitOBB(points.data(), count, executor);
+        DoNotOptimize(box);
+    });
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <vector>
+
+#include <FMaths/RigidBody.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 100000;
+    const size_t repeats = 10;
+    const float dt = 1.f / 60.f;
+    const Vector3 gravity(0.f, -9.81f, 0.f);
+
+    RigidBodyArray bodies;
+    bodies.Reserve(count);
+
+    // Array of structures bodies, as they were stored before
+    struct Body
+    {
+        Vector3 position;
+        Quaternion orientation;
+        Vector3 velocity;
+        Vector3 angularVelocity;
+        Vector3 force;
+        Vector3 torque;
+        float invMass;
+        Vector3 invInertia;
+    };
+
+    std::vector<Body> aos(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Body& b = aos[i];
+        b.position = Vector3(RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f));
+        b.orientation = Quaternion(Vector3(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), 1.f), RandomFloat(-3.f, 3.f));
+        b.velocity = Vector3(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f));
+        b.angularVelocity = Vector3(RandomFloat(-5.f, 5.f), RandomFloat(-5.f, 5.f), RandomFloat(-5.f, 5.f));
+        b.force = Vector3(RandomFloat(-1.f, 1.f), 0.f, 0.f);
+        b.torque = Vector3(0.f, RandomFloat(-1.f, 1.f), 0.f);
+        b.invMass = RandomFloat(0.5f, 2.f);
+        b.invInertia = Vector3(RandomFloat(0.5f, 2.f), RandomFloat(0.5f, 2.f), RandomFloat(0.5f, 2.f));
+
+        bodies.Push(b.position, b.orientation, b.invMass, b.invInertia, b.velocity, b.angularVelocity);
+        bodies.fx[i] = b.force.x;
+        bodies.ty[i] = b.torque.y;
+    }
+
+    Bench("Euler through Quaternion operators", count, repeats, [&]() {
+        for (Body& b : aos)
+        {
+            Quaternion q = b.orientation;
+            Quaternion inverse(-q.x, -q.y, -q.z, q.w);
+            Vector3 local = inverse.Apply(b.torque);
+            Vector3 alpha = q.Apply(Vector3(local.x * b.invInertia.x, local.y * b.invInertia.y, local.z * b.invInertia.z));
+
+            b.velocity += (gravity + (b.force * b.invMass)) * dt;
+            b.angularVelocity += alpha * dt;
+            b.position += b.velocity * dt;
+
+            Quaternion spin(b.angularVelocity.x, b.angularVelocity.y, b.angularVelocity.z, 0.f);
+            b.orientation = (q + ((spin * q) * (0.5f * dt))).Normalized();
+        }
+        DoNotOptimize(aos.data());
+    });
+
+    Bench("IntegrateEuler", count, repeats, [&]() {
+        IntegrateEuler(bodies, gravity, dt);
+        DoNotOptimize(bodies.qw.data());
+    });
+
+    Bench("IntegrateRK4", count, repeats, [&]() {
+        IntegrateRK4(bodies, gravity, dt);
+        DoNotOptimize(bodies.qw.data());
+    });
+
+    ThreadPool pool;
+    Executor executor = pool.GetExecutor();
+
+    Bench("IntegrateEuler, thread pool", count, repeats, [&]() {
+        IntegrateEuler(bodies, gravity, dt, executor);
+        DoNotOptimize(bodies.qw.data());
+    });
+
+    Bench("IntegrateRK4, thread pool", count, repeats, [&]() {
+        IntegrateRK4(bodies, gravity, dt, executor);
+        DoNotOptimize(bodies.qw.data());
+    });
+
+    std::vector<Matrix4x4> inertia(count);
+
+    Bench("WorldInverseInertia", count, repeats, [&]() {
+        WorldInverseInertia(bodies, inertia.data());
+        DoNotOptimize(inertia.data());
+    });
+}
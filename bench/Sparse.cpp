@@ -0,0 +1,99 @@
+#include <vector>
+
+#include <FMaths/Sparse.h>
+
+#include "Bench.h"
+
+int main()
+{
+    // A 320 x 320 cloth, implicit mass spring system over structural and shear springs
+    const size_t width = 320, height = 320, n = width * height;
+    const size_t repeats = 5;
+
+    std::vector<BlockEntry> entries;
+
+    for (size_t i = 0; i < n; i++)
+        entries.push_back({uint32_t(i), uint32_t(i), Matrix3x3(1.f)});
+
+    const size_t offsets[][2] = {{1, 0}, {0, 1}, {1, 1}};
+
+    for (size_t y = 0; y < height; y++)
+        for (size_t x = 0; x < width; x++)
+            for (const size_t* o : offsets)
+            {
+                if (x + o[0] >= width || y + o[1] >= height)
+                    continue;
+
+                uint32_t i = uint32_t((y * width) + x);
+                uint32_t j = uint32_t(((y + o[1]) * width) + x + o[0]);
+
+                Vector3 d = Vector3(float(o[0]), float(o[1]), RandomFloat(-0.2f, 0.2f)).Normalized();
+                Matrix3x3 k(d * (d.x * 50.f), d * (d.y * 50.f), d * (d.z * 50.f));
+
+                entries.push_back({i, i, k});
+                entries.push_back({j, j, k});
+                entries.push_back({i, j, k * -1.f});
+                entries.push_back({j, i, k * -1.f});
+            }
+
+    BlockSparseMatrix a(n, entries.data(), entries.size());
+
+    // Rows of (column, block) pairs through Matrix3x3 and Vector3 operators, as before
+    std::vector<std::vector<std::pair<uint32_t, Matrix3x3>>> naive(n);
+    for (size_t i = 0; i < n; i++)
+        for (uint32_t k = a.RowStart()[i]; k < a.RowStart()[i + 1]; k++)
+            naive[i].emplace_back(a.Columns()[k], a.Block(k));
+
+    std::vector<Vector3> b(n), x(n), ax(n);
+    for (Vector3& v : b)
+        v = Vector3(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f));
+
+    // Rows per second, each call multiplying or iterating this many times
+    const size_t iterations = 20;
+
+    Bench("Multiply through operators", n * iterations, repeats, [&]() {
+        for (size_t k = 0; k < iterations; k++)
+            for (size_t i = 0; i < n; i++)
+            {
+                Vector3 sum;
+                for (const auto& block : naive[i])
+                    sum += block.second * b[block.first];
+
+                ax[i] = sum;
+            }
+        DoNotOptimize(ax.data());
+    });
+
+    Bench("Multiply", n * iterations, repeats, [&]() {
+        for (size_t k = 0; k < iterations; k++)
+            Multiply(a, b.data(), ax.data());
+        DoNotOptimize(ax.data());
+    });
+
+    ThreadPool pool(4);
+    Bench("Multiply, 4 threads", n * iterations, repeats, [&]() {
+        for (size_t k = 0; k < iterations; k++)
+            Multiply(a, b.data(), ax.data(), pool.GetExecutor());
+        DoNotOptimize(ax.data());
+    });
+
+    Bench("Conjugate gradient iteration", n * iterations, repeats, [&]() {
+        std::fill(x.begin(), x.end(), Vector3());
+        ConjugateGradient(a, b.data(), x.data(), iterations, 0.f);
+        DoNotOptimize(x.data());
+    });
+
+    Bench("Gauss-Seidel iteration", n * iterations, repeats, [&]() {
+        std::fill(x.begin(), x.end(), Vector3());
+        GaussSeidel(a, b.data(), x.data(), iterations);
+        DoNotOptimize(x.data());
+    });
+
+    Bench("Jacobi iteration", n * iterations, repeats, [&]() {
+        std::fill(x.begin(), x.end(), Vector3());
+        Jacobi(a, b.data(), x.data(), iterations);
+        DoNotOptimize(x.data());
+    });
+
+    return 0;
+}
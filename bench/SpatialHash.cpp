@@ -0,0 +1,73 @@
+#include <vector>
+
+#include <FMaths/SpatialHash.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 1000000;
+    const size_t repeats = 5;
+
+    // Particles at roughly 8 per cell of the query radius
+    const float radius = 1.f;
+    const float extent = 25.f;
+
+    std::vector<Vector3> points(count);
+    for (Vector3& p : points)
+        p = Vector3(RandomFloat(-extent, extent), RandomFloat(-extent, extent), RandomFloat(-extent, extent));
+
+    SpatialHashGrid grid(radius);
+
+    Bench("Build", count, repeats, [&]() {
+        grid.Build(points.data(), count);
+        DoNotOptimize(grid.Indices());
+    });
+
+    ThreadPool pool(4);
+    Bench("Build, 4 threads", count, repeats, [&]() {
+        grid.Build(points.data(), count, pool.GetExecutor());
+        DoNotOptimize(grid.Indices());
+    });
+
+    std::vector<uint32_t> offsets, neighbors;
+    Bench("Neighbour lists", count, 1, [&]() {
+        grid.FindNeighbors(radius, offsets, neighbors);
+        DoNotOptimize(neighbors.data());
+    });
+
+    std::vector<uint32_t> slots;
+    const size_t queries = count / 100;
+
+    Bench("Grid queries", queries, repeats, [&]() {
+        for (size_t q = 0; q < queries; q++)
+        {
+            slots.clear();
+            grid.Query(points[q], radius, slots);
+        }
+        DoNotOptimize(slots.data());
+    });
+
+    // Neighbour lists of 20000 points at the same density, against the O(n^2) LengthSquared scan
+    const size_t small = 20000;
+    std::vector<Vector3> subset(points.begin(), points.begin() + small);
+    for (Vector3& p : subset)
+        p = p * 0.27f;
+
+    size_t found = 0;
+    Bench("Brute force neighbour lists, 20k", small, 1, [&]() {
+        for (size_t i = 0; i < small; i++)
+            for (size_t j = 0; j < small; j++)
+                if (i != j && (subset[j] - subset[i]).LengthSquared() <= radius * radius)
+                    found++;
+        DoNotOptimize(found);
+    });
+
+    Bench("Grid neighbour lists, 20k", small, repeats, [&]() {
+        grid.Build(subset.data(), small);
+        grid.FindNeighbors(radius, offsets, neighbors);
+        DoNotOptimize(neighbors.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <vector>
+
+#include <FMaths/SpatialHash.h>
+#include <FMaths/SpatialSort.h>
+
+#include "Bench.h"
+
+namespace
+{
+
+/**
+ * @brief Morton code a bit at a time
+ */
+uint32_t NaiveMorton(uint32_t x, uint32_t y, uint32_t z)
+{
+    uint32_t code = 0;
+    for (uint32_t b = 0; b < 10; b++)
+        code |= (((x >> b) & 1) << (3 * b)) | (((y >> b) & 1) << ((3 * b) + 1)) | (((z >> b) & 1) << ((3 * b) + 2));
+
+    return code;
+}
+
+/**
+ * @brief Sum over every point's neighbours, the gather pattern of particle solvers
+ */
+float GatherNeighbours(const std::vector<Vector3>& points, const std::vector<uint32_t>& offsets, const std::vector<uint32_t>& neighbors)
+{
+    float sum = 0.f;
+    for (size_t i = 0; i + 1 < offsets.size(); i++)
+        for (uint32_t k = offsets[i]; k < offsets[i + 1]; k++)
+            sum += (points[neighbors[k]] - points[i]).LengthSquared();
+
+    return sum;
+}
+
+} // namespace
+
+int main()
+{
+    const size_t count = 1000000;
+    const size_t repeats = 5;
+    const float extent = 25.f;
+
+    std::vector<Vector3> points(count);
+    for (Vector3& p : points)
+        p = Vector3(RandomFloat(-extent, extent), RandomFloat(-extent, extent), RandomFloat(-extent, extent));
+
+    AABB bounds(Vector3(-extent, -extent, -extent), Vector3(extent, extent, extent));
+    std::vector<uint32_t> codes(count);
+    std::vector<uint64_t> wide(count);
+
+    uint32_t sink = 0;
+    Bench("Morton 30, bit at a time", count, repeats, [&]() {
+        float scale = 1024.f / (2.f * extent);
+        for (const Vector3& p : points)
+            sink += NaiveMorton(uint32_t((p.x + extent) * scale) & 1023, uint32_t((p.y + extent) * scale) & 1023,
+                uint32_t((p.z + extent) * scale) & 1023);
+        DoNotOptimize(sink);
+    });
+
+    Bench("Morton 30", count, repeats, [&]() {
+        EncodePoints(points.data(), count, bounds, SpaceCurve::Morton, codes.data());
+        DoNotOptimize(codes.data());
+    });
+
+    Bench("Morton 63", count, repeats, [&]() {
+        EncodePoints(points.data(), count, bounds, SpaceCurve::Morton, wide.data());
+        DoNotOptimize(wide.data());
+    });
+
+    Bench("Hilbert 30", count, repeats, [&]() {
+        EncodePoints(points.data(), count, bounds, SpaceCurve::Hilbert, codes.data());
+        DoNotOptimize(codes.data());
+    });
+
+    std::vector<uint32_t> permutation(count);
+    Bench("Sort 30 bit codes", count, repeats, [&]() {
+        SortCodes(codes.data(), count, permutation.data());
+        DoNotOptimize(permutation.data());
+    });
+
+    Bench("Sort 63 bit codes", count, repeats, [&]() {
+        SortCodes(wide.data(), count, permutation.data());
+        DoNotOptimize(permutation.data());
+    });
+
+    ThreadPool pool(4);
+    std::vector<Vector3> sorted;
+    Bench("Hilbert spatial sort, 4 threads", count, repeats, [&]() {
+        sorted = points;
+        SpatialSort(sorted.data(), count, permutation.data(), SpaceCurve::Hilbert, pool.GetExecutor());
+        DoNotOptimize(sorted.data());
+    });
+
+    // Neighbour lists by original index, gathered in random then in curve order
+    SpatialHashGrid grid(1.f);
+    std::vector<uint32_t> slotOffsets, slotNeighbors;
+
+    auto neighbourLists = [&](const std::vector<Vector3>& p, std::vector<uint32_t>& offsets, std::vector<uint32_t>& neighbors) {
+        grid.Build(p.data(), count);
+        grid.FindNeighbors(1.f, slotOffsets, slotNeighbors);
+
+        std::vector<uint32_t> slotOf(count);
+        for (size_t s = 0; s < count; s++)
+            slotOf[grid.Indices()[s]] = static_cast<uint32_t>(s);
+
+        offsets.assign(count + 1, 0);
+        neighbors.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t s = slotOf[i];
+            for (uint32_t k = slotOffsets[s]; k < slotOffsets[s + 1]; k++)
+                neighbors.push_back(grid.Indices()[slotNeighbors[k]]);
+            offsets[i + 1] = static_cast<uint32_t>(neighbors.size());
+        }
+    };
+
+    std::vector<uint32_t> offsets, neighbors;
+    float sum = 0.f;
+
+    neighbourLists(points, offsets, neighbors);
+    Bench("Neighbour gather, random order", count, repeats, [&]() {
+        sum += GatherNeighbours(points, offsets, neighbors);
+        DoNotOptimize(sum);
+    });
+
+    neighbourLists(sorted, offsets, neighbors);
+    Bench("Neighbour gather, Hilbert order", count, repeats, [&]() {
+        sum += GatherNeighbours(sorted, offsets, neighbors);
+        DoNotOptimize(sum);
+    });
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <vector>
+
+#include <FMaths/Swizzle.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 1 << 20;
+    const size_t repeats = 10;
+
+    std::vector<Vector4> a(count), b(count), out(count);
+    std::vector<Vector3> out3(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        a[i] = Vector4(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f));
+        b[i] = Vector4(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f));
+    }
+
+    // A cross product in shader style, a.yzx * b.zxy - a.zxy * b.yzx
+    Bench("Cross through operator[]", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            const Vector4& p = a[i];
+            const Vector4& q = b[i];
+
+            Vector3 l(p[1] * q[2], p[2] * q[0], p[0] * q[1]);
+            Vector3 r(p[2] * q[1], p[0] * q[2], p[1] * q[0]);
+            out3[i] = l - r;
+        }
+        DoNotOptimize(out3.data());
+    });
+
+    Bench("Cross through Swizzle", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            Vector3 ayzx = Swizzle<1, 2, 0>(a[i]);
+            Vector3 bzxy = Swizzle<2, 0, 1>(b[i]);
+            Vector3 azxy = Swizzle<2, 0, 1>(a[i]);
+            Vector3 byzx = Swizzle<1, 2, 0>(b[i]);
+
+            out3[i] = Vector3(ayzx.x * bzxy.x, ayzx.y * bzxy.y, ayzx.z * bzxy.z) - Vector3(azxy.x * byzx.x, azxy.y * byzx.y, azxy.z * byzx.z);
+        }
+        DoNotOptimize(out3.data());
+    });
+
+    Bench("Vector4(Vector3(v), 1)", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            out[i] = Vector4(Vector3(a[i]), 1.f);
+        DoNotOptimize(out.data());
+    });
+
+    Bench("Swizzle<3, 2, 1, 0> then SetSwizzle<1, 3>", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            Vector4 v = Swizzle<3, 2, 1, 0>(a[i]);
+            SetSwizzle<1, 3>(v, Vector2(b[i]));
+            out[i] = v;
+        }
+        DoNotOptimize(out.data());
+    });
+}
@@ -0,0 +1,58 @@
+#include <vector>
+
+#include <FMaths/Matrix3x3.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Vector2.h>
+#include <FMaths/Vector4.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 1 << 20;
+    const size_t repeats = 50;
+
+    Matrix3x3 m = Matrix3x3::Translate(Vector2(10.f, -4.f)) * Matrix3x3::Rotate(0.7f) * Matrix3x3::Scale(Vector2(2.f, 3.f));
+
+    // Same transform embedded in the upper left of a 4x4
+    Matrix4x4 m4 = Matrix4x4::Identity();
+    for (size_t col = 0; col < 2; col++)
+        for (size_t row = 0; row < 2; row++)
+            m4[col][row] = m[col][row];
+
+    m4[3][0] = m[2][0];
+    m4[3][1] = m[2][1];
+
+    std::vector<Vector2> points(count), out(count);
+    std::vector<float> x(count), y(count), outX(count), outY(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        points[i] = Vector2(RandomFloat(-1000.f, 1000.f), RandomFloat(-1000.f, 1000.f));
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+    }
+
+    Bench("Matrix4x4 * Vector4 detour", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            out[i] = Vector2(m4 * Vector4(points[i].x, points[i].y, 0.f, 1.f));
+        DoNotOptimize(out[0]);
+    });
+
+    Bench("Matrix3x3::TransformPoint", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+            out[i] = m.TransformPoint(points[i]);
+        DoNotOptimize(out[0]);
+    });
+
+    Bench("Matrix3x3::TransformPoints AoS", count, repeats, [&]() {
+        m.TransformPoints(points.data(), out.data(), count);
+        DoNotOptimize(out[0]);
+    });
+
+    Bench("Matrix3x3::TransformPoints SoA", count, repeats, [&]() {
+        m.TransformPoints(x.data(), y.data(), outX.data(), outY.data(), count);
+        DoNotOptimize(outX[0]);
+    });
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <vector>
+
+#include <FMaths/TransformStream.h>
+
+#include "Bench.h"
+
+int main()
+{
+    const size_t count = 100000;
+    const size_t repeats = 20;
+
+    std::vector<Matrix4x4> m(count);
+    for (Matrix4x4& matrix : m)
+        matrix = Matrix4x4::Translate(Vector3(RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f), RandomFloat(-100.f, 100.f))) *
+            Matrix4x4::Scale(Vector3(RandomFloat(0.5f, 2.f), RandomFloat(0.5f, 2.f), RandomFloat(0.5f, 2.f)));
+
+    std::vector<float> rebuilt(12 * count);
+
+    // Every instance packed every frame, as before
+    Bench("Rebuild 3x4 instances", count, repeats, [&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            Matrix4x4 t = m[i].Transpose();
+            for (size_t row = 0; row < 3; row++)
+                for (size_t col = 0; col < 4; col++)
+                    rebuilt[(i * 12) + (row * 4) + col] = t[row][col];
+        }
+        DoNotOptimize(rebuilt.data());
+    });
+
+    TransformStream stream(InstanceFormat::Affine3x4, 2);
+    stream.Update(m.data(), count);
+    stream.Update(m.data(), count);
+
+    Bench("Stream, nothing changed", count, repeats, [&]() {
+        stream.Update(m.data(), count);
+        DoNotOptimize(stream.Buffer());
+    });
+
+    size_t frame = 0;
+
+    Bench("Stream, 1% changed", count, repeats, [&]() {
+        for (size_t i = frame++ % 100; i < count; i += 100)
+            m[i][3].y += 0.01f;
+
+        stream.Update(m.data(), count);
+        DoNotOptimize(stream.Buffer());
+    });
+
+    Bench("Stream, everything changed", count, repeats, [&]() {
+        for (Matrix4x4& matrix : m)
+            matrix[3].y += 0.01f;
+
+        stream.Update(m.data(), count);
+        DoNotOptimize(stream.Buffer());
+    });
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <FMaths/Weld.h>
+
+#include "Bench.h"
+
+namespace
+{
+
+/**
+ * @brief Weld by sorting on x then sweeping the window of earlier vertices within tolerance along it
+ */
+size_t SortWeld(const Vector3* vertices, size_t count, float tolerance, uint32_t* remap, Vector3* unique)
+{
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [vertices](uint32_t a, uint32_t b) { return vertices[a].x < vertices[b].x; });
+
+    float toleranceSq = tolerance * tolerance;
+    size_t uniqueCount = 0;
+    size_t window = 0;
+
+    for (size_t k = 0; k < count; k++)
+    {
+        const Vector3& p = vertices[order[k]];
+
+        while (vertices[order[window]].x < p.x - tolerance)
+            window++;
+
+        // Earlier vertices in the window are already remapped, join the first in range
+        uint32_t found = UINT32_MAX;
+        for (size_t w = window; w < k && found == UINT32_MAX; w++)
+            if ((unique[remap[order[w]]] - p).LengthSquared() <= toleranceSq)
+                found = remap[order[w]];
+
+        if (found == UINT32_MAX)
+        {
+            found = static_cast<uint32_t>(uniqueCount++);
+            unique[found] = p;
+        }
+
+        remap[order[k]] = found;
+    }
+
+    return uniqueCount;
+}
+
+} // namespace
+
+int main()
+{
+    // Triangle soup of a 577 x 577 grid, about 2M vertices each repeated up to 6 times with jitter below the tolerance
+    const size_t side = 577;
+    const size_t repeats = 5;
+    const float spacing = 0.01f;
+    const float tolerance = 1e-4f;
+
+    auto corner = [&](size_t i, size_t j) {
+        return Vector3(static_cast<float>(i) * spacing + RandomFloat(-1e-5f, 1e-5f),
+            static_cast<float>(j) * spacing + RandomFloat(-1e-5f, 1e-5f), RandomFloat(-1e-5f, 1e-5f));
+    };
+
+    std::vector<Vector3> vertices;
+    for (size_t j = 0; j < side; j++)
+        for (size_t i = 0; i < side; i++)
+        {
+            const Vector3 quad[] = {corner(i, j), corner(i + 1, j), corner(i + 1, j + 1), corner(i, j), corner(i + 1, j + 1),
+                corner(i, j + 1)};
+            vertices.insert(vertices.end(), quad, quad + 6);
+        }
+
+    size_t count = vertices.size();
+    std::vector<uint32_t> remap(count);
+    std::vector<Vector3> unique(count);
+
+    size_t hashed = 0, sorted = 0;
+    Bench("Hash grid weld", count, repeats, [&]() {
+        hashed = WeldVertices(vertices.data(), count, tolerance, remap.data(), unique.data());
+        DoNotOptimize(remap.data());
+    });
+
+    Bench("Hash grid weld, exact", count, repeats, [&]() {
+        WeldVertices(vertices.data(), count, 0.f, remap.data(), unique.data());
+        DoNotOptimize(remap.data());
+    });
+
+    Bench("Sort and sweep weld", count, repeats, [&]() {
+        sorted = SortWeld(vertices.data(), count, tolerance, remap.data(), unique.data());
+        DoNotOptimize(remap.data());
+    });
+
+    // Points scattered through a unit cube, each with a few others within tolerance
+    std::vector<Vector3> dense(count);
+    for (Vector3& p : dense)
+        p = Vector3(RandomFloat(0.f, 1.f), RandomFloat(0.f, 1.f), RandomFloat(0.f, 1.f));
+
+    Bench("Hash grid weld, dense", count, repeats, [&]() {
+        WeldVertices(dense.data(), count, 0.01f, remap.data(), unique.data());
+        DoNotOptimize(remap.data());
+    });
+
+    // The sort alone, which any sort based weld pays before comparing a single pair
+    std::vector<uint32_t> order(count);
+    Bench("Index sort on x only", count, repeats, [&]() {
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return vertices[a].x < vertices[b].x; });
+        DoNotOptimize(order.data());
+    });
+
+    printf("%zu vertices, %zu unique by hash grid, %zu by sort\n", count, hashed, sorted);
+    return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file Animation.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Keyframed skeletal animation clips in structure of arrays, and a cached pose sampler
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Matrix4x4.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+
+/**
+ * @brief Keys of one channel for every joint, in structure of arrays
+ *
+ * Joint j's keys are [offsets[j], offsets[j + 1]) of times and the component
+ * arrays, with times increasing. w is only used by rotations.
+ */
+struct AnimationChannel
+{
+    std::vector<uint32_t> offsets;
+    std::vector<float> times;
+    std::vector<float> x, y, z, w;
+
+    size_t KeyCount(size_t joint) const;
+};
+
+/**
+ * @brief Translation, rotation and scale tracks for each joint of a skeleton
+ *
+ * A joint without keys in a channel takes the identity for it, a joint with
+ * one key holds it. Before the first key and after the last the end key holds.
+ */
+struct AnimationClip
+{
+    /**
+     * @param duration Length in seconds, sample times are kept within [0, duration]
+     */
+    AnimationClip(size_t joints, float duration);
+
+    /**
+     * @brief Replace joint's track in a channel
+     *
+     * @param times count increasing key times in seconds
+     * @param keys count values
+     */
+    void SetTranslations(size_t joint, const float* times, const Vector3* keys, size_t count);
+
+    /**
+     * @param keys count unit quaternions
+     */
+    void SetRotations(size_t joint, const float* times, const Quaternion* keys, size_t count);
+    void SetScales(size_t joint, const float* times, const Vector3* keys, size_t count);
+
+    size_t JointCount() const;
+
+    /**
+     * @brief Time within the clip, clamped to [0, duration] or, if loop, wrapped back into it
+     *
+     * NaN stays NaN. A clip with no duration always gives 0.
+     */
+    float ClipTime(float time, bool loop) const;
+
+    float duration;
+
+    AnimationChannel translations;
+    AnimationChannel rotations;
+    AnimationChannel scales;
+};
+
+/**
+ * @brief Local transform of every joint, in structure of arrays
+ */
+struct Pose
+{
+    explicit Pose(size_t joints = 0);
+
+    void Resize(size_t joints);
+    size_t JointCount() const;
+
+    Vector3 Translation(size_t joint) const;
+    Quaternion Rotation(size_t joint) const;
+    Vector3 Scale(size_t joint) const;
+
+    std::vector<float> tx, ty, tz;
+    std::vector<float> rx, ry, rz, rw;
+    std::vector<float> sx, sy, sz;
+};
+
+/**
+ * @brief Samples whole poses from a clip, remembering the key each track was last between
+ *
+ * Playing forward only steps each cursor past the keys it crossed, so costs
+ * O(1) per track per frame rather than a binary search. Jumping backwards
+ * searches once and carries on from there.
+ *
+ * The keys are found per track, then every joint is interpolated at once:
+ * lerp for translation and scale, nlerp along the shorter arc for rotation.
+ * Each sampler keeps its own cursors, so use one per playing instance.
+ */
+struct PoseSampler
+{
+    /**
+     * @param clip Must outlive the sampler and not change while it is used
+     */
+    explicit PoseSampler(const AnimationClip& clip);
+
+    /**
+     * @brief Sample the clip at its ClipTime for time
+     *
+     * Looping playback steps cursors forward except at the wrap, which
+     * searches once like any other jump back.
+     *
+     * @param pose Resized to the clip's joint count
+     */
+    void Sample(float time, Pose& pose, bool loop = false);
+
+    /**
+     * @brief Forget the cursors, the next Sample searches every track
+     */
+    void Reset();
+
+private:
+
+    const AnimationClip* m_Clip;
+
+    /**
+     * @brief Key index within each track, translations then rotations then scales
+     */
+    std::vector<uint32_t> m_Cursors;
+    float m_LastTime;
+
+    /**
+     * @brief Per joint start keys, end keys and blend factors in structure of arrays
+     */
+    std::vector<float> m_Scratch;
+};
+
+/**
+ * @brief Translation * rotation * scale matrix of every joint
+ *
+ * @param out Array of pose.JointCount() matrices
+ */
+void LocalMatrices(const Pose& pose, Matrix4x4* out);
+
+/**
+ * @brief Concatenate local matrices down a hierarchy, model[i] = model[parents[i]] * local[i]
+ *
+ * @param parents Parent of each joint, which must come before it, or -1 for roots
+ * @param model Array of count matrices, may not alias local
+ */
+void ModelMatrices(const Matrix4x4* local, const int32_t* parents, size_t count, Matrix4x4* model);
+
+#endif
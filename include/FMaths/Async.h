@@ -0,0 +1,227 @@
+/**
+ * @file Async.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Asynchronous, chunk pipelined batch kernels
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct Matrix4x4;
+struct Quaternion;
+struct Vector3;
+
+using Task = std::function<void()>;
+
+/**
+ * @brief Runs a task at some point, on any thread
+ *
+ * Lets a job system schedule the work, wrap its own submit function in one.
+ */
+using Executor = std::function<void(Task)>;
+
+/**
+ * @brief Executor which runs each task immediately on the submitting thread
+ */
+Executor InlineExecutor();
+
+/**
+ * @brief Fixed set of worker threads taking tasks in submission order
+ */
+struct ThreadPool
+{
+public:
+    /**
+     * @param threads Number of workers, 0 for one per hardware thread
+     */
+    explicit ThreadPool(size_t threads = 0);
+
+    /**
+     * @brief Finishes every submitted task then joins the workers
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(Task task);
+
+    /**
+     * @brief Executor submitting to this pool, which must outlive it
+     */
+    Executor GetExecutor();
+
+    size_t Size() const;
+
+private:
+    void Work();
+
+    std::vector<std::thread> m_Workers;
+    std::deque<Task> m_Queue;
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    bool m_Stopping;
+};
+
+/**
+ * @brief Completion handle for an asynchronous batch
+ *
+ * Copies share the same state. A default constructed handle is already complete.
+ */
+struct BatchHandle
+{
+public:
+    BatchHandle();
+
+    /**
+     * @brief Whether every chunk and continuation has finished
+     */
+    bool Ready() const;
+
+    /**
+     * @brief Block until Ready
+     */
+    void Wait() const;
+
+    /**
+     * @brief Run a continuation once complete
+     *
+     * Runs on the thread which finishes the last chunk, or immediately on
+     * the calling thread if already Ready. Continuations run one at a time,
+     * in the order added, and Ready is only true once all of them have
+     * returned, including any added while earlier ones were running. Keep
+     * it short, or hand it to an executor.
+     */
+    void Then(Task task) const;
+
+private:
+    friend struct BatchPipeline;
+
+    struct State;
+
+    explicit BatchHandle(size_t pending);
+
+    /**
+     * @brief Mark a chunk finished
+     */
+    void Complete() const;
+
+    /**
+     * @brief Complete one chunk of dependent once this handle is ready
+     */
+    void Release(const BatchHandle& dependent) const;
+
+    std::shared_ptr<State> m_State;
+};
+
+/**
+ * @brief Chain of batch stages run chunk by chunk
+ *
+ * Every stage runs over a chunk before the next chunk starts, so data written
+ * by one stage is still in cache when the next reads it, rather than each stage
+ * streaming the whole array through memory. Chunks are independent tasks, so
+ * stages must only touch elements in [begin, end).
+ */
+struct BatchPipeline
+{
+public:
+    /**
+     * @brief Stage processing elements [begin, end)
+     */
+    using Stage = std::function<void(size_t begin, size_t end)>;
+
+    /**
+     * @brief Elements per chunk, two arrays of this many Matrix4x4 fill 128KB
+     */
+    static constexpr size_t kDefaultChunkSize = 1024;
+
+    /**
+     * @param count Number of elements
+     * @param chunkSize Elements per task, 0 for kDefaultChunkSize
+     */
+    explicit BatchPipeline(size_t count, size_t chunkSize = kDefaultChunkSize);
+
+    /**
+     * @brief Append a stage, run after all earlier stages on each chunk
+     */
+    BatchPipeline& Then(Stage stage);
+
+    /**
+     * @brief Submit one task per chunk
+     *
+     * Stages and anything they reference must stay valid until the handle is ready.
+     */
+    BatchHandle Run(const Executor& executor) const;
+
+    /**
+     * @brief Submit once another batch is complete
+     */
+    BatchHandle Run(const Executor& executor, const BatchHandle& after) const;
+
+    size_t Count() const;
+    size_t ChunkSize() const;
+
+private:
+    void Submit(const Executor& executor, const BatchHandle& handle) const;
+
+    size_t m_Count;
+    size_t m_ChunkSize;
+    std::vector<Stage> m_Stages;
+};
+
+/**
+ * @brief Call fn(begin, end) for every chunkSize elements as a task on executor, then wait for all of them
+ *
+ * The blocking form every batch kernel taking an executor is built on. The
+ * calling thread sleeps until the last chunk finishes, so calling it from a
+ * task of an executor whose threads can all end up waiting like this, such
+ * as from inside another ParallelFor on a ThreadPool, deadlocks once every
+ * worker is waiting. Chunk k covers [k * chunkSize, (k + 1) * chunkSize), so
+ * begin / chunkSize indexes per chunk results.
+ */
+void ParallelFor(size_t count, size_t chunkSize, const Executor& executor, const BatchPipeline::Stage& fn);
+
+// Stages wrapping the batch kernels, arrays are indexed by element
+
+/**
+ * @brief Matrix4x4::Multiply as a stage
+ */
+BatchPipeline::Stage MultiplyStage(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out);
+
+/**
+ * @brief Matrix4x4::Inverse as a stage
+ */
+BatchPipeline::Stage InverseStage(const Matrix4x4* m, Matrix4x4* out);
+
+/**
+ * @brief Quaternion::Apply with one rotation as a stage, copies q
+ */
+BatchPipeline::Stage ApplyStage(const Quaternion& q, const Vector3* v, Vector3* out);
+
+/**
+ * @brief Quaternion::Apply with a rotation per element as a stage
+ */
+BatchPipeline::Stage ApplyStage(const Quaternion* q, const Vector3* v, Vector3* out);
+
+// Single stage shortcuts
+
+BatchHandle MultiplyAsync(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out, size_t count, const Executor& executor);
+BatchHandle InverseAsync(const Matrix4x4* m, Matrix4x4* out, size_t count, const Executor& executor);
+BatchHandle ApplyAsync(const Quaternion& q, const Vector3* v, Vector3* out, size_t count, const Executor& executor);
+BatchHandle ApplyAsync(const Quaternion* q, const Vector3* v, Vector3* out, size_t count, const Executor& executor);
+
+#endif
@@ -0,0 +1,163 @@
+/**
+ * @file Collision.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Convex narrowphase, GJK distance, EPA penetration and box-box SAT, with batched pair lists
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Async.h"
+#include "Geometry.h"
+#include "Matrix4x4.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+
+/**
+ * @brief Convex shape placed in the world, described by its support mapping
+ *
+ * A shape is a core, a point, segment, box or hull, grown by radius, so a
+ * sphere is a point with a radius and a capsule a segment with one. GJK runs
+ * on the cores and only falls back to EPA when they overlap, which keeps
+ * rounded shapes fast and exact.
+ */
+struct ConvexShape
+{
+    enum class Core : uint32_t
+    {
+        Point,
+        Segment,
+        Box,
+        Hull
+    };
+
+    static ConvexShape Sphere(float radius);
+
+    /**
+     * @brief Capsule along local y, the segment from -halfHeight to halfHeight
+     */
+    static ConvexShape Capsule(float halfHeight, float radius);
+    static ConvexShape Box(const Vector3& halfExtents, float radius = 0);
+
+    /**
+     * @param points count local space points, which must outlive the shape
+     */
+    static ConvexShape Hull(const Vector3* points, size_t count, float radius = 0);
+
+    /**
+     * @brief Place the shape, orientation must be unit length
+     */
+    ConvexShape& SetTransform(const Vector3& position, const Quaternion& orientation);
+
+    /**
+     * @brief Place the shape by a rigid transform, columns 0 to 2 orthonormal and translation in column 3
+     */
+    ConvexShape& SetTransform(const Matrix4x4& transform);
+
+    /**
+     * @brief Furthest point of the shape in direction d, in world space
+     */
+    Vector3 Support(const Vector3& d) const;
+
+    Core core;
+
+    /**
+     * @brief Box half extents, or the segment's half height in y
+     */
+    Vector3 extents;
+    float radius;
+
+    const Vector3* points;
+    size_t pointCount;
+
+    Vector3 position;
+
+    /**
+     * @brief World space local axes, the rotation's columns
+     */
+    Vector3 axes[3];
+};
+
+/**
+ * @brief Closest or deepest points between two shapes
+ */
+struct Contact
+{
+    /**
+     * @brief Unit direction from a towards b, moving b along it separates them
+     */
+    Vector3 normal;
+
+    /**
+     * @brief Witness points on each shape, closest when separated and deepest when overlapping
+     */
+    Vector3 pointA, pointB;
+
+    /**
+     * @brief Separation, negative penetration depth when overlapping
+     */
+    float distance;
+};
+
+/**
+ * @brief Indices of the two shapes of a pair, from a broadphase
+ */
+struct ShapePair
+{
+    uint32_t a, b;
+};
+
+/**
+ * @brief Pairs per task of every batched narrowphase
+ */
+constexpr size_t kNarrowphaseChunkSize = 256;
+
+/**
+ * @brief GJK boolean test, stopping as soon as a separating axis is found
+ */
+bool Overlap(const ConvexShape& a, const ConvexShape& b);
+
+/**
+ * @brief GJK distance, with EPA for the penetration when the cores overlap
+ *
+ * EPA runs on the cores and the radii are added to its depth, so rounded
+ * shapes are exact. Cores without volume, e.g. coincident sphere centres or a
+ * flat hull inside another shape, give a depth of the summed radii along the
+ * direction between their positions.
+ */
+Contact Collide(const ConvexShape& a, const ConvexShape& b);
+
+/**
+ * @brief Separating axis test over the 15 axes of two boxes
+ *
+ * When separated, distance is the largest separation along any axis, a lower
+ * bound on the true distance. Edge axes have to beat the face axes by 5% of
+ * the depth, which keeps contacts from flipping between near equal axes at
+ * the cost of a depth up to 5% deeper than the minimum. Contact points are
+ * the deepest vertex for a face axis, or the closest points of the two edges
+ * for an edge axis.
+ */
+Contact Collide(const OBB& a, const OBB& b);
+
+// Batches run one task per kNarrowphaseChunkSize pairs on executor and wait
+// for them, results don't depend on the executor.
+
+/**
+ * @param out Array of count contacts, one per pair
+ */
+void Collide(const ConvexShape* shapes, const ShapePair* pairs, size_t count, Contact* out, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Box-box SAT over a pair list, lanes of pairs tested together
+ */
+void Collide(const OBB* boxes, const ShapePair* pairs, size_t count, Contact* out, const Executor& executor = InlineExecutor());
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * @file Compare.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Tolerance aware float comparison
+ * @version 0.1
+ * @date 19-10-2026
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef COMPARE_H
+#define COMPARE_H
+
+#include <cstdint>
+
+/**
+ * @brief Default tolerance for ApproxEqual, around 100 ULP at 1
+ */
+constexpr float kApproxEpsilon = 1e-5f;
+
+/**
+ * @brief Number of representable floats between a and b
+ * 
+ * -0 and +0 are 0 apart, saturates at UINT32_MAX.
+ */
+uint32_t UlpDistance(float a, float b);
+
+/**
+ * @brief |a - b| <= epsilon * max(1, |a|, |b|)
+ * 
+ * Absolute near zero and relative elsewhere, so one epsilon serves all magnitudes.
+ * Equal infinities compare equal, NaN never does.
+ */
+bool ApproxEqual(float a, float b, float epsilon = kApproxEpsilon);
+
+/**
+ * @brief Within maxUlps representable floats of each other, NaN never is
+ */
+bool UlpEqual(float a, float b, uint32_t maxUlps = 4);
+
+#endif
@@ -0,0 +1,186 @@
+/**
+ * @file Curve.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Cubic Hermite, Bezier, Catmull-Rom and B-spline curves, and squad for quaternions
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef CURVE_H
+#define CURVE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Quaternion.h"
+
+// Curves are templates over Vector2, Vector3 and Vector4. Segments are stored
+// in power form and evaluated by Horner's rule, the batched forms run the same
+// operations across SIMD lanes so are bitwise identical to single evaluation.
+
+/**
+ * @brief How the four control values of a cubic segment are interpreted
+ */
+enum class CurveBasis
+{
+    Hermite,    ///< p0, tangent at p0, p1, tangent at p1
+    Bezier,     ///< p0, two control points, p1
+    CatmullRom, ///< Passes through the middle two points, the outer two set the tangents
+    BSpline     ///< Uniform cubic B-spline, C2 continuous but passes through none of the points
+};
+
+/**
+ * @brief Single cubic segment, a + bt + ct^2 + dt^3 for t in [0, 1]
+ *
+ * @tparam V Vector2, Vector3 or Vector4
+ */
+template<typename V>
+struct CubicCurve
+{
+    /**
+     * @brief Constant 0
+     */
+    CubicCurve();
+
+    /**
+     * @brief Convert control values in basis to power form
+     */
+    CubicCurve(CurveBasis basis, const V& p0, const V& p1, const V& p2, const V& p3);
+
+    /**
+     * @brief a, b, c and d
+     */
+    V coefficients[4];
+
+    V Evaluate(float t) const;
+
+    /**
+     * @brief First derivative with respect to t
+     */
+    V Tangent(float t) const;
+
+    /**
+     * @brief Evaluate at count parameters, bitwise identical to Evaluate
+     */
+    void Evaluate(const float* t, V* out, size_t count) const;
+
+    /**
+     * @brief count samples at t = i / (count - 1) by forward differencing
+     *
+     * Three additions per sample rather than a polynomial, rounding error
+     * grows with count and is around 1e-5 of the curve's size for a thousand
+     * samples. The last sample is exactly Evaluate(1).
+     */
+    void EvaluateUniform(V* out, size_t count) const;
+};
+
+/**
+ * @brief Chain of cubic segments with an optional arc length table
+ *
+ * Parameter u runs from 0 to SegmentCount(), the integer part picks the
+ * segment and the fraction is its t. Values outside are clamped.
+ *
+ * @tparam V Vector2, Vector3 or Vector4
+ */
+template<typename V>
+struct Spline
+{
+    Spline();
+
+    /**
+     * @brief Build segments from control points laid out for basis
+     *
+     * - Hermite: point, tangent pairs, segment i uses pairs i and i + 1
+     * - Bezier: p0 c0 c1 p1 c2 c3 p2 ..., consecutive segments share an end point
+     * - CatmullRom and BSpline: segment i uses points i to i + 3
+     *
+     * Control points which don't complete a segment are ignored.
+     *
+     * @param arcLengthSamples Chords per segment for the arc length table, 0 to skip building it
+     */
+    Spline(CurveBasis basis, const V* points, size_t count, size_t arcLengthSamples = 16);
+
+    size_t SegmentCount() const;
+    const CubicCurve<V>& Segment(size_t i) const;
+
+    V Evaluate(float u) const;
+    V Tangent(float u) const;
+
+    /**
+     * @brief Evaluate at count parameters, bitwise identical to Evaluate
+     */
+    void Evaluate(const float* u, V* out, size_t count) const;
+
+    /**
+     * @brief samplesPerSegment samples per segment by forward differencing, see CubicCurve::EvaluateUniform
+     *
+     * @param out Room for SegmentCount() * samplesPerSegment + 1 samples, ending at the last point
+     */
+    void EvaluateUniform(V* out, size_t samplesPerSegment) const;
+
+    /**
+     * @brief Replace the arc length table, samples chords per segment
+     *
+     * Chords underestimate the length of a curved segment by roughly 1 / samples^2.
+     */
+    void BuildArcLengthTable(size_t samples);
+
+    /**
+     * @brief Total length from the arc length table
+     */
+    float Length() const;
+
+    /**
+     * @brief Parameter u a distance s along the spline, interpolating the table. s is clamped
+     */
+    float ParameterAtDistance(float s) const;
+
+    /**
+     * @brief Evaluate at count distances along the spline, for constant speed sampling
+     */
+    void EvaluateAtDistance(const float* s, V* out, size_t count) const;
+
+private:
+
+    std::vector<CubicCurve<V>> m_Segments;
+
+    /**
+     * @brief Cumulative length at u = i / m_ArcLengthSamples
+     */
+    std::vector<float> m_ArcLengths;
+    size_t m_ArcLengthSamples;
+};
+
+/**
+ * @brief Spherical linear interpolation along the shorter arc
+ *
+ * Falls back to a normalized linear interpolation when a and b are nearly
+ * equal. a and b should be unit quaternions.
+ */
+Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t);
+
+/**
+ * @brief Inner control point for squad at key q, from its neighbours
+ *
+ * q exp(-(log(q^-1 next) + log(q^-1 prev)) / 4), with the neighbours taken
+ * in q's hemisphere. At the ends of a sequence pass q as the missing neighbour.
+ */
+Quaternion SquadControl(const Quaternion& prev, const Quaternion& q, const Quaternion& next);
+
+/**
+ * @brief Spherical quadrangle interpolation from q0 to q1, C1 continuous across keys
+ *
+ * Slerp(Slerp(q0, q1, t), Slerp(s0, s1, t), 2t(1 - t)) where s0 and s1 are the
+ * SquadControl points at q0 and q1.
+ */
+Quaternion Squad(const Quaternion& q0, const Quaternion& q1, const Quaternion& s0, const Quaternion& s1, float t);
+
+/**
+ * @brief Squad at count parameters, bitwise identical to the single form
+ */
+void Squad(const Quaternion& q0, const Quaternion& q1, const Quaternion& s0, const Quaternion& s1, const float* t, Quaternion* out, size_t count);
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file FastMath.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Portable polynomial approximations of transcendental functions
+ * @version 0.1
+ * @date 19-10-2026
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <cstddef>
+
+// Scalar and batched forms give identical results for the same input.
+// Errors are measured against double precision:
+//   Sin, Cos, SinCos  <= 2 ULP for |x| <= 10, absolute error <= 2^-23 for |x| <= 8192
+//   Tan               error <= 2^-22 * max(1, |tan x|) for |x| <= 8192 where |tan x| < 10^4, so
+//                     relative where |tan x| >= 1 but absolute near the zeros, whose tiny
+//                     reduced arguments keep the reduction's error
+//   Atan2             <= 4 ULP
+//   Acos              <= 2 ULP
+//   InvSqrt           <= 4 ULP, correctly rounded in FMATHS_DETERMINISTIC builds
+//
+// For a given FMATHS_FMA setting every function evaluates the same operations
+// in the same order on any platform, so only InvSqrt, which starts from the hardware estimate, can
+// differ between CPUs unless built with FMATHS_DETERMINISTIC.
+
+float Sin(float x);
+float Cos(float x);
+
+/**
+ * @brief Sine and cosine sharing a single range reduction
+ */
+void SinCos(float x, float& s, float& c);
+
+float Tan(float x);
+
+/**
+ * @brief Angle of (x, y) from the x axis in [-pi, pi], 0 for (0, 0)
+ */
+float Atan2(float y, float x);
+
+/**
+ * @brief Arc cosine in [0, pi], input must be in [-1, 1]
+ */
+float Acos(float x);
+
+/**
+ * @brief 1 / sqrt(x), +inf for 0 and 0 for +inf
+ *
+ * Denormals can give +inf too, where the hardware estimate treats them as 0.
+ */
+float InvSqrt(float x);
+
+// Batched forms, out may alias the input
+
+void Sin(const float* x, float* out, size_t count);
+void Cos(const float* x, float* out, size_t count);
+void SinCos(const float* x, float* s, float* c, size_t count);
+void Tan(const float* x, float* out, size_t count);
+void Atan2(const float* y, const float* x, float* out, size_t count);
+void Acos(const float* x, float* out, size_t count);
+void InvSqrt(const float* x, float* out, size_t count);
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * @file Fixed.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Saturating fixed point numbers for integer only simulation
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Signed fixed point number, raw / 2^FractionBits
+ *
+ * Every operation saturates at Lowest and Highest rather than wrapping, and
+ * rounds to nearest with ties towards +infinity. Results are exact integer
+ * functions of the inputs, so identical on every platform.
+ *
+ * Converts implicitly from float, double and int so literals mix with it,
+ * converting back to float is explicit.
+ *
+ * @tparam T Raw integer type
+ * @tparam FracBits Bits after the binary point
+ */
+template<typename T, size_t FracBits>
+struct Fixed
+{
+    static_assert((std::is_same_v<T, int32_t> && FracBits == 16) || (std::is_same_v<T, int64_t> && FracBits == 32),
+        "Only Q16.16 and Q32.32 are supported");
+
+    using Raw = T;
+    static constexpr size_t FractionBits = FracBits;
+
+    /**
+     * @brief 0
+     */
+    Fixed();
+
+    /**
+     * @brief Nearest value, ties to even, saturating. NaN becomes 0
+     */
+    Fixed(float f);
+    Fixed(double d);
+    Fixed(int i);
+
+    static Fixed FromRaw(Raw raw);
+
+    static Fixed Lowest();
+    static Fixed Highest();
+
+    /**
+     * @brief Smallest positive value, a raw value of 1
+     */
+    static Fixed Epsilon();
+
+    Raw raw;
+
+    explicit operator float() const;
+    explicit operator double() const;
+
+    /**
+     * @brief Square root, 0 for negative values
+     */
+    Fixed Sqrt() const;
+
+    /**
+     * @brief 1 / sqrt, Highest for values at or below 0
+     */
+    Fixed InvSqrt() const;
+
+    Fixed Abs() const;
+
+    // Operators
+
+    Fixed operator+(Fixed f) const;
+    Fixed operator-(Fixed f) const;
+    Fixed operator*(Fixed f) const;
+
+    /**
+     * @brief Division by 0 saturates towards the sign of the dividend, 0 / 0 is 0
+     */
+    Fixed operator/(Fixed f) const;
+    Fixed operator-() const;
+
+    Fixed& operator+=(Fixed f);
+    Fixed& operator-=(Fixed f);
+    Fixed& operator*=(Fixed f);
+    Fixed& operator/=(Fixed f);
+
+    bool operator==(Fixed f) const;
+    bool operator!=(Fixed f) const;
+    bool operator<(Fixed f) const;
+    bool operator<=(Fixed f) const;
+    bool operator>(Fixed f) const;
+    bool operator>=(Fixed f) const;
+};
+
+/**
+ * @brief 16 integer and 16 fraction bits, range +/-32768 with a resolution of 1.5e-5
+ */
+using Q16 = Fixed<int32_t, 16>;
+
+/**
+ * @brief 32 integer and 32 fraction bits, range +/-2.1e9 with a resolution of 2.3e-10
+ */
+using Q32 = Fixed<int64_t, 32>;
+
+/**
+ * @brief Sine and cosine from an integer polynomial, independent of the C library
+ *
+ * Accurate to a few units of Epsilon, for angles of any size.
+ */
+template<typename T, size_t FracBits>
+void SinCos(Fixed<T, FracBits> x, Fixed<T, FracBits>& s, Fixed<T, FracBits>& c);
+
+#endif
@@ -0,0 +1,114 @@
+/**
+ * @file FixedMatrix4x4.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Fixed point 4x4 matrix, mirroring Matrix4x4
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef FIXEDMATRIX4X4_H
+#define FIXEDMATRIX4X4_H
+
+#include <cstddef>
+
+#include "Fixed.h"
+#include "FixedVector.h"
+
+struct Matrix4x4;
+
+/**
+ * @brief 4x4 matrix of fixed point values in column major order
+ *
+ * Projection, view and decomposition builders stay on Matrix4x4, build those
+ * in float and convert.
+ *
+ * @tparam T Q16 or Q32
+ */
+template<typename T>
+struct FixedMatrix4x4
+{
+public:
+    /**
+     * @brief Zero matrix
+     */
+    FixedMatrix4x4();
+
+    /**
+     * @brief Diagonal set to s
+     */
+    FixedMatrix4x4(T s);
+
+    FixedMatrix4x4(const FixedVector4<T>& col0, const FixedVector4<T>& col1, const FixedVector4<T>& col2, const FixedVector4<T>& col3);
+
+    /**
+     * @brief Nearest fixed point elements, see Fixed
+     */
+    explicit FixedMatrix4x4(const Matrix4x4& m);
+
+    Matrix4x4 ToFloat() const;
+
+    /**
+     * @brief Inverse by Laplace expansion, as Matrix4x4::Inverse
+     *
+     * Each step rounds, so matrices with very large or very small elements lose
+     * precision quickly. Identity when the determinant is 0.
+     */
+    FixedMatrix4x4 Inverse() const;
+
+    FixedMatrix4x4 Transpose() const;
+
+    FixedVector4<T>& operator[](size_t i);
+    const FixedVector4<T>& operator[](size_t i) const;
+
+    FixedMatrix4x4 operator*(const FixedMatrix4x4& m) const;
+    FixedMatrix4x4& operator*=(const FixedMatrix4x4& m);
+
+    /**
+     * @brief Each row is ((c0 * x + c1 * y) + c2 * z) + c3 * w, rounding every product
+     */
+    FixedVector4<T> operator*(const FixedVector4<T>& v) const;
+
+    FixedMatrix4x4 operator*(T s) const;
+    FixedMatrix4x4& operator*=(T s);
+
+    bool operator==(const FixedMatrix4x4& m) const;
+    bool operator!=(const FixedMatrix4x4& m) const;
+
+    static FixedMatrix4x4 Identity();
+    static FixedMatrix4x4 Translate(const FixedVector3<T>& v);
+    static FixedMatrix4x4 Scale(const FixedVector3<T>& v);
+
+    /**
+     * @brief Batched matrix multiplication, out[i] = a[i] * b[i], bitwise identical to operator*
+     *
+     * Q16 runs in 32 bit integer lanes.
+     *
+     * @param out Array of count products, may alias a or b
+     */
+    static void Multiply(const FixedMatrix4x4* a, const FixedMatrix4x4* b, FixedMatrix4x4* out, size_t count);
+
+    /**
+     * @brief Batched Inverse, may alias m
+     */
+    static void Inverse(const FixedMatrix4x4* m, FixedMatrix4x4* out, size_t count);
+
+    /**
+     * @brief Batched Transpose, may alias m
+     */
+    static void Transpose(const FixedMatrix4x4* m, FixedMatrix4x4* out, size_t count);
+
+    static void FromFloat(const Matrix4x4* m, FixedMatrix4x4* out, size_t count);
+    static void ToFloat(const FixedMatrix4x4* m, Matrix4x4* out, size_t count);
+
+private:
+
+    FixedVector4<T> m_Columns[4];
+};
+
+using Matrix4x4Q16 = FixedMatrix4x4<Q16>;
+using Matrix4x4Q32 = FixedMatrix4x4<Q32>;
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * @file FixedQuaternion.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Fixed point quaternion, mirroring Quaternion
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef FIXEDQUATERNION_H
+#define FIXEDQUATERNION_H
+
+#include <cstddef>
+
+#include "Fixed.h"
+#include "FixedVector.h"
+
+struct Quaternion;
+
+/**
+ * @brief Rotation quaternion of fixed point values
+ *
+ * @tparam T Q16 or Q32
+ */
+template<typename T>
+struct FixedQuaternion
+{
+    /**
+     * @brief Identity rotation
+     */
+    FixedQuaternion();
+
+    FixedQuaternion(T x, T y, T z, T w);
+
+    /**
+     * @brief Construct from an axis and rotation, using the fixed point SinCos
+     *
+     * @param axis Axis of rotation, will be converted to unit vector if not already
+     * @param r Rotation about axis in radians
+     */
+    FixedQuaternion(const FixedVector3<T>& axis, T r);
+
+    /**
+     * @brief Nearest fixed point components, see Fixed
+     */
+    explicit FixedQuaternion(const Quaternion& q);
+
+    T x, y, z, w;
+
+    Quaternion ToFloat() const;
+
+    T Magnitude() const;
+    T MagnitudeSquared() const;
+
+    FixedQuaternion& Normalize();
+    FixedQuaternion Normalized() const;
+    bool IsNormalized() const;
+
+    T Dot(const FixedQuaternion& q) const;
+
+    /**
+     * @brief Rotate v by the normalized quaternion, v + w t + u x t with t = 2 (u x v)
+     */
+    FixedVector3<T> Apply(const FixedVector3<T>& v) const;
+    FixedVector4<T> Apply(const FixedVector4<T>& v) const;
+
+    /**
+     * @brief Rotate many vectors by this quaternion, bitwise identical to Apply
+     *
+     * Q16 runs in 32 bit integer lanes.
+     *
+     * @param out Array of count rotated vectors, may alias v
+     */
+    void Apply(const FixedVector3<T>* v, FixedVector3<T>* out, size_t count) const;
+
+    /**
+     * @brief Batched Apply, rotating each v[i] by q[i], bitwise identical to Apply
+     *
+     * @param out Array of count rotated vectors, may alias v
+     */
+    static void Apply(const FixedQuaternion* q, const FixedVector3<T>* v, FixedVector3<T>* out, size_t count);
+
+    FixedQuaternion operator*(T s) const;
+    FixedQuaternion operator/(T s) const;
+
+    FixedQuaternion& operator*=(T s);
+    FixedQuaternion& operator/=(T s);
+
+    FixedQuaternion operator*(const FixedQuaternion& q) const;
+    FixedQuaternion& operator*=(const FixedQuaternion& q);
+
+    FixedQuaternion operator+(const FixedQuaternion& q) const;
+    FixedQuaternion operator-(const FixedQuaternion& q) const;
+
+    FixedQuaternion& operator+=(const FixedQuaternion& q);
+    FixedQuaternion& operator-=(const FixedQuaternion& q);
+
+    bool operator==(const FixedQuaternion& q) const;
+    bool operator!=(const FixedQuaternion& q) const;
+
+    T& operator[](size_t i);
+    const T& operator[](size_t i) const;
+};
+
+using QuaternionQ16 = FixedQuaternion<Q16>;
+using QuaternionQ32 = FixedQuaternion<Q32>;
+
+#endif
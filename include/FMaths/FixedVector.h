@@ -0,0 +1,223 @@
+/**
+ * @file FixedVector.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Fixed point 2D, 3D and 4D vectors, mirroring Vector2, Vector3 and Vector4
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef FIXEDVECTOR_H
+#define FIXEDVECTOR_H
+
+#include <cstddef>
+
+#include "Fixed.h"
+
+struct Vector2;
+struct Vector3;
+struct Vector4;
+
+template<typename T>
+struct FixedVector3;
+
+template<typename T>
+struct FixedVector4;
+
+// The same interface as the float vectors with T in place of float, so code
+// can switch between them with a type alias. Every operation saturates.
+//
+// Length and Normalize use the exact sum of squares in a wide integer, so
+// keep their precision for small and large vectors. Normalizing a zero
+// vector leaves it unchanged.
+
+/**
+ * @tparam T Q16 or Q32
+ */
+template<typename T>
+struct FixedVector2
+{
+    // Constructors
+
+    FixedVector2();
+    FixedVector2(T x, T y);
+    FixedVector2(const FixedVector3<T>& v);
+    FixedVector2(const FixedVector4<T>& v);
+
+    /**
+     * @brief Nearest fixed point components, see Fixed
+     */
+    explicit FixedVector2(const Vector2& v);
+
+    // Variables
+
+    T x, y;
+
+    // Functions
+
+    Vector2 ToFloat() const;
+
+    T Length() const;
+    T LengthSquared() const;
+
+    FixedVector2& Normalize();
+    FixedVector2 Normalized() const;
+    bool IsNormalized() const;
+
+    T Dot(const FixedVector2& v) const;
+
+    // Operators
+
+    FixedVector2 operator+(const FixedVector2& v) const;
+    FixedVector2 operator-(const FixedVector2& v) const;
+    FixedVector2& operator+=(const FixedVector2& v);
+    FixedVector2& operator-=(const FixedVector2& v);
+
+    FixedVector2 operator*(T s) const;
+    FixedVector2 operator/(T s) const;
+    FixedVector2& operator*=(T s);
+    FixedVector2& operator/=(T s);
+
+    bool operator==(const FixedVector2& v) const;
+    bool operator!=(const FixedVector2& v) const;
+
+    T& operator[](size_t i);
+    const T& operator[](size_t i) const;
+};
+
+/**
+ * @tparam T Q16 or Q32
+ */
+template<typename T>
+struct FixedVector3
+{
+    // Constructors
+
+    FixedVector3();
+    FixedVector3(T x, T y, T z);
+    FixedVector3(const FixedVector2<T>& v, T z = T());
+    FixedVector3(const FixedVector4<T>& v);
+    explicit FixedVector3(const Vector3& v);
+
+    // Variables
+
+    T x, y, z;
+
+    // Functions
+
+    Vector3 ToFloat() const;
+
+    T Length() const;
+    T LengthSquared() const;
+
+    FixedVector3& Normalize();
+    FixedVector3 Normalized() const;
+    bool IsNormalized() const;
+
+    T Dot(const FixedVector3& v) const;
+    FixedVector3 Cross(const FixedVector3& v) const;
+
+    // Batched forms, Q16 runs in 32 bit integer lanes
+
+    /**
+     * @brief Convert count vectors, identical to the constructor
+     */
+    static void FromFloat(const Vector3* v, FixedVector3* out, size_t count);
+
+    /**
+     * @brief Identical to ToFloat
+     */
+    static void ToFloat(const FixedVector3* v, Vector3* out, size_t count);
+
+    static void Normalize(FixedVector3* v, size_t count);
+    static void Dot(const FixedVector3* a, const FixedVector3* b, T* out, size_t count);
+    static void Cross(const FixedVector3* a, const FixedVector3* b, FixedVector3* out, size_t count);
+
+    // Operators
+
+    FixedVector3 operator+(const FixedVector3& v) const;
+    FixedVector3 operator-(const FixedVector3& v) const;
+    FixedVector3& operator+=(const FixedVector3& v);
+    FixedVector3& operator-=(const FixedVector3& v);
+
+    FixedVector3 operator*(T s) const;
+    FixedVector3 operator/(T s) const;
+    FixedVector3& operator*=(T s);
+    FixedVector3& operator/=(T s);
+
+    bool operator==(const FixedVector3& v) const;
+    bool operator!=(const FixedVector3& v) const;
+
+    T& operator[](size_t i);
+    const T& operator[](size_t i) const;
+};
+
+/**
+ * @tparam T Q16 or Q32
+ */
+template<typename T>
+struct FixedVector4
+{
+    // Constructors
+
+    FixedVector4();
+    FixedVector4(T x, T y, T z, T w = T(1));
+    FixedVector4(const FixedVector2<T>& v, T z = T(), T w = T(1));
+    FixedVector4(const FixedVector3<T>& v, T w = T(1));
+    explicit FixedVector4(const Vector4& v);
+
+    // Variables
+
+    T x, y, z, w;
+
+    // Functions
+
+    Vector4 ToFloat() const;
+
+    T Length() const;
+    T LengthSquared() const;
+
+    FixedVector4& Normalize();
+    FixedVector4 Normalized() const;
+    bool IsNormalized() const;
+
+    T Dot(const FixedVector4& v) const;
+
+    /**
+     * @brief Cross product of the xyz components, w is 1
+     */
+    FixedVector4 Cross(const FixedVector4& v) const;
+
+    static void FromFloat(const Vector4* v, FixedVector4* out, size_t count);
+    static void ToFloat(const FixedVector4* v, Vector4* out, size_t count);
+
+    // Operators
+
+    FixedVector4 operator+(const FixedVector4& v) const;
+    FixedVector4 operator-(const FixedVector4& v) const;
+    FixedVector4& operator+=(const FixedVector4& v);
+    FixedVector4& operator-=(const FixedVector4& v);
+
+    FixedVector4 operator*(T s) const;
+    FixedVector4 operator/(T s) const;
+    FixedVector4& operator*=(T s);
+    FixedVector4& operator/=(T s);
+
+    bool operator==(const FixedVector4& v) const;
+    bool operator!=(const FixedVector4& v) const;
+
+    T& operator[](size_t i);
+    const T& operator[](size_t i) const;
+};
+
+using Vector2Q16 = FixedVector2<Q16>;
+using Vector3Q16 = FixedVector3<Q16>;
+using Vector4Q16 = FixedVector4<Q16>;
+
+using Vector2Q32 = FixedVector2<Q32>;
+using Vector3Q32 = FixedVector3<Q32>;
+using Vector4Q32 = FixedVector4<Q32>;
+
+#endif
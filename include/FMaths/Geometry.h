@@ -0,0 +1,285 @@
+/**
+ * @file Geometry.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Geometric primitives and batched intersection queries
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Vector3.h"
+
+/**
+ * @brief Half-line from an origin along a direction
+ */
+struct Ray
+{
+    Ray();
+
+    /**
+     * @param origin Start point
+     * @param direction Direction, does not need to be normalized but hit distances are in multiples of it
+     */
+    Ray(const Vector3& origin, const Vector3& direction);
+
+    Vector3 origin;
+    Vector3 direction;
+
+    /**
+     * @brief Point at distance t along the ray
+     */
+    Vector3 At(float t) const;
+};
+
+/**
+ * @brief Plane of all points p where normal.Dot(p) == d
+ */
+struct Plane
+{
+    Plane();
+    Plane(const Vector3& normal, float d);
+
+    /**
+     * @brief Construct from a normal and any point on the plane
+     */
+    Plane(const Vector3& normal, const Vector3& point);
+
+    Vector3 normal;
+    float d;
+
+    /**
+     * @brief Distance from plane, positive on the side the normal faces
+     * @note Only a true distance if normal is normalized
+     */
+    float SignedDistance(const Vector3& p) const;
+
+    /**
+     * @brief Ray intersection
+     *
+     * @param t Set to hit distance on intersection
+     * @return true if the ray hits the plane at t >= 0
+     */
+    bool Intersect(const Ray& ray, float& t) const;
+};
+
+/**
+ * @brief Axis aligned bounding box
+ */
+struct AABB
+{
+    AABB();
+    AABB(const Vector3& min, const Vector3& max);
+
+    Vector3 min;
+    Vector3 max;
+
+    bool Contains(const Vector3& p) const;
+    bool Overlaps(const AABB& b) const;
+
+    /**
+     * @brief Point inside the box closest to p
+     */
+    Vector3 ClosestPoint(const Vector3& p) const;
+
+    /**
+     * @brief Ray intersection using the slab test
+     *
+     * @param t Set to entry distance, 0 if the ray starts inside the box
+     */
+    bool Intersect(const Ray& ray, float& t) const;
+};
+
+/**
+ * @brief Sphere from centre and radius
+ */
+struct Sphere
+{
+    Sphere();
+    Sphere(const Vector3& centre, float radius);
+
+    Vector3 centre;
+    float radius;
+
+    bool Contains(const Vector3& p) const;
+    bool Overlaps(const Sphere& s) const;
+    bool Overlaps(const AABB& b) const;
+
+    /**
+     * @brief Ray intersection
+     *
+     * @param t Set to entry distance, 0 if the ray starts inside the sphere
+     */
+    bool Intersect(const Ray& ray, float& t) const;
+};
+
+/**
+ * @brief Oriented box from centre, orthonormal axes and half extents along each axis
+ */
+struct OBB
+{
+    OBB();
+    OBB(const Vector3& centre, const Vector3& axis0, const Vector3& axis1, const Vector3& axis2, const Vector3& halfExtents);
+
+    Vector3 centre;
+    Vector3 axes[3];
+    Vector3 halfExtents;
+
+    bool Contains(const Vector3& p) const;
+
+    /**
+     * @brief Point inside the box closest to p
+     */
+    Vector3 ClosestPoint(const Vector3& p) const;
+};
+
+/**
+ * @brief Triangle from 3 vertices, front face is counter-clockwise
+ */
+struct Triangle
+{
+    Triangle();
+    Triangle(const Vector3& v0, const Vector3& v1, const Vector3& v2);
+
+    Vector3 v0, v1, v2;
+
+    /**
+     * @brief Unnormalized face normal, length is twice the area
+     */
+    Vector3 Normal() const;
+
+    /**
+     * @brief Point on the triangle closest to p
+     */
+    Vector3 ClosestPoint(const Vector3& p) const;
+
+    /**
+     * @brief Two sided ray intersection using Möller–Trumbore
+     *
+     * @param t Set to hit distance on intersection
+     */
+    bool Intersect(const Ray& ray, float& t) const;
+};
+
+/**
+ * @brief Fixed size structure of arrays triangle packet
+ *
+ * Stores the first vertex and both edges so a ray can be tested against all
+ * N triangles with a single pass of Möller–Trumbore.
+ * Unused slots are filled with degenerate triangles which never report a hit.
+ *
+ * @tparam N Triangles per packet, 4 or 8
+ */
+template<size_t N>
+struct TrianglePacket
+{
+    static_assert(N == 4 || N == 8, "Triangle packets are 4 or 8 wide");
+
+    TrianglePacket();
+
+    /**
+     * @brief Pack up to N triangles
+     */
+    TrianglePacket(const Triangle* tris, size_t count);
+
+    alignas(32) float v0x[N], v0y[N], v0z[N];
+    alignas(32) float e1x[N], e1y[N], e1z[N];
+    alignas(32) float e2x[N], e2y[N], e2z[N];
+};
+
+using TrianglePacket4 = TrianglePacket<4>;
+using TrianglePacket8 = TrianglePacket<8>;
+
+/**
+ * @brief Growable structure of arrays triangle storage for batch queries
+ */
+struct TriangleArray
+{
+    std::vector<float> v0x, v0y, v0z;
+    std::vector<float> e1x, e1y, e1z;
+    std::vector<float> e2x, e2y, e2z;
+
+    void Push(const Triangle& t);
+    void Clear();
+    void Reserve(size_t n);
+    size_t Size() const;
+
+    Triangle operator[](size_t i) const;
+};
+
+/**
+ * @brief Growable structure of arrays AABB storage for batch queries
+ */
+struct AABBArray
+{
+    std::vector<float> minX, minY, minZ;
+    std::vector<float> maxX, maxY, maxZ;
+
+    void Push(const AABB& b);
+    void Clear();
+    void Reserve(size_t n);
+    size_t Size() const;
+
+    AABB operator[](size_t i) const;
+};
+
+// Batched queries
+// Hit masks hold one bit per element, element i is bit (i % 32) of word (i / 32),
+// so they must have room for (count + 31) / 32 words.
+// Distances are written for every element but are unspecified for misses.
+
+/**
+ * @brief Intersect a ray against a packet of 4 triangles
+ *
+ * @param t Receives 4 distances
+ * @return Hit mask, bit i set if triangle i was hit
+ */
+uint32_t IntersectRay(const Ray& ray, const TrianglePacket4& tris, float* t);
+
+/**
+ * @brief Intersect a ray against a packet of 8 triangles
+ *
+ * @param t Receives 8 distances
+ * @return Hit mask, bit i set if triangle i was hit
+ */
+uint32_t IntersectRay(const Ray& ray, const TrianglePacket8& tris, float* t);
+
+/**
+ * @brief Intersect a ray against every triangle in the array
+ *
+ * @return Number of triangles hit
+ */
+size_t IntersectRay(const Ray& ray, const TriangleArray& tris, uint32_t* hitMask, float* t);
+
+/**
+ * @brief Slab test a ray against every box in the array
+ *
+ * @param t Receives entry distances, 0 where the ray starts inside
+ * @return Number of boxes hit
+ */
+size_t IntersectRay(const Ray& ray, const AABBArray& boxes, uint32_t* hitMask, float* t);
+
+/**
+ * @brief Closest point on triangle i to point i, for each i
+ *
+ * @param points Array of tris.Size() points
+ * @param out Array of tris.Size() results
+ */
+void ClosestPoints(const Vector3* points, const TriangleArray& tris, Vector3* out);
+
+/**
+ * @brief Closest point on each triangle to a single point
+ *
+ * @param out Array of tris.Size() results
+ */
+void ClosestPoints(const Vector3& point, const TriangleArray& tris, Vector3* out);
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * @file Layout.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Conversion between array of structures, structure of arrays and blocked layouts
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <cstddef>
+
+struct Vector3;
+struct Vector4;
+struct Matrix4x4;
+
+/**
+ * @brief Elements per block in the AoSoA layouts
+ *
+ * A block stores each component for 8 elements contiguously, x0..x7 y0..y7 ...,
+ * so one AVX or two SSE loads fetch a component.
+ */
+constexpr size_t kAoSoAWidth = 8;
+
+/**
+ * @brief Outputs of at least this many bytes use non-temporal stores
+ *
+ * Only when every output array is aligned to the SIMD width, 32 bytes covers
+ * any build. Output this large would only evict the input from cache.
+ */
+constexpr size_t kStreamThreshold = size_t(4) << 20;
+
+/**
+ * @brief Floats needed to hold count elements of components floats as AoSoA
+ *
+ * Rounded up to whole blocks, the last block is padded with 0.
+ */
+size_t AoSoASize(size_t count, size_t components);
+
+// Structure of arrays, one array per component
+
+/**
+ * @param v Array of count vectors
+ * @param x, y, z Arrays of count components
+ */
+void ToSoA(const Vector3* v, size_t count, float* x, float* y, float* z);
+void FromSoA(const float* x, const float* y, const float* z, size_t count, Vector3* v);
+
+void ToSoA(const Vector4* v, size_t count, float* x, float* y, float* z, float* w);
+void FromSoA(const float* x, const float* y, const float* z, const float* w, size_t count, Vector4* v);
+
+/**
+ * @brief Element (col, row) of matrix i goes to soa[(col * 4 + row) * count + i]
+ *
+ * Converted in blocks that fit in L1, writing one run per component at a time.
+ *
+ * @param soa 16 * count floats
+ */
+void ToSoA(const Matrix4x4* m, size_t count, float* soa);
+void FromSoA(const float* soa, size_t count, Matrix4x4* m);
+
+// Array of structures of arrays, see kAoSoAWidth
+
+/**
+ * @param aosoa AoSoASize(count, 3) floats
+ */
+void ToAoSoA(const Vector3* v, size_t count, float* aosoa);
+void FromAoSoA(const float* aosoa, size_t count, Vector3* v);
+
+void ToAoSoA(const Vector4* v, size_t count, float* aosoa);
+void FromAoSoA(const float* aosoa, size_t count, Vector4* v);
+
+/**
+ * @brief Each block holds 16 components of 8 matrices, component order as ToSoA
+ */
+void ToAoSoA(const Matrix4x4* m, size_t count, float* aosoa);
+void FromAoSoA(const float* aosoa, size_t count, Matrix4x4* m);
+
+#endif
@@ -0,0 +1,182 @@
+/**
+ * @file Matrix3x3.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief 3x3 Matrix, useful for 2D transformations
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef MATRIX3X3_H
+#define MATRIX3X3_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vector2.h"
+#include "Vector3.h"
+
+/**
+ * @brief 3x3 Matrix of floats, a 2D affine transform in homogeneous co-ordinates
+ *
+ * Column major like Matrix4x4, the third column holds the translation.
+ */
+struct Matrix3x3
+{
+public:
+    /**
+     * @brief Default constructor
+     */
+    Matrix3x3();
+
+    /**
+     * @brief Construct a Matrix with all of the central diagonal elements set to s
+     *
+     * @param s Diagonal value
+     */
+    Matrix3x3(float s);
+
+    /**
+     * @brief Construct from columns
+     */
+    Matrix3x3(const Vector3& col0, const Vector3& col1, const Vector3& col2);
+
+    /**
+     * @brief Copy Constructor
+     */
+    Matrix3x3(const Matrix3x3& m);
+
+    float Determinant() const;
+
+    /**
+     * @brief Get inverse matrix from the adjugate
+     *
+     * @return Matrix3x3 Inverse matrix or Identity Matrix if inverse does not exist
+     */
+    Matrix3x3 Inverse() const;
+
+    /**
+     * @brief Transform a point, applying translation
+     *
+     * @note The bottom row is assumed to be (0, 0, 1)
+     */
+    Vector2 TransformPoint(const Vector2& p) const;
+
+    /**
+     * @brief Transform a direction, ignoring translation
+     */
+    Vector2 TransformVector(const Vector2& v) const;
+
+    /**
+     * @brief Batched TransformPoint, bitwise identical to it
+     *
+     * @param p Array of count points
+     * @param out Array of count transformed points, may alias p
+     */
+    void TransformPoints(const Vector2* p, Vector2* out, size_t count) const;
+
+    /**
+     * @brief Batched TransformPoint on separate x and y arrays
+     *
+     * @param x, y Arrays of count co-ordinates
+     * @param outX, outY Arrays of count transformed co-ordinates, may alias x and y
+     */
+    void TransformPoints(const float* x, const float* y, float* outX, float* outY, size_t count) const;
+
+    /**
+     * @brief Accessor for matrix data in column major ordering
+     */
+    Vector3& operator[](size_t i);
+
+    /**
+     * @brief Constant accessor
+     */
+    const Vector3& operator[](size_t i) const;
+
+    /**
+     * @brief Matrix multiplication, (a * b) applies b first
+     */
+    Matrix3x3 operator*(const Matrix3x3& m) const;
+
+    /**
+     * @brief Matrix multiplication assignment
+     */
+    Matrix3x3& operator*=(const Matrix3x3& m);
+
+    /**
+     * @brief Matrix vector multiplication
+     */
+    Vector3 operator*(const Vector3& v) const;
+
+    /**
+     * @brief Matrix scalar multiplication
+     */
+    Matrix3x3 operator*(float s) const;
+
+    /**
+     * @brief Matrix scalar multiplication assignment
+     */
+    Matrix3x3& operator*=(float s);
+
+    /**
+     * @brief Assignment operator
+     */
+    Matrix3x3& operator=(const Matrix3x3& m);
+
+    /**
+     * @brief Equatable
+     * @note Does not account for floating point precision errors
+     */
+    bool operator==(const Matrix3x3& m) const;
+
+    /**
+     * @brief Inequatable
+     * @note Does not account for floating point precision errors
+     */
+    bool operator!=(const Matrix3x3& m) const;
+
+    /**
+     * @brief Every element ApproxEqual, see Compare.h
+     */
+    bool ApproxEqual(const Matrix3x3& m, float epsilon = kApproxEpsilon) const;
+
+    /**
+     * @brief Every element within maxUlps
+     */
+    bool UlpEqual(const Matrix3x3& m, uint32_t maxUlps = 4) const;
+
+    /**
+     * @brief Creates an Identity matrix
+     */
+    static Matrix3x3 Identity();
+
+    /**
+     * @brief Creates a translation matrix
+     */
+    static Matrix3x3 Translate(const Vector2& v);
+
+    /**
+     * @brief Creates a scaling matrix
+     */
+    static Matrix3x3 Scale(const Vector2& v);
+
+    /**
+     * @brief Creates a rotation matrix
+     *
+     * @param r Counter-clockwise rotation in radians
+     */
+    static Matrix3x3 Rotate(float r);
+
+private:
+
+    /**
+     * @brief Encapsulated matrix
+     *
+     * Organized as an array of vector3 in column major ordering.
+     */
+    Vector3 m_Columns[3];
+};
+
+#endif
@@ -17,6 +17,8 @@
 #include "Vector3.h"
 #include "Vector4.h"
 
+struct Quaternion;
+
 /**
  * @brief 4x4 Matrix of floats, useful for transformations
  * 
@@ -53,6 +55,41 @@ public:
      */
     Matrix4x4 Inverse() const;
 
+    /**
+     * @brief Swap rows and columns, also converts between column and row major storage
+     */
+    Matrix4x4 Transpose() const;
+
+    /**
+     * @brief Split into translation, rotation and scale
+     * 
+     * Assumes the matrix was built as Translate * Rotate * Scale with no shear or projection.
+     * Negative determinants are folded into the x scale.
+     * Unit length basis vectors take a fast path which skips normalization.
+     * 
+     * @return false if any axis has zero scale, rotation is then set to identity
+     */
+    bool Decompose(Vector3& translation, Quaternion& rotation, Vector3& scale) const;
+
+    /**
+     * @brief Make the upper 3x3 orthonormal using Gram-Schmidt
+     * 
+     * x is kept in direction, y is made perpendicular to it and z is rebuilt as x cross y.
+     * Translation and the bottom row are left untouched, any scale is removed.
+     */
+    Matrix4x4& Orthonormalize();
+
+    /**
+     * @brief Pull a drifted upper 3x3 back towards the nearest rotation
+     * 
+     * Newton-Schulz iteration towards the orthogonal polar factor, X = X * (3I - X^T X) / 2.
+     * Unlike Orthonormalize no axis is favoured, but the basis must already be close
+     * to orthonormal; each iteration roughly squares the error.
+     * 
+     * @param iterations Number of iterations, 1 is enough for per-frame correction
+     */
+    Matrix4x4& OrthonormalizePolar(size_t iterations = 1);
+
     /**
      * @brief Accessor for matrix data in column major ordering
      */
@@ -65,9 +102,18 @@ public:
 
     /**
      * @brief Matrix multiplication
+     * @note Uses MultiplyCompensated when built with FMATHS_COMPENSATED
      */
     Matrix4x4 operator*(const Matrix4x4& m) const;
 
+    /**
+     * @brief Matrix multiplication with compensated accumulation
+     * 
+     * Each element is accumulated as if in twice the working precision,
+     * limiting drift through long transform chains at roughly 4x the cost.
+     */
+    Matrix4x4 MultiplyCompensated(const Matrix4x4& m) const;
+
     /**
      * @brief Matrix multiplication assignment
      */
@@ -106,6 +152,16 @@ public:
      */
     bool operator!=(const Matrix4x4& m) const;
 
+    /**
+     * @brief Every element ApproxEqual, see Compare.h
+     */
+    bool ApproxEqual(const Matrix4x4& m, float epsilon = kApproxEpsilon) const;
+
+    /**
+     * @brief Every element within maxUlps
+     */
+    bool UlpEqual(const Matrix4x4& m, uint32_t maxUlps = 4) const;
+
     /**
      * @brief Creates an Identity matrix
      */
@@ -133,6 +189,52 @@ public:
      */
     static Matrix4x4 QuatRotate(const Vector4& q);
 
+    /**
+     * @brief Batched Decompose
+     * 
+     * @param m Array of count matrices
+     * @param translation Array of count translations
+     * @param rotation Array of count rotations, identity where decomposition failed
+     * @param scale Array of count scales
+     */
+    static void Decompose(const Matrix4x4* m, Vector3* translation, Quaternion* rotation, Vector3* scale, size_t count);
+
+    /**
+     * @brief Batched matrix multiplication, out[i] = a[i] * b[i]
+     * 
+     * Bitwise identical to operator*, including with FMATHS_COMPENSATED.
+     * 
+     * @param out Array of count products, may alias a or b
+     */
+    static void Multiply(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out, size_t count);
+
+    /**
+     * @brief Batched Inverse, bitwise identical to the member function
+     * 
+     * @param m Array of count matrices
+     * @param out Array of count inverses, identity where the inverse does not exist. May alias m
+     */
+    static void Inverse(const Matrix4x4* m, Matrix4x4* out, size_t count);
+
+    /**
+     * @brief Batched Transpose, e.g. for uploading row major matrices
+     * 
+     * Large outputs aligned to 16 bytes are written with non-temporal stores, see Layout.h.
+     * 
+     * @param out Array of count transposes, may alias m
+     */
+    static void Transpose(const Matrix4x4* m, Matrix4x4* out, size_t count);
+
+    /**
+     * @brief Batched Orthonormalize, in place
+     */
+    static void Orthonormalize(Matrix4x4* m, size_t count);
+
+    /**
+     * @brief Batched OrthonormalizePolar, in place
+     */
+    static void OrthonormalizePolar(Matrix4x4* m, size_t count, size_t iterations = 1);
+
     /**
      * @brief Create an orthographic projection matrix
      * 
@@ -144,14 +246,67 @@ public:
     /**
      * @brief Create a perspective projection matrix
      * 
+     * Maps depth from near to far onto [-1, 1].
+     * 
      * @param fov Horizontal fov 
      * @param width Display width
      * @param height Display height
      * @param near Distance to near plane
-     * @param far Distance to far plane
+     * @param far Distance to far plane, may be INFINITY
      */
     static Matrix4x4 Perspective(float fov, float width, float height, float near, float far);
 
+    /**
+     * @brief Create a reverse-Z perspective projection matrix
+     * 
+     * Maps depth from near to far onto [1, 0], spreading float precision evenly over
+     * distance. Needs a [0, 1] clip range, e.g. glClipControl(GL_LOWER_LEFT, GL_ZERO_TO_ONE),
+     * and a greater-than depth test.
+     * 
+     * @param far Distance to far plane, may be INFINITY
+     */
+    static Matrix4x4 PerspectiveReverseZ(float fov, float width, float height, float near, float far);
+
+    /**
+     * @brief Create a view matrix looking from eye towards target
+     * 
+     * Right handed like Perspective, the camera looks down -z with y up.
+     * 
+     * @param up World up, must not be parallel to target - eye
+     */
+    static Matrix4x4 LookAt(const Vector3& eye, const Vector3& target, const Vector3& up);
+
+    /**
+     * @brief Create a view matrix for a camera placed in the world
+     * 
+     * The inverse of Translate(position) * QuatRotate(rotation), without a general inverse.
+     * 
+     * @param rotation Unit rotation taking the camera's -z to its view direction
+     */
+    static Matrix4x4 View(const Vector3& position, const Quaternion& rotation);
+
+    /**
+     * @brief Fused projection * view and its inverse
+     * 
+     * The inverse is built from the structure of both matrices instead of
+     * the general Inverse, so is cheaper and more accurate.
+     * 
+     * @param view Rigid transform, as from LookAt or View
+     * @param projection From Perspective, PerspectiveReverseZ or Orthographic
+     * @param inverse Set to the inverse of the result, taking clip space back to world space
+     */
+    static Matrix4x4 ViewProjection(const Matrix4x4& view, const Matrix4x4& projection, Matrix4x4& inverse);
+
+    /**
+     * @brief Batched ViewProjection, e.g. for every shadow cascade at once
+     * 
+     * Bitwise identical to the single version.
+     * 
+     * @param out Array of count products
+     * @param inverse Array of count inverses
+     */
+    static void ViewProjection(const Matrix4x4* view, const Matrix4x4* projection, Matrix4x4* out, Matrix4x4* inverse, size_t count);
+
 private:
 
     /**
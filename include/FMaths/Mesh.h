@@ -0,0 +1,124 @@
+/**
+ * @file Mesh.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Batched vertex normal and MikkTSpace tangent generation for indexed triangle meshes
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef MESH_H
+#define MESH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Async.h"
+
+/**
+ * @brief Triangles or vertices per task of every mesh kernel
+ */
+constexpr size_t kMeshChunkSize = 4096;
+
+/**
+ * @brief Connectivity of an indexed triangle mesh, built once and reused as its vertices move
+ *
+ * Alongside the triangles it stores, for every vertex, the corners that
+ * reference it in triangle order. Kernels first compute per triangle values
+ * in lanes, then each vertex gathers from its own corners, so vertices can be
+ * processed in parallel with no write conflicts and results don't depend on
+ * the executor.
+ *
+ * Positions, normals and texture coordinates are structures of arrays, one
+ * float array per component. The kernels keep per triangle scratch in the
+ * mesh, so one Mesh can't run two kernels at once.
+ */
+struct Mesh
+{
+public:
+    /**
+     * @param indices 3 * triangleCount vertex indices, counter-clockwise front faces
+     * @param vertexCount Fewer than 2^32, every index below it
+     */
+    Mesh(const uint32_t* indices, size_t triangleCount, size_t vertexCount);
+
+    size_t TriangleCount() const;
+    size_t VertexCount() const;
+    const uint32_t* Indices() const;
+
+    /**
+     * @brief Corners of vertex v are Corners()[CornerStart()[v]] to Corners()[CornerStart()[v + 1] - 1]
+     *
+     * A corner is 3 * triangle + its position in the triangle.
+     */
+    const uint32_t* CornerStart() const;
+    const uint32_t* Corners() const;
+
+    /**
+     * @brief Area weighted vertex normals, the normalized sum of the normals of the triangles around each vertex
+     *
+     * Vertices with no area around them get 0. Runs one task per
+     * kMeshChunkSize triangles, then per kMeshChunkSize vertices, on executor
+     * and waits for them.
+     *
+     * @param x, y, z Positions, VertexCount() of each
+     * @param nx, ny, nz Receive VertexCount() normals
+     */
+    void ComputeNormals(const float* x, const float* y, const float* z, float* nx, float* ny, float* nz,
+        const Executor& executor = InlineExecutor());
+
+    /**
+     * @brief Face normals from the last ComputeNormals, unnormalized with length twice the triangle's area
+     */
+    const float* FaceX() const;
+    const float* FaceY() const;
+    const float* FaceZ() const;
+
+    /**
+     * @brief Per vertex tangents following MikkTSpace's rules, for baked normal maps to match
+     *
+     * Each triangle's tangent is its texture space s direction. Each corner
+     * projects it onto the plane of the vertex normal and weights it by the
+     * corner's angle in that plane, and a vertex normalizes the sum. The sign
+     * in tw is +1 where texture space is right handed and -1 where mirrored,
+     * so the bitangent is tw * cross(n, t).
+     *
+     * As with MikkTSpace, vertices need to be split where texture coordinates
+     * are, and where the mirroring changes. A vertex whose triangles disagree
+     * on handedness takes that of its first triangle with texture area and
+     * ignores the rest. Triangles without texture area don't contribute, and
+     * vertices with none of them get a tangent of 0 with tw 1.
+     *
+     * @param nx, ny, nz Unit vertex normals, e.g. from ComputeNormals
+     * @param u, v Texture coordinates, VertexCount() of each
+     * @param tx, ty, tz, tw Receive VertexCount() tangents and signs
+     */
+    void ComputeTangents(const float* x, const float* y, const float* z, const float* nx, const float* ny, const float* nz,
+        const float* u, const float* v, float* tx, float* ty, float* tz, float* tw, const Executor& executor = InlineExecutor());
+
+private:
+    size_t m_VertexCount;
+    std::vector<uint32_t> m_Indices;
+    std::vector<uint32_t> m_CornerStart;
+    std::vector<uint32_t> m_Corners;
+
+    std::vector<float> m_FaceX, m_FaceY, m_FaceZ;
+
+    /**
+     * @brief Unit tangent of each triangle, and +1 or -1 for its texture space's handedness, 0 without texture area
+     */
+    std::vector<float> m_TangentX, m_TangentY, m_TangentZ;
+    std::vector<float> m_TangentSign;
+};
+
+/**
+ * @brief Normalize count vectors in place, vectors of length 0 stay 0
+ *
+ * Runs one task per kMeshChunkSize vectors on executor and waits for them.
+ */
+void NormalizeSoA(float* x, float* y, float* z, size_t count, const Executor& executor = InlineExecutor());
+
+#endif
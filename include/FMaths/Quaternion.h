@@ -13,9 +13,13 @@
 #define QUATERNION_H
 
 #include <cstddef>
+#include <cstdint>
+
+#include "Compare.h"
 
 struct Vector3;
 struct Vector4;
+struct Matrix4x4;
 
 struct Quaternion
 {
@@ -49,6 +53,47 @@ struct Quaternion
      */
     Quaternion(const Quaternion& q);
 
+    /**
+     * @brief Extract the rotation from a matrix, inverse of Matrix4x4::QuatRotate
+     * 
+     * Uses Shepperd's method, picking the largest pivot to stay stable for all rotations.
+     * 
+     * @param m Matrix whose upper 3x3 is a pure rotation, use Matrix4x4::Decompose if it is scaled
+     */
+    static Quaternion FromMatrix(const Matrix4x4& m);
+
+    /**
+     * @brief Batched FromMatrix
+     * 
+     * @param m Array of count rotation matrices
+     * @param out Array of count quaternions
+     */
+    static void FromMatrices(const Matrix4x4* m, Quaternion* out, size_t count);
+
+    /**
+     * @brief Construct from Euler angles in radians
+     * 
+     * Rotates about x, then y, then z, equivalent to qz * qy * qx.
+     */
+    static Quaternion FromEuler(const Vector3& euler);
+
+    /**
+     * @brief Batched FromEuler
+     * 
+     * @param euler Array of count Euler angles in radians
+     * @param out Array of count quaternions
+     */
+    static void FromEulers(const Vector3* euler, Quaternion* out, size_t count);
+
+    /**
+     * @brief Batched axis and rotation constructor
+     * 
+     * @param axes Array of count axes, will be converted to unit vectors if not already
+     * @param r Array of count rotations in radians
+     * @param out Array of count quaternions
+     */
+    static void FromAxisAngles(const Vector3* axes, const float* r, Quaternion* out, size_t count);
+
     float x, y, z, w;
 
     float Magnitude() const;
@@ -58,11 +103,39 @@ struct Quaternion
     Quaternion Normalized() const;
     bool IsNormalized() const;
 
+    /**
+     * @brief Batched first order renormalization without sqrt, in place
+     * 
+     * Scales by (3 - |q|^2) / 2, the first order expansion of 1 / |q| about 1.
+     * Only valid for quaternions which have drifted slightly from unit length,
+     * an error e in |q|^2 is reduced to roughly 3e^2 / 4.
+     */
+    static void Renormalize(Quaternion* q, size_t count);
+
     float Dot(const Quaternion& q) const;
 
     Vector3 Apply(const Vector3& v) const;
     Vector4 Apply(const Vector4& v) const;
 
+    /**
+     * @brief Rotate many vectors by this quaternion
+     * 
+     * Agrees with Apply to within a few ULP of |v|, but is not bitwise identical.
+     * 
+     * @param v Array of count vectors
+     * @param out Array of count rotated vectors, may alias v
+     */
+    void Apply(const Vector3* v, Vector3* out, size_t count) const;
+
+    /**
+     * @brief Batched Apply, rotating each v[i] by q[i]
+     * 
+     * @param q Array of count rotations
+     * @param v Array of count vectors
+     * @param out Array of count rotated vectors, may alias v
+     */
+    static void Apply(const Quaternion* q, const Vector3* v, Vector3* out, size_t count);
+
     Quaternion operator*(float s) const;
     Quaternion operator/(float s) const;
     
@@ -84,6 +157,18 @@ struct Quaternion
     bool operator==(const Quaternion& q) const;
     bool operator!=(const Quaternion& q) const;
 
+    /**
+     * @brief Every component ApproxEqual, see Compare.h
+     * 
+     * @note q and -q are the same rotation but do not compare equal
+     */
+    bool ApproxEqual(const Quaternion& q, float epsilon = kApproxEpsilon) const;
+
+    /**
+     * @brief Every component within maxUlps
+     */
+    bool UlpEqual(const Quaternion& q, uint32_t maxUlps = 4) const;
+
     float& operator[](size_t i);
     const float& operator[](size_t i) const;
 };
@@ -0,0 +1,79 @@
+/**
+ * @file Reduce.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Parallel reductions over point arrays, bounds, centroid, covariance and OBB fitting
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef REDUCE_H
+#define REDUCE_H
+
+#include <cstddef>
+
+#include "Async.h"
+#include "Geometry.h"
+#include "Matrix3x3.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+/**
+ * @brief Elements per chunk of every reduction
+ *
+ * Chunks are reduced independently and their results combined in chunk order,
+ * so a result depends only on the input, never on the executor, how many
+ * threads it has or the build's SIMD width.
+ */
+constexpr size_t kReduceChunkSize = 4096;
+
+// Each reduction runs its chunks through ParallelFor
+
+/**
+ * @brief Per component minimum and maximum, NaN components are ignored
+ *
+ * @param min, max Set to +/-INFINITY when count is 0
+ */
+void MinMax(const Vector3* points, size_t count, Vector3& min, Vector3& max, const Executor& executor = InlineExecutor());
+void MinMax(const Vector4* points, size_t count, Vector4& min, Vector4& max, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief MinMax as a box
+ */
+AABB Bounds(const Vector3* points, size_t count, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Sum of all points
+ *
+ * Each chunk sums in float lanes, chunks are combined in double.
+ */
+Vector3 Sum(const Vector3* points, size_t count, const Executor& executor = InlineExecutor());
+Vector4 Sum(const Vector4* points, size_t count, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Centroid, 0 when count is 0
+ */
+Vector3 Mean(const Vector3* points, size_t count, const Executor& executor = InlineExecutor());
+Vector4 Mean(const Vector4* points, size_t count, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Population covariance about the mean
+ *
+ * Takes two passes, the mean then products of offsets from it, so points far
+ * from the origin do not lose precision.
+ *
+ * @param mean Set to the mean if not null
+ */
+Matrix3x3 Covariance(const Vector3* points, size_t count, Vector3* mean = nullptr, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Box aligned to the principal axes of the points
+ *
+ * Axes are the eigenvectors of the covariance, largest variance first, and
+ * form a right handed basis. The extents tightly bound every point.
+ */
+OBB FitOBB(const Vector3* points, size_t count, const Executor& executor = InlineExecutor());
+
+#endif
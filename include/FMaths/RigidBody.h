@@ -0,0 +1,110 @@
+/**
+ * @file RigidBody.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Structure of arrays rigid body state, and batched Euler and RK4 integrators
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef RIGIDBODY_H
+#define RIGIDBODY_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Async.h"
+#include "Matrix4x4.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+
+/**
+ * @brief Growable structure of arrays rigid body storage
+ *
+ * Velocities, forces and torques are in world space. Inertia is stored as
+ * the inverse of the principal moments in body space, an inverse mass or
+ * moment of 0 makes the body immovable along it.
+ */
+struct RigidBodyArray
+{
+    std::vector<float> px, py, pz;
+    std::vector<float> qx, qy, qz, qw;
+    std::vector<float> vx, vy, vz;
+    std::vector<float> wx, wy, wz;
+    std::vector<float> fx, fy, fz;
+    std::vector<float> tx, ty, tz;
+    std::vector<float> invMass;
+    std::vector<float> ix, iy, iz;
+
+    /**
+     * @param orientation Unit body to world rotation
+     * @param invInertia Inverse principal moments of inertia in body space
+     */
+    void Push(const Vector3& position, const Quaternion& orientation, float invMass, const Vector3& invInertia,
+        const Vector3& velocity = Vector3(), const Vector3& angularVelocity = Vector3());
+
+    void Clear();
+    void Reserve(size_t n);
+    size_t Size() const;
+
+    /**
+     * @brief Zero every force and torque, integrating leaves them as they are
+     */
+    void ClearForces();
+
+    Vector3 Position(size_t i) const;
+    Quaternion Orientation(size_t i) const;
+    Vector3 Velocity(size_t i) const;
+    Vector3 AngularVelocity(size_t i) const;
+};
+
+/**
+ * @brief Bodies per task of every integrator
+ */
+constexpr size_t kIntegrateChunkSize = 1024;
+
+// Integrators run their chunks through ParallelFor. Bodies are independent,
+// so results don't depend on the executor.
+//
+// Orientations are advanced along dq/dt = (w, 0) q / 2 then pulled back to
+// unit length with one Newton step of 1/sqrt, which needs neither a square
+// root nor a division. A semi-implicit Euler step turning a body by theta
+// radians leaves it around theta^4 / 40 off unit length, RK4 far less.
+
+/**
+ * @brief Semi-implicit Euler step, velocities first then positions and orientations
+ *
+ * Leaves out the gyroscopic torque, which explicitly integrated adds energy
+ * to spinning bodies.
+ *
+ * @param gravity Acceleration applied to every body with a non-zero inverse mass
+ */
+void IntegrateEuler(RigidBodyArray& bodies, const Vector3& gravity, float dt, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Classic fourth order Runge-Kutta step, forces and torques held over the step
+ *
+ * Includes the gyroscopic torque, so torque free bodies tumble while keeping
+ * their angular momentum. Axes with an inverse moment of 0 don't turn.
+ */
+void IntegrateRK4(RigidBodyArray& bodies, const Vector3& gravity, float dt, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief World space inverse inertia tensor of each body, R diag(i) R^T
+ *
+ * @param out Array of bodies.Size() matrices, the tensor in the upper 3x3 block and identity elsewhere
+ */
+void WorldInverseInertia(const RigidBodyArray& bodies, Matrix4x4* out, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Rotate count inertia tensors into world space, R M R^T on the upper 3x3 blocks
+ *
+ * For tensors which aren't diagonal in body space. q should be unit quaternions.
+ *
+ * @param out Tensors in the upper 3x3 blocks and identity elsewhere, may alias local
+ */
+void RotateInertia(const Quaternion* q, const Matrix4x4* local, Matrix4x4* out, size_t count, const Executor& executor = InlineExecutor());
+
+#endif
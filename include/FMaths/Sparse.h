@@ -0,0 +1,158 @@
+/**
+ * @file Sparse.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Block sparse matrices of 3x3 blocks over Vector3 arrays, and iterative solvers
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SPARSE_H
+#define SPARSE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Async.h"
+#include "Matrix3x3.h"
+#include "Vector3.h"
+
+/**
+ * @brief One 3x3 block at block row and column, as assembled from springs or constraints
+ */
+struct BlockEntry
+{
+    uint32_t row, col;
+    Matrix3x3 block;
+};
+
+/**
+ * @brief Square matrix of 3x3 blocks in compressed sparse rows
+ *
+ * Block row i couples Vector3 i to the Vector3s of its columns. Columns are
+ * sorted within each row. The structure is fixed on construction, values can
+ * be changed in place, e.g. stiffness recomputed every frame.
+ *
+ * Rows are also grouped into colors, no two rows of a color referencing each
+ * other, so GaussSeidel can sweep a color's rows in parallel. That needs a
+ * structurally symmetric matrix, which any matrix the solvers converge on is.
+ */
+struct BlockSparseMatrix
+{
+public:
+    BlockSparseMatrix();
+
+    /**
+     * @param blockRows Rows and columns, in blocks
+     * @param entries count blocks in any order, blocks at the same position are summed
+     */
+    BlockSparseMatrix(size_t blockRows, const BlockEntry* entries, size_t count);
+
+    size_t BlockRows() const;
+    size_t BlockCount() const;
+
+    /**
+     * @brief Index of the block at row and col, or BlockCount() if it isn't in the structure
+     */
+    size_t Find(size_t row, size_t col) const;
+
+    Matrix3x3 Block(size_t index) const;
+    void SetBlock(size_t index, const Matrix3x3& block);
+    void AddBlock(size_t index, const Matrix3x3& block);
+
+    /**
+     * @brief Zero every block, keeping the structure
+     */
+    void ZeroBlocks();
+
+    /**
+     * @brief Blocks of row i are [RowStart()[i], RowStart()[i + 1])
+     */
+    const uint32_t* RowStart() const;
+    const uint32_t* Columns() const;
+
+    /**
+     * @brief 12 floats per block, three columns padded to four floats
+     */
+    const float* Values() const;
+
+    size_t ColorCount() const;
+
+    /**
+     * @brief Rows of color c are ColorRows()[ColorStart()[c]] to ColorRows()[ColorStart()[c + 1] - 1]
+     */
+    const uint32_t* ColorStart() const;
+    const uint32_t* ColorRows() const;
+
+private:
+    size_t m_BlockRows;
+    std::vector<uint32_t> m_RowStart;
+    std::vector<uint32_t> m_Columns;
+    std::vector<float> m_Values;
+    std::vector<uint32_t> m_ColorStart;
+    std::vector<uint32_t> m_ColorRows;
+};
+
+/**
+ * @brief Rows per task of every sparse operation
+ */
+constexpr size_t kSparseChunkSize = 1024;
+
+// Operations run their chunks through ParallelFor. Dot products are summed
+// per chunk and combined in chunk order, so results don't depend on the
+// executor or the build's SIMD width.
+//
+// Vectors are arrays of BlockRows() Vector3s. Diagonal blocks which can't
+// be inverted leave their rows unchanged in the Jacobi preconditioner and
+// iterations.
+
+/**
+ * @brief out = a x
+ *
+ * @param out Can't alias x
+ */
+void Multiply(const BlockSparseMatrix& a, const Vector3* x, Vector3* out, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Result of an iterative solve
+ */
+struct SolveResult
+{
+    size_t iterations;
+
+    /**
+     * @brief |b - a x| / |b|, as tracked by the solver
+     */
+    float residual;
+};
+
+/**
+ * @brief Block Jacobi preconditioned conjugate gradient for symmetric positive definite a
+ *
+ * Stops once the relative residual is at most tolerance.
+ *
+ * @param x Starting guess, overwritten with the solution
+ */
+SolveResult ConjugateGradient(const BlockSparseMatrix& a, const Vector3* b, Vector3* x, size_t maxIterations, float tolerance,
+    const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Block Jacobi iterations, every row updated from the previous iterate
+ *
+ * Converges for block diagonally dominant a. Every row is independent, so
+ * this parallelises fully but converges slower than GaussSeidel.
+ */
+void Jacobi(const BlockSparseMatrix& a, const Vector3* b, Vector3* x, size_t iterations, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Block Gauss-Seidel iterations, sweeping rows color by color
+ *
+ * Converges for symmetric positive definite a. Rows of one color run in
+ * parallel, so the result depends on the coloring, not on the executor.
+ */
+void GaussSeidel(const BlockSparseMatrix& a, const Vector3* b, Vector3* x, size_t iterations, const Executor& executor = InlineExecutor());
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file SpatialHash.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Uniform hash grid over Vector3 points for radius queries, rebuilt every frame
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SPATIALHASH_H
+#define SPATIALHASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Async.h"
+#include "Vector3.h"
+
+/**
+ * @brief Points per task of SpatialHashGrid's builds and batch queries
+ */
+constexpr size_t kGridChunkSize = 4096;
+
+/**
+ * @brief Points sorted by the hash of their grid cell, in structure of arrays
+ *
+ * Cells are hashed into a power of two table of buckets at least as large as
+ * the point count, and points are sorted by bucket, then by index, with a
+ * stable radix sort. The hash gives cells next to each other along x
+ * consecutive buckets, so points near each other in space are mostly near
+ * each other in the sorted arrays, and iterating over slots rather than
+ * original indices keeps neighbours in cache.
+ *
+ * Queries test every point in the buckets of the cells the radius touches,
+ * lanes at a time, a run of consecutive buckets as one range. A radius up to
+ * the cell size touches at most 27 cells, larger radii more. Cells which
+ * share a bucket are only visited once.
+ */
+struct SpatialHashGrid
+{
+public:
+    /**
+     * @param cellSize Grid spacing, ideally around the query radius
+     */
+    explicit SpatialHashGrid(float cellSize);
+
+    /**
+     * @brief Sort count points into the grid, replacing any earlier build
+     *
+     * Runs one task per kGridChunkSize points on executor and waits for them.
+     * The result doesn't depend on the executor. NaN points are never found.
+     *
+     * @param count Fewer than 2^32
+     */
+    void Build(const Vector3* points, size_t count, const Executor& executor = InlineExecutor());
+
+    size_t Count() const;
+    float CellSize() const;
+    size_t BucketCount() const;
+
+    /**
+     * @brief Positions in sorted order, Count() of each
+     */
+    const float* X() const;
+    const float* Y() const;
+    const float* Z() const;
+
+    /**
+     * @brief Original index of the point in each slot
+     */
+    const uint32_t* Indices() const;
+
+    /**
+     * @brief Append the slots of every point within radius of p, inclusive, to out
+     */
+    void Query(const Vector3& p, float radius, std::vector<uint32_t>& out) const;
+
+    /**
+     * @brief Neighbours within radius of every point, other than itself, by slot
+     *
+     * Slot s's neighbours are slots neighbors[offsets[s]] to neighbors[offsets[s + 1] - 1].
+     * Runs one task per kGridChunkSize points on executor and waits for them.
+     *
+     * @param offsets Resized to Count() + 1
+     * @param neighbors Resized to the total number of neighbours
+     */
+    void FindNeighbors(float radius, std::vector<uint32_t>& offsets, std::vector<uint32_t>& neighbors,
+        const Executor& executor = InlineExecutor()) const;
+
+private:
+    /**
+     * @brief Slot ranges of the buckets of cells from lo to hi inclusive, as sorted begin, end pairs
+     */
+    void CollectRanges(const int32_t (&lo)[3], const int32_t (&hi)[3], std::vector<uint32_t>& ranges) const;
+
+    /**
+     * @brief Append the slots in ranges within radius of p to out, skipping slot skip
+     */
+    void Filter(const std::vector<uint32_t>& ranges, const Vector3& p, float radius, size_t skip, std::vector<uint32_t>& out) const;
+
+    float m_CellSize;
+    float m_InvCellSize;
+    size_t m_Count;
+    uint32_t m_BucketBits;
+
+    /**
+     * @brief Slots of bucket b are [m_BucketStart[b], m_BucketStart[b + 1])
+     */
+    std::vector<uint32_t> m_BucketStart;
+
+    std::vector<float> m_X, m_Y, m_Z;
+    std::vector<uint32_t> m_Indices;
+
+    /**
+     * @brief Bucket of each slot, and sort scratch
+     */
+    std::vector<uint32_t> m_Keys;
+    std::vector<uint32_t> m_ScratchKeys;
+    std::vector<uint32_t> m_ScratchIndices;
+    std::vector<uint32_t> m_Histogram;
+};
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @file SpatialSort.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Morton and Hilbert codes of Vector3 points, and sorting point arrays along them for locality
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SPATIALSORT_H
+#define SPATIALSORT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Async.h"
+#include "Geometry.h"
+#include "Vector3.h"
+
+/**
+ * @brief Space filling curve used to order points
+ *
+ * Both visit every cell of an octree level before the next one. Morton codes
+ * interleave the coordinates' bits and are cheaper, Hilbert codes never jump
+ * between cells that aren't neighbours so keep slightly more locality.
+ */
+enum class SpaceCurve
+{
+    Morton,
+    Hilbert
+};
+
+/**
+ * @brief Points per task of every batched encode and sort
+ */
+constexpr size_t kSortChunkSize = 4096;
+
+// Codes of cell coordinates, 10 bits per axis for 30 bit codes and 21 for 63 bit.
+// Higher coordinate bits are ignored. x is the lowest bit of each Morton triple.
+// Built with FMATHS_BMI2, Morton interleaving uses pdep.
+
+uint32_t Morton30(uint32_t x, uint32_t y, uint32_t z);
+uint64_t Morton63(uint32_t x, uint32_t y, uint32_t z);
+uint32_t Hilbert30(uint32_t x, uint32_t y, uint32_t z);
+uint64_t Hilbert63(uint32_t x, uint32_t y, uint32_t z);
+
+/**
+ * @brief Codes of points quantized to a grid of 2^10 or 2^21 cells per axis over bounds
+ *
+ * Each axis is scaled to bounds separately. Points outside bounds are clamped
+ * to its edges, and NaN components go to cell 0. Runs one task per
+ * kSortChunkSize points on executor and waits for them.
+ *
+ * @param codes Array of count codes
+ */
+void EncodePoints(const Vector3* points, size_t count, const AABB& bounds, SpaceCurve curve, uint32_t* codes,
+    const Executor& executor = InlineExecutor());
+void EncodePoints(const Vector3* points, size_t count, const AABB& bounds, SpaceCurve curve, uint64_t* codes,
+    const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Order of codes from smallest to largest, by a stable parallel radix sort
+ *
+ * The result doesn't depend on the executor.
+ *
+ * @param permutation Array of count indices, permutation[i] is the index of the i-th smallest code
+ */
+void SortCodes(const uint32_t* codes, size_t count, uint32_t* permutation, const Executor& executor = InlineExecutor());
+void SortCodes(const uint64_t* codes, size_t count, uint32_t* permutation, const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Reorder points in place along curve over their bounds, with 30 bit codes
+ *
+ * @param permutation Array of count indices, set to the original index of each reordered point
+ */
+void SpatialSort(Vector3* points, size_t count, uint32_t* permutation, SpaceCurve curve = SpaceCurve::Hilbert,
+    const Executor& executor = InlineExecutor());
+
+/**
+ * @brief Gather out[i] = in[permutation[i]], so attributes follow their points
+ *
+ * in and out must not overlap.
+ */
+template<typename T>
+void Permute(const T* in, const uint32_t* permutation, size_t count, T* out, const Executor& executor = InlineExecutor())
+{
+    ParallelFor(count, kSortChunkSize, executor, [in, permutation, out](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            out[i] = in[permutation[i]];
+    });
+}
+
+#endif
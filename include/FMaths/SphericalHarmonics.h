@@ -0,0 +1,114 @@
+/**
+ * @file SphericalHarmonics.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Low order spherical harmonics for lighting
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SPHERICALHARMONICS_H
+#define SPHERICALHARMONICS_H
+
+#include <cstddef>
+
+#include "Vector3.h"
+
+struct Quaternion;
+struct Matrix4x4;
+
+/**
+ * @brief RGB function on the sphere projected onto the real SH basis
+ *
+ * Basis functions are ordered by band, l = 0 then l = 1 (y, z, x) then
+ * l = 2 (xy, yz, 3z^2 - 1, xz, x^2 - y^2), without the Condon-Shortley phase.
+ *
+ * Scalar and batched functions agree bit for bit, except AddSamples which
+ * sums lanes separately so differs from repeated AddSample by rounding.
+ *
+ * @tparam Order Number of bands, 2 or 3
+ */
+template<size_t Order>
+struct SphericalHarmonics
+{
+    static_assert(Order == 2 || Order == 3, "Only order 2 and 3 are supported");
+
+    static constexpr size_t Count = Order * Order;
+
+    /**
+     * @brief All coefficients 0
+     */
+    SphericalHarmonics();
+
+    Vector3 coefficients[Count];
+
+    /**
+     * @brief Accumulate radiance arriving from a direction
+     *
+     * @param direction Unit direction
+     * @param weight Solid angle the sample represents, 4pi / n for n uniform samples of the sphere
+     */
+    void AddSample(const Vector3& direction, const Vector3& radiance, float weight);
+
+    /**
+     * @brief Batched AddSample
+     *
+     * @param directions Array of count unit directions
+     * @param radiance Array of count samples
+     * @param weights Array of count solid angles
+     */
+    void AddSamples(const Vector3* directions, const Vector3* radiance, const float* weights, size_t count);
+
+    /**
+     * @brief Value in a unit direction
+     */
+    Vector3 Evaluate(const Vector3& direction) const;
+
+    /**
+     * @brief Batched Evaluate
+     *
+     * @param directions Array of count unit directions
+     * @param out Array of count values
+     */
+    void Evaluate(const Vector3* directions, Vector3* out, size_t count) const;
+
+    /**
+     * @brief Convolve with the clamped cosine lobe, turning radiance into irradiance
+     *
+     * Divide the result by pi for the outgoing radiance of a white Lambertian surface.
+     */
+    SphericalHarmonics& ConvolveCosine();
+
+    /**
+     * @brief Rotated copy, so that Rotated(q).Evaluate(q.Apply(d)) == Evaluate(d)
+     */
+    SphericalHarmonics Rotated(const Quaternion& q) const;
+
+    /**
+     * @brief Rotated copy
+     *
+     * @param m Matrix whose upper 3x3 is a pure rotation
+     */
+    SphericalHarmonics Rotated(const Matrix4x4& m) const;
+
+    /**
+     * @brief Batched Rotated, applying the same rotation to many
+     *
+     * @param in Array of count functions
+     * @param out Array of count rotated functions, may alias in
+     */
+    static void Rotate(const SphericalHarmonics* in, SphericalHarmonics* out, size_t count, const Matrix4x4& m);
+
+    SphericalHarmonics operator+(const SphericalHarmonics& sh) const;
+    SphericalHarmonics& operator+=(const SphericalHarmonics& sh);
+
+    SphericalHarmonics operator*(float s) const;
+    SphericalHarmonics& operator*=(float s);
+};
+
+using SH2 = SphericalHarmonics<2>;
+using SH3 = SphericalHarmonics<3>;
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * @file Swizzle.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Compile time swizzles of Vector2, Vector3 and Vector4
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SWIZZLE_H
+#define SWIZZLE_H
+
+#include <cstddef>
+#include <utility>
+
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+// Components are named by index, x = 0 to w = 3, so shader code's v.zyx is
+// Swizzle<2, 1, 0>(v). Indices are checked at compile time and everything is
+// inline, so a swizzle of a vector in a register compiles to a shuffle, or to
+// nothing when the compiler can rename the components instead.
+
+/**
+ * @brief Vector type with N components
+ */
+template<size_t N>
+struct SwizzleVector;
+
+template<> struct SwizzleVector<2> { using Type = Vector2; };
+template<> struct SwizzleVector<3> { using Type = Vector3; };
+template<> struct SwizzleVector<4> { using Type = Vector4; };
+
+template<typename V>
+constexpr size_t kSwizzleComponents = sizeof(V) / sizeof(float);
+
+/**
+ * @brief Whether no index repeats, for swizzles which are written to
+ */
+template<size_t... I>
+constexpr bool SwizzleDistinct()
+{
+    const size_t index[] = {I...};
+
+    for (size_t i = 0; i < sizeof...(I); i++)
+        for (size_t j = i + 1; j < sizeof...(I); j++)
+            if (index[i] == index[j])
+                return false;
+
+    return true;
+}
+
+/**
+ * @brief Component I of v, resolved at compile time rather than through operator[]
+ */
+template<size_t I, typename V>
+const float& SwizzleComponent(const V& v)
+{
+    static_assert(I < kSwizzleComponents<V>, "Swizzle index out of range for this vector");
+
+    if constexpr (I == 0)
+        return v.x;
+    else if constexpr (I == 1)
+        return v.y;
+    else if constexpr (I == 2)
+        return v.z;
+    else
+        return v.w;
+}
+
+template<size_t I, typename V>
+float& SwizzleComponent(V& v)
+{
+    return const_cast<float&>(SwizzleComponent<I>(static_cast<const V&>(v)));
+}
+
+/**
+ * @brief Vector of v's components I..., e.g. Swizzle<2, 1, 0>(v) for v.zyx
+ *
+ * Returns a Vector2, Vector3 or Vector4 by the number of indices. Indices may repeat.
+ */
+template<size_t... I, typename V>
+typename SwizzleVector<sizeof...(I)>::Type Swizzle(const V& v)
+{
+    return typename SwizzleVector<sizeof...(I)>::Type(SwizzleComponent<I>(v)...);
+}
+
+template<size_t... I, size_t... K, typename V, typename S>
+void SetSwizzle(V& v, const S& s, std::index_sequence<K...>)
+{
+    ((SwizzleComponent<I>(v) = SwizzleComponent<K>(s)), ...);
+}
+
+/**
+ * @brief Write s into v's components I..., e.g. SetSwizzle<2, 0>(v, s) for v.zx = s
+ *
+ * Components not named are left as they are. s may be v.
+ */
+template<size_t... I, typename V, typename S>
+void SetSwizzle(V& v, const S& s)
+{
+    static_assert(sizeof...(I) == kSwizzleComponents<S>, "Swizzle needs one index per component of the value");
+    static_assert(SwizzleDistinct<I...>(), "Swizzle written to can't repeat a component");
+
+    // Copied first in case s is v, free otherwise
+    const S value(s);
+    SetSwizzle<I...>(v, value, std::make_index_sequence<sizeof...(I)>());
+}
+
+#endif
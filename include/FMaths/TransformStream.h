@@ -0,0 +1,139 @@
+/**
+ * @file TransformStream.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Multi-buffered instance data re-encoded only where matrices change
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef TRANSFORMSTREAM_H
+#define TRANSFORMSTREAM_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Async.h"
+#include "Matrix4x4.h"
+
+/**
+ * @brief Layout of one instance in a TransformStream buffer
+ */
+enum class InstanceFormat
+{
+    /**
+     * @brief 16 floats, column major as Matrix4x4
+     */
+    Full4x4,
+
+    /**
+     * @brief 12 floats, the top three rows in row major order, for affine transforms
+     */
+    Affine3x4
+};
+
+/**
+ * @brief Instances [begin, end)
+ */
+struct DirtyRange
+{
+    size_t begin, end;
+};
+
+/**
+ * @brief Matrices per task of TransformStream::Update
+ */
+constexpr size_t kStreamChunkSize = 1024;
+
+/**
+ * @brief Ring of instance buffers kept in step with an array of world matrices
+ *
+ * Each Update compares the matrices bit for bit against the previous frame's,
+ * moves on to the next buffer and re-encodes only the instances that buffer
+ * is missing, the changes of this frame and of the frames since the buffer
+ * was last written. With two or three buffers the GPU can read one while the
+ * next is written.
+ *
+ * Matrices count as changed when any bit differs, so an unchanged NaN stays
+ * clean and 0 becoming -0 is a change.
+ */
+struct TransformStream
+{
+public:
+    /**
+     * @param bufferCount Buffers in the ring, at least 1
+     * @param mergeGap Reported ranges separated by up to this many clean instances are joined, trading bytes for fewer copies
+     */
+    explicit TransformStream(InstanceFormat format, size_t bufferCount = 2, size_t mergeGap = 0);
+
+    /**
+     * @brief Write this frame's matrices to the next buffer
+     *
+     * A change of count re-encodes everything in every buffer. Runs one task
+     * per kStreamChunkSize matrices on executor and waits for them.
+     */
+    void Update(const Matrix4x4* matrices, size_t count, const Executor& executor = InlineExecutor());
+
+    /**
+     * @brief Re-encode every instance of every buffer from the next Update, e.g. after the GPU copies are lost
+     */
+    void Invalidate();
+
+    /**
+     * @brief Buffer written by the last Update, Count() instances of Stride() bytes
+     */
+    const float* Buffer() const;
+
+    size_t BufferIndex() const;
+    size_t BufferCount() const;
+    size_t Count() const;
+    InstanceFormat Format() const;
+
+    /**
+     * @brief Bytes per instance
+     */
+    size_t Stride() const;
+
+    /**
+     * @brief Ranges written to Buffer() by the last Update, sorted, the bytes the uploader needs to copy
+     */
+    const std::vector<DirtyRange>& DirtyRanges() const;
+
+    /**
+     * @brief Ranges whose matrices changed in the last Update, a subset of DirtyRanges() with more than one buffer
+     */
+    const std::vector<DirtyRange>& ChangedRanges() const;
+
+private:
+    InstanceFormat m_Format;
+    size_t m_MergeGap;
+    size_t m_Count;
+    size_t m_Index;
+    bool m_Invalid;
+
+    std::vector<std::vector<float>> m_Buffers;
+
+    /**
+     * @brief Last frame's matrices, 16 floats each
+     */
+    std::vector<float> m_Previous;
+
+    /**
+     * @brief Unmerged changes of the last BufferCount() - 1 frames, oldest first
+     */
+    std::vector<std::vector<DirtyRange>> m_History;
+
+    /**
+     * @brief Changes found by each chunk
+     */
+    std::vector<std::vector<DirtyRange>> m_ChunkRanges;
+
+    std::vector<DirtyRange> m_Pending;
+    std::vector<DirtyRange> m_Scratch;
+    std::vector<DirtyRange> m_Dirty;
+    std::vector<DirtyRange> m_Changed;
+};
+
+#endif
@@ -57,5 +57,37 @@ struct Vector2
     const float& operator[](size_t i) const;
 };
 
+// Construction and assignment are inline so conversions and swizzles compile
+// to register moves rather than calls. The other vectors are included after
+// the definition above, as their inline members need this one complete.
+#include "Vector3.h"
+#include "Vector4.h"
 
-#endif
\ No newline at end of file
+inline Vector2::Vector2():
+    x(0), y(0)
+{}
+
+inline Vector2::Vector2(float x, float y):
+    x(x), y(y)
+{}
+
+inline Vector2::Vector2(const Vector2& v):
+    x(v.x), y(v.y)
+{}
+
+inline Vector2::Vector2(const Vector3& v):
+    x(v.x), y(v.y)
+{}
+
+inline Vector2::Vector2(const Vector4& v):
+    x(v.x), y(v.y)
+{}
+
+inline Vector2& Vector2::operator=(const Vector2& v)
+{
+    x = v.x;
+    y = v.y;
+    return *this;
+}
+
+#endif
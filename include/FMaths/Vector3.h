@@ -13,6 +13,9 @@
 #define VECTOR3_H
 
 #include <cstddef>
+#include <cstdint>
+
+#include "Compare.h"
 
 struct Vector2;
 struct Vector4;
@@ -78,6 +81,23 @@ struct Vector3
      */
     Vector3 Cross(const Vector3& v) const;
 
+    /**
+     * @brief Batched Normalize, in place and bitwise identical to it
+     */
+    static void Normalize(Vector3* v, size_t count);
+
+    /**
+     * @brief Batched dot product, out[i] = a[i].Dot(b[i])
+     */
+    static void Dot(const Vector3* a, const Vector3* b, float* out, size_t count);
+
+    /**
+     * @brief Batched cross product, out[i] = a[i].Cross(b[i])
+     * 
+     * @param out Array of count vectors, may alias a or b
+     */
+    static void Cross(const Vector3* a, const Vector3* b, Vector3* out, size_t count);
+
     // Operators
     // # Arithmetic
     // ## Vector
@@ -98,6 +118,24 @@ struct Vector3
     bool operator==(const Vector3& v) const;
     bool operator!=(const Vector3& v) const;
 
+    /**
+     * @brief Every component ApproxEqual, see Compare.h
+     */
+    bool ApproxEqual(const Vector3& v, float epsilon = kApproxEpsilon) const;
+
+    /**
+     * @brief Every component within maxUlps
+     */
+    bool UlpEqual(const Vector3& v, uint32_t maxUlps = 4) const;
+
+    /**
+     * @brief Hash of the grid cell of size cellSize containing this point
+     * 
+     * Points in the same cell hash equally, so nearby points usually do but
+     * may straddle a cell boundary. Coordinates beyond 2^30 cells are clamped.
+     */
+    size_t QuantizedHash(float cellSize) const;
+
     Vector3& operator=(const Vector3& v);
 
     // # Accessor
@@ -105,4 +143,38 @@ struct Vector3
     const float& operator[](size_t i) const;
 };
 
-#endif
\ No newline at end of file
+// Construction and assignment are inline so conversions and swizzles compile
+// to register moves rather than calls. The other vectors are included after
+// the definition above, as their inline members need this one complete.
+#include "Vector2.h"
+#include "Vector4.h"
+
+inline Vector3::Vector3():
+    x(0), y(0), z(0)
+{}
+
+inline Vector3::Vector3(float x, float y, float z):
+    x(x), y(y), z(z)
+{}
+
+inline Vector3::Vector3(const Vector2& v, float z):
+    x(v.x), y(v.y), z(z)
+{}
+
+inline Vector3::Vector3(const Vector3& v):
+    x(v.x), y(v.y), z(v.z)
+{}
+
+inline Vector3::Vector3(const Vector4& v):
+    x(v.x), y(v.y), z(v.z)
+{}
+
+inline Vector3& Vector3::operator=(const Vector3& v)
+{
+    x = v.x;
+    y = v.y;
+    z = v.z;
+    return *this;
+}
+
+#endif
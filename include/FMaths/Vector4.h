@@ -13,6 +13,9 @@
 #define VECTOR4_H
 
 #include <cstddef>
+#include <cstdint>
+
+#include "Compare.h"
 
 struct Vector2;
 struct Vector3;
@@ -141,6 +144,21 @@ struct Vector4
      */
     bool operator!=(const Vector4& v) const;
 
+    /**
+     * @brief Every component ApproxEqual, see Compare.h
+     */
+    bool ApproxEqual(const Vector4& v, float epsilon = kApproxEpsilon) const;
+
+    /**
+     * @brief Every component within maxUlps
+     */
+    bool UlpEqual(const Vector4& v, uint32_t maxUlps = 4) const;
+
+    /**
+     * @brief Hash of the 4D grid cell of size cellSize containing this point, see Vector3::QuantizedHash
+     */
+    size_t QuantizedHash(float cellSize) const;
+
     /**
      * @brief Assignment operator
      */
@@ -157,4 +175,39 @@ struct Vector4
     const float& operator[](size_t i) const;
 };
 
-#endif
\ No newline at end of file
+// Construction and assignment are inline so conversions and swizzles compile
+// to register moves rather than calls. The other vectors are included after
+// the definition above, as their inline members need this one complete.
+#include "Vector2.h"
+#include "Vector3.h"
+
+inline Vector4::Vector4():
+    x(0), y(0), z(0), w(0)
+{}
+
+inline Vector4::Vector4(float x, float y, float z, float w):
+    x(x), y(y), z(z), w(w)
+{}
+
+inline Vector4::Vector4(const Vector2& v, float z, float w):
+    x(v.x), y(v.y), z(z), w(w)
+{}
+
+inline Vector4::Vector4(const Vector3& v, float w):
+    x(v.x), y(v.y), z(v.z), w(w)
+{}
+
+inline Vector4::Vector4(const Vector4& v):
+    x(v.x), y(v.y), z(v.z), w(v.w)
+{}
+
+inline Vector4& Vector4::operator=(const Vector4& v)
+{
+    x = v.x;
+    y = v.y;
+    z = v.z;
+    w = v.w;
+    return *this;
+}
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file Weld.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Vertex welding using a hash grid
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef WELD_H
+#define WELD_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vector3.h"
+
+/**
+ * @brief Merge vertices that lie within tolerance of each other
+ *
+ * Vertices are visited in order, each joins the earliest unique vertex within
+ * tolerance or becomes a new one. Candidates are found through a hash grid with
+ * cells twice the tolerance wide, so the cost is linear in count for any mesh
+ * that is not packed far more densely than the tolerance. With no tolerance
+ * positions are hashed directly, linear for any mesh. NaN vertices are never
+ * merged.
+ *
+ * @param vertices Array of count vertices, fewer than 2^32
+ * @param tolerance Maximum distance between merged vertices, 0 or less only merges identical positions
+ * @param remap Array of count, set to the index in unique each vertex became
+ * @param unique Array of count, receives the unique vertices in order of first appearance. May alias vertices
+ * @return Number of unique vertices
+ */
+size_t WeldVertices(const Vector3* vertices, size_t count, float tolerance, uint32_t* remap, Vector3* unique);
+
+#endif
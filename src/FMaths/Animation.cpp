@@ -0,0 +1,388 @@
+#include "FMaths/Animation.h"
+
+#include <math.h>
+#include <algorithm>
+#include <cassert>
+
+#include "Kernels.h"
+
+namespace
+{
+
+/**
+ * @brief Per joint arrays in PoseSampler's scratch, start key, end key and blend factor per channel
+ */
+enum Stream
+{
+    TranslationA, TranslationB = TranslationA + 3, TranslationAlpha = TranslationB + 3,
+    RotationA, RotationB = RotationA + 4, RotationAlpha = RotationB + 4,
+    ScaleA, ScaleB = ScaleA + 3, ScaleAlpha = ScaleB + 3,
+    StreamCount
+};
+
+std::vector<float>& Component(AnimationChannel& channel, size_t k)
+{
+    std::vector<float>* components[] = {&channel.x, &channel.y, &channel.z, &channel.w};
+    return *components[k];
+}
+
+const std::vector<float>& Component(const AnimationChannel& channel, size_t k)
+{
+    const std::vector<float>* components[] = {&channel.x, &channel.y, &channel.z, &channel.w};
+    return *components[k];
+}
+
+/**
+ * @brief Replace joint's keys, each key is components consecutive floats
+ */
+void SetTrack(AnimationChannel& channel, size_t joint, const float* times, const float* keys, size_t components, size_t count)
+{
+    assert(joint + 1 < channel.offsets.size());
+
+    for (size_t i = 1; i < count; i++)
+        assert(times[i] > times[i - 1]);
+
+    size_t begin = channel.offsets[joint];
+    size_t end = channel.offsets[joint + 1];
+
+    channel.times.erase(channel.times.begin() + begin, channel.times.begin() + end);
+    channel.times.insert(channel.times.begin() + begin, times, times + count);
+
+    for (size_t k = 0; k < components; k++)
+    {
+        std::vector<float>& c = Component(channel, k);
+        c.erase(c.begin() + begin, c.begin() + end);
+        c.insert(c.begin() + begin, count, 0.f);
+
+        for (size_t i = 0; i < count; i++)
+            c[begin + i] = keys[(i * components) + k];
+    }
+
+    for (size_t j = joint + 1; j < channel.offsets.size(); j++)
+        channel.offsets[j] = static_cast<uint32_t>(channel.offsets[j] - (end - begin) + count);
+}
+
+/**
+ * @brief Find the keys either side of time and the blend between them
+ *
+ * Unless search is set, cursor must be a key at or before time and is
+ * stepped forward. Outside the keys, both are the end key and alpha is 0.
+ *
+ * @return false when the track is empty
+ */
+bool FindKeys(const AnimationChannel& channel, size_t joint, float time, bool search, uint32_t& cursor, size_t& a, size_t& b, float& alpha)
+{
+    size_t begin = channel.offsets[joint];
+    size_t n = channel.offsets[joint + 1] - begin;
+
+    if (n == 0)
+        return false;
+
+    const float* t = channel.times.data() + begin;
+    alpha = 0.f;
+
+    // Also catches NaN
+    if (n == 1 || !(time > t[0]))
+    {
+        cursor = 0;
+        a = b = begin;
+        return true;
+    }
+
+    if (time >= t[n - 1])
+    {
+        cursor = static_cast<uint32_t>(n - 2);
+        a = b = begin + n - 1;
+        return true;
+    }
+
+    size_t k = cursor;
+
+    if (search || k + 1 >= n)
+        k = static_cast<size_t>(std::upper_bound(t, t + n, time) - t) - 1;
+    else
+        while (t[k + 1] <= time)
+            k++;
+
+    cursor = static_cast<uint32_t>(k);
+    a = begin + k;
+    b = a + 1;
+    alpha = (time - t[k]) / (t[k + 1] - t[k]);
+    return true;
+}
+
+/**
+ * @brief Write every joint's keys for a channel into the scratch streams, identity for empty tracks
+ */
+void GatherKeys(const AnimationChannel& channel, size_t joints, float time, bool search, uint32_t* cursors,
+    const float* identity, size_t components, float* streams)
+{
+    const float* c[4];
+    for (size_t k = 0; k < components; k++)
+        c[k] = Component(channel, k).data();
+
+    float* keyA = streams;
+    float* keyB = streams + (components * joints);
+    float* blend = streams + (2 * components * joints);
+
+    for (size_t j = 0; j < joints; j++)
+    {
+        size_t a, b;
+        float alpha;
+
+        if (!FindKeys(channel, j, time, search, cursors[j], a, b, alpha))
+        {
+            for (size_t k = 0; k < components; k++)
+            {
+                keyA[(k * joints) + j] = identity[k];
+                keyB[(k * joints) + j] = identity[k];
+            }
+
+            blend[j] = 0.f;
+            continue;
+        }
+
+        for (size_t k = 0; k < components; k++)
+        {
+            keyA[(k * joints) + j] = c[k][a];
+            keyB[(k * joints) + j] = c[k][b];
+        }
+
+        blend[j] = alpha;
+    }
+}
+
+template<typename F>
+F Lerp(F a, F b, F alpha)
+{
+    return MulAdd(b - a, alpha, a);
+}
+
+/**
+ * @brief Blend W joints from the scratch streams into the pose
+ */
+template<typename F>
+void BlendLanes(const float* s, size_t joints, size_t i, Pose& pose)
+{
+    auto load = [&](size_t stream) { return F::Load(s + (stream * joints) + i); };
+
+    F alpha = load(TranslationAlpha);
+    Lerp(load(TranslationA), load(TranslationB), alpha).Store(pose.tx.data() + i);
+    Lerp(load(TranslationA + 1), load(TranslationB + 1), alpha).Store(pose.ty.data() + i);
+    Lerp(load(TranslationA + 2), load(TranslationB + 2), alpha).Store(pose.tz.data() + i);
+
+    alpha = load(ScaleAlpha);
+    Lerp(load(ScaleA), load(ScaleB), alpha).Store(pose.sx.data() + i);
+    Lerp(load(ScaleA + 1), load(ScaleB + 1), alpha).Store(pose.sy.data() + i);
+    Lerp(load(ScaleA + 2), load(ScaleB + 2), alpha).Store(pose.sz.data() + i);
+
+    QuaternionLanes<F> a = {load(RotationA), load(RotationA + 1), load(RotationA + 2), load(RotationA + 3)};
+    QuaternionLanes<F> b = {load(RotationB), load(RotationB + 1), load(RotationB + 2), load(RotationB + 3)};
+    alpha = load(RotationAlpha);
+
+    // q and -q are the same rotation, take the shorter arc
+    auto flip = MulAdd(a.w, b.w, MulAdd(a.z, b.z, MulAdd(a.y, b.y, a.x * b.x))) < F::Set(0.f);
+    b = {Select(flip, -b.x, b.x), Select(flip, -b.y, b.y), Select(flip, -b.z, b.z), Select(flip, -b.w, b.w)};
+
+    QuaternionLanes<F> r = {Lerp(a.x, b.x, alpha), Lerp(a.y, b.y, alpha), Lerp(a.z, b.z, alpha), Lerp(a.w, b.w, alpha)};
+    F scale = InvSqrt(MulAdd(r.w, r.w, MulAdd(r.z, r.z, MulAdd(r.y, r.y, r.x * r.x))));
+
+    (r.x * scale).Store(pose.rx.data() + i);
+    (r.y * scale).Store(pose.ry.data() + i);
+    (r.z * scale).Store(pose.rz.data() + i);
+    (r.w * scale).Store(pose.rw.data() + i);
+}
+
+/**
+ * @brief W translation * rotation * scale matrices, the rotation as in Matrix4x4::QuatRotate
+ */
+template<typename F>
+void ComposeLanes(const Pose& pose, size_t i, Matrix4x4* out)
+{
+    QuaternionLanes<F> q = {F::Load(pose.rx.data() + i), F::Load(pose.ry.data() + i), F::Load(pose.rz.data() + i), F::Load(pose.rw.data() + i)};
+    F scale[3] = {F::Load(pose.sx.data() + i), F::Load(pose.sy.data() + i), F::Load(pose.sz.data() + i)};
+
+    F r[3][3];
+    RotationLanes(q, r);
+
+    MatrixLanes<F> m;
+
+    for (size_t col = 0; col < 3; col++)
+    {
+        for (size_t row = 0; row < 3; row++)
+            m.m[col][row] = r[col][row] * scale[col];
+
+        m.m[col][3] = F::Set(0.f);
+    }
+
+    m.m[3][0] = F::Load(pose.tx.data() + i);
+    m.m[3][1] = F::Load(pose.ty.data() + i);
+    m.m[3][2] = F::Load(pose.tz.data() + i);
+    m.m[3][3] = F::Set(1.f);
+
+    m.Store(out + i);
+}
+
+} // namespace
+
+// AnimationChannel
+
+size_t AnimationChannel::KeyCount(size_t joint) const
+{
+    assert(joint + 1 < offsets.size());
+    return offsets[joint + 1] - offsets[joint];
+}
+
+// AnimationClip
+
+AnimationClip::AnimationClip(size_t joints, float duration):
+    duration(duration)
+{
+    translations.offsets.assign(joints + 1, 0);
+    rotations.offsets.assign(joints + 1, 0);
+    scales.offsets.assign(joints + 1, 0);
+}
+
+void AnimationClip::SetTranslations(size_t joint, const float* times, const Vector3* keys, size_t count)
+{
+    SetTrack(translations, joint, times, reinterpret_cast<const float*>(keys), 3, count);
+}
+
+void AnimationClip::SetRotations(size_t joint, const float* times, const Quaternion* keys, size_t count)
+{
+    SetTrack(rotations, joint, times, reinterpret_cast<const float*>(keys), 4, count);
+}
+
+void AnimationClip::SetScales(size_t joint, const float* times, const Vector3* keys, size_t count)
+{
+    SetTrack(scales, joint, times, reinterpret_cast<const float*>(keys), 3, count);
+}
+
+size_t AnimationClip::JointCount() const
+{
+    return translations.offsets.size() - 1;
+}
+
+float AnimationClip::ClipTime(float time, bool loop) const
+{
+    if (!(duration > 0.f))
+        return time == time ? 0.f : time;
+
+    if (loop)
+    {
+        // fmod keeps the sign of time, exact either way
+        float t = fmodf(time, duration);
+        return t < 0.f ? t + duration : t;
+    }
+
+    // Written so NaN falls through
+    return time < 0.f ? 0.f : (time > duration ? duration : time);
+}
+
+// Pose
+
+Pose::Pose(size_t joints)
+{
+    Resize(joints);
+}
+
+void Pose::Resize(size_t joints)
+{
+    for (std::vector<float>* v : {&tx, &ty, &tz, &rx, &ry, &rz, &rw, &sx, &sy, &sz})
+        v->resize(joints);
+}
+
+size_t Pose::JointCount() const
+{
+    return tx.size();
+}
+
+Vector3 Pose::Translation(size_t joint) const
+{
+    assert(joint < JointCount());
+    return Vector3(tx[joint], ty[joint], tz[joint]);
+}
+
+Quaternion Pose::Rotation(size_t joint) const
+{
+    assert(joint < JointCount());
+    return Quaternion(rx[joint], ry[joint], rz[joint], rw[joint]);
+}
+
+Vector3 Pose::Scale(size_t joint) const
+{
+    assert(joint < JointCount());
+    return Vector3(sx[joint], sy[joint], sz[joint]);
+}
+
+// PoseSampler
+
+PoseSampler::PoseSampler(const AnimationClip& clip):
+    m_Clip(&clip),
+    m_Cursors(clip.JointCount() * 3, 0),
+    m_LastTime(NAN),
+    m_Scratch(clip.JointCount() * StreamCount)
+{}
+
+void PoseSampler::Sample(float time, Pose& pose, bool loop)
+{
+    const size_t joints = m_Clip->JointCount();
+    pose.Resize(joints);
+
+    time = m_Clip->ClipTime(time, loop);
+
+    // Cursors only step forward, anything else searches. After Reset NaN compares false so every track searches
+    const bool search = !(time >= m_LastTime);
+    m_LastTime = time;
+
+    static const float zero[3] = {0.f, 0.f, 0.f};
+    static const float one[3] = {1.f, 1.f, 1.f};
+    static const float identity[4] = {0.f, 0.f, 0.f, 1.f};
+
+    float* s = m_Scratch.data();
+    uint32_t* cursors = m_Cursors.data();
+
+    GatherKeys(m_Clip->translations, joints, time, search, cursors, zero, 3, s + (TranslationA * joints));
+    GatherKeys(m_Clip->rotations, joints, time, search, cursors + joints, identity, 4, s + (RotationA * joints));
+    GatherKeys(m_Clip->scales, joints, time, search, cursors + (2 * joints), one, 3, s + (ScaleA * joints));
+
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= joints; i += SimdFloat::Width)
+        BlendLanes<SimdFloat>(s, joints, i, pose);
+
+    for (; i < joints; i++)
+        BlendLanes<ScalarFloat>(s, joints, i, pose);
+}
+
+void PoseSampler::Reset()
+{
+    m_LastTime = NAN;
+}
+
+// Matrices
+
+void LocalMatrices(const Pose& pose, Matrix4x4* out)
+{
+    const size_t joints = pose.JointCount();
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= joints; i += SimdFloat::Width)
+        ComposeLanes<SimdFloat>(pose, i, out);
+
+    for (; i < joints; i++)
+        ComposeLanes<ScalarFloat>(pose, i, out);
+}
+
+void ModelMatrices(const Matrix4x4* local, const int32_t* parents, size_t count, Matrix4x4* model)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        assert(parents[i] < static_cast<int32_t>(i));
+
+        if (parents[i] < 0)
+            model[i] = local[i];
+        else
+            model[i] = model[parents[i]] * local[i];
+    }
+}
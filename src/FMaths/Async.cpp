@@ -0,0 +1,291 @@
+#include "FMaths/Async.h"
+
+#include <atomic>
+#include <cassert>
+
+#include "FMaths/Matrix4x4.h"
+#include "FMaths/Quaternion.h"
+#include "FMaths/Vector3.h"
+
+Executor InlineExecutor()
+{
+    return [](Task task) { task(); };
+}
+
+ThreadPool::ThreadPool(size_t threads):
+    m_Stopping(false)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    if (threads == 0) // unknown
+        threads = 1;
+
+    for (size_t i = 0; i < threads; i++)
+        m_Workers.emplace_back([this]() { Work(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+
+    m_Wake.notify_all();
+
+    for (std::thread& worker : m_Workers)
+        worker.join();
+}
+
+void ThreadPool::Submit(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Queue.push_back(std::move(task));
+    }
+
+    m_Wake.notify_one();
+}
+
+Executor ThreadPool::GetExecutor()
+{
+    return [this](Task task) { Submit(std::move(task)); };
+}
+
+size_t ThreadPool::Size() const
+{
+    return m_Workers.size();
+}
+
+void ThreadPool::Work()
+{
+    for (;;)
+    {
+        Task task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Wake.wait(lock, [this]() { return m_Stopping || !m_Queue.empty(); });
+
+            // Drain the queue before stopping so no submitted task is lost
+            if (m_Queue.empty())
+                return;
+
+            task = std::move(m_Queue.front());
+            m_Queue.pop_front();
+        }
+
+        task();
+    }
+}
+
+struct BatchHandle::State
+{
+    std::atomic<size_t> pending;
+    bool finished = false; // chunks and continuations done, guarded by mutex
+    std::mutex mutex;
+    std::condition_variable done;
+    std::vector<Task> continuations;
+    std::vector<BatchHandle> dependents; // each completed once finished
+};
+
+BatchHandle::BatchHandle():
+    BatchHandle(0)
+{}
+
+BatchHandle::BatchHandle(size_t pending):
+    m_State(std::make_shared<State>())
+{
+    m_State->pending = pending;
+    m_State->finished = (pending == 0);
+}
+
+bool BatchHandle::Ready() const
+{
+    std::lock_guard<std::mutex> lock(m_State->mutex);
+    return m_State->finished;
+}
+
+void BatchHandle::Wait() const
+{
+    std::unique_lock<std::mutex> lock(m_State->mutex);
+    m_State->done.wait(lock, [this]() { return m_State->finished; });
+}
+
+void BatchHandle::Then(Task task) const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_State->mutex);
+        if (!m_State->finished)
+        {
+            m_State->continuations.push_back(std::move(task));
+            return;
+        }
+    }
+
+    task();
+}
+
+void BatchHandle::Complete() const
+{
+    assert(m_State->pending > 0);
+
+    if (m_State->pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    // Last chunk. Continuations are still queued until finished is set, so
+    // keep draining until none are left, which also runs them one at a time
+    std::vector<BatchHandle> dependents;
+    for (;;)
+    {
+        std::vector<Task> continuations;
+        {
+            std::lock_guard<std::mutex> lock(m_State->mutex);
+            continuations.swap(m_State->continuations);
+
+            if (continuations.empty())
+            {
+                m_State->finished = true;
+                dependents.swap(m_State->dependents);
+                break;
+            }
+        }
+
+        for (Task& task : continuations)
+            task();
+    }
+
+    m_State->done.notify_all();
+
+    for (const BatchHandle& dependent : dependents)
+        dependent.Complete();
+}
+
+void BatchHandle::Release(const BatchHandle& dependent) const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_State->mutex);
+        if (!m_State->finished)
+        {
+            m_State->dependents.push_back(dependent);
+            return;
+        }
+    }
+
+    dependent.Complete();
+}
+
+BatchPipeline::BatchPipeline(size_t count, size_t chunkSize):
+    m_Count(count), m_ChunkSize(chunkSize == 0 ? kDefaultChunkSize : chunkSize)
+{}
+
+BatchPipeline& BatchPipeline::Then(Stage stage)
+{
+    m_Stages.push_back(std::move(stage));
+    return *this;
+}
+
+BatchHandle BatchPipeline::Run(const Executor& executor) const
+{
+    size_t chunks = (m_Count + m_ChunkSize - 1) / m_ChunkSize;
+
+    // An empty batch still completes once, through Submit
+    BatchHandle handle(chunks == 0 ? 1 : chunks);
+    Submit(executor, handle);
+
+    return handle;
+}
+
+BatchHandle BatchPipeline::Run(const Executor& executor, const BatchHandle& after) const
+{
+    size_t chunks = (m_Count + m_ChunkSize - 1) / m_ChunkSize;
+
+    // One extra count, released once after is finished, continuations included,
+    // so this batch is never ready before the one it follows
+    BatchHandle handle((chunks == 0 ? 1 : chunks) + 1);
+    after.Then([pipeline = *this, executor, handle]() { pipeline.Submit(executor, handle); });
+    after.Release(handle);
+
+    return handle;
+}
+
+size_t BatchPipeline::Count() const
+{
+    return m_Count;
+}
+
+size_t BatchPipeline::ChunkSize() const
+{
+    return m_ChunkSize;
+}
+
+void BatchPipeline::Submit(const Executor& executor, const BatchHandle& handle) const
+{
+    if (m_Count == 0)
+    {
+        handle.Complete();
+        return;
+    }
+
+    // Shared so each task does not copy every stage
+    std::shared_ptr<const std::vector<Stage>> stages = std::make_shared<const std::vector<Stage>>(m_Stages);
+
+    for (size_t begin = 0; begin < m_Count; begin += m_ChunkSize)
+    {
+        size_t end = (m_Count - begin < m_ChunkSize) ? m_Count : begin + m_ChunkSize;
+
+        executor([stages, handle, begin, end]() {
+            for (const Stage& stage : *stages)
+                stage(begin, end);
+
+            handle.Complete();
+        });
+    }
+}
+
+void ParallelFor(size_t count, size_t chunkSize, const Executor& executor, const BatchPipeline::Stage& fn)
+{
+    // fn outlives every chunk, so the stage only needs to reference it
+    BatchPipeline(count, chunkSize).Then([&fn](size_t begin, size_t end) { fn(begin, end); }).Run(executor).Wait();
+}
+
+BatchPipeline::Stage MultiplyStage(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out)
+{
+    return [a, b, out](size_t begin, size_t end) { Matrix4x4::Multiply(a + begin, b + begin, out + begin, end - begin); };
+}
+
+BatchPipeline::Stage InverseStage(const Matrix4x4* m, Matrix4x4* out)
+{
+    return [m, out](size_t begin, size_t end) { Matrix4x4::Inverse(m + begin, out + begin, end - begin); };
+}
+
+BatchPipeline::Stage ApplyStage(const Quaternion& q, const Vector3* v, Vector3* out)
+{
+    return [q, v, out](size_t begin, size_t end) { q.Apply(v + begin, out + begin, end - begin); };
+}
+
+BatchPipeline::Stage ApplyStage(const Quaternion* q, const Vector3* v, Vector3* out)
+{
+    return [q, v, out](size_t begin, size_t end) { Quaternion::Apply(q + begin, v + begin, out + begin, end - begin); };
+}
+
+BatchHandle MultiplyAsync(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out, size_t count, const Executor& executor)
+{
+    return BatchPipeline(count).Then(MultiplyStage(a, b, out)).Run(executor);
+}
+
+BatchHandle InverseAsync(const Matrix4x4* m, Matrix4x4* out, size_t count, const Executor& executor)
+{
+    return BatchPipeline(count).Then(InverseStage(m, out)).Run(executor);
+}
+
+BatchHandle ApplyAsync(const Quaternion& q, const Vector3* v, Vector3* out, size_t count, const Executor& executor)
+{
+    return BatchPipeline(count).Then(ApplyStage(q, v, out)).Run(executor);
+}
+
+BatchHandle ApplyAsync(const Quaternion* q, const Vector3* v, Vector3* out, size_t count, const Executor& executor)
+{
+    return BatchPipeline(count).Then(ApplyStage(q, v, out)).Run(executor);
+}
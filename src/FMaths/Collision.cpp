@@ -0,0 +1,962 @@
+#include "FMaths/Collision.h"
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+
+#include "Simd.h"
+
+namespace
+{
+
+// Vector3's arithmetic is out of line, these inline in the loops below
+
+inline Vector3 Add3(const Vector3& a, const Vector3& b) { return Vector3(a.x + b.x, a.y + b.y, a.z + b.z); }
+inline Vector3 Sub3(const Vector3& a, const Vector3& b) { return Vector3(a.x - b.x, a.y - b.y, a.z - b.z); }
+inline Vector3 Scale3(const Vector3& a, float s) { return Vector3(a.x * s, a.y * s, a.z * s); }
+inline Vector3 Negate3(const Vector3& a) { return Vector3(-a.x, -a.y, -a.z); }
+inline float Dot3(const Vector3& a, const Vector3& b) { return (a.x * b.x) + (a.y * b.y) + (a.z * b.z); }
+
+inline Vector3 Cross3(const Vector3& a, const Vector3& b)
+{
+    return Vector3((a.y * b.z) - (a.z * b.y), (a.z * b.x) - (a.x * b.z), (a.x * b.y) - (a.y * b.x));
+}
+
+/**
+ * @brief a + b s
+ */
+inline Vector3 AddScaled3(const Vector3& a, const Vector3& b, float s)
+{
+    return Vector3(a.x + (b.x * s), a.y + (b.y * s), a.z + (b.z * s));
+}
+
+constexpr size_t kGjkIterations = 64;
+
+/**
+ * @brief Relative progress below which GJK has converged, |v|^2 - v.w <= tolerance |v|^2
+ */
+constexpr float kGjkTolerance = 1e-5f;
+
+/**
+ * @brief Squared distance, relative to the simplex's size, below which the cores touch
+ */
+constexpr float kGjkEpsilon = 1e-10f;
+
+constexpr size_t kEpaIterations = 64;
+constexpr size_t kEpaVertices = 64;
+constexpr size_t kEpaFaces = 128;
+constexpr float kEpaTolerance = 1e-4f;
+
+/**
+ * @brief Furthest point of the core in direction d, in world space
+ */
+Vector3 CoreSupport(const ConvexShape& s, const Vector3& d)
+{
+    Vector3 local(Dot3(s.axes[0], d), Dot3(s.axes[1], d), Dot3(s.axes[2], d));
+    Vector3 p;
+
+    switch (s.core)
+    {
+    case ConvexShape::Core::Point:
+        return s.position;
+
+    case ConvexShape::Core::Segment:
+        return AddScaled3(s.position, s.axes[1], local.y >= 0.f ? s.extents.y : -s.extents.y);
+
+    case ConvexShape::Core::Box:
+        p = Vector3(local.x >= 0.f ? s.extents.x : -s.extents.x, local.y >= 0.f ? s.extents.y : -s.extents.y,
+            local.z >= 0.f ? s.extents.z : -s.extents.z);
+        break;
+
+    case ConvexShape::Core::Hull:
+    {
+        float best = -FLT_MAX;
+        for (size_t i = 0; i < s.pointCount; i++)
+        {
+            float dot = Dot3(s.points[i], local);
+            if (dot > best)
+            {
+                best = dot;
+                p = s.points[i];
+            }
+        }
+        break;
+    }
+    }
+
+    return AddScaled3(AddScaled3(AddScaled3(s.position, s.axes[0], p.x), s.axes[1], p.y), s.axes[2], p.z);
+}
+
+/**
+ * @brief Point of the Minkowski difference a - b, with the points of a and b it came from
+ */
+struct SimplexVertex
+{
+    Vector3 w, a, b;
+};
+
+struct Simplex
+{
+    SimplexVertex v[4];
+    float lambda[4];
+    size_t n;
+};
+
+/**
+ * @brief Keep vertices index of s with weights lambda, in order
+ */
+void Reduce(Simplex& s, size_t n, const size_t* index, const float* lambda)
+{
+    SimplexVertex v[4];
+    for (size_t k = 0; k < n; k++)
+        v[k] = s.v[index[k]];
+
+    for (size_t k = 0; k < n; k++)
+    {
+        s.v[k] = v[k];
+        s.lambda[k] = lambda[k];
+    }
+
+    s.n = n;
+}
+
+/**
+ * @brief Closest point to the origin on segment i0 i1 of s, reducing s to the vertices it lies on
+ */
+void ClosestSegment(Simplex& s, size_t i0, size_t i1)
+{
+    const Vector3& a = s.v[i0].w;
+    Vector3 ab = Sub3(s.v[i1].w, a);
+    float t = -Dot3(a, ab);
+    float length2 = Dot3(ab, ab);
+
+    if (t <= 0.f || length2 <= 0.f)
+    {
+        const size_t index[] = {i0};
+        const float lambda[] = {1.f};
+        Reduce(s, 1, index, lambda);
+    }
+    else if (t >= length2)
+    {
+        const size_t index[] = {i1};
+        const float lambda[] = {1.f};
+        Reduce(s, 1, index, lambda);
+    }
+    else
+    {
+        const size_t index[] = {i0, i1};
+        const float lambda[] = {1.f - (t / length2), t / length2};
+        Reduce(s, 2, index, lambda);
+    }
+}
+
+/**
+ * @brief Closest point to the origin on triangle i0 i1 i2 of s, Ericson's region tests
+ */
+void ClosestTriangle(Simplex& s, size_t i0, size_t i1, size_t i2)
+{
+    const Vector3& a = s.v[i0].w;
+    const Vector3& b = s.v[i1].w;
+    const Vector3& c = s.v[i2].w;
+    Vector3 ab = Sub3(b, a), ac = Sub3(c, a);
+
+    float d1 = -Dot3(ab, a), d2 = -Dot3(ac, a);
+    if (d1 <= 0.f && d2 <= 0.f)
+    {
+        const size_t index[] = {i0};
+        const float lambda[] = {1.f};
+        return Reduce(s, 1, index, lambda);
+    }
+
+    float d3 = -Dot3(ab, b), d4 = -Dot3(ac, b);
+    if (d3 >= 0.f && d4 <= d3)
+    {
+        const size_t index[] = {i1};
+        const float lambda[] = {1.f};
+        return Reduce(s, 1, index, lambda);
+    }
+
+    float vc = (d1 * d4) - (d3 * d2);
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+        return ClosestSegment(s, i0, i1);
+
+    float d5 = -Dot3(ab, c), d6 = -Dot3(ac, c);
+    if (d6 >= 0.f && d5 <= d6)
+    {
+        const size_t index[] = {i2};
+        const float lambda[] = {1.f};
+        return Reduce(s, 1, index, lambda);
+    }
+
+    float vb = (d5 * d2) - (d1 * d6);
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+        return ClosestSegment(s, i0, i2);
+
+    float va = (d3 * d6) - (d5 * d4);
+    if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+        return ClosestSegment(s, i1, i2);
+
+    float denom = va + vb + vc;
+    if (!(denom > 0.f))
+        return ClosestSegment(s, i0, i1);
+
+    float v = vb / denom, w = vc / denom;
+    const size_t index[] = {i0, i1, i2};
+    const float lambda[] = {1.f - v - w, v, w};
+    Reduce(s, 3, index, lambda);
+}
+
+/**
+ * @brief Whether the origin is on the other side of face a b c from d, or on its plane
+ */
+bool OriginOutside(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+{
+    Vector3 n = Cross3(Sub3(b, a), Sub3(c, a));
+    return -Dot3(a, n) * Dot3(Sub3(d, a), n) <= 0.f;
+}
+
+/**
+ * @brief Closest point to the origin on the tetrahedron, keeping all four vertices if it contains the origin
+ */
+void ClosestTetrahedron(Simplex& s)
+{
+    const size_t faces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+    Simplex best = s;
+    float bestDistance = FLT_MAX;
+    bool outside = false;
+
+    for (const size_t* f : faces)
+    {
+        if (!OriginOutside(s.v[f[0]].w, s.v[f[1]].w, s.v[f[2]].w, s.v[f[3]].w))
+            continue;
+
+        Simplex face = s;
+        ClosestTriangle(face, f[0], f[1], f[2]);
+
+        Vector3 p;
+        for (size_t k = 0; k < face.n; k++)
+            p = AddScaled3(p, face.v[k].w, face.lambda[k]);
+
+        float distance = Dot3(p, p);
+        if (distance < bestDistance)
+        {
+            best = face;
+            bestDistance = distance;
+        }
+
+        outside = true;
+    }
+
+    if (outside)
+        s = best;
+}
+
+/**
+ * @brief Reduce s to the smallest simplex holding its closest point to the origin, and return that point
+ */
+Vector3 Closest(Simplex& s)
+{
+    switch (s.n)
+    {
+    case 1:
+        s.lambda[0] = 1.f;
+        break;
+    case 2:
+        ClosestSegment(s, 0, 1);
+        break;
+    case 3:
+        ClosestTriangle(s, 0, 1, 2);
+        break;
+    default:
+        ClosestTetrahedron(s);
+        if (s.n == 4)
+            return Vector3();
+        break;
+    }
+
+    Vector3 p;
+    for (size_t k = 0; k < s.n; k++)
+        p = AddScaled3(p, s.v[k].w, s.lambda[k]);
+
+    return p;
+}
+
+/**
+ * @brief GJK over the cores
+ *
+ * @param separation For a boolean test, stop once the cores are known to be further apart than this, else negative
+ * @param v Closest point of a - b to the origin, a's minus b's witness point
+ * @return true if the cores overlap
+ */
+bool Gjk(const ConvexShape& a, const ConvexShape& b, float separation, Simplex& s, Vector3& v)
+{
+    v = Sub3(a.position, b.position);
+    if (Dot3(v, v) == 0.f)
+        v = Vector3(1.f, 0.f, 0.f);
+
+    s.n = 0;
+    float previous = FLT_MAX;
+
+    for (size_t iteration = 0; iteration < kGjkIterations; iteration++)
+    {
+        SimplexVertex vertex;
+        vertex.a = CoreSupport(a, Negate3(v));
+        vertex.b = CoreSupport(b, v);
+        vertex.w = Sub3(vertex.a, vertex.b);
+
+        float vv = Dot3(v, v);
+        float vw = Dot3(v, vertex.w);
+
+        // Every point of a - b is at least vw / |v| along v from the origin
+        if (separation >= 0.f && vw > 0.f && vw * vw > separation * separation * vv)
+            return false;
+
+        if (s.n > 0 && vv - vw <= kGjkTolerance * vv)
+            return false;
+
+        bool repeat = false;
+        for (size_t k = 0; k < s.n; k++)
+            repeat = repeat || (s.v[k].w.x == vertex.w.x && s.v[k].w.y == vertex.w.y && s.v[k].w.z == vertex.w.z);
+
+        if (repeat)
+            return false;
+
+        s.v[s.n++] = vertex;
+        v = Closest(s);
+
+        float size = 0.f;
+        for (size_t k = 0; k < s.n; k++)
+            size = std::fmax(size, Dot3(s.v[k].w, s.v[k].w));
+
+        float distance = Dot3(v, v);
+
+        if (s.n == 4 || distance <= kGjkEpsilon * size)
+            return true;
+
+        // Rounding has stopped it getting closer
+        if (distance >= previous)
+            return false;
+
+        previous = distance;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Support of the cores' difference in direction d
+ */
+SimplexVertex CoreDifference(const ConvexShape& a, const ConvexShape& b, const Vector3& d)
+{
+    SimplexVertex vertex;
+    vertex.a = CoreSupport(a, d);
+    vertex.b = CoreSupport(b, Negate3(d));
+    vertex.w = Sub3(vertex.a, vertex.b);
+    return vertex;
+}
+
+struct EpaFace
+{
+    size_t v[3];
+    Vector3 n;
+    float d;
+    bool live;
+};
+
+/**
+ * @brief Grow a simplex touching the origin to a tetrahedron around it
+ */
+bool BlowUp(const ConvexShape& a, const ConvexShape& b, SimplexVertex* v, size_t& n)
+{
+    const Vector3 axes[] = {Vector3(1.f, 0.f, 0.f), Vector3(-1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f),
+        Vector3(0.f, -1.f, 0.f), Vector3(0.f, 0.f, 1.f), Vector3(0.f, 0.f, -1.f)};
+
+    if (n == 1)
+    {
+        for (const Vector3& d : axes)
+        {
+            SimplexVertex c = CoreDifference(a, b, d);
+            Vector3 e = Sub3(c.w, v[0].w);
+
+            if (Dot3(e, e) > 1e-10f)
+            {
+                v[n++] = c;
+                break;
+            }
+        }
+    }
+
+    if (n == 2)
+    {
+        Vector3 d = Sub3(v[1].w, v[0].w);
+        Vector3 axis = std::fabs(d.x) < std::fabs(d.y) ? (std::fabs(d.x) < std::fabs(d.z) ? axes[0] : axes[4])
+                                                        : (std::fabs(d.y) < std::fabs(d.z) ? axes[2] : axes[4]);
+        Vector3 e1 = Cross3(d, axis);
+        Vector3 e2 = Cross3(d, e1);
+        const Vector3 directions[] = {e1, Negate3(e1), e2, Negate3(e2)};
+
+        for (const Vector3& dir : directions)
+        {
+            SimplexVertex c = CoreDifference(a, b, dir);
+            Vector3 off = Cross3(d, Sub3(c.w, v[0].w));
+
+            if (Dot3(off, off) > 1e-10f * Dot3(d, d))
+            {
+                v[n++] = c;
+                break;
+            }
+        }
+    }
+
+    if (n == 3)
+    {
+        Vector3 normal = Cross3(Sub3(v[1].w, v[0].w), Sub3(v[2].w, v[0].w));
+        const Vector3 directions[] = {normal, Negate3(normal)};
+
+        for (const Vector3& dir : directions)
+        {
+            SimplexVertex c = CoreDifference(a, b, dir);
+            float height = Dot3(normal, Sub3(c.w, v[0].w));
+
+            if (height * height > 1e-10f * Dot3(normal, normal))
+            {
+                v[n++] = c;
+                break;
+            }
+        }
+    }
+
+    return n == 4;
+}
+
+/**
+ * @brief Face through vertices i, j and k, its normal from the origin's side
+ */
+EpaFace MakeFace(const SimplexVertex* v, size_t i, size_t j, size_t k)
+{
+    EpaFace f = {{i, j, k}, Cross3(Sub3(v[j].w, v[i].w), Sub3(v[k].w, v[i].w)), FLT_MAX, true};
+    float length2 = Dot3(f.n, f.n);
+
+    // A sliver face can't be the closest, but still closes the polytope
+    if (length2 > 1e-20f)
+    {
+        f.n = Scale3(f.n, 1.f / std::sqrt(length2));
+        f.d = Dot3(f.n, v[i].w);
+    }
+    else
+        f.n = Vector3();
+
+    return f;
+}
+
+/**
+ * @brief Expanding polytope from a simplex around the origin to the face of the cores' a - b closest to it
+ *
+ * Radii grow a - b by exactly their sum along every normal, so they're added
+ * to the core depth afterwards rather than approximated by the polytope.
+ */
+bool Epa(const ConvexShape& a, const ConvexShape& b, const Simplex& start, Contact& contact)
+{
+    SimplexVertex v[kEpaVertices];
+    size_t n = start.n;
+    for (size_t k = 0; k < n; k++)
+        v[k] = start.v[k];
+
+    if (!BlowUp(a, b, v, n))
+        return false;
+
+    EpaFace faces[kEpaFaces];
+    size_t faceCount = 0;
+
+    const size_t tetrahedron[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0}};
+    for (const size_t* t : tetrahedron)
+    {
+        // Wound so the normal faces away from the fourth vertex
+        Vector3 normal = Cross3(Sub3(v[t[1]].w, v[t[0]].w), Sub3(v[t[2]].w, v[t[0]].w));
+        bool flip = Dot3(normal, Sub3(v[t[3]].w, v[t[0]].w)) > 0.f;
+
+        faces[faceCount++] = flip ? MakeFace(v, t[0], t[2], t[1]) : MakeFace(v, t[0], t[1], t[2]);
+    }
+
+    size_t closest = 0;
+
+    for (size_t iteration = 0; iteration < kEpaIterations; iteration++)
+    {
+        closest = kEpaFaces;
+        for (size_t f = 0; f < faceCount; f++)
+            if (faces[f].live && (closest == kEpaFaces || faces[f].d < faces[closest].d))
+                closest = f;
+
+        if (closest == kEpaFaces || faces[closest].d == FLT_MAX)
+            return false;
+
+        const EpaFace& face = faces[closest];
+        SimplexVertex c = CoreDifference(a, b, face.n);
+        float distance = Dot3(c.w, face.n);
+
+        if (distance - face.d <= kEpaTolerance * std::fmax(distance, 1e-3f) || n == kEpaVertices)
+            break;
+
+        // Remove every face c can see, keeping the edges of the hole they leave
+        size_t edges[kEpaFaces * 3][2];
+        size_t edgeCount = 0;
+
+        for (size_t f = 0; f < faceCount; f++)
+        {
+            if (!faces[f].live || Dot3(faces[f].n, Sub3(c.w, v[faces[f].v[0]].w)) <= 0.f)
+                continue;
+
+            faces[f].live = false;
+
+            for (size_t e = 0; e < 3; e++)
+            {
+                size_t from = faces[f].v[e], to = faces[f].v[(e + 1) % 3];
+
+                // An edge shared by two removed faces is inside the hole
+                bool shared = false;
+                for (size_t k = 0; k < edgeCount && !shared; k++)
+                    if (edges[k][0] == to && edges[k][1] == from)
+                    {
+                        edges[k][0] = edges[edgeCount - 1][0];
+                        edges[k][1] = edges[edgeCount - 1][1];
+                        edgeCount--;
+                        shared = true;
+                    }
+
+                if (!shared)
+                {
+                    edges[edgeCount][0] = from;
+                    edges[edgeCount][1] = to;
+                    edgeCount++;
+                }
+            }
+        }
+
+        // Reuse dead faces first
+        size_t live = 0;
+        for (size_t f = 0; f < faceCount; f++)
+            if (faces[f].live)
+                faces[live++] = faces[f];
+
+        if (live + edgeCount > kEpaFaces)
+            return false;
+
+        v[n] = c;
+        for (size_t e = 0; e < edgeCount; e++)
+            faces[live++] = MakeFace(v, edges[e][0], edges[e][1], n);
+
+        n++;
+        faceCount = live;
+    }
+
+    const EpaFace& face = faces[closest];
+    const Vector3& p0 = v[face.v[0]].w;
+    const Vector3& p1 = v[face.v[1]].w;
+    const Vector3& p2 = v[face.v[2]].w;
+
+    // Barycentric coordinates of the origin's projection onto the face
+    Vector3 p = Scale3(face.n, face.d);
+    Vector3 e0 = Sub3(p1, p0), e1 = Sub3(p2, p0), ep = Sub3(p, p0);
+    float d00 = Dot3(e0, e0), d01 = Dot3(e0, e1), d11 = Dot3(e1, e1);
+    float d20 = Dot3(ep, e0), d21 = Dot3(ep, e1);
+    float denom = (d00 * d11) - (d01 * d01);
+
+    float l1 = denom > 0.f ? ((d11 * d20) - (d01 * d21)) / denom : 0.f;
+    float l2 = denom > 0.f ? ((d00 * d21) - (d01 * d20)) / denom : 0.f;
+    float l0 = 1.f - l1 - l2;
+
+    Vector3 pa = AddScaled3(AddScaled3(Scale3(v[face.v[0]].a, l0), v[face.v[1]].a, l1), v[face.v[2]].a, l2);
+    Vector3 pb = AddScaled3(AddScaled3(Scale3(v[face.v[0]].b, l0), v[face.v[1]].b, l1), v[face.v[2]].b, l2);
+
+    contact.normal = face.n;
+    contact.distance = -face.d - a.radius - b.radius;
+    contact.pointA = AddScaled3(pa, face.n, a.radius);
+    contact.pointB = AddScaled3(pb, face.n, -b.radius);
+    return true;
+}
+
+// Box-box SAT
+
+/**
+ * @brief Floats of an OBB in lanes, centre, the three axes then half extents
+ */
+constexpr size_t kBoxFloats = 15;
+
+void PackBox(const OBB& box, float* lanes, size_t lane, size_t width)
+{
+    const float values[kBoxFloats] = {box.centre.x, box.centre.y, box.centre.z,
+        box.axes[0].x, box.axes[0].y, box.axes[0].z, box.axes[1].x, box.axes[1].y, box.axes[1].z,
+        box.axes[2].x, box.axes[2].y, box.axes[2].z, box.halfExtents.x, box.halfExtents.y, box.halfExtents.z};
+
+    for (size_t k = 0; k < kBoxFloats; k++)
+        lanes[(k * width) + lane] = values[k];
+}
+
+/**
+ * @brief Largest separation over the 15 axes and which axis gave it, faces of a, faces of b then a_i x b_j
+ *
+ * Edge axes need to beat the faces by 5% of the depth, as near parallel
+ * edges give noisy normals.
+ */
+template<typename F>
+void SatLanes(const F (&a)[kBoxFloats], const F (&b)[kBoxFloats], F& best, F& axis)
+{
+    const F* ca = a;
+    const F* cb = b;
+    const F* ha = a + 12;
+    const F* hb = b + 12;
+
+    F t[3], r[3][3], absR[3][3];
+    F d[3] = {cb[0] - ca[0], cb[1] - ca[1], cb[2] - ca[2]};
+
+    // Near parallel axes get a little slack so their cross products don't decide
+    F slack = F::Set(1e-6f);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        const F* ai = a + 3 + (3 * i);
+        t[i] = MulAdd(d[2], ai[2], MulAdd(d[1], ai[1], d[0] * ai[0]));
+
+        for (size_t j = 0; j < 3; j++)
+        {
+            const F* bj = b + 3 + (3 * j);
+            r[i][j] = MulAdd(ai[2], bj[2], MulAdd(ai[1], bj[1], ai[0] * bj[0]));
+            absR[i][j] = Abs(r[i][j]) + slack;
+        }
+    }
+
+    best = F::Set(-FLT_MAX);
+    axis = F::Set(0.f);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        F rb = MulAdd(hb[2], absR[i][2], MulAdd(hb[1], absR[i][1], hb[0] * absR[i][0]));
+        F sep = Abs(t[i]) - (ha[i] + rb);
+
+        typename F::Mask better = sep > best;
+        best = Select(better, sep, best);
+        axis = Select(better, F::Set(float(i)), axis);
+    }
+
+    for (size_t j = 0; j < 3; j++)
+    {
+        F ra = MulAdd(ha[2], absR[2][j], MulAdd(ha[1], absR[1][j], ha[0] * absR[0][j]));
+        F projection = MulAdd(t[2], r[2][j], MulAdd(t[1], r[1][j], t[0] * r[0][j]));
+        F sep = Abs(projection) - (ra + hb[j]);
+
+        typename F::Mask better = sep > best;
+        best = Select(better, sep, best);
+        axis = Select(better, F::Set(float(3 + j)), axis);
+    }
+
+    F threshold = Max(best, best * F::Set(0.95f));
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        size_t i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+
+        for (size_t j = 0; j < 3; j++)
+        {
+            size_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+
+            F ra = MulAdd(ha[i1], absR[i2][j], ha[i2] * absR[i1][j]);
+            F rb = MulAdd(hb[j1], absR[i][j2], hb[j2] * absR[i][j1]);
+            F distance = Abs((t[i2] * r[i1][j]) - (t[i1] * r[i2][j]));
+
+            // |a_i x b_j| for unit axes
+            F length2 = F::Set(1.f) - (r[i][j] * r[i][j]);
+            F sep = (distance - (ra + rb)) * InvSqrt(Max(length2, F::Set(1e-6f)));
+
+            typename F::Mask better = (length2 > F::Set(1e-6f)) & (sep > threshold) & (sep > best);
+            best = Select(better, sep, best);
+            axis = Select(better, F::Set(float(6 + (3 * i) + j)), axis);
+        }
+    }
+}
+
+/**
+ * @brief Closest points of segments p1 q1 and p2 q2, Ericson's clamped solution
+ */
+void ClosestSegments(const Vector3& p1, const Vector3& q1, const Vector3& p2, const Vector3& q2, Vector3& c1, Vector3& c2)
+{
+    Vector3 d1 = Sub3(q1, p1), d2 = Sub3(q2, p2), r = Sub3(p1, p2);
+    float a = Dot3(d1, d1), e = Dot3(d2, d2), f = Dot3(d2, r);
+    float s = 0.f, t = 0.f;
+
+    if (a > 0.f && e > 0.f)
+    {
+        float c = Dot3(d1, r), b = Dot3(d1, d2);
+        float denom = (a * e) - (b * b);
+
+        s = denom > 0.f ? std::fmin(std::fmax(((b * f) - (c * e)) / denom, 0.f), 1.f) : 0.f;
+        t = ((b * s) + f) / e;
+
+        if (t < 0.f)
+        {
+            t = 0.f;
+            s = std::fmin(std::fmax(-c / a, 0.f), 1.f);
+        }
+        else if (t > 1.f)
+        {
+            t = 1.f;
+            s = std::fmin(std::fmax((b - c) / a, 0.f), 1.f);
+        }
+    }
+    else if (e > 0.f)
+        t = std::fmin(std::fmax(f / e, 0.f), 1.f);
+    else if (a > 0.f)
+        s = std::fmin(std::fmax(-Dot3(d1, r) / a, 0.f), 1.f);
+
+    c1 = AddScaled3(p1, d1, s);
+    c2 = AddScaled3(p2, d2, t);
+}
+
+/**
+ * @brief Corner of box furthest along n, or the centre of the edge along axis skip furthest along n
+ */
+Vector3 BoxFeature(const OBB& box, const Vector3& n, size_t skip = 3)
+{
+    Vector3 p = box.centre;
+    for (size_t k = 0; k < 3; k++)
+        if (k != skip)
+            p = AddScaled3(p, box.axes[k], Dot3(box.axes[k], n) >= 0.f ? box.halfExtents[k] : -box.halfExtents[k]);
+
+    return p;
+}
+
+Contact BoxContact(const OBB& a, const OBB& b, float separation, size_t axis)
+{
+    Contact contact;
+    Vector3 n;
+
+    if (axis < 3)
+        n = a.axes[axis];
+    else if (axis < 6)
+        n = b.axes[axis - 3];
+    else
+    {
+        n = Cross3(a.axes[(axis - 6) / 3], b.axes[(axis - 6) % 3]);
+        n = Scale3(n, 1.f / std::sqrt(Dot3(n, n)));
+    }
+
+    if (Dot3(n, Sub3(b.centre, a.centre)) < 0.f)
+        n = Negate3(n);
+
+    contact.normal = n;
+    contact.distance = separation;
+
+    if (axis < 3)
+    {
+        // Deepest corner of b, against a's face
+        contact.pointB = BoxFeature(b, Negate3(n));
+        contact.pointA = AddScaled3(contact.pointB, n, -separation);
+    }
+    else if (axis < 6)
+    {
+        contact.pointA = BoxFeature(a, n);
+        contact.pointB = AddScaled3(contact.pointA, n, separation);
+    }
+    else
+    {
+        size_t i = (axis - 6) / 3, j = (axis - 6) % 3;
+        Vector3 ea = BoxFeature(a, n, i);
+        Vector3 eb = BoxFeature(b, Negate3(n), j);
+        Vector3 da = Scale3(a.axes[i], a.halfExtents[i]);
+        Vector3 db = Scale3(b.axes[j], b.halfExtents[j]);
+
+        ClosestSegments(Sub3(ea, da), Add3(ea, da), Sub3(eb, db), Add3(eb, db), contact.pointA, contact.pointB);
+    }
+
+    return contact;
+}
+
+/**
+ * @brief SAT over W pairs from i
+ */
+template<typename F>
+void SatPairs(const OBB* boxes, const ShapePair* pairs, size_t i, Contact* out)
+{
+    constexpr size_t W = F::Width;
+    float lanes[2][kBoxFloats * W];
+
+    for (size_t lane = 0; lane < W; lane++)
+    {
+        PackBox(boxes[pairs[i + lane].a], lanes[0], lane, W);
+        PackBox(boxes[pairs[i + lane].b], lanes[1], lane, W);
+    }
+
+    F a[kBoxFloats], b[kBoxFloats];
+    for (size_t k = 0; k < kBoxFloats; k++)
+    {
+        a[k] = F::Load(lanes[0] + (k * W));
+        b[k] = F::Load(lanes[1] + (k * W));
+    }
+
+    F best, axis;
+    SatLanes(a, b, best, axis);
+
+    float separation[W], index[W];
+    best.Store(separation);
+    axis.Store(index);
+
+    for (size_t lane = 0; lane < W; lane++)
+    {
+        const ShapePair& pair = pairs[i + lane];
+        out[i + lane] = BoxContact(boxes[pair.a], boxes[pair.b], separation[lane], static_cast<size_t>(index[lane]));
+    }
+}
+
+} // namespace
+
+// ConvexShape
+
+ConvexShape ConvexShape::Sphere(float radius)
+{
+    ConvexShape s;
+    s.core = Core::Point;
+    s.extents = Vector3();
+    s.radius = radius;
+    s.points = nullptr;
+    s.pointCount = 0;
+    return s.SetTransform(Vector3(), Quaternion());
+}
+
+ConvexShape ConvexShape::Capsule(float halfHeight, float radius)
+{
+    ConvexShape s = Sphere(radius);
+    s.core = Core::Segment;
+    s.extents = Vector3(0.f, halfHeight, 0.f);
+    return s;
+}
+
+ConvexShape ConvexShape::Box(const Vector3& halfExtents, float radius)
+{
+    ConvexShape s = Sphere(radius);
+    s.core = Core::Box;
+    s.extents = halfExtents;
+    return s;
+}
+
+ConvexShape ConvexShape::Hull(const Vector3* points, size_t count, float radius)
+{
+    assert(count > 0);
+
+    ConvexShape s = Sphere(radius);
+    s.core = Core::Hull;
+    s.points = points;
+    s.pointCount = count;
+    return s;
+}
+
+ConvexShape& ConvexShape::SetTransform(const Vector3& position, const Quaternion& orientation)
+{
+    this->position = position;
+    axes[0] = orientation.Apply(Vector3(1.f, 0.f, 0.f));
+    axes[1] = orientation.Apply(Vector3(0.f, 1.f, 0.f));
+    axes[2] = orientation.Apply(Vector3(0.f, 0.f, 1.f));
+    return *this;
+}
+
+ConvexShape& ConvexShape::SetTransform(const Matrix4x4& transform)
+{
+    position = Vector3(transform[3].x, transform[3].y, transform[3].z);
+    for (size_t k = 0; k < 3; k++)
+        axes[k] = Vector3(transform[k].x, transform[k].y, transform[k].z);
+
+    return *this;
+}
+
+Vector3 ConvexShape::Support(const Vector3& d) const
+{
+    Vector3 p = CoreSupport(*this, d);
+    float length2 = Dot3(d, d);
+
+    return (radius == 0.f || length2 == 0.f) ? p : AddScaled3(p, d, radius / std::sqrt(length2));
+}
+
+// Narrowphase
+
+bool Overlap(const ConvexShape& a, const ConvexShape& b)
+{
+    Simplex s;
+    Vector3 v;
+
+    if (Gjk(a, b, a.radius + b.radius, s, v))
+        return true;
+
+    // Converged without a separating axis past the radii
+    return Dot3(v, v) <= (a.radius + b.radius) * (a.radius + b.radius);
+}
+
+Contact Collide(const ConvexShape& a, const ConvexShape& b)
+{
+    Simplex s;
+    Vector3 v;
+    Contact contact;
+
+    if (!Gjk(a, b, -1.f, s, v))
+    {
+        Vector3 pa, pb;
+        for (size_t k = 0; k < s.n; k++)
+        {
+            pa = AddScaled3(pa, s.v[k].a, s.lambda[k]);
+            pb = AddScaled3(pb, s.v[k].b, s.lambda[k]);
+        }
+
+        float distance = std::sqrt(Dot3(v, v));
+
+        if (distance > 0.f)
+        {
+            contact.normal = Scale3(v, -1.f / distance);
+            contact.distance = distance - a.radius - b.radius;
+            contact.pointA = AddScaled3(pa, contact.normal, a.radius);
+            contact.pointB = AddScaled3(pb, contact.normal, -b.radius);
+            return contact;
+        }
+    }
+
+    if (Epa(a, b, s, contact))
+        return contact;
+
+    // No volume to expand into, only the radii overlap, e.g. spheres with coincident centres
+    Vector3 d = Sub3(b.position, a.position);
+    float length2 = Dot3(d, d);
+
+    contact.normal = length2 > 0.f ? Scale3(d, 1.f / std::sqrt(length2)) : Vector3(1.f, 0.f, 0.f);
+    contact.distance = -a.radius - b.radius;
+    contact.pointA = AddScaled3(a.position, contact.normal, a.radius);
+    contact.pointB = AddScaled3(b.position, contact.normal, -b.radius);
+    return contact;
+}
+
+Contact Collide(const OBB& a, const OBB& b)
+{
+    ShapePair pair = {0, 1};
+    const OBB boxes[] = {a, b};
+
+    Contact contact;
+    SatPairs<ScalarFloat>(boxes, &pair, 0, &contact);
+    return contact;
+}
+
+void Collide(const ConvexShape* shapes, const ShapePair* pairs, size_t count, Contact* out, const Executor& executor)
+{
+    ParallelFor(count, kNarrowphaseChunkSize, executor, [shapes, pairs, out](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            out[i] = Collide(shapes[pairs[i].a], shapes[pairs[i].b]);
+    });
+}
+
+void Collide(const OBB* boxes, const ShapePair* pairs, size_t count, Contact* out, const Executor& executor)
+{
+    ParallelFor(count, kNarrowphaseChunkSize, executor, [boxes, pairs, out](size_t begin, size_t end) {
+        size_t i = begin;
+
+        for (; i + SimdFloat::Width <= end; i += SimdFloat::Width)
+            SatPairs<SimdFloat>(boxes, pairs, i, out);
+
+        for (; i < end; i++)
+            SatPairs<ScalarFloat>(boxes, pairs, i, out);
+    });
+}
@@ -0,0 +1,40 @@
+#include "FMaths/Compare.h"
+
+#include <cmath>
+#include <cstring>
+
+uint32_t UlpDistance(float a, float b)
+{
+    // Map onto a line of integers that is monotonic in the float value
+    auto ordered = [](float f) {
+        int32_t i;
+        std::memcpy(&i, &f, sizeof(f));
+        return (i >= 0) ? static_cast<int64_t>(i) : static_cast<int64_t>(INT32_MIN) - i;
+    };
+
+    int64_t d = ordered(a) - ordered(b);
+    d = (d < 0) ? -d : d;
+
+    return (d > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(d);
+}
+
+bool ApproxEqual(float a, float b, float epsilon)
+{
+    if (a == b)
+        return true;
+
+    // Otherwise an infinity would be within epsilon of anything
+    if (!std::isfinite(a) || !std::isfinite(b))
+        return false;
+
+    float scale = fmaxf(1.f, fmaxf(fabsf(a), fabsf(b)));
+    return fabsf(a - b) <= epsilon * scale;
+}
+
+bool UlpEqual(float a, float b, uint32_t maxUlps)
+{
+    if (std::isnan(a) || std::isnan(b))
+        return false;
+
+    return UlpDistance(a, b) <= maxUlps;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file Compensated.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal error-free transformations for compensated accumulation
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef COMPENSATED_H
+#define COMPENSATED_H
+
+#include <cmath>
+#include <cstddef>
+
+namespace Compensated
+{
+
+/**
+ * @brief a + b, with the rounding error in err so that s + err == a + b exactly
+ */
+inline float TwoSum(float a, float b, float& err)
+{
+    float s = a + b;
+    float bv = s - a;
+    err = (a - (s - bv)) + (b - bv);
+
+    return s;
+}
+
+/**
+ * @brief a * b, with the rounding error in err so that p + err == a * b exactly
+ */
+inline float TwoProduct(float a, float b, float& err)
+{
+    float p = a * b;
+
+#ifdef FMATHS_FMA
+    err = fmaf(a, b, -p);
+#else
+    // Dekker's split of each operand into 12 bit halves
+    constexpr float split = 4097.f; // 2^12 + 1
+
+    float ta = split * a;
+    float ah = ta - (ta - a);
+    float al = a - ah;
+
+    float tb = split * b;
+    float bh = tb - (tb - b);
+    float bl = b - bh;
+
+    err = (((ah * bh) - p) + (ah * bl) + (al * bh)) + (al * bl);
+#endif
+
+    return p;
+}
+
+/**
+ * @brief Dot product as if accumulated in twice the working precision
+ *
+ * Ogita, Rump and Oishi's Dot2.
+ *
+ * @param a First vector, elements strideA apart
+ * @param b Second vector, elements strideB apart
+ */
+inline float Dot(const float* a, size_t strideA, const float* b, size_t strideB, size_t n)
+{
+    float err = 0.f;
+    float p = TwoProduct(a[0], b[0], err);
+
+    for (size_t i = 1; i < n; i++)
+    {
+        float prodErr, sumErr;
+        float h = TwoProduct(a[i * strideA], b[i * strideB], prodErr);
+
+        p = TwoSum(p, h, sumErr);
+        err += sumErr + prodErr;
+    }
+
+    return p + err;
+}
+
+} // namespace Compensated
+
+#endif
@@ -0,0 +1,548 @@
+#include "FMaths/Curve.h"
+
+#include <math.h>
+#include <algorithm>
+#include <cassert>
+
+#include "FMaths/Vector2.h"
+#include "FMaths/Vector3.h"
+#include "FMaths/Vector4.h"
+
+#include "Kernels.h"
+#include "SimdMath.h"
+
+static_assert(sizeof(Vector2) == sizeof(float) * 2, "Vector2 must be tightly packed");
+
+namespace
+{
+
+template<typename V>
+constexpr size_t kComponents = sizeof(V) / sizeof(float);
+
+template<typename V>
+const float* Components(const V& v)
+{
+    return reinterpret_cast<const float*>(&v);
+}
+
+/**
+ * @brief a + bt + ct^2 + dt^3 by Horner's rule, float and lanes round the same way
+ */
+template<typename F>
+F Horner(F a, F b, F c, F d, F t)
+{
+    return MulAdd(MulAdd(MulAdd(d, t, c), t, b), t, a);
+}
+
+/**
+ * @brief Clamp u to the spline and split it into a segment and its t
+ */
+void Locate(float u, size_t segments, size_t& segment, float& t)
+{
+    // Also catches NaN
+    if (!(u > 0.f))
+        u = 0.f;
+
+    u = std::min(u, static_cast<float>(segments));
+    segment = std::min(static_cast<size_t>(u), segments - 1);
+    t = u - static_cast<float>(segment);
+}
+
+/**
+ * @brief Evaluate W parameters across lanes, where each lane may use a different segment
+ */
+template<typename F, typename V>
+void EvaluateLanes(const CubicCurve<V>* const* curves, F t, float* out)
+{
+    constexpr size_t K = kComponents<V>;
+
+    // Sorted parameters mostly share a segment, broadcast rather than transpose
+    bool shared = true;
+    for (size_t lane = 1; lane < F::Width; lane++)
+        shared = shared && (curves[lane] == curves[0]);
+
+    if (shared)
+    {
+        const V* k = curves[0]->coefficients;
+
+        for (size_t j = 0; j < K; j++)
+            Horner(F::Set(Components(k[0])[j]), F::Set(Components(k[1])[j]), F::Set(Components(k[2])[j]), F::Set(Components(k[3])[j]), t).Scatter(out + j, K);
+
+        return;
+    }
+
+    alignas(32) float c[4][K][F::Width];
+
+    for (size_t lane = 0; lane < F::Width; lane++)
+        for (size_t j = 0; j < 4; j++)
+        {
+            const float* f = Components(curves[lane]->coefficients[j]);
+
+            for (size_t k = 0; k < K; k++)
+                c[j][k][lane] = f[k];
+        }
+
+    for (size_t k = 0; k < K; k++)
+        Horner(F::Load(c[0][k]), F::Load(c[1][k]), F::Load(c[2][k]), F::Load(c[3][k]), t).Scatter(out + k, K);
+}
+
+template<typename F>
+F DotLanes(const QuaternionLanes<F>& a, const QuaternionLanes<F>& b)
+{
+    return MulAdd(a.w, b.w, MulAdd(a.z, b.z, MulAdd(a.y, b.y, a.x * b.x)));
+}
+
+template<typename F>
+QuaternionLanes<F> SlerpLanes(const QuaternionLanes<F>& a, QuaternionLanes<F> b, F t)
+{
+    F zero = F::Set(0.f);
+    F one = F::Set(1.f);
+
+    // q and -q are the same rotation, take the shorter arc
+    F d = DotLanes(a, b);
+    auto flip = d < zero;
+
+    b = {Select(flip, -b.x, b.x), Select(flip, -b.y, b.y), Select(flip, -b.z, b.z), Select(flip, -b.w, b.w)};
+    d = Abs(d);
+
+    // Nearly equal, sin(theta) is too small to divide by so interpolate linearly
+    auto close = d > F::Set(0.9995f);
+
+    F theta = SimdMath::Acos(Min(d, one));
+    F invSin = InvSqrt(Max(one - (d * d), F::Set(1e-12f)));
+
+    F wa = Select(close, one - t, SimdMath::Sin((one - t) * theta) * invSin);
+    F wb = Select(close, t, SimdMath::Sin(t * theta) * invSin);
+
+    QuaternionLanes<F> res = {
+        MulAdd(wb, b.x, wa * a.x),
+        MulAdd(wb, b.y, wa * a.y),
+        MulAdd(wb, b.z, wa * a.z),
+        MulAdd(wb, b.w, wa * a.w)
+    };
+
+    // Only the linear case leaves the unit sphere
+    F scale = Select(close, InvSqrt(DotLanes(res, res)), one);
+    return {res.x * scale, res.y * scale, res.z * scale, res.w * scale};
+}
+
+template<typename F>
+QuaternionLanes<F> SquadLanes(const QuaternionLanes<F>& q0, const QuaternionLanes<F>& q1,
+    const QuaternionLanes<F>& s0, const QuaternionLanes<F>& s1, F t)
+{
+    F h = (t + t) * (F::Set(1.f) - t);
+    return SlerpLanes(SlerpLanes(q0, q1, t), SlerpLanes(s0, s1, t), h);
+}
+
+template<typename F>
+QuaternionLanes<F> Broadcast(const Quaternion& q)
+{
+    return {F::Set(q.x), F::Set(q.y), F::Set(q.z), F::Set(q.w)};
+}
+
+Quaternion Conjugate(const Quaternion& q)
+{
+    return Quaternion(-q.x, -q.y, -q.z, q.w);
+}
+
+/**
+ * @brief Rotation vector of a unit quaternion, half the axis times angle
+ */
+Vector3 Log(const Quaternion& q)
+{
+    Vector3 v(q.x, q.y, q.z);
+    float length = v.Length();
+
+    // theta / sin(theta) tends to 1
+    if (length < 1e-6f)
+        return v;
+
+    float theta = SimdMath::Atan2(ScalarFloat{length}, ScalarFloat{q.w}).v;
+    return v * (theta / length);
+}
+
+Quaternion Exp(const Vector3& v)
+{
+    float theta = v.Length();
+
+    ScalarFloat s, c;
+    SimdMath::SinCos(ScalarFloat{theta}, s, c);
+
+    Vector3 axis = (theta < 1e-6f) ? v : v * (s.v / theta);
+    return Quaternion(axis.x, axis.y, axis.z, c.v);
+}
+
+} // namespace
+
+// CubicCurve
+
+template<typename V>
+CubicCurve<V>::CubicCurve():
+    coefficients()
+{}
+
+template<typename V>
+CubicCurve<V>::CubicCurve(CurveBasis basis, const V& p0, const V& p1, const V& p2, const V& p3)
+{
+    V* k = coefficients;
+
+    switch (basis)
+    {
+    default:
+    case CurveBasis::Hermite:
+        // p0, m0, p1, m1
+        k[0] = p0;
+        k[1] = p1;
+        k[2] = (p2 * 3.f) - (p0 * 3.f) - (p1 * 2.f) - p3;
+        k[3] = (p0 * 2.f) - (p2 * 2.f) + p1 + p3;
+        break;
+    case CurveBasis::Bezier:
+        k[0] = p0;
+        k[1] = (p1 - p0) * 3.f;
+        k[2] = (p0 - (p1 * 2.f) + p2) * 3.f;
+        k[3] = p3 - p0 + ((p1 - p2) * 3.f);
+        break;
+    case CurveBasis::CatmullRom:
+        k[0] = p1;
+        k[1] = (p2 - p0) * 0.5f;
+        k[2] = ((p0 * 2.f) - (p1 * 5.f) + (p2 * 4.f) - p3) * 0.5f;
+        k[3] = (p3 - p0 + ((p1 - p2) * 3.f)) * 0.5f;
+        break;
+    case CurveBasis::BSpline:
+        k[0] = (p0 + (p1 * 4.f) + p2) * (1.f / 6.f);
+        k[1] = (p2 - p0) * 0.5f;
+        k[2] = (p0 - (p1 * 2.f) + p2) * 0.5f;
+        k[3] = (p3 - p0 + ((p1 - p2) * 3.f)) * (1.f / 6.f);
+        break;
+    }
+}
+
+template<typename V>
+V CubicCurve<V>::Evaluate(float t) const
+{
+    const float* a = Components(coefficients[0]);
+    const float* b = Components(coefficients[1]);
+    const float* c = Components(coefficients[2]);
+    const float* d = Components(coefficients[3]);
+
+    V res;
+    float* r = reinterpret_cast<float*>(&res);
+
+    for (size_t k = 0; k < kComponents<V>; k++)
+        r[k] = Horner(a[k], b[k], c[k], d[k], t);
+
+    return res;
+}
+
+template<typename V>
+V CubicCurve<V>::Tangent(float t) const
+{
+    const float* b = Components(coefficients[1]);
+    const float* c = Components(coefficients[2]);
+    const float* d = Components(coefficients[3]);
+
+    // b + 2ct + 3dt^2
+    V res;
+    float* r = reinterpret_cast<float*>(&res);
+
+    for (size_t k = 0; k < kComponents<V>; k++)
+        r[k] = MulAdd(MulAdd(3.f * d[k], t, 2.f * c[k]), t, b[k]);
+
+    return res;
+}
+
+template<typename V>
+void CubicCurve<V>::Evaluate(const float* t, V* out, size_t count) const
+{
+    constexpr size_t K = kComponents<V>;
+    float* f = reinterpret_cast<float*>(out);
+
+    SimdFloat c[4][K];
+    for (size_t j = 0; j < 4; j++)
+        for (size_t k = 0; k < K; k++)
+            c[j][k] = SimdFloat::Set(Components(coefficients[j])[k]);
+
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        SimdFloat ti = SimdFloat::Load(t + i);
+
+        for (size_t k = 0; k < K; k++)
+            Horner(c[0][k], c[1][k], c[2][k], c[3][k], ti).Scatter(f + (i * K) + k, K);
+    }
+
+    for (; i < count; i++)
+        out[i] = Evaluate(t[i]);
+}
+
+template<typename V>
+void CubicCurve<V>::EvaluateUniform(V* out, size_t count) const
+{
+    if (count == 0)
+        return;
+
+    if (count == 1)
+    {
+        out[0] = Evaluate(0.f);
+        return;
+    }
+
+    float h = 1.f / static_cast<float>(count - 1);
+    float h2 = h * h;
+    float h3 = h2 * h;
+
+    constexpr size_t K = kComponents<V>;
+
+    const float* a = Components(coefficients[0]);
+    const float* b = Components(coefficients[1]);
+    const float* c = Components(coefficients[2]);
+    const float* d = Components(coefficients[3]);
+
+    float* o = reinterpret_cast<float*>(out);
+
+    // One component at a time so the differences stay in registers, the third is constant
+    for (size_t k = 0; k < K; k++)
+    {
+        float f = a[k];
+        float d1 = (b[k] * h) + (c[k] * h2) + (d[k] * h3);
+        float d2 = (c[k] * (2.f * h2)) + (d[k] * (6.f * h3));
+        float d3 = d[k] * (6.f * h3);
+
+        for (size_t i = 0; i + 1 < count; i++)
+        {
+            o[(i * K) + k] = f;
+
+            f += d1;
+            d1 += d2;
+            d2 += d3;
+        }
+    }
+
+    out[count - 1] = Evaluate(1.f);
+}
+
+// Spline
+
+template<typename V>
+Spline<V>::Spline():
+    m_ArcLengthSamples(0)
+{}
+
+template<typename V>
+Spline<V>::Spline(CurveBasis basis, const V* points, size_t count, size_t arcLengthSamples):
+    m_ArcLengthSamples(0)
+{
+    size_t step = 1;
+    if (basis == CurveBasis::Hermite)
+        step = 2;
+    else if (basis == CurveBasis::Bezier)
+        step = 3;
+
+    for (size_t i = 0; i + 3 < count; i += step)
+        m_Segments.emplace_back(basis, points[i], points[i + 1], points[i + 2], points[i + 3]);
+
+    if (arcLengthSamples != 0)
+        BuildArcLengthTable(arcLengthSamples);
+}
+
+template<typename V>
+size_t Spline<V>::SegmentCount() const
+{
+    return m_Segments.size();
+}
+
+template<typename V>
+const CubicCurve<V>& Spline<V>::Segment(size_t i) const
+{
+    assert(i < m_Segments.size());
+    return m_Segments[i];
+}
+
+template<typename V>
+V Spline<V>::Evaluate(float u) const
+{
+    assert(!m_Segments.empty());
+
+    size_t segment;
+    float t;
+    Locate(u, m_Segments.size(), segment, t);
+
+    return m_Segments[segment].Evaluate(t);
+}
+
+template<typename V>
+V Spline<V>::Tangent(float u) const
+{
+    assert(!m_Segments.empty());
+
+    size_t segment;
+    float t;
+    Locate(u, m_Segments.size(), segment, t);
+
+    return m_Segments[segment].Tangent(t);
+}
+
+template<typename V>
+void Spline<V>::Evaluate(const float* u, V* out, size_t count) const
+{
+    assert(count == 0 || !m_Segments.empty());
+
+    constexpr size_t K = kComponents<V>;
+    float* f = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        const CubicCurve<V>* curves[SimdFloat::Width];
+        alignas(32) float t[SimdFloat::Width];
+
+        for (size_t lane = 0; lane < SimdFloat::Width; lane++)
+        {
+            size_t segment;
+            Locate(u[i + lane], m_Segments.size(), segment, t[lane]);
+            curves[lane] = &m_Segments[segment];
+        }
+
+        EvaluateLanes(curves, SimdFloat::Load(t), f + (i * K));
+    }
+
+    for (; i < count; i++)
+        out[i] = Evaluate(u[i]);
+}
+
+template<typename V>
+void Spline<V>::EvaluateUniform(V* out, size_t samplesPerSegment) const
+{
+    assert(samplesPerSegment != 0);
+
+    // Each segment also writes its end point, which the next one overwrites with its start
+    for (size_t i = 0; i < m_Segments.size(); i++)
+        m_Segments[i].EvaluateUniform(out + (i * samplesPerSegment), samplesPerSegment + 1);
+}
+
+template<typename V>
+void Spline<V>::BuildArcLengthTable(size_t samples)
+{
+    m_ArcLengths.clear();
+    m_ArcLengthSamples = samples;
+
+    if (samples == 0 || m_Segments.empty())
+        return;
+
+    size_t n = m_Segments.size() * samples;
+    std::vector<V> points(n + 1);
+    EvaluateUniform(points.data(), samples);
+
+    m_ArcLengths.resize(n + 1);
+    m_ArcLengths[0] = 0.f;
+
+    // Double so thousands of short chords don't lose the total
+    double length = 0.0;
+    for (size_t i = 1; i <= n; i++)
+    {
+        length += (points[i] - points[i - 1]).Length();
+        m_ArcLengths[i] = static_cast<float>(length);
+    }
+}
+
+template<typename V>
+float Spline<V>::Length() const
+{
+    assert(!m_ArcLengths.empty());
+    return m_ArcLengths.back();
+}
+
+template<typename V>
+float Spline<V>::ParameterAtDistance(float s) const
+{
+    assert(!m_ArcLengths.empty());
+
+    if (!(s > 0.f))
+        return 0.f;
+
+    if (s >= m_ArcLengths.back())
+        return static_cast<float>(m_Segments.size());
+
+    // First entry past s, s is below the last so this is in range
+    size_t hi = static_cast<size_t>(std::upper_bound(m_ArcLengths.begin(), m_ArcLengths.end(), s) - m_ArcLengths.begin());
+    size_t lo = hi - 1;
+
+    float chord = m_ArcLengths[hi] - m_ArcLengths[lo];
+    float frac = (chord > 0.f) ? (s - m_ArcLengths[lo]) / chord : 0.f;
+
+    return (static_cast<float>(lo) + frac) / static_cast<float>(m_ArcLengthSamples);
+}
+
+template<typename V>
+void Spline<V>::EvaluateAtDistance(const float* s, V* out, size_t count) const
+{
+    // Parameters in blocks so there is no allocation
+    constexpr size_t kBlock = 256;
+    float u[kBlock];
+
+    for (size_t i = 0; i < count; i += kBlock)
+    {
+        size_t n = std::min(kBlock, count - i);
+
+        for (size_t j = 0; j < n; j++)
+            u[j] = ParameterAtDistance(s[i + j]);
+
+        Evaluate(u, out + i, n);
+    }
+}
+
+template struct CubicCurve<Vector2>;
+template struct CubicCurve<Vector3>;
+template struct CubicCurve<Vector4>;
+
+template struct Spline<Vector2>;
+template struct Spline<Vector3>;
+template struct Spline<Vector4>;
+
+// Squad
+
+Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t)
+{
+    Quaternion res;
+    SlerpLanes(Broadcast<ScalarFloat>(a), Broadcast<ScalarFloat>(b), ScalarFloat{t}).Store(&res);
+
+    return res;
+}
+
+Quaternion SquadControl(const Quaternion& prev, const Quaternion& q, const Quaternion& next)
+{
+    // Neighbours in q's hemisphere, so the logs are of the shorter rotations
+    Quaternion p = (q.Dot(prev) < 0.f) ? prev * -1.f : prev;
+    Quaternion n = (q.Dot(next) < 0.f) ? next * -1.f : next;
+
+    Quaternion inv = Conjugate(q);
+    Vector3 sum = Log(inv * n) + Log(inv * p);
+
+    return q * Exp(sum * -0.25f);
+}
+
+Quaternion Squad(const Quaternion& q0, const Quaternion& q1, const Quaternion& s0, const Quaternion& s1, float t)
+{
+    Quaternion res;
+    SquadLanes(Broadcast<ScalarFloat>(q0), Broadcast<ScalarFloat>(q1), Broadcast<ScalarFloat>(s0), Broadcast<ScalarFloat>(s1), ScalarFloat{t}).Store(&res);
+
+    return res;
+}
+
+void Squad(const Quaternion& q0, const Quaternion& q1, const Quaternion& s0, const Quaternion& s1, const float* t, Quaternion* out, size_t count)
+{
+    QuaternionLanes<SimdFloat> a = Broadcast<SimdFloat>(q0);
+    QuaternionLanes<SimdFloat> b = Broadcast<SimdFloat>(q1);
+    QuaternionLanes<SimdFloat> c = Broadcast<SimdFloat>(s0);
+    QuaternionLanes<SimdFloat> d = Broadcast<SimdFloat>(s1);
+
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        SquadLanes(a, b, c, d, SimdFloat::Load(t + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = Squad(q0, q1, s0, s1, t[i]);
+}
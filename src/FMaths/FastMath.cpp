@@ -0,0 +1,116 @@
+#include "FMaths/FastMath.h"
+
+#include "SimdMath.h"
+
+namespace
+{
+
+/**
+ * @brief Apply a lane function over an array, SIMD blocks first then scalar tail
+ *
+ * @param fn Generic callable taking a lane and returning a lane
+ */
+template<typename Fn>
+void Map(const float* x, float* out, size_t count, Fn fn)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        fn(SimdFloat::Load(x + i)).Store(out + i);
+
+    for (; i < count; i++)
+        fn(ScalarFloat::Load(x + i)).Store(out + i);
+}
+
+} // namespace
+
+float Sin(float x)
+{
+    return SimdMath::Sin(ScalarFloat{x}).v;
+}
+
+float Cos(float x)
+{
+    return SimdMath::Cos(ScalarFloat{x}).v;
+}
+
+void SinCos(float x, float& s, float& c)
+{
+    ScalarFloat sl, cl;
+    SimdMath::SinCos(ScalarFloat{x}, sl, cl);
+
+    s = sl.v;
+    c = cl.v;
+}
+
+float Tan(float x)
+{
+    return SimdMath::Tan(ScalarFloat{x}).v;
+}
+
+float Atan2(float y, float x)
+{
+    return SimdMath::Atan2(ScalarFloat{y}, ScalarFloat{x}).v;
+}
+
+float Acos(float x)
+{
+    return SimdMath::Acos(ScalarFloat{x}).v;
+}
+
+float InvSqrt(float x)
+{
+    return SimdMath::InvSqrtFast(ScalarFloat{x}).v;
+}
+
+void Sin(const float* x, float* out, size_t count)
+{
+    Map(x, out, count, [](auto v) { return SimdMath::Sin(v); });
+}
+
+void Cos(const float* x, float* out, size_t count)
+{
+    Map(x, out, count, [](auto v) { return SimdMath::Cos(v); });
+}
+
+void SinCos(const float* x, float* s, float* c, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        SimdFloat sl, cl;
+        SimdMath::SinCos(SimdFloat::Load(x + i), sl, cl);
+        sl.Store(s + i);
+        cl.Store(c + i);
+    }
+
+    for (; i < count; i++)
+        SinCos(x[i], s[i], c[i]);
+}
+
+void Tan(const float* x, float* out, size_t count)
+{
+    Map(x, out, count, [](auto v) { return SimdMath::Tan(v); });
+}
+
+void Atan2(const float* y, const float* x, float* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        SimdMath::Atan2(SimdFloat::Load(y + i), SimdFloat::Load(x + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = Atan2(y[i], x[i]);
+}
+
+void Acos(const float* x, float* out, size_t count)
+{
+    Map(x, out, count, [](auto v) { return SimdMath::Acos(v); });
+}
+
+void InvSqrt(const float* x, float* out, size_t count)
+{
+    Map(x, out, count, [](auto v) { return SimdMath::InvSqrtFast(v); });
+}
@@ -0,0 +1,182 @@
+#include "FMaths/Fixed.h"
+
+#include "FixedMath.h"
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>::Fixed():
+    raw(0)
+{}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>::Fixed(float f):
+    raw(FixedMath::FromReal<FracBits, T>(f))
+{}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>::Fixed(double d):
+    raw(FixedMath::FromReal<FracBits, T>(d))
+{}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>::Fixed(int i):
+    raw(FixedMath::Saturate<T>(FixedMath::WideOf<T>(i) * (FixedMath::WideOf<T>(1) << FracBits)))
+{}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::FromRaw(Raw raw)
+{
+    Fixed res;
+    res.raw = raw;
+
+    return res;
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::Lowest()
+{
+    return FromRaw(FixedMath::kLowest<T>);
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::Highest()
+{
+    return FromRaw(FixedMath::kHighest<T>);
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::Epsilon()
+{
+    return FromRaw(1);
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>::operator float() const
+{
+    return FixedMath::ToReal<FracBits, T, float>(raw);
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>::operator double() const
+{
+    return FixedMath::ToReal<FracBits, T, double>(raw);
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::Sqrt() const
+{
+    return FromRaw(FixedMath::Sqrt<FracBits>(raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::InvSqrt() const
+{
+    return FromRaw(FixedMath::InvSqrt<FracBits>(raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::Abs() const
+{
+    return FromRaw(FixedMath::Abs(raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::operator+(Fixed f) const
+{
+    return FromRaw(FixedMath::Add(raw, f.raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::operator-(Fixed f) const
+{
+    return FromRaw(FixedMath::Sub(raw, f.raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::operator*(Fixed f) const
+{
+    return FromRaw(FixedMath::Mul<FracBits>(raw, f.raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::operator/(Fixed f) const
+{
+    return FromRaw(FixedMath::Div<FracBits>(raw, f.raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits> Fixed<T, FracBits>::operator-() const
+{
+    return FromRaw(FixedMath::Neg(raw));
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>& Fixed<T, FracBits>::operator+=(Fixed f)
+{
+    return *this = *this + f;
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>& Fixed<T, FracBits>::operator-=(Fixed f)
+{
+    return *this = *this - f;
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>& Fixed<T, FracBits>::operator*=(Fixed f)
+{
+    return *this = *this * f;
+}
+
+template<typename T, size_t FracBits>
+Fixed<T, FracBits>& Fixed<T, FracBits>::operator/=(Fixed f)
+{
+    return *this = *this / f;
+}
+
+template<typename T, size_t FracBits>
+bool Fixed<T, FracBits>::operator==(Fixed f) const
+{
+    return raw == f.raw;
+}
+
+template<typename T, size_t FracBits>
+bool Fixed<T, FracBits>::operator!=(Fixed f) const
+{
+    return raw != f.raw;
+}
+
+template<typename T, size_t FracBits>
+bool Fixed<T, FracBits>::operator<(Fixed f) const
+{
+    return raw < f.raw;
+}
+
+template<typename T, size_t FracBits>
+bool Fixed<T, FracBits>::operator<=(Fixed f) const
+{
+    return raw <= f.raw;
+}
+
+template<typename T, size_t FracBits>
+bool Fixed<T, FracBits>::operator>(Fixed f) const
+{
+    return raw > f.raw;
+}
+
+template<typename T, size_t FracBits>
+bool Fixed<T, FracBits>::operator>=(Fixed f) const
+{
+    return raw >= f.raw;
+}
+
+template<typename T, size_t FracBits>
+void SinCos(Fixed<T, FracBits> x, Fixed<T, FracBits>& s, Fixed<T, FracBits>& c)
+{
+    FixedMath::SinCos<FracBits>(x.raw, s.raw, c.raw);
+}
+
+template struct Fixed<int32_t, 16>;
+template struct Fixed<int64_t, 32>;
+
+template void SinCos(Q16 x, Q16& s, Q16& c);
+template void SinCos(Q32 x, Q32& s, Q32& c);
@@ -0,0 +1,336 @@
+/**
+ * @file FixedMath.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal saturating arithmetic on raw fixed point values
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef FIXEDMATH_H
+#define FIXEDMATH_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Shared by Fixed and the integer lanes so scalar and batched results match.
+// Intermediates are held in an integer twice as wide as the raw value.
+
+namespace FixedMath
+{
+
+__extension__ typedef __int128 Int128;
+__extension__ typedef unsigned __int128 UInt128;
+
+template<typename Raw>
+struct Wide;
+
+template<>
+struct Wide<int32_t>
+{
+    using Signed = int64_t;
+    using Unsigned = uint64_t;
+};
+
+template<>
+struct Wide<int64_t>
+{
+    using Signed = Int128;
+    using Unsigned = UInt128;
+};
+
+template<typename Raw>
+using WideOf = typename Wide<Raw>::Signed;
+
+template<typename Raw>
+using UnsignedWideOf = typename Wide<Raw>::Unsigned;
+
+template<typename Raw>
+constexpr Raw kLowest = std::numeric_limits<Raw>::min();
+
+template<typename Raw>
+constexpr Raw kHighest = std::numeric_limits<Raw>::max();
+
+/**
+ * @brief pi / 2 * 2^124, scaled down to the precision Reduce needs
+ */
+constexpr UInt128 kHalfPi124 = (UInt128(0x1921fb54442d1846ull) << 64) | 0x9898cc51701b839aull;
+
+template<typename Raw>
+Raw Saturate(WideOf<Raw> v)
+{
+    if (v < kLowest<Raw>)
+        return kLowest<Raw>;
+
+    if (v > kHighest<Raw>)
+        return kHighest<Raw>;
+
+    return static_cast<Raw>(v);
+}
+
+template<typename Raw>
+Raw Add(Raw a, Raw b)
+{
+    return Saturate<Raw>(WideOf<Raw>(a) + b);
+}
+
+template<typename Raw>
+Raw Sub(Raw a, Raw b)
+{
+    return Saturate<Raw>(WideOf<Raw>(a) - b);
+}
+
+template<typename Raw>
+Raw Neg(Raw a)
+{
+    return Saturate<Raw>(-WideOf<Raw>(a));
+}
+
+/**
+ * @brief Shift right by Frac rounding to nearest, ties towards +infinity
+ */
+template<size_t Frac, typename W>
+W RoundShift(W v)
+{
+    return (v + (W(1) << (Frac - 1))) >> Frac;
+}
+
+template<size_t Frac, typename Raw>
+Raw Mul(Raw a, Raw b)
+{
+    return Saturate<Raw>(RoundShift<Frac>(WideOf<Raw>(a) * b));
+}
+
+template<size_t Frac, typename Raw>
+Raw Div(Raw a, Raw b)
+{
+    using W = WideOf<Raw>;
+
+    if (b == 0)
+        return (a > 0) ? kHighest<Raw> : ((a < 0) ? kLowest<Raw> : 0);
+
+    // Half the divisor away from zero, so the truncating divide rounds to nearest
+    W n = W(a) * (W(1) << Frac);
+    W half = W(b) / 2;
+    n += ((n < 0) == (b < 0)) ? half : -half;
+
+    return Saturate<Raw>(n / b);
+}
+
+/**
+ * @brief floor(sqrt(n)), one bit at a time
+ */
+template<typename U>
+U ISqrt(U n)
+{
+    U res = 0;
+    U bit = U(1) << ((sizeof(U) * 8) - 2);
+
+    while (bit > n)
+        bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (n >= res + bit)
+        {
+            n -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+            res >>= 1;
+
+        bit >>= 2;
+    }
+
+    return res;
+}
+
+/**
+ * @brief sqrt(n) rounded to nearest
+ */
+template<typename U>
+U ISqrtRounded(U n)
+{
+    U s = ISqrt(n);
+
+    // (s + 1/2)^2 = s^2 + s + 1/4, so round up when the remainder exceeds s
+    return (n - (s * s) > s) ? s + 1 : s;
+}
+
+template<size_t Frac, typename Raw>
+Raw Sqrt(Raw a)
+{
+    if (a <= 0)
+        return 0;
+
+    // sqrt(a / 2^F) * 2^F = sqrt(a * 2^F)
+    return static_cast<Raw>(ISqrtRounded(UnsignedWideOf<Raw>(a) << Frac));
+}
+
+template<size_t Frac, typename Raw>
+Raw InvSqrt(Raw a)
+{
+    if (a <= 0)
+        return kHighest<Raw>;
+
+    // 2^F / sqrt(a / 2^F) = sqrt(2^3F / a)
+    using U = UnsignedWideOf<Raw>;
+    return Saturate<Raw>(static_cast<WideOf<Raw>>(ISqrtRounded((U(1) << (3 * Frac)) / U(a))));
+}
+
+template<typename Raw>
+Raw Abs(Raw a)
+{
+    return (a < 0) ? Neg(a) : a;
+}
+
+/**
+ * @brief Exact sum of squares, Lowest counts as -Highest so four terms can't overflow
+ */
+template<typename Raw, size_t N>
+UnsignedWideOf<Raw> SumSquares(const Raw (&c)[N])
+{
+    using U = UnsignedWideOf<Raw>;
+    U sum = 0;
+
+    for (Raw v : c)
+    {
+        WideOf<Raw> m = (v == kLowest<Raw>) ? kHighest<Raw> : v;
+        U magnitude = static_cast<U>((m < 0) ? -m : m);
+
+        sum += magnitude * magnitude;
+    }
+
+    return sum;
+}
+
+template<size_t Frac, typename Raw, size_t N>
+Raw LengthSquared(const Raw (&c)[N])
+{
+    using U = UnsignedWideOf<Raw>;
+    U r = (SumSquares(c) + (U(1) << (Frac - 1))) >> Frac;
+
+    return (r > U(kHighest<Raw>)) ? kHighest<Raw> : static_cast<Raw>(r);
+}
+
+/**
+ * @brief Length in raw units, from the exact sum of squares rather than a rounded LengthSquared
+ */
+template<typename Raw, size_t N>
+Raw Length(const Raw (&c)[N])
+{
+    using U = UnsignedWideOf<Raw>;
+    U r = ISqrtRounded(SumSquares(c));
+
+    return (r > U(kHighest<Raw>)) ? kHighest<Raw> : static_cast<Raw>(r);
+}
+
+/**
+ * @brief Scale to unit length, dividing by the exact length so small vectors keep their precision
+ *
+ * A zero vector is left unchanged.
+ */
+template<size_t Frac, typename Raw, size_t N>
+void Normalize(Raw (&c)[N])
+{
+    using W = WideOf<Raw>;
+
+    // At most 2^32 or 2^64, which fits the signed wide type
+    W length = static_cast<W>(ISqrtRounded(SumSquares(c)));
+    if (length == 0)
+        return;
+
+    for (Raw& v : c)
+    {
+        W n = W(v) * (W(1) << Frac);
+        n += (n < 0) ? -(length / 2) : (length / 2);
+
+        v = Saturate<Raw>(n / length);
+    }
+}
+
+/**
+ * @brief Nearest raw value to f * 2^Frac, ties to even, saturating. NaN gives 0
+ *
+ * Float is scaled in float, matching the lane conversions.
+ */
+template<size_t Frac, typename Raw, typename Real>
+Raw FromReal(Real f)
+{
+    Real scaled = f * static_cast<Real>(WideOf<Raw>(1) << Frac);
+    Real limit = static_cast<Real>(WideOf<Raw>(1) << ((sizeof(Raw) * 8) - 1));
+
+    if (scaled != scaled)
+        return 0;
+
+    // Values just below the limit are already whole, so nearbyint can't round up to it
+    if (scaled >= limit)
+        return kHighest<Raw>;
+
+    if (scaled <= -limit)
+        return kLowest<Raw>;
+
+    return static_cast<Raw>(std::nearbyint(scaled));
+}
+
+template<size_t Frac, typename Raw, typename Real>
+Real ToReal(Raw raw)
+{
+    return static_cast<Real>(raw) * (Real(1) / static_cast<Real>(WideOf<Raw>(1) << Frac));
+}
+
+/**
+ * @brief x reduced to r in about [-pi/4, pi/4] where x = r + q * pi/2
+ *
+ * pi / 2 carries 30 extra fraction bits, so large angles keep their precision
+ * while q * pi / 2 still fits the wide type.
+ *
+ * @param quadrant Set to q mod 4
+ */
+template<size_t Frac, typename Raw>
+Raw Reduce(Raw x, int& quadrant)
+{
+    using W = WideOf<Raw>;
+
+    W halfPiExtended = static_cast<W>(kHalfPi124 >> (124 - (Frac + 30)));
+    W twoOverPi = FromReal<Frac, Raw>(0.63661977236758134);
+
+    W q = RoundShift<2 * Frac>(W(x) * twoOverPi);
+    W r = RoundShift<30>((W(x) * (W(1) << 30)) - (q * halfPiExtended));
+
+    quadrant = static_cast<int>(q & 3);
+    return static_cast<Raw>(r);
+}
+
+template<size_t Frac, typename Raw>
+void SinCos(Raw x, Raw& s, Raw& c)
+{
+    int quadrant;
+    Raw r = Reduce<Frac, Raw>(x, quadrant);
+    Raw r2 = Mul<Frac>(r, r);
+
+    // Taylor series to r^9 and r^10, the truncation error is below 2^-28 at pi/4
+    auto k = [](double v) { return FromReal<Frac, Raw>(v); };
+
+    Raw sp = Add(k(-1.0 / 6.0), Mul<Frac>(r2, Add(k(1.0 / 120.0), Mul<Frac>(r2, Add(k(-1.0 / 5040.0), Mul<Frac>(r2, k(1.0 / 362880.0)))))));
+    Raw sr = Add(r, Mul<Frac>(Mul<Frac>(r, r2), sp));
+
+    Raw cp = Add(k(1.0 / 24.0), Mul<Frac>(r2, Add(k(-1.0 / 720.0), Mul<Frac>(r2, Add(k(1.0 / 40320.0), Mul<Frac>(r2, k(-1.0 / 3628800.0)))))));
+    Raw cr = Add(Sub(k(1.0), Mul<Frac>(r2, k(0.5))), Mul<Frac>(Mul<Frac>(r2, r2), cp));
+
+    // Quadrants 1 and 3 swap sin and cos, sin is negated in 2 and 3, cos in 1 and 2
+    bool swap = (quadrant & 1) != 0;
+    Raw sv = swap ? cr : sr;
+    Raw cv = swap ? sr : cr;
+
+    s = (quadrant >= 2) ? Neg(sv) : sv;
+    c = (quadrant == 1 || quadrant == 2) ? Neg(cv) : cv;
+}
+
+} // namespace FixedMath
+
+#endif
@@ -0,0 +1,301 @@
+#include "FMaths/FixedMatrix4x4.h"
+
+#include <cassert>
+
+#include "FMaths/Matrix4x4.h"
+
+#include "FixedSimd.h"
+
+static_assert(sizeof(Matrix4x4Q16) == sizeof(int32_t) * 16, "Matrix4x4Q16 must be tightly packed");
+static_assert(sizeof(Matrix4x4Q32) == sizeof(int64_t) * 16, "Matrix4x4Q32 must be tightly packed");
+static_assert(sizeof(Matrix4x4) == sizeof(float) * 16, "Matrix4x4 must be tightly packed");
+
+namespace
+{
+
+/**
+ * @brief W fixed point matrices in integer lanes, m[col][row]
+ */
+template<typename T, typename L>
+struct FixedMatrixLanes
+{
+    using Raw = typename T::Raw;
+
+    L m[4][4];
+
+    static FixedMatrixLanes Load(const FixedMatrix4x4<T>* p)
+    {
+        const Raw* r = reinterpret_cast<const Raw*>(p);
+        FixedMatrixLanes res;
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                res.m[col][row] = L::Gather(r + (col * 4) + row, 16);
+
+        return res;
+    }
+
+    void Store(FixedMatrix4x4<T>* p) const
+    {
+        Raw* r = reinterpret_cast<Raw*>(p);
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                m[col][row].Scatter(r + (col * 4) + row, 16);
+    }
+};
+
+template<typename T, typename L>
+FixedMatrixLanes<T, L> MultiplyLanes(const FixedMatrixLanes<T, L>& a, const FixedMatrixLanes<T, L>& b)
+{
+    FixedMatrixLanes<T, L> res;
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+            res.m[col][row] = (((a.m[0][row] * b.m[col][0]) + (a.m[1][row] * b.m[col][1])) + (a.m[2][row] * b.m[col][2])) + (a.m[3][row] * b.m[col][3]);
+
+    return res;
+}
+
+} // namespace
+
+template<typename T>
+FixedMatrix4x4<T>::FixedMatrix4x4():
+    m_Columns()
+{}
+
+template<typename T>
+FixedMatrix4x4<T>::FixedMatrix4x4(T s):
+    m_Columns{
+        FixedVector4<T>(s, T(), T(), T()),
+        FixedVector4<T>(T(), s, T(), T()),
+        FixedVector4<T>(T(), T(), s, T()),
+        FixedVector4<T>(T(), T(), T(), s)
+    }
+{}
+
+template<typename T>
+FixedMatrix4x4<T>::FixedMatrix4x4(const FixedVector4<T>& col0, const FixedVector4<T>& col1, const FixedVector4<T>& col2, const FixedVector4<T>& col3):
+    m_Columns{col0, col1, col2, col3}
+{}
+
+template<typename T>
+FixedMatrix4x4<T>::FixedMatrix4x4(const Matrix4x4& m):
+    m_Columns{FixedVector4<T>(m[0]), FixedVector4<T>(m[1]), FixedVector4<T>(m[2]), FixedVector4<T>(m[3])}
+{}
+
+template<typename T>
+Matrix4x4 FixedMatrix4x4<T>::ToFloat() const
+{
+    return Matrix4x4(m_Columns[0].ToFloat(), m_Columns[1].ToFloat(), m_Columns[2].ToFloat(), m_Columns[3].ToFloat());
+}
+
+template<typename T>
+FixedMatrix4x4<T> FixedMatrix4x4<T>::Inverse() const
+{
+    const FixedVector4<T>* m = m_Columns;
+
+    // Find determinants for submatrices
+    T s0 = (m[0][0] * m[1][1]) - (m[0][1] * m[1][0]);
+    T s1 = (m[0][0] * m[1][2]) - (m[0][2] * m[1][0]);
+    T s2 = (m[0][0] * m[1][3]) - (m[0][3] * m[1][0]);
+    T s3 = (m[0][1] * m[1][2]) - (m[0][2] * m[1][1]);
+    T s4 = (m[0][1] * m[1][3]) - (m[0][3] * m[1][1]);
+    T s5 = (m[0][2] * m[1][3]) - (m[0][3] * m[1][2]);
+
+    T c0 = (m[2][0] * m[3][1]) - (m[2][1] * m[3][0]);
+    T c1 = (m[2][0] * m[3][2]) - (m[2][2] * m[3][0]);
+    T c2 = (m[2][0] * m[3][3]) - (m[2][3] * m[3][0]);
+    T c3 = (m[2][1] * m[3][2]) - (m[2][2] * m[3][1]);
+    T c4 = (m[2][1] * m[3][3]) - (m[2][3] * m[3][1]);
+    T c5 = (m[2][2] * m[3][3]) - (m[2][3] * m[3][2]);
+
+    T determinant = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+    if (determinant == T())
+        return Identity();
+
+    // Adjugate = transpose of cofactor
+    FixedVector4<T> adj[4] = {
+        FixedVector4<T>(
+             (m[1][1] * c5) - (m[1][2] * c4) + (m[1][3] * c3),
+            -(m[0][1] * c5) + (m[0][2] * c4) - (m[0][3] * c3),
+             (m[3][1] * s5) - (m[3][2] * s4) + (m[3][3] * s3),
+            -(m[2][1] * s5) + (m[2][2] * s4) - (m[2][3] * s3)
+        ),
+        FixedVector4<T>(
+            -(m[1][0] * c5) + (m[1][2] * c2) - (m[1][3] * c1),
+             (m[0][0] * c5) - (m[0][2] * c2) + (m[0][3] * c1),
+            -(m[3][0] * s5) + (m[3][2] * s2) - (m[3][3] * s1),
+             (m[2][0] * s5) - (m[2][2] * s2) + (m[2][3] * s1)
+        ),
+        FixedVector4<T>(
+             (m[1][0] * c4) - (m[1][1] * c2) + (m[1][3] * c0),
+            -(m[0][0] * c4) + (m[0][1] * c2) - (m[0][3] * c0),
+             (m[3][0] * s4) - (m[3][1] * s2) + (m[3][3] * s0),
+            -(m[2][0] * s4) + (m[2][1] * s2) - (m[2][3] * s0)
+        ),
+        FixedVector4<T>(
+            -(m[1][0] * c3) + (m[1][1] * c1) - (m[1][2] * c0),
+             (m[0][0] * c3) - (m[0][1] * c1) + (m[0][2] * c0),
+            -(m[3][0] * s3) + (m[3][1] * s1) - (m[3][2] * s0),
+             (m[2][0] * s3) - (m[2][1] * s1) + (m[2][2] * s0)
+        )
+    };
+
+    // Divide rather than scale by 1 / det, a rounded reciprocal of a large determinant keeps few bits
+    for (FixedVector4<T>& col : adj)
+        col /= determinant;
+
+    return FixedMatrix4x4(adj[0], adj[1], adj[2], adj[3]);
+}
+
+template<typename T>
+FixedMatrix4x4<T> FixedMatrix4x4<T>::Transpose() const
+{
+    FixedMatrix4x4 res;
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+            res.m_Columns[row][col] = m_Columns[col][row];
+
+    return res;
+}
+
+template<typename T>
+FixedVector4<T>& FixedMatrix4x4<T>::operator[](size_t i)
+{
+    assert(i < 4);
+    return m_Columns[i];
+}
+
+template<typename T>
+const FixedVector4<T>& FixedMatrix4x4<T>::operator[](size_t i) const
+{
+    assert(i < 4);
+    return m_Columns[i];
+}
+
+template<typename T>
+FixedMatrix4x4<T> FixedMatrix4x4<T>::operator*(const FixedMatrix4x4& m) const
+{
+    FixedMatrix4x4 res;
+
+    for (size_t col = 0; col < 4; col++)
+        res.m_Columns[col] = operator*(m.m_Columns[col]);
+
+    return res;
+}
+
+template<typename T>
+FixedMatrix4x4<T>& FixedMatrix4x4<T>::operator*=(const FixedMatrix4x4& m)
+{
+    return *this = *this * m;
+}
+
+template<typename T>
+FixedVector4<T> FixedMatrix4x4<T>::operator*(const FixedVector4<T>& v) const
+{
+    FixedVector4<T> res;
+
+    for (size_t row = 0; row < 4; row++)
+        res[row] = (((m_Columns[0][row] * v.x) + (m_Columns[1][row] * v.y)) + (m_Columns[2][row] * v.z)) + (m_Columns[3][row] * v.w);
+
+    return res;
+}
+
+template<typename T>
+FixedMatrix4x4<T> FixedMatrix4x4<T>::operator*(T s) const
+{
+    return FixedMatrix4x4(m_Columns[0] * s, m_Columns[1] * s, m_Columns[2] * s, m_Columns[3] * s);
+}
+
+template<typename T>
+FixedMatrix4x4<T>& FixedMatrix4x4<T>::operator*=(T s)
+{
+    return *this = *this * s;
+}
+
+template<typename T>
+bool FixedMatrix4x4<T>::operator==(const FixedMatrix4x4& m) const
+{
+    return (m_Columns[0] == m.m_Columns[0]) && (m_Columns[1] == m.m_Columns[1]) &&
+        (m_Columns[2] == m.m_Columns[2]) && (m_Columns[3] == m.m_Columns[3]);
+}
+
+template<typename T>
+bool FixedMatrix4x4<T>::operator!=(const FixedMatrix4x4& m) const
+{
+    return !operator==(m);
+}
+
+template<typename T>
+FixedMatrix4x4<T> FixedMatrix4x4<T>::Identity()
+{
+    return FixedMatrix4x4(T(1));
+}
+
+template<typename T>
+FixedMatrix4x4<T> FixedMatrix4x4<T>::Translate(const FixedVector3<T>& v)
+{
+    FixedMatrix4x4 trans = Identity();
+    trans[3] = FixedVector4<T>(v);
+
+    return trans;
+}
+
+template<typename T>
+FixedMatrix4x4<T> FixedMatrix4x4<T>::Scale(const FixedVector3<T>& v)
+{
+    FixedMatrix4x4 scale = Identity();
+
+    for (size_t i = 0; i < 3; i++)
+        scale[i][i] = v[i];
+
+    return scale;
+}
+
+template<typename T>
+void FixedMatrix4x4<T>::Multiply(const FixedMatrix4x4* a, const FixedMatrix4x4* b, FixedMatrix4x4* out, size_t count)
+{
+    using L = SimdFixed<T>;
+    using Lanes = FixedMatrixLanes<T, L>;
+
+    size_t i = 0;
+
+    for (; i + L::Width <= count; i += L::Width)
+        MultiplyLanes(Lanes::Load(a + i), Lanes::Load(b + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = a[i] * b[i];
+}
+
+template<typename T>
+void FixedMatrix4x4<T>::Inverse(const FixedMatrix4x4* m, FixedMatrix4x4* out, size_t count)
+{
+    // Branches on the determinant and divides, which integer lanes can't do
+    for (size_t i = 0; i < count; i++)
+        out[i] = m[i].Inverse();
+}
+
+template<typename T>
+void FixedMatrix4x4<T>::Transpose(const FixedMatrix4x4* m, FixedMatrix4x4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        out[i] = m[i].Transpose();
+}
+
+template<typename T>
+void FixedMatrix4x4<T>::FromFloat(const Matrix4x4* m, FixedMatrix4x4* out, size_t count)
+{
+    // Both are packed columns, see the asserts above
+    FixedVector4<T>::FromFloat(reinterpret_cast<const Vector4*>(m), reinterpret_cast<FixedVector4<T>*>(out), count * 4);
+}
+
+template<typename T>
+void FixedMatrix4x4<T>::ToFloat(const FixedMatrix4x4* m, Matrix4x4* out, size_t count)
+{
+    FixedVector4<T>::ToFloat(reinterpret_cast<const FixedVector4<T>*>(m), reinterpret_cast<Vector4*>(out), count * 4);
+}
+
+template struct FixedMatrix4x4<Q16>;
+template struct FixedMatrix4x4<Q32>;
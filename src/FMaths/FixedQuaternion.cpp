@@ -0,0 +1,311 @@
+#include "FMaths/FixedQuaternion.h"
+
+#include <cassert>
+
+#include "FMaths/Quaternion.h"
+
+#include "FixedSimd.h"
+
+static_assert(sizeof(QuaternionQ16) == sizeof(int32_t) * 4, "QuaternionQ16 must be tightly packed");
+static_assert(sizeof(QuaternionQ32) == sizeof(int64_t) * 4, "QuaternionQ32 must be tightly packed");
+
+namespace
+{
+
+template<typename L>
+struct FixedApplyLanes
+{
+    L x, y, z;
+};
+
+/**
+ * @brief v + w t + u x t with t = 2 (u x v), in the same order as FixedQuaternion::Apply
+ */
+template<typename L>
+FixedApplyLanes<L> ApplyLanes(L qx, L qy, L qz, L qw, const FixedApplyLanes<L>& v)
+{
+    L cx = (qy * v.z) - (qz * v.y);
+    L cy = (qz * v.x) - (qx * v.z);
+    L cz = (qx * v.y) - (qy * v.x);
+
+    L tx = cx + cx;
+    L ty = cy + cy;
+    L tz = cz + cz;
+
+    return {
+        (v.x + (tx * qw)) + ((qy * tz) - (qz * ty)),
+        (v.y + (ty * qw)) + ((qz * tx) - (qx * tz)),
+        (v.z + (tz * qw)) + ((qx * ty) - (qy * tx))
+    };
+}
+
+template<typename T, typename L>
+FixedApplyLanes<L> LoadLanes(const FixedVector3<T>* p)
+{
+    using Raw = typename T::Raw;
+    const Raw* r = reinterpret_cast<const Raw*>(p);
+
+    return {L::Gather(r, 3), L::Gather(r + 1, 3), L::Gather(r + 2, 3)};
+}
+
+template<typename T, typename L>
+void StoreLanes(const FixedApplyLanes<L>& v, FixedVector3<T>* p)
+{
+    using Raw = typename T::Raw;
+    Raw* r = reinterpret_cast<Raw*>(p);
+
+    v.x.Scatter(r, 3);
+    v.y.Scatter(r + 1, 3);
+    v.z.Scatter(r + 2, 3);
+}
+
+} // namespace
+
+template<typename T>
+FixedQuaternion<T>::FixedQuaternion():
+    x(), y(), z(), w(1)
+{}
+
+template<typename T>
+FixedQuaternion<T>::FixedQuaternion(T x, T y, T z, T w):
+    x(x), y(y), z(z), w(w)
+{}
+
+template<typename T>
+FixedQuaternion<T>::FixedQuaternion(const FixedVector3<T>& axis, T r)
+{
+    T s, c;
+    SinCos(r * T(0.5), s, c);
+
+    FixedVector3<T> v = axis.Normalized() * s;
+
+    x = v.x;
+    y = v.y;
+    z = v.z;
+    w = c;
+}
+
+template<typename T>
+FixedQuaternion<T>::FixedQuaternion(const Quaternion& q):
+    x(q.x), y(q.y), z(q.z), w(q.w)
+{}
+
+template<typename T>
+Quaternion FixedQuaternion<T>::ToFloat() const
+{
+    return Quaternion(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), static_cast<float>(w));
+}
+
+template<typename T>
+T FixedQuaternion<T>::Magnitude() const
+{
+    return FixedVector4<T>(x, y, z, w).Length();
+}
+
+template<typename T>
+T FixedQuaternion<T>::MagnitudeSquared() const
+{
+    return FixedVector4<T>(x, y, z, w).LengthSquared();
+}
+
+template<typename T>
+FixedQuaternion<T>& FixedQuaternion<T>::Normalize()
+{
+    FixedVector4<T> v = FixedVector4<T>(x, y, z, w).Normalize();
+    return *this = FixedQuaternion(v.x, v.y, v.z, v.w);
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::Normalized() const
+{
+    return FixedQuaternion(*this).Normalize();
+}
+
+template<typename T>
+bool FixedQuaternion<T>::IsNormalized() const
+{
+    return FixedVector4<T>(x, y, z, w).IsNormalized();
+}
+
+template<typename T>
+T FixedQuaternion<T>::Dot(const FixedQuaternion& q) const
+{
+    return FixedVector4<T>(x, y, z, w).Dot(FixedVector4<T>(q.x, q.y, q.z, q.w));
+}
+
+template<typename T>
+FixedVector3<T> FixedQuaternion<T>::Apply(const FixedVector3<T>& v) const
+{
+    FixedQuaternion q = Normalized();
+
+    FixedApplyLanes<ScalarFixed<T>> res = ApplyLanes<ScalarFixed<T>>(
+        {q.x.raw}, {q.y.raw}, {q.z.raw}, {q.w.raw}, {{v.x.raw}, {v.y.raw}, {v.z.raw}});
+
+    return FixedVector3<T>(T::FromRaw(res.x.v), T::FromRaw(res.y.v), T::FromRaw(res.z.v));
+}
+
+template<typename T>
+FixedVector4<T> FixedQuaternion<T>::Apply(const FixedVector4<T>& v) const
+{
+    return FixedVector4<T>(Apply(FixedVector3<T>(v)), v.w);
+}
+
+template<typename T>
+void FixedQuaternion<T>::Apply(const FixedVector3<T>* v, FixedVector3<T>* out, size_t count) const
+{
+    using L = SimdFixed<T>;
+
+    // Normalize once, Apply does it per call
+    FixedQuaternion q = Normalized();
+    L qx = L::Set(q.x.raw), qy = L::Set(q.y.raw), qz = L::Set(q.z.raw), qw = L::Set(q.w.raw);
+
+    size_t i = 0;
+
+    for (; i + L::Width <= count; i += L::Width)
+        StoreLanes(ApplyLanes(qx, qy, qz, qw, LoadLanes<T, L>(v + i)), out + i);
+
+    for (; i < count; i++)
+        out[i] = Apply(v[i]);
+}
+
+template<typename T>
+void FixedQuaternion<T>::Apply(const FixedQuaternion* q, const FixedVector3<T>* v, FixedVector3<T>* out, size_t count)
+{
+    using L = SimdFixed<T>;
+    using Raw = typename T::Raw;
+
+    size_t i = 0;
+
+    for (; i + L::Width <= count; i += L::Width)
+    {
+        // Normalizing needs a wide square root, so do it per quaternion before loading the lanes
+        FixedQuaternion unit[L::Width];
+        for (size_t j = 0; j < L::Width; j++)
+            unit[j] = q[i + j].Normalized();
+
+        const Raw* r = reinterpret_cast<const Raw*>(unit);
+        StoreLanes(ApplyLanes(L::Gather(r, 4), L::Gather(r + 1, 4), L::Gather(r + 2, 4), L::Gather(r + 3, 4), LoadLanes<T, L>(v + i)), out + i);
+    }
+
+    for (; i < count; i++)
+        out[i] = q[i].Apply(v[i]);
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::operator*(T s) const
+{
+    return FixedQuaternion(x * s, y * s, z * s, w * s);
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::operator/(T s) const
+{
+    return FixedQuaternion(x / s, y / s, z / s, w / s);
+}
+
+template<typename T>
+FixedQuaternion<T>& FixedQuaternion<T>::operator*=(T s)
+{
+    return *this = *this * s;
+}
+
+template<typename T>
+FixedQuaternion<T>& FixedQuaternion<T>::operator/=(T s)
+{
+    return *this = *this / s;
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::operator*(const FixedQuaternion& q) const
+{
+    FixedVector3<T> vecA(x, y, z);
+    FixedVector3<T> vecB(q.x, q.y, q.z);
+
+    FixedVector3<T> outVec = (vecB * w) + (vecA * q.w) + vecA.Cross(vecB);
+    T outW = (w * q.w) - vecA.Dot(vecB);
+
+    return FixedQuaternion(outVec.x, outVec.y, outVec.z, outW);
+}
+
+template<typename T>
+FixedQuaternion<T>& FixedQuaternion<T>::operator*=(const FixedQuaternion& q)
+{
+    return *this = *this * q;
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::operator+(const FixedQuaternion& q) const
+{
+    return FixedQuaternion(x + q.x, y + q.y, z + q.z, w + q.w);
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::operator-(const FixedQuaternion& q) const
+{
+    return FixedQuaternion(x - q.x, y - q.y, z - q.z, w - q.w);
+}
+
+template<typename T>
+FixedQuaternion<T>& FixedQuaternion<T>::operator+=(const FixedQuaternion& q)
+{
+    return *this = *this + q;
+}
+
+template<typename T>
+FixedQuaternion<T>& FixedQuaternion<T>::operator-=(const FixedQuaternion& q)
+{
+    return *this = *this - q;
+}
+
+template<typename T>
+bool FixedQuaternion<T>::operator==(const FixedQuaternion& q) const
+{
+    return (x == q.x) && (y == q.y) && (z == q.z) && (w == q.w);
+}
+
+template<typename T>
+bool FixedQuaternion<T>::operator!=(const FixedQuaternion& q) const
+{
+    return (x != q.x) || (y != q.y) || (z != q.z) || (w != q.w);
+}
+
+template<typename T>
+T& FixedQuaternion<T>::operator[](size_t i)
+{
+    assert(i < 4);
+
+    switch (i)
+    {
+    default:
+    case 0:
+        return x;
+    case 1:
+        return y;
+    case 2:
+        return z;
+    case 3:
+        return w;
+    }
+}
+
+template<typename T>
+const T& FixedQuaternion<T>::operator[](size_t i) const
+{
+    assert(i < 4);
+
+    switch (i)
+    {
+    default:
+    case 0:
+        return x;
+    case 1:
+        return y;
+    case 2:
+        return z;
+    case 3:
+        return w;
+    }
+}
+
+template struct FixedQuaternion<Q16>;
+template struct FixedQuaternion<Q32>;
@@ -0,0 +1,284 @@
+/**
+ * @file FixedSimd.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal integer lane types used by the fixed point batch kernels
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef FIXEDSIMD_H
+#define FIXEDSIMD_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "FMaths/Fixed.h"
+
+#include "FixedMath.h"
+#include "Simd.h"
+
+#if defined(FMATHS_SIMD_SSE) && defined(__AVX2__)
+    #define FMATHS_SIMD_AVX2
+#endif
+
+/**
+ * @brief Single lane of raw fixed point values, used for loop tails, Q32 and when SIMD is disabled
+ *
+ * Integer lanes expose the same interface as the float lanes in Simd.h, with
+ * saturating arithmetic, so kernels are written once as templates.
+ */
+template<typename T>
+struct ScalarFixed
+{
+    using Raw = typename T::Raw;
+    static constexpr size_t Width = 1;
+    static constexpr size_t Frac = T::FractionBits;
+
+    /**
+     * @brief Float lane of the same width, for conversions
+     */
+    using FloatLane = ScalarFloat;
+
+    Raw v;
+
+    static ScalarFixed Load(const Raw* p) { return {*p}; }
+    static ScalarFixed Set(Raw s) { return {s}; }
+    static ScalarFixed Gather(const Raw* p, size_t) { return {*p}; }
+    void Store(Raw* p) const { *p = v; }
+    void Scatter(Raw* p, size_t) const { *p = v; }
+
+    ScalarFixed operator+(ScalarFixed b) const { return {FixedMath::Add(v, b.v)}; }
+    ScalarFixed operator-(ScalarFixed b) const { return {FixedMath::Sub(v, b.v)}; }
+    ScalarFixed operator*(ScalarFixed b) const { return {FixedMath::Mul<Frac>(v, b.v)}; }
+    ScalarFixed operator-() const { return {FixedMath::Neg(v)}; }
+
+    /**
+     * @brief Nearest fixed point values, ties to even, saturating. NaN becomes 0
+     */
+    static ScalarFixed FromFloat(ScalarFloat f) { return {FixedMath::FromReal<Frac, Raw>(f.v)}; }
+    ScalarFloat ToFloat() const { return {FixedMath::ToReal<Frac, Raw, float>(v)}; }
+};
+
+#ifdef FMATHS_SIMD_SSE
+
+/**
+ * @brief Signed 64 bit products of the even 32 bit lanes
+ */
+inline __m128i MulEven(__m128i a, __m128i b)
+{
+#ifdef __SSE4_1__
+    return _mm_mul_epi32(a, b);
+#else
+    // The unsigned product of a negative operand is 2^32 times the other operand too large
+    __m128i p = _mm_mul_epu32(a, b);
+    __m128i fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+
+    return _mm_sub_epi64(p, _mm_slli_epi64(fix, 32));
+#endif
+}
+
+/**
+ * @brief Per lane a if mask is set, otherwise b
+ */
+inline __m128i Blend(__m128i m, __m128i a, __m128i b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+
+/**
+ * @brief Highest for lanes with sign clear, Lowest for lanes with it set
+ */
+inline __m128i SaturatedLike(__m128i a) { return _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(INT32_MAX)); }
+
+/**
+ * @brief 4 lanes of Q16.16 in SSE2 integer registers
+ */
+struct Fixed4
+{
+    using Raw = int32_t;
+    using FloatLane = Float4;
+    static constexpr size_t Width = 4;
+
+    __m128i v;
+
+    static Fixed4 Load(const int32_t* p) { return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))}; }
+    static Fixed4 Set(int32_t s) { return {_mm_set1_epi32(s)}; }
+    static Fixed4 Gather(const int32_t* p, size_t stride) { return {_mm_setr_epi32(p[0], p[stride], p[stride * 2], p[stride * 3])}; }
+    void Store(int32_t* p) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+    void Scatter(int32_t* p, size_t stride) const
+    {
+        alignas(16) int32_t lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), v);
+
+        for (size_t i = 0; i < 4; i++)
+            p[i * stride] = lanes[i];
+    }
+
+    Fixed4 operator+(Fixed4 b) const
+    {
+        // Overflowed where both operands have the opposite sign to the sum
+        __m128i sum = _mm_add_epi32(v, b.v);
+        __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(v, sum), _mm_xor_si128(b.v, sum)), 31);
+
+        return {Blend(overflow, SaturatedLike(v), sum)};
+    }
+
+    Fixed4 operator-(Fixed4 b) const
+    {
+        // Overflowed where the operands differ in sign and the difference has b's sign
+        __m128i diff = _mm_sub_epi32(v, b.v);
+        __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(v, b.v), _mm_xor_si128(v, diff)), 31);
+
+        return {Blend(overflow, SaturatedLike(v), diff)};
+    }
+
+    Fixed4 operator*(Fixed4 b) const
+    {
+        const __m128i round = _mm_set1_epi64x(1 << 15);
+        const __m128i even = _mm_setr_epi32(-1, 0, -1, 0);
+
+        __m128i pe = _mm_add_epi64(MulEven(v, b.v), round);
+        __m128i po = _mm_add_epi64(MulEven(_mm_srli_epi64(v, 32), _mm_srli_epi64(b.v, 32)), round);
+
+        // Bits 16 to 47 of each product, and its high half
+        __m128i res = _mm_or_si128(_mm_and_si128(_mm_srli_epi64(pe, 16), even), _mm_slli_epi64(_mm_srli_epi64(po, 16), 32));
+        __m128i high = _mm_or_si128(_mm_srli_epi64(pe, 32), _mm_andnot_si128(even, po));
+
+        // Fits when bits 47 to 63 all match the sign of the result
+        __m128i fits = _mm_cmpeq_epi32(_mm_srai_epi32(high, 15), _mm_srai_epi32(res, 31));
+
+        return {Blend(fits, res, SaturatedLike(high))};
+    }
+
+    Fixed4 operator-() const { return Set(0) - *this; }
+
+    static Fixed4 FromFloat(Float4 f)
+    {
+        __m128 scaled = _mm_mul_ps(f.v, _mm_set1_ps(65536.f));
+
+        // Out of range and NaN lanes convert to Lowest
+        __m128i res = _mm_cvtps_epi32(scaled);
+        res = Blend(_mm_castps_si128(_mm_cmpge_ps(scaled, _mm_set1_ps(2147483648.f))), _mm_set1_epi32(INT32_MAX), res);
+
+        return {_mm_and_si128(res, _mm_castps_si128(_mm_cmpord_ps(scaled, scaled)))};
+    }
+
+    Float4 ToFloat() const { return {_mm_mul_ps(_mm_cvtepi32_ps(v), _mm_set1_ps(1.f / 65536.f))}; }
+};
+
+#endif
+
+#ifdef FMATHS_SIMD_AVX2
+
+inline __m256i Blend(__m256i m, __m256i a, __m256i b) { return _mm256_blendv_epi8(b, a, m); }
+inline __m256i SaturatedLike(__m256i a) { return _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(INT32_MAX)); }
+
+/**
+ * @brief 8 lanes of Q16.16 in AVX2 integer registers
+ */
+struct Fixed8
+{
+    using Raw = int32_t;
+    using FloatLane = Float8;
+    static constexpr size_t Width = 8;
+
+    __m256i v;
+
+    static Fixed8 Load(const int32_t* p) { return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))}; }
+    static Fixed8 Set(int32_t s) { return {_mm256_set1_epi32(s)}; }
+
+    static Fixed8 Gather(const int32_t* p, size_t stride)
+    {
+        return {_mm256_setr_epi32(
+            p[0], p[stride], p[stride * 2], p[stride * 3],
+            p[stride * 4], p[stride * 5], p[stride * 6], p[stride * 7]
+        )};
+    }
+
+    void Store(int32_t* p) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+    void Scatter(int32_t* p, size_t stride) const
+    {
+        alignas(32) int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+
+        for (size_t i = 0; i < 8; i++)
+            p[i * stride] = lanes[i];
+    }
+
+    Fixed8 operator+(Fixed8 b) const
+    {
+        __m256i sum = _mm256_add_epi32(v, b.v);
+        __m256i overflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(v, sum), _mm256_xor_si256(b.v, sum)), 31);
+
+        return {Blend(overflow, SaturatedLike(v), sum)};
+    }
+
+    Fixed8 operator-(Fixed8 b) const
+    {
+        __m256i diff = _mm256_sub_epi32(v, b.v);
+        __m256i overflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(v, b.v), _mm256_xor_si256(v, diff)), 31);
+
+        return {Blend(overflow, SaturatedLike(v), diff)};
+    }
+
+    Fixed8 operator*(Fixed8 b) const
+    {
+        const __m256i round = _mm256_set1_epi64x(1 << 15);
+        const __m256i even = _mm256_setr_epi32(-1, 0, -1, 0, -1, 0, -1, 0);
+
+        __m256i pe = _mm256_add_epi64(_mm256_mul_epi32(v, b.v), round);
+        __m256i po = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(v, 32), _mm256_srli_epi64(b.v, 32)), round);
+
+        __m256i res = _mm256_blend_epi32(_mm256_srli_epi64(pe, 16), _mm256_slli_epi64(_mm256_srli_epi64(po, 16), 32), 0xaa);
+        __m256i high = _mm256_or_si256(_mm256_srli_epi64(pe, 32), _mm256_andnot_si256(even, po));
+        __m256i fits = _mm256_cmpeq_epi32(_mm256_srai_epi32(high, 15), _mm256_srai_epi32(res, 31));
+
+        return {Blend(fits, res, SaturatedLike(high))};
+    }
+
+    Fixed8 operator-() const { return Set(0) - *this; }
+
+    static Fixed8 FromFloat(Float8 f)
+    {
+        __m256 scaled = _mm256_mul_ps(f.v, _mm256_set1_ps(65536.f));
+
+        __m256i res = _mm256_cvtps_epi32(scaled);
+        res = Blend(_mm256_castps_si256(_mm256_cmp_ps(scaled, _mm256_set1_ps(2147483648.f), _CMP_GE_OQ)), _mm256_set1_epi32(INT32_MAX), res);
+
+        return {_mm256_and_si256(res, _mm256_castps_si256(_mm256_cmp_ps(scaled, scaled, _CMP_ORD_Q)))};
+    }
+
+    Float8 ToFloat() const { return {_mm256_mul_ps(_mm256_cvtepi32_ps(v), _mm256_set1_ps(1.f / 65536.f))}; }
+};
+
+#endif
+
+/**
+ * @brief Widest lane type for T in this build, Q32 products need 128 bits so stay scalar
+ */
+template<typename T>
+struct WidestFixed
+{
+    using Type = ScalarFixed<T>;
+};
+
+#if defined(FMATHS_SIMD_AVX2)
+template<>
+struct WidestFixed<Q16>
+{
+    using Type = Fixed8;
+};
+#elif defined(FMATHS_SIMD_SSE)
+template<>
+struct WidestFixed<Q16>
+{
+    using Type = Fixed4;
+};
+#endif
+
+template<typename T>
+using SimdFixed = typename WidestFixed<T>::Type;
+
+#endif
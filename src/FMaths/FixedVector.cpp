@@ -0,0 +1,706 @@
+#include "FMaths/FixedVector.h"
+
+#include <cassert>
+
+#include "FMaths/Vector2.h"
+#include "FMaths/Vector3.h"
+#include "FMaths/Vector4.h"
+
+#include "FixedMath.h"
+#include "FixedSimd.h"
+
+// Batch kernels treat arrays of these types as packed raw values
+static_assert(sizeof(Vector3Q16) == sizeof(int32_t) * 3, "Vector3Q16 must be tightly packed");
+static_assert(sizeof(Vector4Q16) == sizeof(int32_t) * 4, "Vector4Q16 must be tightly packed");
+static_assert(sizeof(Vector3Q32) == sizeof(int64_t) * 3, "Vector3Q32 must be tightly packed");
+static_assert(sizeof(Vector4Q32) == sizeof(int64_t) * 4, "Vector4Q32 must be tightly packed");
+
+namespace
+{
+
+/**
+ * @brief Largest distance of LengthSquared from 1 in raw units still counted as normalized
+ *
+ * Normalize rounds each component to within half a unit, which moves the
+ * squared length by at most about 2 units.
+ */
+constexpr int kNormalizedTolerance = 4;
+
+template<typename T>
+bool IsUnitLengthSquared(T len2)
+{
+    return (len2 - T(1)).Abs().raw <= kNormalizedTolerance;
+}
+
+/**
+ * @brief W fixed point 3D vectors in integer lanes
+ */
+template<typename T, typename L>
+struct FixedVector3Lanes
+{
+    using Raw = typename T::Raw;
+
+    L x, y, z;
+
+    static FixedVector3Lanes Load(const FixedVector3<T>* p)
+    {
+        const Raw* r = reinterpret_cast<const Raw*>(p);
+        return {L::Gather(r, 3), L::Gather(r + 1, 3), L::Gather(r + 2, 3)};
+    }
+
+    void Store(FixedVector3<T>* p) const
+    {
+        Raw* r = reinterpret_cast<Raw*>(p);
+
+        x.Scatter(r, 3);
+        y.Scatter(r + 1, 3);
+        z.Scatter(r + 2, 3);
+    }
+};
+
+// Same order of rounded products and saturating sums as the member functions
+
+template<typename L>
+L DotLanes(L ax, L ay, L az, L bx, L by, L bz)
+{
+    return ((ax * bx) + (ay * by)) + (az * bz);
+}
+
+template<typename T, typename L>
+FixedVector3Lanes<T, L> CrossLanes(const FixedVector3Lanes<T, L>& a, const FixedVector3Lanes<T, L>& b)
+{
+    return {
+        (a.y * b.z) - (a.z * b.y),
+        (a.z * b.x) - (a.x * b.z),
+        (a.x * b.y) - (a.y * b.x)
+    };
+}
+
+/**
+ * @brief Convert count * N packed floats to raw values, matching the Fixed(float) constructor
+ */
+template<typename T>
+void FromFloatPacked(const float* f, typename T::Raw* r, size_t n)
+{
+    using L = SimdFixed<T>;
+    using F = typename L::FloatLane;
+
+    size_t i = 0;
+
+    for (; i + L::Width <= n; i += L::Width)
+        L::FromFloat(F::Load(f + i)).Store(r + i);
+
+    for (; i < n; i++)
+        r[i] = T(f[i]).raw;
+}
+
+template<typename T>
+void ToFloatPacked(const typename T::Raw* r, float* f, size_t n)
+{
+    using L = SimdFixed<T>;
+
+    size_t i = 0;
+
+    for (; i + L::Width <= n; i += L::Width)
+        L::Load(r + i).ToFloat().Store(f + i);
+
+    for (; i < n; i++)
+        f[i] = static_cast<float>(T::FromRaw(r[i]));
+}
+
+} // namespace
+
+// FixedVector2
+
+template<typename T>
+FixedVector2<T>::FixedVector2():
+    x(), y()
+{}
+
+template<typename T>
+FixedVector2<T>::FixedVector2(T x, T y):
+    x(x), y(y)
+{}
+
+template<typename T>
+FixedVector2<T>::FixedVector2(const FixedVector3<T>& v):
+    x(v.x), y(v.y)
+{}
+
+template<typename T>
+FixedVector2<T>::FixedVector2(const FixedVector4<T>& v):
+    x(v.x), y(v.y)
+{}
+
+template<typename T>
+FixedVector2<T>::FixedVector2(const Vector2& v):
+    x(v.x), y(v.y)
+{}
+
+template<typename T>
+Vector2 FixedVector2<T>::ToFloat() const
+{
+    return Vector2(static_cast<float>(x), static_cast<float>(y));
+}
+
+template<typename T>
+T FixedVector2<T>::Length() const
+{
+    typename T::Raw c[] = {x.raw, y.raw};
+    return T::FromRaw(FixedMath::Length(c));
+}
+
+template<typename T>
+T FixedVector2<T>::LengthSquared() const
+{
+    typename T::Raw c[] = {x.raw, y.raw};
+    return T::FromRaw(FixedMath::LengthSquared<T::FractionBits>(c));
+}
+
+template<typename T>
+FixedVector2<T>& FixedVector2<T>::Normalize()
+{
+    typename T::Raw c[] = {x.raw, y.raw};
+    FixedMath::Normalize<T::FractionBits>(c);
+
+    x.raw = c[0];
+    y.raw = c[1];
+
+    return *this;
+}
+
+template<typename T>
+FixedVector2<T> FixedVector2<T>::Normalized() const
+{
+    return FixedVector2(*this).Normalize();
+}
+
+template<typename T>
+bool FixedVector2<T>::IsNormalized() const
+{
+    return IsUnitLengthSquared(LengthSquared());
+}
+
+template<typename T>
+T FixedVector2<T>::Dot(const FixedVector2& v) const
+{
+    return (x * v.x) + (y * v.y);
+}
+
+template<typename T>
+FixedVector2<T> FixedVector2<T>::operator+(const FixedVector2& v) const
+{
+    return FixedVector2(x + v.x, y + v.y);
+}
+
+template<typename T>
+FixedVector2<T> FixedVector2<T>::operator-(const FixedVector2& v) const
+{
+    return FixedVector2(x - v.x, y - v.y);
+}
+
+template<typename T>
+FixedVector2<T>& FixedVector2<T>::operator+=(const FixedVector2& v)
+{
+    return *this = *this + v;
+}
+
+template<typename T>
+FixedVector2<T>& FixedVector2<T>::operator-=(const FixedVector2& v)
+{
+    return *this = *this - v;
+}
+
+template<typename T>
+FixedVector2<T> FixedVector2<T>::operator*(T s) const
+{
+    return FixedVector2(x * s, y * s);
+}
+
+template<typename T>
+FixedVector2<T> FixedVector2<T>::operator/(T s) const
+{
+    return FixedVector2(x / s, y / s);
+}
+
+template<typename T>
+FixedVector2<T>& FixedVector2<T>::operator*=(T s)
+{
+    return *this = *this * s;
+}
+
+template<typename T>
+FixedVector2<T>& FixedVector2<T>::operator/=(T s)
+{
+    return *this = *this / s;
+}
+
+template<typename T>
+bool FixedVector2<T>::operator==(const FixedVector2& v) const
+{
+    return (x == v.x) && (y == v.y);
+}
+
+template<typename T>
+bool FixedVector2<T>::operator!=(const FixedVector2& v) const
+{
+    return (x != v.x) || (y != v.y);
+}
+
+template<typename T>
+T& FixedVector2<T>::operator[](size_t i)
+{
+    assert(i < 2);
+    return (i == 0) ? x : y;
+}
+
+template<typename T>
+const T& FixedVector2<T>::operator[](size_t i) const
+{
+    assert(i < 2);
+    return (i == 0) ? x : y;
+}
+
+// FixedVector3
+
+template<typename T>
+FixedVector3<T>::FixedVector3():
+    x(), y(), z()
+{}
+
+template<typename T>
+FixedVector3<T>::FixedVector3(T x, T y, T z):
+    x(x), y(y), z(z)
+{}
+
+template<typename T>
+FixedVector3<T>::FixedVector3(const FixedVector2<T>& v, T z):
+    x(v.x), y(v.y), z(z)
+{}
+
+template<typename T>
+FixedVector3<T>::FixedVector3(const FixedVector4<T>& v):
+    x(v.x), y(v.y), z(v.z)
+{}
+
+template<typename T>
+FixedVector3<T>::FixedVector3(const Vector3& v):
+    x(v.x), y(v.y), z(v.z)
+{}
+
+template<typename T>
+Vector3 FixedVector3<T>::ToFloat() const
+{
+    return Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+}
+
+template<typename T>
+T FixedVector3<T>::Length() const
+{
+    typename T::Raw c[] = {x.raw, y.raw, z.raw};
+    return T::FromRaw(FixedMath::Length(c));
+}
+
+template<typename T>
+T FixedVector3<T>::LengthSquared() const
+{
+    typename T::Raw c[] = {x.raw, y.raw, z.raw};
+    return T::FromRaw(FixedMath::LengthSquared<T::FractionBits>(c));
+}
+
+template<typename T>
+FixedVector3<T>& FixedVector3<T>::Normalize()
+{
+    typename T::Raw c[] = {x.raw, y.raw, z.raw};
+    FixedMath::Normalize<T::FractionBits>(c);
+
+    x.raw = c[0];
+    y.raw = c[1];
+    z.raw = c[2];
+
+    return *this;
+}
+
+template<typename T>
+FixedVector3<T> FixedVector3<T>::Normalized() const
+{
+    return FixedVector3(*this).Normalize();
+}
+
+template<typename T>
+bool FixedVector3<T>::IsNormalized() const
+{
+    return IsUnitLengthSquared(LengthSquared());
+}
+
+template<typename T>
+T FixedVector3<T>::Dot(const FixedVector3& v) const
+{
+    return ((x * v.x) + (y * v.y)) + (z * v.z);
+}
+
+template<typename T>
+FixedVector3<T> FixedVector3<T>::Cross(const FixedVector3& v) const
+{
+    return FixedVector3(
+        (y * v.z) - (z * v.y),
+        (z * v.x) - (x * v.z),
+        (x * v.y) - (y * v.x)
+    );
+}
+
+template<typename T>
+void FixedVector3<T>::FromFloat(const Vector3* v, FixedVector3* out, size_t count)
+{
+    FromFloatPacked<T>(reinterpret_cast<const float*>(v), reinterpret_cast<typename T::Raw*>(out), count * 3);
+}
+
+template<typename T>
+void FixedVector3<T>::ToFloat(const FixedVector3* v, Vector3* out, size_t count)
+{
+    ToFloatPacked<T>(reinterpret_cast<const typename T::Raw*>(v), reinterpret_cast<float*>(out), count * 3);
+}
+
+template<typename T>
+void FixedVector3<T>::Normalize(FixedVector3* v, size_t count)
+{
+    // The exact length needs a wide integer square root per vector, which has no lane form
+    for (size_t i = 0; i < count; i++)
+        v[i].Normalize();
+}
+
+template<typename T>
+void FixedVector3<T>::Dot(const FixedVector3* a, const FixedVector3* b, T* out, size_t count)
+{
+    using L = SimdFixed<T>;
+    using Lanes = FixedVector3Lanes<T, L>;
+
+    size_t i = 0;
+
+    for (; i + L::Width <= count; i += L::Width)
+    {
+        Lanes va = Lanes::Load(a + i);
+        Lanes vb = Lanes::Load(b + i);
+
+        DotLanes(va.x, va.y, va.z, vb.x, vb.y, vb.z).Store(&out[i].raw);
+    }
+
+    for (; i < count; i++)
+        out[i] = a[i].Dot(b[i]);
+}
+
+template<typename T>
+void FixedVector3<T>::Cross(const FixedVector3* a, const FixedVector3* b, FixedVector3* out, size_t count)
+{
+    using L = SimdFixed<T>;
+    using Lanes = FixedVector3Lanes<T, L>;
+
+    size_t i = 0;
+
+    for (; i + L::Width <= count; i += L::Width)
+        CrossLanes(Lanes::Load(a + i), Lanes::Load(b + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = a[i].Cross(b[i]);
+}
+
+template<typename T>
+FixedVector3<T> FixedVector3<T>::operator+(const FixedVector3& v) const
+{
+    return FixedVector3(x + v.x, y + v.y, z + v.z);
+}
+
+template<typename T>
+FixedVector3<T> FixedVector3<T>::operator-(const FixedVector3& v) const
+{
+    return FixedVector3(x - v.x, y - v.y, z - v.z);
+}
+
+template<typename T>
+FixedVector3<T>& FixedVector3<T>::operator+=(const FixedVector3& v)
+{
+    return *this = *this + v;
+}
+
+template<typename T>
+FixedVector3<T>& FixedVector3<T>::operator-=(const FixedVector3& v)
+{
+    return *this = *this - v;
+}
+
+template<typename T>
+FixedVector3<T> FixedVector3<T>::operator*(T s) const
+{
+    return FixedVector3(x * s, y * s, z * s);
+}
+
+template<typename T>
+FixedVector3<T> FixedVector3<T>::operator/(T s) const
+{
+    return FixedVector3(x / s, y / s, z / s);
+}
+
+template<typename T>
+FixedVector3<T>& FixedVector3<T>::operator*=(T s)
+{
+    return *this = *this * s;
+}
+
+template<typename T>
+FixedVector3<T>& FixedVector3<T>::operator/=(T s)
+{
+    return *this = *this / s;
+}
+
+template<typename T>
+bool FixedVector3<T>::operator==(const FixedVector3& v) const
+{
+    return (x == v.x) && (y == v.y) && (z == v.z);
+}
+
+template<typename T>
+bool FixedVector3<T>::operator!=(const FixedVector3& v) const
+{
+    return (x != v.x) || (y != v.y) || (z != v.z);
+}
+
+template<typename T>
+T& FixedVector3<T>::operator[](size_t i)
+{
+    assert(i < 3);
+
+    switch (i)
+    {
+    default:
+    case 0:
+        return x;
+    case 1:
+        return y;
+    case 2:
+        return z;
+    }
+}
+
+template<typename T>
+const T& FixedVector3<T>::operator[](size_t i) const
+{
+    assert(i < 3);
+
+    switch (i)
+    {
+    default:
+    case 0:
+        return x;
+    case 1:
+        return y;
+    case 2:
+        return z;
+    }
+}
+
+// FixedVector4
+
+template<typename T>
+FixedVector4<T>::FixedVector4():
+    x(), y(), z(), w()
+{}
+
+template<typename T>
+FixedVector4<T>::FixedVector4(T x, T y, T z, T w):
+    x(x), y(y), z(z), w(w)
+{}
+
+template<typename T>
+FixedVector4<T>::FixedVector4(const FixedVector2<T>& v, T z, T w):
+    x(v.x), y(v.y), z(z), w(w)
+{}
+
+template<typename T>
+FixedVector4<T>::FixedVector4(const FixedVector3<T>& v, T w):
+    x(v.x), y(v.y), z(v.z), w(w)
+{}
+
+template<typename T>
+FixedVector4<T>::FixedVector4(const Vector4& v):
+    x(v.x), y(v.y), z(v.z), w(v.w)
+{}
+
+template<typename T>
+Vector4 FixedVector4<T>::ToFloat() const
+{
+    return Vector4(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), static_cast<float>(w));
+}
+
+template<typename T>
+T FixedVector4<T>::Length() const
+{
+    typename T::Raw c[] = {x.raw, y.raw, z.raw, w.raw};
+    return T::FromRaw(FixedMath::Length(c));
+}
+
+template<typename T>
+T FixedVector4<T>::LengthSquared() const
+{
+    typename T::Raw c[] = {x.raw, y.raw, z.raw, w.raw};
+    return T::FromRaw(FixedMath::LengthSquared<T::FractionBits>(c));
+}
+
+template<typename T>
+FixedVector4<T>& FixedVector4<T>::Normalize()
+{
+    typename T::Raw c[] = {x.raw, y.raw, z.raw, w.raw};
+    FixedMath::Normalize<T::FractionBits>(c);
+
+    x.raw = c[0];
+    y.raw = c[1];
+    z.raw = c[2];
+    w.raw = c[3];
+
+    return *this;
+}
+
+template<typename T>
+FixedVector4<T> FixedVector4<T>::Normalized() const
+{
+    return FixedVector4(*this).Normalize();
+}
+
+template<typename T>
+bool FixedVector4<T>::IsNormalized() const
+{
+    return IsUnitLengthSquared(LengthSquared());
+}
+
+template<typename T>
+T FixedVector4<T>::Dot(const FixedVector4& v) const
+{
+    return (((x * v.x) + (y * v.y)) + (z * v.z)) + (w * v.w);
+}
+
+template<typename T>
+FixedVector4<T> FixedVector4<T>::Cross(const FixedVector4& v) const
+{
+    return FixedVector4(
+        (y * v.z) - (z * v.y),
+        (z * v.x) - (x * v.z),
+        (x * v.y) - (y * v.x)
+    );
+}
+
+template<typename T>
+void FixedVector4<T>::FromFloat(const Vector4* v, FixedVector4* out, size_t count)
+{
+    FromFloatPacked<T>(reinterpret_cast<const float*>(v), reinterpret_cast<typename T::Raw*>(out), count * 4);
+}
+
+template<typename T>
+void FixedVector4<T>::ToFloat(const FixedVector4* v, Vector4* out, size_t count)
+{
+    ToFloatPacked<T>(reinterpret_cast<const typename T::Raw*>(v), reinterpret_cast<float*>(out), count * 4);
+}
+
+template<typename T>
+FixedVector4<T> FixedVector4<T>::operator+(const FixedVector4& v) const
+{
+    return FixedVector4(x + v.x, y + v.y, z + v.z, w + v.w);
+}
+
+template<typename T>
+FixedVector4<T> FixedVector4<T>::operator-(const FixedVector4& v) const
+{
+    return FixedVector4(x - v.x, y - v.y, z - v.z, w - v.w);
+}
+
+template<typename T>
+FixedVector4<T>& FixedVector4<T>::operator+=(const FixedVector4& v)
+{
+    return *this = *this + v;
+}
+
+template<typename T>
+FixedVector4<T>& FixedVector4<T>::operator-=(const FixedVector4& v)
+{
+    return *this = *this - v;
+}
+
+template<typename T>
+FixedVector4<T> FixedVector4<T>::operator*(T s) const
+{
+    return FixedVector4(x * s, y * s, z * s, w * s);
+}
+
+template<typename T>
+FixedVector4<T> FixedVector4<T>::operator/(T s) const
+{
+    return FixedVector4(x / s, y / s, z / s, w / s);
+}
+
+template<typename T>
+FixedVector4<T>& FixedVector4<T>::operator*=(T s)
+{
+    return *this = *this * s;
+}
+
+template<typename T>
+FixedVector4<T>& FixedVector4<T>::operator/=(T s)
+{
+    return *this = *this / s;
+}
+
+template<typename T>
+bool FixedVector4<T>::operator==(const FixedVector4& v) const
+{
+    return (x == v.x) && (y == v.y) && (z == v.z) && (w == v.w);
+}
+
+template<typename T>
+bool FixedVector4<T>::operator!=(const FixedVector4& v) const
+{
+    return (x != v.x) || (y != v.y) || (z != v.z) || (w != v.w);
+}
+
+template<typename T>
+T& FixedVector4<T>::operator[](size_t i)
+{
+    assert(i < 4);
+
+    switch (i)
+    {
+    default:
+    case 0:
+        return x;
+    case 1:
+        return y;
+    case 2:
+        return z;
+    case 3:
+        return w;
+    }
+}
+
+template<typename T>
+const T& FixedVector4<T>::operator[](size_t i) const
+{
+    assert(i < 4);
+
+    switch (i)
+    {
+    default:
+    case 0:
+        return x;
+    case 1:
+        return y;
+    case 2:
+        return z;
+    case 3:
+        return w;
+    }
+}
+
+template struct FixedVector2<Q16>;
+template struct FixedVector3<Q16>;
+template struct FixedVector4<Q16>;
+
+template struct FixedVector2<Q32>;
+template struct FixedVector3<Q32>;
+template struct FixedVector4<Q32>;
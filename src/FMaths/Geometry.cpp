@@ -0,0 +1,693 @@
+#include "FMaths/Geometry.h"
+
+#include <cmath>
+#include <cassert>
+#include <bitset>
+#include <algorithm>
+#include <type_traits>
+
+#include "Simd.h"
+
+// Determinants smaller than this are treated as parallel/degenerate
+static constexpr float kParallelEpsilon = __FLT_MIN__;
+
+Ray::Ray():
+    origin(), direction(0.f, 0.f, -1.f)
+{}
+
+Ray::Ray(const Vector3& origin, const Vector3& direction):
+    origin(origin), direction(direction)
+{}
+
+Vector3 Ray::At(float t) const
+{
+    return origin + (direction * t);
+}
+
+Plane::Plane():
+    normal(0.f, 1.f, 0.f), d(0.f)
+{}
+
+Plane::Plane(const Vector3& normal, float d):
+    normal(normal), d(d)
+{}
+
+Plane::Plane(const Vector3& normal, const Vector3& point):
+    normal(normal), d(normal.Dot(point))
+{}
+
+float Plane::SignedDistance(const Vector3& p) const
+{
+    return normal.Dot(p) - d;
+}
+
+bool Plane::Intersect(const Ray& ray, float& t) const
+{
+    float denom = normal.Dot(ray.direction);
+    if (fabsf(denom) < kParallelEpsilon)
+        return false;
+
+    float hit = (d - normal.Dot(ray.origin)) / denom;
+    if (hit < 0.f)
+        return false;
+
+    t = hit;
+    return true;
+}
+
+AABB::AABB():
+    min(), max()
+{}
+
+AABB::AABB(const Vector3& min, const Vector3& max):
+    min(min), max(max)
+{}
+
+bool AABB::Contains(const Vector3& p) const
+{
+    return (p.x >= min.x) && (p.x <= max.x)
+        && (p.y >= min.y) && (p.y <= max.y)
+        && (p.z >= min.z) && (p.z <= max.z);
+}
+
+bool AABB::Overlaps(const AABB& b) const
+{
+    return (min.x <= b.max.x) && (max.x >= b.min.x)
+        && (min.y <= b.max.y) && (max.y >= b.min.y)
+        && (min.z <= b.max.z) && (max.z >= b.min.z);
+}
+
+Vector3 AABB::ClosestPoint(const Vector3& p) const
+{
+    return Vector3(
+        std::min(std::max(p.x, min.x), max.x),
+        std::min(std::max(p.y, min.y), max.y),
+        std::min(std::max(p.z, min.z), max.z)
+    );
+}
+
+bool AABB::Intersect(const Ray& ray, float& t) const
+{
+    float tNear = 0.f;
+    float tFar = INFINITY;
+
+    for (size_t i = 0; i < 3; i++) // iterate slabs
+    {
+        // Parallel to the slab, the ray is inside it everywhere or nowhere.
+        // The general case would give 0 * inf for an origin on a face
+        if (ray.direction[i] == 0.f)
+        {
+            if (ray.origin[i] < min[i] || ray.origin[i] > max[i])
+                return false;
+
+            continue;
+        }
+
+        float invDir = 1.f / ray.direction[i];
+        float t0 = (min[i] - ray.origin[i]) * invDir;
+        float t1 = (max[i] - ray.origin[i]) * invDir;
+
+        if (t0 > t1)
+            std::swap(t0, t1);
+
+        tNear = std::max(t0, tNear);
+        tFar = std::min(t1, tFar);
+    }
+
+    if (tNear > tFar)
+        return false;
+
+    t = tNear;
+    return true;
+}
+
+Sphere::Sphere():
+    centre(), radius(1.f)
+{}
+
+Sphere::Sphere(const Vector3& centre, float radius):
+    centre(centre), radius(radius)
+{}
+
+bool Sphere::Contains(const Vector3& p) const
+{
+    return (p - centre).LengthSquared() <= radius * radius;
+}
+
+bool Sphere::Overlaps(const Sphere& s) const
+{
+    float r = radius + s.radius;
+    return (s.centre - centre).LengthSquared() <= r * r;
+}
+
+bool Sphere::Overlaps(const AABB& b) const
+{
+    return Contains(b.ClosestPoint(centre));
+}
+
+bool Sphere::Intersect(const Ray& ray, float& t) const
+{
+    // Solve |o + td - c|^2 = r^2 for t
+    Vector3 oc = ray.origin - centre;
+    float a = ray.direction.LengthSquared();
+    float b = oc.Dot(ray.direction);
+    float c = oc.LengthSquared() - (radius * radius);
+
+    float discriminant = (b * b) - (a * c);
+    if (discriminant < 0.f || a == 0.f)
+        return false;
+
+    float root = sqrtf(discriminant);
+    float tFar = (-b + root) / a;
+    if (tFar < 0.f) // sphere is behind ray
+        return false;
+
+    t = std::max((-b - root) / a, 0.f);
+    return true;
+}
+
+OBB::OBB():
+    centre(), axes{Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f)}, halfExtents()
+{}
+
+OBB::OBB(const Vector3& centre, const Vector3& axis0, const Vector3& axis1, const Vector3& axis2, const Vector3& halfExtents):
+    centre(centre), axes{axis0, axis1, axis2}, halfExtents(halfExtents)
+{}
+
+bool OBB::Contains(const Vector3& p) const
+{
+    Vector3 d = p - centre;
+
+    for (size_t i = 0; i < 3; i++) // iterate axes
+        if (fabsf(d.Dot(axes[i])) > halfExtents[i])
+            return false;
+
+    return true;
+}
+
+Vector3 OBB::ClosestPoint(const Vector3& p) const
+{
+    Vector3 d = p - centre;
+    Vector3 res = centre;
+
+    for (size_t i = 0; i < 3; i++) // clamp along each axis
+        res += axes[i] * std::min(std::max(d.Dot(axes[i]), -halfExtents[i]), halfExtents[i]);
+
+    return res;
+}
+
+Triangle::Triangle():
+    v0(), v1(), v2()
+{}
+
+Triangle::Triangle(const Vector3& v0, const Vector3& v1, const Vector3& v2):
+    v0(v0), v1(v1), v2(v2)
+{}
+
+Vector3 Triangle::Normal() const
+{
+    return (v1 - v0).Cross(v2 - v0);
+}
+
+Vector3 Triangle::ClosestPoint(const Vector3& p) const
+{
+    // Voronoi region tests from Real-Time Collision Detection, Ericson 5.1.5
+    Vector3 ab = v1 - v0;
+    Vector3 ac = v2 - v0;
+
+    Vector3 ap = p - v0;
+    float d1 = ab.Dot(ap);
+    float d2 = ac.Dot(ap);
+    if (d1 <= 0.f && d2 <= 0.f)
+        return v0;
+
+    Vector3 bp = p - v1;
+    float d3 = ab.Dot(bp);
+    float d4 = ac.Dot(bp);
+    if (d3 >= 0.f && d4 <= d3)
+        return v1;
+
+    float vc = (d1 * d4) - (d3 * d2);
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+        return v0 + (ab * (d1 / (d1 - d3)));
+
+    Vector3 cp = p - v2;
+    float d5 = ab.Dot(cp);
+    float d6 = ac.Dot(cp);
+    if (d6 >= 0.f && d5 <= d6)
+        return v2;
+
+    float vb = (d5 * d2) - (d1 * d6);
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+        return v0 + (ac * (d2 / (d2 - d6)));
+
+    float va = (d3 * d6) - (d5 * d4);
+    if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+        return v1 + ((v2 - v1) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))));
+
+    // Inside face region
+    float denom = 1.f / (va + vb + vc);
+    return v0 + (ab * (vb * denom)) + (ac * (vc * denom));
+}
+
+bool Triangle::Intersect(const Ray& ray, float& t) const
+{
+    Vector3 e1 = v1 - v0;
+    Vector3 e2 = v2 - v0;
+
+    Vector3 pvec = ray.direction.Cross(e2);
+    float det = e1.Dot(pvec);
+    if (fabsf(det) < kParallelEpsilon)
+        return false;
+
+    float invDet = 1.f / det;
+    Vector3 tvec = ray.origin - v0;
+
+    float u = tvec.Dot(pvec) * invDet;
+    if (u < 0.f || u > 1.f)
+        return false;
+
+    Vector3 qvec = tvec.Cross(e1);
+    float v = ray.direction.Dot(qvec) * invDet;
+    if (v < 0.f || u + v > 1.f)
+        return false;
+
+    float hit = e2.Dot(qvec) * invDet;
+    if (hit < 0.f)
+        return false;
+
+    t = hit;
+    return true;
+}
+
+template<size_t N>
+TrianglePacket<N>::TrianglePacket():
+    v0x(), v0y(), v0z(), e1x(), e1y(), e1z(), e2x(), e2y(), e2z()
+{}
+
+template<size_t N>
+TrianglePacket<N>::TrianglePacket(const Triangle* tris, size_t count):
+    TrianglePacket()
+{
+    assert(count <= N);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Vector3 e1 = tris[i].v1 - tris[i].v0;
+        Vector3 e2 = tris[i].v2 - tris[i].v0;
+
+        v0x[i] = tris[i].v0.x; v0y[i] = tris[i].v0.y; v0z[i] = tris[i].v0.z;
+        e1x[i] = e1.x; e1y[i] = e1.y; e1z[i] = e1.z;
+        e2x[i] = e2.x; e2y[i] = e2.y; e2z[i] = e2.z;
+    }
+}
+
+template struct TrianglePacket<4>;
+template struct TrianglePacket<8>;
+
+void TriangleArray::Push(const Triangle& t)
+{
+    Vector3 e1 = t.v1 - t.v0;
+    Vector3 e2 = t.v2 - t.v0;
+
+    v0x.push_back(t.v0.x); v0y.push_back(t.v0.y); v0z.push_back(t.v0.z);
+    e1x.push_back(e1.x); e1y.push_back(e1.y); e1z.push_back(e1.z);
+    e2x.push_back(e2.x); e2y.push_back(e2.y); e2z.push_back(e2.z);
+}
+
+void TriangleArray::Clear()
+{
+    for (std::vector<float>* a : {&v0x, &v0y, &v0z, &e1x, &e1y, &e1z, &e2x, &e2y, &e2z})
+        a->clear();
+}
+
+void TriangleArray::Reserve(size_t n)
+{
+    for (std::vector<float>* a : {&v0x, &v0y, &v0z, &e1x, &e1y, &e1z, &e2x, &e2y, &e2z})
+        a->reserve(n);
+}
+
+size_t TriangleArray::Size() const
+{
+    return v0x.size();
+}
+
+Triangle TriangleArray::operator[](size_t i) const
+{
+    assert(i < Size());
+
+    Vector3 v0(v0x[i], v0y[i], v0z[i]);
+    return Triangle(v0, v0 + Vector3(e1x[i], e1y[i], e1z[i]), v0 + Vector3(e2x[i], e2y[i], e2z[i]));
+}
+
+void AABBArray::Push(const AABB& b)
+{
+    minX.push_back(b.min.x); minY.push_back(b.min.y); minZ.push_back(b.min.z);
+    maxX.push_back(b.max.x); maxY.push_back(b.max.y); maxZ.push_back(b.max.z);
+}
+
+void AABBArray::Clear()
+{
+    for (std::vector<float>* a : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ})
+        a->clear();
+}
+
+void AABBArray::Reserve(size_t n)
+{
+    for (std::vector<float>* a : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ})
+        a->reserve(n);
+}
+
+size_t AABBArray::Size() const
+{
+    return minX.size();
+}
+
+AABB AABBArray::operator[](size_t i) const
+{
+    assert(i < Size());
+    return AABB(Vector3(minX[i], minY[i], minZ[i]), Vector3(maxX[i], maxY[i], maxZ[i]));
+}
+
+// Kernels are templated on lane type so the same code handles full SIMD
+// blocks and the scalar remainder.
+
+namespace
+{
+
+/**
+ * @brief Pointers into structure of arrays triangle data
+ */
+struct TriangleSoA
+{
+    const float *v0x, *v0y, *v0z;
+    const float *e1x, *e1y, *e1z;
+    const float *e2x, *e2y, *e2z;
+};
+
+/**
+ * @brief Ray broadcast to every lane, built once per batch
+ */
+template<typename F>
+struct RayLanes
+{
+    RayLanes(const Ray& ray):
+        ox(F::Set(ray.origin.x)), oy(F::Set(ray.origin.y)), oz(F::Set(ray.origin.z)),
+        dx(F::Set(ray.direction.x)), dy(F::Set(ray.direction.y)), dz(F::Set(ray.direction.z)),
+        idx(F::Set(1.f / ray.direction.x)), idy(F::Set(1.f / ray.direction.y)), idz(F::Set(1.f / ray.direction.z))
+    {}
+
+    F ox, oy, oz;
+    F dx, dy, dz;
+    F idx, idy, idz;
+};
+
+template<typename F>
+uint32_t RayTriangles(const RayLanes<F>& ray, const TriangleSoA& tri, size_t i, float* t)
+{
+    F dx = ray.dx, dy = ray.dy, dz = ray.dz;
+    F e1x = F::Load(tri.e1x + i), e1y = F::Load(tri.e1y + i), e1z = F::Load(tri.e1z + i);
+    F e2x = F::Load(tri.e2x + i), e2y = F::Load(tri.e2y + i), e2z = F::Load(tri.e2z + i);
+
+    // pvec = d x e2
+    F px = (dy * e2z) - (dz * e2y);
+    F py = (dz * e2x) - (dx * e2z);
+    F pz = (dx * e2y) - (dy * e2x);
+
+    F det = MulAdd(e1x, px, MulAdd(e1y, py, e1z * pz));
+    F invDet = F::Set(1.f) / det;
+
+    // tvec = o - v0
+    F tx = ray.ox - F::Load(tri.v0x + i);
+    F ty = ray.oy - F::Load(tri.v0y + i);
+    F tz = ray.oz - F::Load(tri.v0z + i);
+
+    F u = MulAdd(tx, px, MulAdd(ty, py, tz * pz)) * invDet;
+
+    // qvec = tvec x e1
+    F qx = (ty * e1z) - (tz * e1y);
+    F qy = (tz * e1x) - (tx * e1z);
+    F qz = (tx * e1y) - (ty * e1x);
+
+    F v = MulAdd(dx, qx, MulAdd(dy, qy, dz * qz)) * invDet;
+    F hit = MulAdd(e2x, qx, MulAdd(e2y, qy, e2z * qz)) * invDet;
+
+    F zero = F::Set(0.f);
+    F one = F::Set(1.f);
+    auto mask = (Abs(det) >= F::Set(kParallelEpsilon))
+        & (u >= zero) & (u <= one)
+        & (v >= zero) & ((u + v) <= one)
+        & (hit >= zero);
+
+    hit.Store(t + i);
+    return MaskBits(mask);
+}
+
+template<typename F>
+F Slab(F o, F invDir, const float* min, const float* max, F& tNear, F& tFar)
+{
+    F t0 = (F::Load(min) - o) * invDir;
+    F t1 = (F::Load(max) - o) * invDir;
+
+    // NaN from 0 * inf, a ray parallel to the slab lying in one of its faces, which doesn't limit it
+    auto onFace = (t0 != t0) | (t1 != t1);
+
+    tNear = Select(onFace, tNear, Max(Min(t0, t1), tNear));
+    tFar = Select(onFace, tFar, Min(Max(t0, t1), tFar));
+    return tNear;
+}
+
+template<typename F>
+uint32_t RayAABBs(const RayLanes<F>& ray, const AABBArray& boxes, size_t i, float* t)
+{
+    F tNear = F::Set(0.f);
+    F tFar = F::Set(INFINITY);
+
+    Slab(ray.ox, ray.idx, boxes.minX.data() + i, boxes.maxX.data() + i, tNear, tFar);
+    Slab(ray.oy, ray.idy, boxes.minY.data() + i, boxes.maxY.data() + i, tNear, tFar);
+    Slab(ray.oz, ray.idz, boxes.minZ.data() + i, boxes.maxZ.data() + i, tNear, tFar);
+
+    tNear.Store(t + i);
+    return MaskBits(tNear <= tFar);
+}
+
+template<typename F>
+void ClosestPointsLanes(const Vector3* points, size_t pointStride, const TriangleSoA& tri, size_t i, Vector3* out)
+{
+    constexpr size_t W = F::Width;
+
+    // Gather points to lanes
+    alignas(32) float px[W], py[W], pz[W];
+    for (size_t l = 0; l < W; l++)
+    {
+        const Vector3& p = points[(i + l) * pointStride];
+        px[l] = p.x; py[l] = p.y; pz[l] = p.z;
+    }
+
+    F ax = F::Load(tri.v0x + i), ay = F::Load(tri.v0y + i), az = F::Load(tri.v0z + i);
+    F abx = F::Load(tri.e1x + i), aby = F::Load(tri.e1y + i), abz = F::Load(tri.e1z + i);
+    F acx = F::Load(tri.e2x + i), acy = F::Load(tri.e2y + i), acz = F::Load(tri.e2z + i);
+
+    // ap, bp and cp expressed relative to a
+    F apx = F::Load(px) - ax, apy = F::Load(py) - ay, apz = F::Load(pz) - az;
+
+    F d1 = MulAdd(abx, apx, MulAdd(aby, apy, abz * apz));
+    F d2 = MulAdd(acx, apx, MulAdd(acy, apy, acz * apz));
+
+    F abab = MulAdd(abx, abx, MulAdd(aby, aby, abz * abz));
+    F abac = MulAdd(abx, acx, MulAdd(aby, acy, abz * acz));
+    F acac = MulAdd(acx, acx, MulAdd(acy, acy, acz * acz));
+
+    // bp = ap - ab, cp = ap - ac
+    F d3 = d1 - abab;
+    F d4 = d2 - abac;
+    F d5 = d1 - abac;
+    F d6 = d2 - acac;
+
+    F va = (d3 * d6) - (d5 * d4);
+    F vb = (d5 * d2) - (d1 * d6);
+    F vc = (d1 * d4) - (d3 * d2);
+
+    // Result is a + ab * v + ac * w, start from the face region and let
+    // higher priority regions overwrite it in reverse order of the scalar tests
+    F zero = F::Set(0.f);
+    F one = F::Set(1.f);
+
+    F denom = one / (va + vb + vc);
+    F v = vb * denom;
+    F w = vc * denom;
+
+    F d43 = d4 - d3;
+    F d56 = d5 - d6;
+    auto inBC = (va <= zero) & (d43 >= zero) & (d56 >= zero);
+    F tBC = d43 / (d43 + d56);
+    v = Select(inBC, one - tBC, v);
+    w = Select(inBC, tBC, w);
+
+    auto inAC = (vb <= zero) & (d2 >= zero) & (d6 <= zero);
+    v = Select(inAC, zero, v);
+    w = Select(inAC, d2 / (d2 - d6), w);
+
+    auto inC = (d6 >= zero) & (d5 <= d6);
+    v = Select(inC, zero, v);
+    w = Select(inC, one, w);
+
+    auto inAB = (vc <= zero) & (d1 >= zero) & (d3 <= zero);
+    v = Select(inAB, d1 / (d1 - d3), v);
+    w = Select(inAB, zero, w);
+
+    auto inB = (d3 >= zero) & (d4 <= d3);
+    v = Select(inB, one, v);
+    w = Select(inB, zero, w);
+
+    auto inA = (d1 <= zero) & (d2 <= zero);
+    v = Select(inA, zero, v);
+    w = Select(inA, zero, w);
+
+    MulAdd(abx, v, MulAdd(acx, w, ax)).Store(px);
+    MulAdd(aby, v, MulAdd(acy, w, ay)).Store(py);
+    MulAdd(abz, v, MulAdd(acz, w, az)).Store(pz);
+
+    for (size_t l = 0; l < W; l++)
+    {
+        out[i + l].x = px[l];
+        out[i + l].y = py[l];
+        out[i + l].z = pz[l];
+    }
+}
+
+TriangleSoA MakeSoA(const TriangleArray& a)
+{
+    return {
+        a.v0x.data(), a.v0y.data(), a.v0z.data(),
+        a.e1x.data(), a.e1y.data(), a.e1z.data(),
+        a.e2x.data(), a.e2y.data(), a.e2z.data()
+    };
+}
+
+template<size_t N>
+TriangleSoA MakeSoA(const TrianglePacket<N>& p)
+{
+    return {p.v0x, p.v0y, p.v0z, p.e1x, p.e1y, p.e1z, p.e2x, p.e2y, p.e2z};
+}
+
+/**
+ * @brief Run a masked kernel over count elements, SIMD blocks first then scalar tail
+ *
+ * @param kernel Generic callable taking (lane tag, index) and returning hit bits
+ */
+template<typename Kernel>
+size_t RunMasked(size_t count, uint32_t* hitMask, Kernel kernel)
+{
+    std::fill(hitMask, hitMask + ((count + 31) / 32), 0u);
+
+    size_t hits = 0;
+    size_t i = 0;
+
+    // Widths divide 32 so a block never straddles two mask words
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        uint32_t bits = kernel(SimdFloat(), i);
+        hitMask[i / 32] |= bits << (i % 32);
+        hits += std::bitset<32>(bits).count();
+    }
+
+    for (; i < count; i++)
+    {
+        uint32_t bits = kernel(ScalarFloat(), i);
+        hitMask[i / 32] |= bits << (i % 32);
+        hits += bits;
+    }
+
+    return hits;
+}
+
+template<size_t N>
+uint32_t RayPacket(const Ray& ray, const TrianglePacket<N>& tris, float* t)
+{
+    TriangleSoA soa = MakeSoA(tris);
+    uint32_t bits = 0;
+
+#ifdef FMATHS_SIMD_SSE
+    // Packets are 4 or 8 wide, split into whichever SSE/AVX lanes are available
+    constexpr size_t W = SimdFloat::Width <= N ? SimdFloat::Width : N;
+    using F = std::conditional_t<W == SimdFloat::Width, SimdFloat, Float4>;
+#else
+    constexpr size_t W = 1;
+    using F = ScalarFloat;
+#endif
+
+    RayLanes<F> lanes(ray);
+    for (size_t i = 0; i < N; i += W)
+        bits |= RayTriangles(lanes, soa, i, t) << i;
+
+    return bits;
+}
+
+} // namespace
+
+uint32_t IntersectRay(const Ray& ray, const TrianglePacket4& tris, float* t)
+{
+    return RayPacket(ray, tris, t);
+}
+
+uint32_t IntersectRay(const Ray& ray, const TrianglePacket8& tris, float* t)
+{
+    return RayPacket(ray, tris, t);
+}
+
+size_t IntersectRay(const Ray& ray, const TriangleArray& tris, uint32_t* hitMask, float* t)
+{
+    TriangleSoA soa = MakeSoA(tris);
+    RayLanes<SimdFloat> wide(ray);
+    RayLanes<ScalarFloat> narrow(ray);
+
+    return RunMasked(tris.Size(), hitMask, [&](auto lane, size_t i) {
+        if constexpr (std::is_same_v<decltype(lane), ScalarFloat>)
+            return RayTriangles(narrow, soa, i, t);
+        else
+            return RayTriangles(wide, soa, i, t);
+    });
+}
+
+size_t IntersectRay(const Ray& ray, const AABBArray& boxes, uint32_t* hitMask, float* t)
+{
+    RayLanes<SimdFloat> wide(ray);
+    RayLanes<ScalarFloat> narrow(ray);
+
+    return RunMasked(boxes.Size(), hitMask, [&](auto lane, size_t i) {
+        if constexpr (std::is_same_v<decltype(lane), ScalarFloat>)
+            return RayAABBs(narrow, boxes, i, t);
+        else
+            return RayAABBs(wide, boxes, i, t);
+    });
+}
+
+void ClosestPoints(const Vector3* points, const TriangleArray& tris, Vector3* out)
+{
+    TriangleSoA soa = MakeSoA(tris);
+    size_t count = tris.Size();
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        ClosestPointsLanes<SimdFloat>(points, 1, soa, i, out);
+
+    for (; i < count; i++)
+        ClosestPointsLanes<ScalarFloat>(points, 1, soa, i, out);
+}
+
+void ClosestPoints(const Vector3& point, const TriangleArray& tris, Vector3* out)
+{
+    TriangleSoA soa = MakeSoA(tris);
+    size_t count = tris.Size();
+    size_t i = 0;
+
+    // Stride of 0 broadcasts the single point to every lane
+    const Vector3* p = &point;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        ClosestPointsLanes<SimdFloat>(p, 0, soa, i, out);
+
+    for (; i < count; i++)
+        ClosestPointsLanes<ScalarFloat>(p, 0, soa, i, out);
+}
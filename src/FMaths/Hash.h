@@ -0,0 +1,58 @@
+/**
+ * @file Hash.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal grid quantization and hashing
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief Cell index of v in a grid with cells 1 / invCell wide
+ *
+ * Clamped to +-2^30 so neighbouring cells never overflow, NaN goes to the lowest cell.
+ */
+inline int32_t QuantizeCell(float v, float invCell)
+{
+    constexpr float limit = 1073741824.f; // 2^30
+    float c = floorf(v * invCell);
+
+    if (!(c >= -limit))
+        c = -limit;
+    if (c > limit)
+        c = limit;
+
+    return static_cast<int32_t>(c);
+}
+
+/**
+ * @brief MurmurHash3's 64 bit finalizer
+ */
+inline uint64_t MixHash(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+
+    return h;
+}
+
+inline uint64_t HashCell(int32_t x, int32_t y, int32_t z, int32_t w = 0)
+{
+    uint64_t h = (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    h = MixHash(h) ^ ((static_cast<uint64_t>(static_cast<uint32_t>(z)) << 32) | static_cast<uint32_t>(w));
+
+    return MixHash(h);
+}
+
+#endif
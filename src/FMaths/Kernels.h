@@ -0,0 +1,306 @@
+/**
+ * @file Kernels.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal lane kernels shared between translation units
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <cstddef>
+
+#include "Simd.h"
+
+#include "FMaths/Vector3.h"
+#include "FMaths/Vector4.h"
+#include "FMaths/Matrix4x4.h"
+#include "FMaths/Quaternion.h"
+
+// Batch kernels treat arrays of these types as packed floats
+static_assert(sizeof(Vector3) == sizeof(float) * 3, "Vector3 must be tightly packed");
+static_assert(sizeof(Vector4) == sizeof(float) * 4, "Vector4 must be tightly packed");
+static_assert(sizeof(Quaternion) == sizeof(float) * 4, "Quaternion must be tightly packed");
+static_assert(sizeof(Matrix4x4) == sizeof(float) * 16, "Matrix4x4 must be tightly packed");
+
+/**
+ * @brief W matrices transposed into lanes, m[col][row]
+ */
+template<typename F>
+struct MatrixLanes
+{
+    F m[4][4];
+
+    /**
+     * @brief Load W consecutive matrices starting from p
+     */
+    static MatrixLanes Load(const Matrix4x4* p)
+    {
+        const float* f = reinterpret_cast<const float*>(p);
+        MatrixLanes res;
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                res.m[col][row] = F::Gather(f + (col * 4) + row, 16);
+
+        return res;
+    }
+
+    void Store(Matrix4x4* p) const
+    {
+        float* f = reinterpret_cast<float*>(p);
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                m[col][row].Scatter(f + (col * 4) + row, 16);
+    }
+};
+
+/**
+ * @brief W quaternions in lanes
+ */
+template<typename F>
+struct QuaternionLanes
+{
+    F x, y, z, w;
+
+    static QuaternionLanes Load(const Quaternion* p)
+    {
+        const float* f = reinterpret_cast<const float*>(p);
+        return {F::Gather(f, 4), F::Gather(f + 1, 4), F::Gather(f + 2, 4), F::Gather(f + 3, 4)};
+    }
+
+    void Store(Quaternion* p) const
+    {
+        float* f = reinterpret_cast<float*>(p);
+
+        x.Scatter(f, 4);
+        y.Scatter(f + 1, 4);
+        z.Scatter(f + 2, 4);
+        w.Scatter(f + 3, 4);
+    }
+};
+
+/**
+ * @brief W 3D vectors in lanes
+ */
+template<typename F>
+struct Vector3Lanes
+{
+    F x, y, z;
+
+    static Vector3Lanes Load(const Vector3* p)
+    {
+        const float* f = reinterpret_cast<const float*>(p);
+        return {F::Gather(f, 3), F::Gather(f + 1, 3), F::Gather(f + 2, 3)};
+    }
+
+    void Store(Vector3* p) const
+    {
+        float* f = reinterpret_cast<float*>(p);
+
+        x.Scatter(f, 3);
+        y.Scatter(f + 1, 3);
+        z.Scatter(f + 2, 3);
+    }
+};
+
+/**
+ * @brief Rotation matrix to quaternion using Shepperd's method
+ *
+ * Evaluates all four candidate forms and keeps the one with the largest
+ * pivot, so there is no branching and the divisor never approaches 0.
+ *
+ * @param m 3x3 rotation block, m[col][row]
+ */
+template<typename F>
+QuaternionLanes<F> ShepperdQuaternion(const F (&m)[4][4])
+{
+    const F& m00 = m[0][0];
+    const F& m11 = m[1][1];
+    const F& m22 = m[2][2];
+
+    F one = F::Set(1.f);
+
+    // Off diagonal sums and differences, m[col][row]
+    F d21 = m[1][2] - m[2][1]; // 4wx
+    F d02 = m[2][0] - m[0][2]; // 4wy
+    F d10 = m[0][1] - m[1][0]; // 4wz
+    F s01 = m[1][0] + m[0][1]; // 4xy
+    F s02 = m[2][0] + m[0][2]; // 4xz
+    F s12 = m[2][1] + m[1][2]; // 4yz
+
+    // w pivot
+    F t = one + m00 + m11 + m22;
+    QuaternionLanes<F> q = {d21, d02, d10, t};
+
+    // x pivot
+    F tx = one + m00 - m11 - m22;
+    auto useX = tx > t;
+    t = Select(useX, tx, t);
+    q = {Select(useX, tx, q.x), Select(useX, s01, q.y), Select(useX, s02, q.z), Select(useX, d21, q.w)};
+
+    // y pivot
+    F ty = one - m00 + m11 - m22;
+    auto useY = ty > t;
+    t = Select(useY, ty, t);
+    q = {Select(useY, s01, q.x), Select(useY, ty, q.y), Select(useY, s12, q.z), Select(useY, d02, q.w)};
+
+    // z pivot
+    F tz = one - m00 - m11 + m22;
+    auto useZ = tz > t;
+    t = Select(useZ, tz, t);
+    q = {Select(useZ, s02, q.x), Select(useZ, s12, q.y), Select(useZ, tz, q.z), Select(useZ, d10, q.w)};
+
+    F scale = F::Set(0.5f) * InvSqrt(t);
+    return {q.x * scale, q.y * scale, q.z * scale, q.w * scale};
+}
+
+/**
+ * @brief W matrix products, accumulated in the same order as Matrix4x4::operator*
+ */
+template<typename F>
+MatrixLanes<F> MultiplyLanes(const MatrixLanes<F>& a, const MatrixLanes<F>& b)
+{
+    MatrixLanes<F> res;
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+        {
+            F acc = F::Set(0.f);
+            for (size_t i = 0; i < 4; i++)
+                acc = MulAdd(a.m[i][row], b.m[col][i], acc);
+
+            res.m[col][row] = acc;
+        }
+
+    return res;
+}
+
+/**
+ * @brief W matrix inverses, operation for operation the same as Matrix4x4::Inverse
+ *
+ * Lanes with a zero determinant are set to identity.
+ */
+template<typename F>
+MatrixLanes<F> InverseLanes(const MatrixLanes<F>& mat)
+{
+    const F (&m)[4][4] = mat.m;
+
+    F s0 = (m[0][0] * m[1][1]) - (m[0][1] * m[1][0]);
+    F s1 = (m[0][0] * m[1][2]) - (m[0][2] * m[1][0]);
+    F s2 = (m[0][0] * m[1][3]) - (m[0][3] * m[1][0]);
+    F s3 = (m[0][1] * m[1][2]) - (m[0][2] * m[1][1]);
+    F s4 = (m[0][1] * m[1][3]) - (m[0][3] * m[1][1]);
+    F s5 = (m[0][2] * m[1][3]) - (m[0][3] * m[1][2]);
+
+    F c0 = (m[2][0] * m[3][1]) - (m[2][1] * m[3][0]);
+    F c1 = (m[2][0] * m[3][2]) - (m[2][2] * m[3][0]);
+    F c2 = (m[2][0] * m[3][3]) - (m[2][3] * m[3][0]);
+    F c3 = (m[2][1] * m[3][2]) - (m[2][2] * m[3][1]);
+    F c4 = (m[2][1] * m[3][3]) - (m[2][3] * m[3][1]);
+    F c5 = (m[2][2] * m[3][3]) - (m[2][3] * m[3][2]);
+
+    F det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+
+    F adj[4][4] = {
+        {
+             (m[1][1] * c5) - (m[1][2] * c4) + (m[1][3] * c3),
+            -(m[0][1] * c5) + (m[0][2] * c4) - (m[0][3] * c3),
+             (m[3][1] * s5) - (m[3][2] * s4) + (m[3][3] * s3),
+            -(m[2][1] * s5) + (m[2][2] * s4) - (m[2][3] * s3)
+        },
+        {
+            -(m[1][0] * c5) + (m[1][2] * c2) - (m[1][3] * c1),
+             (m[0][0] * c5) - (m[0][2] * c2) + (m[0][3] * c1),
+            -(m[3][0] * s5) + (m[3][2] * s2) - (m[3][3] * s1),
+             (m[2][0] * s5) - (m[2][2] * s2) + (m[2][3] * s1)
+        },
+        {
+             (m[1][0] * c4) - (m[1][1] * c2) + (m[1][3] * c0),
+            -(m[0][0] * c4) + (m[0][1] * c2) - (m[0][3] * c0),
+             (m[3][0] * s4) - (m[3][1] * s2) + (m[3][3] * s0),
+            -(m[2][0] * s4) + (m[2][1] * s2) - (m[2][3] * s0)
+        },
+        {
+            -(m[1][0] * c3) + (m[1][1] * c1) - (m[1][2] * c0),
+             (m[0][0] * c3) - (m[0][1] * c1) + (m[0][2] * c0),
+            -(m[3][0] * s3) + (m[3][1] * s1) - (m[3][2] * s0),
+             (m[2][0] * s3) - (m[2][1] * s1) + (m[2][2] * s0)
+        }
+    };
+
+    F zero = F::Set(0.f);
+    F one = F::Set(1.f);
+    F invDet = one / det;
+    auto singular = det == zero;
+
+    MatrixLanes<F> res;
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+            res.m[col][row] = Select(singular, (col == row) ? one : zero, adj[col][row] * invDet);
+
+    return res;
+}
+
+/**
+ * @brief Rotate W vectors by W quaternions
+ *
+ * Normalizes under the same rule as Quaternion::IsNormalized, then uses
+ * v + w * t + u x t with t = 2 * (u x v) rather than two quaternion products.
+ */
+template<typename F>
+Vector3Lanes<F> ApplyLanes(QuaternionLanes<F> q, const Vector3Lanes<F>& v)
+{
+    F one = F::Set(1.f);
+    F two = F::Set(2.f);
+
+    F mag2 = MulAdd(q.w, q.w, MulAdd(q.z, q.z, MulAdd(q.y, q.y, q.x * q.x)));
+    auto unit = Abs(mag2 - one) <= F::Set(__FLT_EPSILON__);
+    F inv = Select(unit, one, InvSqrt(mag2));
+
+    q = {q.x * inv, q.y * inv, q.z * inv, q.w * inv};
+
+    F tx = two * ((q.y * v.z) - (q.z * v.y));
+    F ty = two * ((q.z * v.x) - (q.x * v.z));
+    F tz = two * ((q.x * v.y) - (q.y * v.x));
+
+    return {
+        v.x + MulAdd(q.w, tx, (q.y * tz) - (q.z * ty)),
+        v.y + MulAdd(q.w, ty, (q.z * tx) - (q.x * tz)),
+        v.z + MulAdd(q.w, tz, (q.x * ty) - (q.y * tx))
+    };
+}
+
+/**
+ * @brief Rotation blocks of W unit quaternions, r[col][row], operation for operation the same as Matrix4x4::QuatRotate
+ */
+template<typename F>
+void RotationLanes(const QuaternionLanes<F>& q, F (&r)[3][3])
+{
+    const F& x = q.x;
+    const F& y = q.y;
+    const F& z = q.z;
+    const F& w = q.w;
+
+    F one = F::Set(1.f);
+    F two = F::Set(2.f);
+
+    r[0][0] = (two * ((x * x) + (w * w))) - one;
+    r[0][1] = two * ((x * y) + (w * z));
+    r[0][2] = two * ((x * z) - (w * y));
+
+    r[1][0] = two * ((y * x) - (w * z));
+    r[1][1] = (two * ((y * y) + (w * w))) - one;
+    r[1][2] = two * ((y * z) + (w * x));
+
+    r[2][0] = two * ((z * x) + (w * y));
+    r[2][1] = two * ((z * y) - (w * x));
+    r[2][2] = (two * ((z * z) + (w * w))) - one;
+}
+
+#endif
@@ -0,0 +1,324 @@
+#include "FMaths/Layout.h"
+
+#include "FMaths/Matrix4x4.h"
+#include "FMaths/Vector3.h"
+#include "FMaths/Vector4.h"
+
+#include "Simd.h"
+
+static_assert(sizeof(Vector3) == sizeof(float) * 3, "Vector3 must be tightly packed");
+static_assert(sizeof(Vector4) == sizeof(float) * 4, "Vector4 must be tightly packed");
+static_assert(sizeof(Matrix4x4) == sizeof(float) * 16, "Matrix4x4 must be tightly packed");
+
+namespace
+{
+
+// Matrices converted at a time by ToSoA, 4KB so the block stays in L1 while each column is written
+constexpr size_t kMatrixBlock = 64;
+
+/**
+ * @brief Copy count elements of N interleaved components into separate arrays
+ */
+template<size_t N, bool NonTemporal>
+void Split(const float* aos, size_t count, float* const* soa)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        SimdFloat c[N];
+        LoadComponents(aos + (i * N), c);
+
+        for (size_t k = 0; k < N; k++)
+            Put<NonTemporal>(c[k], soa[k] + i);
+    }
+
+    for (; i < count; i++)
+        for (size_t k = 0; k < N; k++)
+            soa[k][i] = aos[(i * N) + k];
+}
+
+/**
+ * @brief Inverse of Split
+ */
+template<size_t N>
+void Join(const float* const* soa, size_t count, float* aos)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        SimdFloat c[N];
+        for (size_t k = 0; k < N; k++)
+            c[k] = SimdFloat::Load(soa[k] + i);
+
+        StoreComponents(aos + (i * N), c);
+    }
+
+    for (; i < count; i++)
+        for (size_t k = 0; k < N; k++)
+            aos[(i * N) + k] = soa[k][i];
+}
+
+template<size_t N>
+void ToArrays(const float* aos, size_t count, float* const* soa)
+{
+    bool stream = (count * N * sizeof(float)) >= kStreamThreshold;
+    for (size_t k = 0; k < N; k++)
+        stream = stream && IsAligned(soa[k], sizeof(SimdFloat));
+
+    if (stream)
+    {
+        Split<N, true>(aos, count, soa);
+        StreamFence();
+    }
+    else
+        Split<N, false>(aos, count, soa);
+}
+
+template<size_t N, bool NonTemporal>
+void SplitBlocks(const float* aos, size_t count, float* aosoa)
+{
+    for (size_t b = 0; b * kAoSoAWidth < count; b++)
+    {
+        size_t first = b * kAoSoAWidth;
+        size_t n = (count - first < kAoSoAWidth) ? count - first : kAoSoAWidth;
+        float* block = aosoa + (b * N * kAoSoAWidth);
+
+        float* soa[N];
+        for (size_t k = 0; k < N; k++)
+            soa[k] = block + (k * kAoSoAWidth);
+
+        Split<N, NonTemporal>(aos + (first * N), n, soa);
+
+        for (size_t k = 0; k < N; k++) // pad the last block
+            for (size_t i = n; i < kAoSoAWidth; i++)
+                soa[k][i] = 0.f;
+    }
+}
+
+template<size_t N>
+void ToBlocks(const float* aos, size_t count, float* aosoa)
+{
+    bool stream = (AoSoASize(count, N) * sizeof(float)) >= kStreamThreshold && IsAligned(aosoa, sizeof(SimdFloat));
+
+    if (stream)
+    {
+        SplitBlocks<N, true>(aos, count, aosoa);
+        StreamFence();
+    }
+    else
+        SplitBlocks<N, false>(aos, count, aosoa);
+}
+
+template<size_t N>
+void FromBlocks(const float* aosoa, size_t count, float* aos)
+{
+    for (size_t b = 0; b * kAoSoAWidth < count; b++)
+    {
+        size_t first = b * kAoSoAWidth;
+        size_t n = (count - first < kAoSoAWidth) ? count - first : kAoSoAWidth;
+        const float* block = aosoa + (b * N * kAoSoAWidth);
+
+        const float* soa[N];
+        for (size_t k = 0; k < N; k++)
+            soa[k] = block + (k * kAoSoAWidth);
+
+        Join<N>(soa, n, aos + (first * N));
+    }
+}
+
+/**
+ * @brief Component k of matrices [0, n) to out[k * stride + j]
+ *
+ * Each column of 4 matrices is one 4x4 transpose, producing 4 components.
+ */
+template<bool NonTemporal>
+void SplitMatrices(const float* m, size_t n, float* out, size_t stride)
+{
+    for (size_t col = 0; col < 4; col++)
+    {
+        float* dst = out + (col * 4 * stride);
+        size_t j = 0;
+
+#ifdef FMATHS_SIMD_SSE
+        for (; j + 4 <= n; j += 4)
+        {
+            const float* src = m + (j * 16) + (col * 4);
+            Float4 r0 = Float4::Load(src);
+            Float4 r1 = Float4::Load(src + 16);
+            Float4 r2 = Float4::Load(src + 32);
+            Float4 r3 = Float4::Load(src + 48);
+            Transpose(r0, r1, r2, r3);
+
+            Put<NonTemporal>(r0, dst + j);
+            Put<NonTemporal>(r1, dst + stride + j);
+            Put<NonTemporal>(r2, dst + (2 * stride) + j);
+            Put<NonTemporal>(r3, dst + (3 * stride) + j);
+        }
+#endif
+
+        for (; j < n; j++)
+            for (size_t row = 0; row < 4; row++)
+                dst[(row * stride) + j] = m[(j * 16) + (col * 4) + row];
+    }
+}
+
+/**
+ * @brief Inverse of SplitMatrices
+ */
+void JoinMatrices(const float* in, size_t stride, size_t n, float* m)
+{
+    for (size_t col = 0; col < 4; col++)
+    {
+        const float* src = in + (col * 4 * stride);
+        size_t j = 0;
+
+#ifdef FMATHS_SIMD_SSE
+        for (; j + 4 <= n; j += 4)
+        {
+            Float4 r0 = Float4::Load(src + j);
+            Float4 r1 = Float4::Load(src + stride + j);
+            Float4 r2 = Float4::Load(src + (2 * stride) + j);
+            Float4 r3 = Float4::Load(src + (3 * stride) + j);
+            Transpose(r0, r1, r2, r3);
+
+            float* dst = m + (j * 16) + (col * 4);
+            r0.Store(dst);
+            r1.Store(dst + 16);
+            r2.Store(dst + 32);
+            r3.Store(dst + 48);
+        }
+#endif
+
+        for (; j < n; j++)
+            for (size_t row = 0; row < 4; row++)
+                m[(j * 16) + (col * 4) + row] = src[(row * stride) + j];
+    }
+}
+
+template<bool NonTemporal>
+void MatricesToSoA(const float* m, size_t count, float* soa)
+{
+    for (size_t first = 0; first < count; first += kMatrixBlock)
+    {
+        size_t n = (count - first < kMatrixBlock) ? count - first : kMatrixBlock;
+        SplitMatrices<NonTemporal>(m + (first * 16), n, soa + first, count);
+    }
+}
+
+template<bool NonTemporal>
+void MatricesToAoSoA(const float* m, size_t count, float* aosoa)
+{
+    for (size_t first = 0; first < count; first += kAoSoAWidth)
+    {
+        size_t n = (count - first < kAoSoAWidth) ? count - first : kAoSoAWidth;
+        float* block = aosoa + (first * 16);
+
+        SplitMatrices<NonTemporal>(m + (first * 16), n, block, kAoSoAWidth);
+
+        for (size_t k = 0; k < 16; k++) // pad the last block
+            for (size_t j = n; j < kAoSoAWidth; j++)
+                block[(k * kAoSoAWidth) + j] = 0.f;
+    }
+}
+
+} // namespace
+
+size_t AoSoASize(size_t count, size_t components)
+{
+    return ((count + kAoSoAWidth - 1) / kAoSoAWidth) * kAoSoAWidth * components;
+}
+
+void ToSoA(const Vector3* v, size_t count, float* x, float* y, float* z)
+{
+    float* soa[3] = {x, y, z};
+    ToArrays<3>(reinterpret_cast<const float*>(v), count, soa);
+}
+
+void FromSoA(const float* x, const float* y, const float* z, size_t count, Vector3* v)
+{
+    const float* soa[3] = {x, y, z};
+    Join<3>(soa, count, reinterpret_cast<float*>(v));
+}
+
+void ToSoA(const Vector4* v, size_t count, float* x, float* y, float* z, float* w)
+{
+    float* soa[4] = {x, y, z, w};
+    ToArrays<4>(reinterpret_cast<const float*>(v), count, soa);
+}
+
+void FromSoA(const float* x, const float* y, const float* z, const float* w, size_t count, Vector4* v)
+{
+    const float* soa[4] = {x, y, z, w};
+    Join<4>(soa, count, reinterpret_cast<float*>(v));
+}
+
+void ToSoA(const Matrix4x4* m, size_t count, float* soa)
+{
+    const float* in = reinterpret_cast<const float*>(m);
+
+    // Rows are 16 byte aligned only if every one is
+    if ((count * sizeof(Matrix4x4)) >= kStreamThreshold && IsAligned(soa, 16) && (count % 4) == 0)
+    {
+        MatricesToSoA<true>(in, count, soa);
+        StreamFence();
+    }
+    else
+        MatricesToSoA<false>(in, count, soa);
+}
+
+void FromSoA(const float* soa, size_t count, Matrix4x4* m)
+{
+    float* out = reinterpret_cast<float*>(m);
+
+    for (size_t first = 0; first < count; first += kMatrixBlock)
+    {
+        size_t n = (count - first < kMatrixBlock) ? count - first : kMatrixBlock;
+        JoinMatrices(soa + first, count, n, out + (first * 16));
+    }
+}
+
+void ToAoSoA(const Vector3* v, size_t count, float* aosoa)
+{
+    ToBlocks<3>(reinterpret_cast<const float*>(v), count, aosoa);
+}
+
+void FromAoSoA(const float* aosoa, size_t count, Vector3* v)
+{
+    FromBlocks<3>(aosoa, count, reinterpret_cast<float*>(v));
+}
+
+void ToAoSoA(const Vector4* v, size_t count, float* aosoa)
+{
+    ToBlocks<4>(reinterpret_cast<const float*>(v), count, aosoa);
+}
+
+void FromAoSoA(const float* aosoa, size_t count, Vector4* v)
+{
+    FromBlocks<4>(aosoa, count, reinterpret_cast<float*>(v));
+}
+
+void ToAoSoA(const Matrix4x4* m, size_t count, float* aosoa)
+{
+    const float* in = reinterpret_cast<const float*>(m);
+
+    if ((AoSoASize(count, 16) * sizeof(float)) >= kStreamThreshold && IsAligned(aosoa, 16))
+    {
+        MatricesToAoSoA<true>(in, count, aosoa);
+        StreamFence();
+    }
+    else
+        MatricesToAoSoA<false>(in, count, aosoa);
+}
+
+void FromAoSoA(const float* aosoa, size_t count, Matrix4x4* m)
+{
+    float* out = reinterpret_cast<float*>(m);
+
+    for (size_t first = 0; first < count; first += kAoSoAWidth)
+    {
+        size_t n = (count - first < kAoSoAWidth) ? count - first : kAoSoAWidth;
+        JoinMatrices(aosoa + (first * 16), kAoSoAWidth, n, out + (first * 16));
+    }
+}
@@ -0,0 +1,263 @@
+#include "FMaths/Matrix3x3.h"
+
+#include <cassert>
+
+#include "FMaths/FastMath.h"
+
+#include "Simd.h"
+
+static_assert(sizeof(Vector2) == sizeof(float) * 2, "Vector2 must be tightly packed");
+
+namespace
+{
+
+/**
+ * @brief Affine part of a matrix broadcast into lanes
+ */
+template<typename F>
+struct AffineLanes
+{
+    F m00, m01, m10, m11, tx, ty;
+
+    static AffineLanes Set(const Matrix3x3& m)
+    {
+        return {F::Set(m[0].x), F::Set(m[0].y), F::Set(m[1].x), F::Set(m[1].y), F::Set(m[2].x), F::Set(m[2].y)};
+    }
+
+    void Transform(F& x, F& y) const
+    {
+        F rx = MulAdd(m00, x, MulAdd(m10, y, tx));
+        F ry = MulAdd(m01, x, MulAdd(m11, y, ty));
+
+        x = rx;
+        y = ry;
+    }
+};
+
+} // namespace
+
+Matrix3x3::Matrix3x3()
+{}
+
+Matrix3x3::Matrix3x3(float s)
+{
+    for (size_t i = 0; i < 3; i++) // iterate diagonal
+        m_Columns[i][i] = s;
+}
+
+Matrix3x3::Matrix3x3(const Vector3& col0, const Vector3& col1, const Vector3& col2):
+    m_Columns{col0, col1, col2}
+{}
+
+Matrix3x3::Matrix3x3(const Matrix3x3& m)
+{
+    for (size_t col = 0; col < 3; col++) // iterate columns
+        m_Columns[col] = m[col];
+}
+
+float Matrix3x3::Determinant() const
+{
+    return m_Columns[0].Dot(m_Columns[1].Cross(m_Columns[2]));
+}
+
+Matrix3x3 Matrix3x3::Inverse() const
+{
+    // Rows of the inverse are the cross products of column pairs, over the determinant
+    Vector3 r0 = m_Columns[1].Cross(m_Columns[2]);
+    Vector3 r1 = m_Columns[2].Cross(m_Columns[0]);
+    Vector3 r2 = m_Columns[0].Cross(m_Columns[1]);
+
+    float determinant = m_Columns[0].Dot(r0);
+    if (determinant == 0.f) // avoid divide by 0
+        return Identity();
+
+    float invDet = 1.f / determinant;
+    return Matrix3x3(
+        Vector3(r0.x, r1.x, r2.x),
+        Vector3(r0.y, r1.y, r2.y),
+        Vector3(r0.z, r1.z, r2.z)
+    ) * invDet;
+}
+
+Vector2 Matrix3x3::TransformPoint(const Vector2& p) const
+{
+    ScalarFloat x{p.x}, y{p.y};
+    AffineLanes<ScalarFloat>::Set(*this).Transform(x, y);
+
+    return Vector2(x.v, y.v);
+}
+
+Vector2 Matrix3x3::TransformVector(const Vector2& v) const
+{
+    return Vector2(
+        MulAdd(m_Columns[0].x, v.x, m_Columns[1].x * v.y),
+        MulAdd(m_Columns[0].y, v.x, m_Columns[1].y * v.y)
+    );
+}
+
+void Matrix3x3::TransformPoints(const Vector2* p, Vector2* out, size_t count) const
+{
+    const float* in = reinterpret_cast<const float*>(p);
+    float* res = reinterpret_cast<float*>(out);
+    size_t i = 0;
+
+    AffineLanes<SimdFloat> m = AffineLanes<SimdFloat>::Set(*this);
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        SimdFloat x, y;
+        SimdFloat::LoadInterleaved(in + (i * 2), x, y);
+        m.Transform(x, y);
+        SimdFloat::StoreInterleaved(res + (i * 2), x, y);
+    }
+
+    for (; i < count; i++)
+        out[i] = TransformPoint(p[i]);
+}
+
+void Matrix3x3::TransformPoints(const float* x, const float* y, float* outX, float* outY, size_t count) const
+{
+    size_t i = 0;
+
+    AffineLanes<SimdFloat> m = AffineLanes<SimdFloat>::Set(*this);
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        SimdFloat lx = SimdFloat::Load(x + i);
+        SimdFloat ly = SimdFloat::Load(y + i);
+        m.Transform(lx, ly);
+
+        lx.Store(outX + i);
+        ly.Store(outY + i);
+    }
+
+    for (; i < count; i++)
+    {
+        Vector2 res = TransformPoint(Vector2(x[i], y[i]));
+        outX[i] = res.x;
+        outY[i] = res.y;
+    }
+}
+
+Vector3& Matrix3x3::operator[](size_t i)
+{
+    assert(i < 3);
+    return m_Columns[i];
+}
+
+const Vector3& Matrix3x3::operator[](size_t i) const
+{
+    assert(i < 3);
+    return m_Columns[i];
+}
+
+Matrix3x3 Matrix3x3::operator*(const Matrix3x3& m) const
+{
+    Matrix3x3 res = Matrix3x3();
+
+    for (size_t col = 0; col < 3; col++) // column
+        for (size_t row = 0; row < 3; row++) // row
+            for (size_t i = 0; i < 3; i++) // multiply along current row/column
+                res[col][row] = MulAdd(m_Columns[i][row], m[col][i], res[col][row]);
+
+    return res;
+}
+
+Matrix3x3& Matrix3x3::operator*=(const Matrix3x3& m)
+{
+    // Cannot multiply in place, see Matrix4x4::operator*=
+    return operator=(operator*(m));
+}
+
+Vector3 Matrix3x3::operator*(const Vector3& v) const
+{
+    Vector3 res = Vector3();
+
+    for (size_t row = 0; row < 3; row++) // row
+        for (size_t col = 0; col < 3; col++) // column
+            res[row] = MulAdd(m_Columns[col][row], v[col], res[row]);
+
+    return res;
+}
+
+Matrix3x3 Matrix3x3::operator*(float s) const
+{
+    return Matrix3x3(m_Columns[0] * s, m_Columns[1] * s, m_Columns[2] * s);
+}
+
+Matrix3x3& Matrix3x3::operator*=(float s)
+{
+    m_Columns[0] *= s;
+    m_Columns[1] *= s;
+    m_Columns[2] *= s;
+
+    return *this;
+}
+
+Matrix3x3& Matrix3x3::operator=(const Matrix3x3& m)
+{
+    for (size_t col = 0; col < 3; col++)
+        m_Columns[col] = m[col];
+
+    return *this;
+}
+
+bool Matrix3x3::operator==(const Matrix3x3& m) const
+{
+    return (m_Columns[0] == m[0]) && (m_Columns[1] == m[1]) && (m_Columns[2] == m[2]);
+}
+
+bool Matrix3x3::operator!=(const Matrix3x3& m) const
+{
+    return (m_Columns[0] != m[0]) || (m_Columns[1] != m[1]) || (m_Columns[2] != m[2]);
+}
+
+bool Matrix3x3::ApproxEqual(const Matrix3x3& m, float epsilon) const
+{
+    for (size_t col = 0; col < 3; col++)
+        if (!m_Columns[col].ApproxEqual(m[col], epsilon))
+            return false;
+
+    return true;
+}
+
+bool Matrix3x3::UlpEqual(const Matrix3x3& m, uint32_t maxUlps) const
+{
+    for (size_t col = 0; col < 3; col++)
+        if (!m_Columns[col].UlpEqual(m[col], maxUlps))
+            return false;
+
+    return true;
+}
+
+Matrix3x3 Matrix3x3::Identity()
+{
+    return Matrix3x3(1);
+}
+
+Matrix3x3 Matrix3x3::Translate(const Vector2& v)
+{
+    Matrix3x3 trans = Matrix3x3(1);
+    trans[2] = Vector3(v.x, v.y, 1.f);
+
+    return trans;
+}
+
+Matrix3x3 Matrix3x3::Scale(const Vector2& v)
+{
+    Matrix3x3 scale = Matrix3x3(1);
+    scale[0][0] = v.x;
+    scale[1][1] = v.y;
+
+    return scale;
+}
+
+Matrix3x3 Matrix3x3::Rotate(float r)
+{
+    float s, c;
+    SinCos(r, s, c);
+
+    return Matrix3x3(
+        Vector3(c, s, 0.f),
+        Vector3(-s, c, 0.f),
+        Vector3(0.f, 0.f, 1.f)
+    );
+}
@@ -3,6 +3,235 @@
 #include <cmath>
 #include <cassert>
 
+#include "FMaths/Layout.h"
+#include "FMaths/Quaternion.h"
+
+#include "Kernels.h"
+#include "Compensated.h"
+#include "SimdMath.h"
+
+namespace
+{
+
+/**
+ * @brief Decompose W matrices at once
+ * 
+ * @return Mask of lanes with non-zero scale on every axis
+ */
+template<typename F>
+typename F::Mask DecomposeLanes(MatrixLanes<F>& mat, Vector3Lanes<F>& t, QuaternionLanes<F>& r, Vector3Lanes<F>& s)
+{
+    F (&m)[4][4] = mat.m;
+    F zero = F::Set(0.f);
+    F one = F::Set(1.f);
+
+    t = {m[3][0], m[3][1], m[3][2]};
+
+    F len2[3];
+    for (size_t col = 0; col < 3; col++)
+        len2[col] = MulAdd(m[col][0], m[col][0], MulAdd(m[col][1], m[col][1], m[col][2] * m[col][2]));
+
+    // Reflections are folded into x scale, so x flips with the sign of the determinant
+    F cx = (m[1][1] * m[2][2]) - (m[1][2] * m[2][1]);
+    F cy = (m[1][2] * m[2][0]) - (m[1][0] * m[2][2]);
+    F cz = (m[1][0] * m[2][1]) - (m[1][1] * m[2][0]);
+    F det = MulAdd(m[0][0], cx, MulAdd(m[0][1], cy, m[0][2] * cz));
+    F sign = Select(det < zero, -one, one);
+
+    auto valid = (len2[0] > zero) & (len2[1] > zero) & (len2[2] > zero);
+
+    F eps = F::Set(__FLT_EPSILON__);
+    auto unit = (Abs(len2[0] - one) <= eps) & (Abs(len2[1] - one) <= eps) & (Abs(len2[2] - one) <= eps);
+
+    F scale[3] = {sign, one, one};
+    F inv[3] = {sign, one, one};
+
+    // Fast path, basis is already unit length so only the reflection needs handling
+    if (!All<F>(unit))
+    {
+        for (size_t col = 0; col < 3; col++)
+        {
+            F len = Sqrt(len2[col]);
+            scale[col] = scale[col] * len;
+            inv[col] = inv[col] / len;
+        }
+    }
+
+    for (size_t col = 0; col < 3; col++)
+        for (size_t row = 0; row < 3; row++)
+            m[col][row] = m[col][row] * inv[col];
+
+    s = {scale[0], scale[1], scale[2]};
+    r = ShepperdQuaternion(m);
+
+    // Identity rotation where the basis collapsed
+    r = {Select(valid, r.x, zero), Select(valid, r.y, zero), Select(valid, r.z, zero), Select(valid, r.w, one)};
+
+    return valid;
+}
+
+template<typename F>
+F Dot3(const F (&a)[4], const F (&b)[4])
+{
+    return MulAdd(a[2], b[2], MulAdd(a[1], b[1], a[0] * b[0]));
+}
+
+template<typename F>
+void OrthonormalizeLanes(F (&m)[4][4])
+{
+    F (&x)[4] = m[0];
+    F (&y)[4] = m[1];
+    F (&z)[4] = m[2];
+
+    F inv = InvSqrt(Dot3(x, x));
+    for (size_t row = 0; row < 3; row++)
+        x[row] = x[row] * inv;
+
+    // Remove the component of y along x
+    F proj = Dot3(x, y);
+    for (size_t row = 0; row < 3; row++)
+        y[row] = y[row] - (x[row] * proj);
+
+    inv = InvSqrt(Dot3(y, y));
+    for (size_t row = 0; row < 3; row++)
+        y[row] = y[row] * inv;
+
+    z[0] = (x[1] * y[2]) - (x[2] * y[1]);
+    z[1] = (x[2] * y[0]) - (x[0] * y[2]);
+    z[2] = (x[0] * y[1]) - (x[1] * y[0]);
+}
+
+template<typename F>
+void PolarLanes(F (&m)[4][4], size_t iterations)
+{
+    F negHalf = F::Set(-0.5f);
+    F threeHalves = F::Set(1.5f);
+
+    for (size_t n = 0; n < iterations; n++)
+    {
+        // t = (3I - X^T X) / 2, symmetric
+        F t[3][3];
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = i; j < 3; j++)
+            {
+                t[i][j] = Dot3(m[i], m[j]) * negHalf;
+                t[j][i] = t[i][j];
+            }
+
+        for (size_t i = 0; i < 3; i++)
+            t[i][i] = t[i][i] + threeHalves;
+
+        // X = X * t, column j of the result mixes columns of X by column j of t
+        F res[3][3];
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+                res[col][row] = MulAdd(m[2][row], t[2][col], MulAdd(m[1][row], t[1][col], m[0][row] * t[0][col]));
+
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+                m[col][row] = res[col][row];
+    }
+}
+
+/**
+ * @brief projection * view and its inverse for W pairs
+ *
+ * Projections from this file only use rows of the form
+ * (sx, 0, 0, tx), (0, sy, 0, ty), (0, 0, a, b), (0, 0, c, d)
+ * so both products only need the non-zero terms.
+ */
+template<typename F>
+void ViewProjectionLanes(const MatrixLanes<F>& view, const MatrixLanes<F>& projection, MatrixLanes<F>& out, MatrixLanes<F>& inverse)
+{
+    const F (&v)[4][4] = view.m;
+    const F (&p)[4][4] = projection.m;
+
+    F sx = p[0][0], sy = p[1][1];
+    F tx = p[3][0], ty = p[3][1];
+    F a = p[2][2], b = p[3][2];
+    F c = p[2][3], d = p[3][3];
+
+    for (size_t col = 0; col < 4; col++)
+    {
+        out.m[col][0] = MulAdd(sx, v[col][0], tx * v[col][3]);
+        out.m[col][1] = MulAdd(sy, v[col][1], ty * v[col][3]);
+        out.m[col][2] = MulAdd(a, v[col][2], b * v[col][3]);
+        out.m[col][3] = MulAdd(c, v[col][2], d * v[col][3]);
+    }
+
+    // Rigid view inverts to its transpose with the translation rotated back
+    F zero = F::Set(0.f);
+    F vi[4][4];
+    for (size_t col = 0; col < 3; col++)
+    {
+        for (size_t row = 0; row < 3; row++)
+            vi[col][row] = v[row][col];
+
+        vi[col][3] = zero;
+    }
+
+    for (size_t row = 0; row < 3; row++)
+        vi[3][row] = -MulAdd(v[row][0], v[3][0], MulAdd(v[row][1], v[3][1], v[row][2] * v[3][2]));
+
+    vi[3][3] = F::Set(1.f);
+
+    // Projection inverse, the z and w rows form a 2x2 block
+    F one = F::Set(1.f);
+    F invSx = one / sx, invSy = one / sy;
+    F invDet = one / (a * d - b * c);
+
+    F pi[4][4] = {
+        {invSx, zero, zero, zero},
+        {zero, invSy, zero, zero},
+        {tx * c * invDet * invSx, ty * c * invDet * invSy, d * invDet, -c * invDet},
+        {-tx * a * invDet * invSx, -ty * a * invDet * invSy, -b * invDet, a * invDet},
+    };
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+            inverse.m[col][row] = MulAdd(vi[3][row], pi[col][3], MulAdd(vi[2][row], pi[col][2], MulAdd(vi[1][row], pi[col][1], vi[0][row] * pi[col][0])));
+}
+
+template<bool NonTemporal>
+void TransposeMatrices(const Matrix4x4* m, Matrix4x4* out, size_t count)
+{
+#ifdef FMATHS_SIMD_SSE
+    for (size_t i = 0; i < count; i++)
+    {
+        const float* src = reinterpret_cast<const float*>(m + i);
+        float* dst = reinterpret_cast<float*>(out + i);
+
+        Float4 c0 = Float4::Load(src);
+        Float4 c1 = Float4::Load(src + 4);
+        Float4 c2 = Float4::Load(src + 8);
+        Float4 c3 = Float4::Load(src + 12);
+        Transpose(c0, c1, c2, c3);
+
+        Put<NonTemporal>(c0, dst);
+        Put<NonTemporal>(c1, dst + 4);
+        Put<NonTemporal>(c2, dst + 8);
+        Put<NonTemporal>(c3, dst + 12);
+    }
+#else
+    for (size_t i = 0; i < count; i++)
+        out[i] = m[i].Transpose();
+#endif
+}
+
+/**
+ * @brief tan(fov / 2), with the library's own polynomial in deterministic builds as tanf varies between C libraries
+ */
+float TanHalfFov(float fov)
+{
+#ifdef FMATHS_DETERMINISTIC
+    return SimdMath::Tan(ScalarFloat{fov * 0.5f}).v;
+#else
+    return tanf(fov * 0.5f);
+#endif
+}
+
+} // namespace
+
 Matrix4x4::Matrix4x4()
 {}
 
@@ -80,6 +309,136 @@ Matrix4x4 Matrix4x4::Inverse() const
     return Matrix4x4(adj0, adj1, adj2, adj3) * invDet;
 }
 
+Matrix4x4 Matrix4x4::Transpose() const
+{
+    Matrix4x4 res = Matrix4x4();
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+            res.m_Columns[row][col] = m_Columns[col][row];
+
+    return res;
+}
+
+bool Matrix4x4::Decompose(Vector3& translation, Quaternion& rotation, Vector3& scale) const
+{
+    MatrixLanes<ScalarFloat> m = MatrixLanes<ScalarFloat>::Load(this);
+    Vector3Lanes<ScalarFloat> t, s;
+    QuaternionLanes<ScalarFloat> r;
+
+    ScalarFloat::Mask valid = DecomposeLanes(m, t, r, s);
+
+    t.Store(&translation);
+    r.Store(&rotation);
+    s.Store(&scale);
+
+    return valid.v;
+}
+
+void Matrix4x4::Decompose(const Matrix4x4* m, Vector3* translation, Quaternion* rotation, Vector3* scale, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        MatrixLanes<SimdFloat> lanes = MatrixLanes<SimdFloat>::Load(m + i);
+        Vector3Lanes<SimdFloat> t, s;
+        QuaternionLanes<SimdFloat> r;
+
+        DecomposeLanes(lanes, t, r, s);
+
+        t.Store(translation + i);
+        r.Store(rotation + i);
+        s.Store(scale + i);
+    }
+
+    for (; i < count; i++)
+        m[i].Decompose(translation[i], rotation[i], scale[i]);
+}
+
+void Matrix4x4::Multiply(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out, size_t count)
+{
+    size_t i = 0;
+
+#ifndef FMATHS_COMPENSATED
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        MultiplyLanes(MatrixLanes<SimdFloat>::Load(a + i), MatrixLanes<SimdFloat>::Load(b + i)).Store(out + i);
+#endif
+
+    for (; i < count; i++)
+        out[i] = a[i] * b[i];
+}
+
+void Matrix4x4::Inverse(const Matrix4x4* m, Matrix4x4* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        InverseLanes(MatrixLanes<SimdFloat>::Load(m + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = m[i].Inverse();
+}
+
+void Matrix4x4::Transpose(const Matrix4x4* m, Matrix4x4* out, size_t count)
+{
+    if ((count * sizeof(Matrix4x4)) >= kStreamThreshold && IsAligned(out, 16))
+    {
+        TransposeMatrices<true>(m, out, count);
+        StreamFence();
+    }
+    else
+        TransposeMatrices<false>(m, out, count);
+}
+
+Matrix4x4& Matrix4x4::Orthonormalize()
+{
+    MatrixLanes<ScalarFloat> lanes = MatrixLanes<ScalarFloat>::Load(this);
+    OrthonormalizeLanes(lanes.m);
+    lanes.Store(this);
+
+    return *this;
+}
+
+Matrix4x4& Matrix4x4::OrthonormalizePolar(size_t iterations)
+{
+    MatrixLanes<ScalarFloat> lanes = MatrixLanes<ScalarFloat>::Load(this);
+    PolarLanes(lanes.m, iterations);
+    lanes.Store(this);
+
+    return *this;
+}
+
+void Matrix4x4::Orthonormalize(Matrix4x4* m, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        MatrixLanes<SimdFloat> lanes = MatrixLanes<SimdFloat>::Load(m + i);
+        OrthonormalizeLanes(lanes.m);
+        lanes.Store(m + i);
+    }
+
+    for (; i < count; i++)
+        m[i].Orthonormalize();
+}
+
+void Matrix4x4::OrthonormalizePolar(Matrix4x4* m, size_t count, size_t iterations)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        MatrixLanes<SimdFloat> lanes = MatrixLanes<SimdFloat>::Load(m + i);
+        PolarLanes(lanes.m, iterations);
+        lanes.Store(m + i);
+    }
+
+    for (; i < count; i++)
+        m[i].OrthonormalizePolar(iterations);
+}
+
 Vector4 & Matrix4x4::operator[](size_t i)
 {
     assert(i < 4);
@@ -94,13 +453,31 @@ const Vector4& Matrix4x4::operator[](size_t i) const
 
 Matrix4x4 Matrix4x4::operator*(const Matrix4x4 & m) const
 {
+#ifdef FMATHS_COMPENSATED
+    return MultiplyCompensated(m);
+#else
     Matrix4x4 res = Matrix4x4();
 
     for (size_t col = 0; col < 4; col++) // column
         for (size_t row = 0; row < 4; row++) // row
             for (size_t i = 0; i < 4; i++) // multiply along current row/column
-                res[col][row] += m_Columns[i][row] * m[col][i];
+                res[col][row] = MulAdd(m_Columns[i][row], m[col][i], res[col][row]);
     
+    return res;
+#endif
+}
+
+Matrix4x4 Matrix4x4::MultiplyCompensated(const Matrix4x4& m) const
+{
+    Matrix4x4 res = Matrix4x4();
+
+    // Rows of this are strided by a column, columns of m are contiguous
+    const float* lhs = &m_Columns[0].x;
+
+    for (size_t col = 0; col < 4; col++) // column
+        for (size_t row = 0; row < 4; row++) // row
+            res[col][row] = Compensated::Dot(lhs + row, 4, &m[col].x, 1, 4);
+
     return res;
 }
 
@@ -117,7 +494,7 @@ Vector4 Matrix4x4::operator*(const Vector4 & v) const
 
     for (size_t row = 0; row < 4; row++) // row
         for (size_t col = 0; col < 4; col++) // column
-            res[row] += v[row] * operator[](col)[row];
+            res[row] = MulAdd(m_Columns[col][row], v[col], res[row]);
     
     return res;
 }
@@ -148,13 +525,7 @@ Matrix4x4 & Matrix4x4::operator=(const Matrix4x4 & m)
 
 bool Matrix4x4::operator==(const Matrix4x4& m) const
 {
-    bool equal = true;
-
-    // Could be un-rolled
-    for (size_t col = 0; col < 4; col++)
-        equal &= operator[](col) == m[col];
-    
-    return equal;
+    return (m_Columns[0] == m[0]) && (m_Columns[1] == m[1]) && (m_Columns[2] == m[2]) && (m_Columns[3] == m[3]);
 }
 
 bool Matrix4x4::operator!=(const Matrix4x4 & m) const
@@ -162,6 +533,24 @@ bool Matrix4x4::operator!=(const Matrix4x4 & m) const
     return (m_Columns[0] != m[0]) || (m_Columns[1] != m[1]) || (m_Columns[2] != m[2]) || (m_Columns[3] != m[3]);
 }
 
+bool Matrix4x4::ApproxEqual(const Matrix4x4& m, float epsilon) const
+{
+    for (size_t col = 0; col < 4; col++)
+        if (!m_Columns[col].ApproxEqual(m[col], epsilon))
+            return false;
+
+    return true;
+}
+
+bool Matrix4x4::UlpEqual(const Matrix4x4& m, uint32_t maxUlps) const
+{
+    for (size_t col = 0; col < 4; col++)
+        if (!m_Columns[col].UlpEqual(m[col], maxUlps))
+            return false;
+
+    return true;
+}
+
 Matrix4x4 Matrix4x4::Identity()
 {
     return Matrix4x4(1);
@@ -254,7 +643,11 @@ Matrix4x4 Matrix4x4::Orthographic(const Vector3 & vMin, const Vector3 & vMax)
 Matrix4x4 Matrix4x4::Perspective(float fov, float width, float height, float near, float far)
 {
     assert(near != 0.f);
-    float tanFov = tanf(fov * 0.5f);
+    float tanFov = TanHalfFov(fov);
+
+    // Limits of the finite terms as far goes to infinity
+    float depthScale = std::isinf(far) ? -1.f : (far + near) / (near - far);
+    float depthOffset = std::isinf(far) ? -2.f * near : (2 * far * near) / (near - far);
 
     Vector4 col0(
         1 / tanFov,
@@ -269,15 +662,94 @@ Matrix4x4 Matrix4x4::Perspective(float fov, float width, float height, float nea
 
     Vector4 col2(
         0, 0,
-        (far + near) / (near - far),
+        depthScale,
         -1
     );
 
     Vector4 col3(
         0, 0,
-        (2 * far * near) / (near - far),
+        depthOffset,
         0
     );
 
     return Matrix4x4(col0, col1, col2, col3);
+}
+
+Matrix4x4 Matrix4x4::PerspectiveReverseZ(float fov, float width, float height, float near, float far)
+{
+    assert(near != 0.f);
+    float tanFov = TanHalfFov(fov);
+
+    // Depth is near / -z for an infinite far plane
+    float depthScale = std::isinf(far) ? 0.f : near / (far - near);
+    float depthOffset = std::isinf(far) ? near : (far * near) / (far - near);
+
+    return Matrix4x4(
+        Vector4(1 / tanFov, 0, 0, 0),
+        Vector4(0, width / (height * tanFov), 0, 0),
+        Vector4(0, 0, depthScale, -1),
+        Vector4(0, 0, depthOffset, 0)
+    );
+}
+
+Matrix4x4 Matrix4x4::LookAt(const Vector3& eye, const Vector3& target, const Vector3& up)
+{
+    Vector3 forward = (target - eye).Normalized();
+    Vector3 right = forward.Cross(up).Normalized();
+    Vector3 trueUp = right.Cross(forward);
+
+    // Rows are the camera axes, z pointing backwards
+    return Matrix4x4(
+        Vector4(right.x, trueUp.x, -forward.x, 0),
+        Vector4(right.y, trueUp.y, -forward.y, 0),
+        Vector4(right.z, trueUp.z, -forward.z, 0),
+        Vector4(-right.Dot(eye), -trueUp.Dot(eye), forward.Dot(eye), 1)
+    );
+}
+
+Matrix4x4 Matrix4x4::View(const Vector3& position, const Quaternion& rotation)
+{
+    Matrix4x4 r = QuatRotate(Vector4(rotation.x, rotation.y, rotation.z, rotation.w));
+    Matrix4x4 res = Matrix4x4(1);
+
+    for (size_t col = 0; col < 3; col++)
+    {
+        Vector3 axis(r[col]);
+
+        for (size_t row = 0; row < 3; row++)
+            res[row][col] = axis[row];
+
+        res[3][col] = -axis.Dot(position);
+    }
+
+    return res;
+}
+
+Matrix4x4 Matrix4x4::ViewProjection(const Matrix4x4& view, const Matrix4x4& projection, Matrix4x4& inverse)
+{
+    MatrixLanes<ScalarFloat> out, inv;
+    ViewProjectionLanes(MatrixLanes<ScalarFloat>::Load(&view), MatrixLanes<ScalarFloat>::Load(&projection), out, inv);
+
+    Matrix4x4 res;
+    out.Store(&res);
+    inv.Store(&inverse);
+
+    return res;
+}
+
+void Matrix4x4::ViewProjection(const Matrix4x4* view, const Matrix4x4* projection, Matrix4x4* out, Matrix4x4* inverse, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+    {
+        MatrixLanes<SimdFloat> res, inv;
+        ViewProjectionLanes(MatrixLanes<SimdFloat>::Load(view + i), MatrixLanes<SimdFloat>::Load(projection + i), res, inv);
+
+        res.Store(out + i);
+        inv.Store(inverse + i);
+    }
+
+    for (; i < count; i++)
+        out[i] = ViewProjection(view[i], projection[i], inverse[i]);
 }
\ No newline at end of file
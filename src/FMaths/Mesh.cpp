@@ -0,0 +1,297 @@
+#include "FMaths/Mesh.h"
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+
+#include "SimdMath.h"
+
+namespace
+{
+
+/**
+ * @brief Component of corner k of F::Width triangles from t, gathered into lanes
+ */
+template<typename F>
+F GatherCorner(const float* values, const uint32_t* indices, size_t t, size_t k)
+{
+    float lanes[F::Width];
+    for (size_t lane = 0; lane < F::Width; lane++)
+        lanes[lane] = values[indices[(3 * (t + lane)) + k]];
+
+    return F::Load(lanes);
+}
+
+template<typename F>
+void FaceNormalLanes(const uint32_t* indices, const float* x, const float* y, const float* z, size_t t, float* fx, float* fy,
+    float* fz)
+{
+    F x0 = GatherCorner<F>(x, indices, t, 0), y0 = GatherCorner<F>(y, indices, t, 0), z0 = GatherCorner<F>(z, indices, t, 0);
+    F e1x = GatherCorner<F>(x, indices, t, 1) - x0, e1y = GatherCorner<F>(y, indices, t, 1) - y0, e1z = GatherCorner<F>(z, indices, t, 1) - z0;
+    F e2x = GatherCorner<F>(x, indices, t, 2) - x0, e2y = GatherCorner<F>(y, indices, t, 2) - y0, e2z = GatherCorner<F>(z, indices, t, 2) - z0;
+
+    ((e1y * e2z) - (e1z * e2y)).Store(fx + t);
+    ((e1z * e2x) - (e1x * e2z)).Store(fy + t);
+    ((e1x * e2y) - (e1y * e2x)).Store(fz + t);
+}
+
+/**
+ * @brief MikkTSpace's triangle tangent, t31.v d1 - t21.v d2 normalized and flipped where texture space is mirrored
+ */
+template<typename F>
+void FaceTangentLanes(const uint32_t* indices, const float* x, const float* y, const float* z, const float* u, const float* v,
+    size_t t, float* tx, float* ty, float* tz, float* sign)
+{
+    F x0 = GatherCorner<F>(x, indices, t, 0), y0 = GatherCorner<F>(y, indices, t, 0), z0 = GatherCorner<F>(z, indices, t, 0);
+    F d1x = GatherCorner<F>(x, indices, t, 1) - x0, d1y = GatherCorner<F>(y, indices, t, 1) - y0, d1z = GatherCorner<F>(z, indices, t, 1) - z0;
+    F d2x = GatherCorner<F>(x, indices, t, 2) - x0, d2y = GatherCorner<F>(y, indices, t, 2) - y0, d2z = GatherCorner<F>(z, indices, t, 2) - z0;
+
+    F u0 = GatherCorner<F>(u, indices, t, 0), v0 = GatherCorner<F>(v, indices, t, 0);
+    F t21u = GatherCorner<F>(u, indices, t, 1) - u0, t21v = GatherCorner<F>(v, indices, t, 1) - v0;
+    F t31u = GatherCorner<F>(u, indices, t, 2) - u0, t31v = GatherCorner<F>(v, indices, t, 2) - v0;
+
+    F area = (t21u * t31v) - (t21v * t31u);
+    F sx = (t31v * d1x) - (t21v * d2x);
+    F sy = (t31v * d1y) - (t21v * d2y);
+    F sz = (t31v * d1z) - (t21v * d2z);
+    F length = Sqrt(MulAdd(sz, sz, MulAdd(sy, sy, sx * sx)));
+
+    F zero = F::Set(0.f), tiny = F::Set(FLT_MIN);
+    auto textured = Abs(area) > tiny;
+    auto valid = textured & (length > tiny);
+
+    F s = Select(area > zero, F::Set(1.f), F::Set(-1.f));
+    F scale = Select(valid, s / Select(valid, length, F::Set(1.f)), zero);
+
+    (sx * scale).Store(tx + t);
+    (sy * scale).Store(ty + t);
+    (sz * scale).Store(tz + t);
+    Select(textured, s, zero).Store(sign + t);
+}
+
+template<typename F>
+void NormalizeLanes(float* x, float* y, float* z, size_t i)
+{
+    F vx = F::Load(x + i), vy = F::Load(y + i), vz = F::Load(z + i);
+    F length2 = MulAdd(vz, vz, MulAdd(vy, vy, vx * vx));
+
+    auto nonZero = length2 > F::Set(0.f);
+    F scale = Select(nonZero, InvSqrt(Select(nonZero, length2, F::Set(1.f))), F::Set(0.f));
+
+    (vx * scale).Store(x + i);
+    (vy * scale).Store(y + i);
+    (vz * scale).Store(z + i);
+}
+
+void NormalizeRange(float* x, float* y, float* z, size_t begin, size_t end)
+{
+    size_t i = begin;
+
+    for (; i + SimdFloat::Width <= end; i += SimdFloat::Width)
+        NormalizeLanes<SimdFloat>(x, y, z, i);
+
+    for (; i < end; i++)
+        NormalizeLanes<ScalarFloat>(x, y, z, i);
+}
+
+// Corner weighting follows MikkTSpace, which treats anything within FLT_MIN of 0 as 0
+
+bool NotZero(float a)
+{
+    return std::fabs(a) > FLT_MIN;
+}
+
+/**
+ * @brief Remove the component of (x, y, z) along unit n, then normalize unless it's 0
+ */
+void ProjectNormalize(const float (&n)[3], float& x, float& y, float& z)
+{
+    float d = (n[0] * x) + (n[1] * y) + (n[2] * z);
+    x -= n[0] * d;
+    y -= n[1] * d;
+    z -= n[2] * d;
+
+    if (NotZero(x) || NotZero(y) || NotZero(z))
+    {
+        float inv = 1.f / std::sqrt((x * x) + (y * y) + (z * z));
+        x *= inv;
+        y *= inv;
+        z *= inv;
+    }
+}
+
+} // namespace
+
+// Mesh
+
+Mesh::Mesh(const uint32_t* indices, size_t triangleCount, size_t vertexCount):
+    m_VertexCount(vertexCount), m_Indices(indices, indices + (3 * triangleCount)), m_CornerStart(vertexCount + 1, 0),
+    m_Corners(3 * triangleCount)
+{
+    assert(vertexCount < UINT32_MAX && 3 * triangleCount < UINT32_MAX);
+
+    for (uint32_t index : m_Indices)
+    {
+        assert(index < vertexCount);
+        m_CornerStart[index + 1]++;
+    }
+
+    for (size_t v = 0; v < vertexCount; v++)
+        m_CornerStart[v + 1] += m_CornerStart[v];
+
+    // Visited in order, so each vertex's corners are in triangle order
+    std::vector<uint32_t> next(m_CornerStart.begin(), m_CornerStart.end() - 1);
+    for (size_t c = 0; c < m_Indices.size(); c++)
+        m_Corners[next[m_Indices[c]]++] = static_cast<uint32_t>(c);
+
+    m_FaceX.resize(triangleCount);
+    m_FaceY.resize(triangleCount);
+    m_FaceZ.resize(triangleCount);
+    m_TangentX.resize(triangleCount);
+    m_TangentY.resize(triangleCount);
+    m_TangentZ.resize(triangleCount);
+    m_TangentSign.resize(triangleCount);
+}
+
+size_t Mesh::TriangleCount() const
+{
+    return m_Indices.size() / 3;
+}
+
+size_t Mesh::VertexCount() const
+{
+    return m_VertexCount;
+}
+
+const uint32_t* Mesh::Indices() const
+{
+    return m_Indices.data();
+}
+
+const uint32_t* Mesh::CornerStart() const
+{
+    return m_CornerStart.data();
+}
+
+const uint32_t* Mesh::Corners() const
+{
+    return m_Corners.data();
+}
+
+const float* Mesh::FaceX() const
+{
+    return m_FaceX.data();
+}
+
+const float* Mesh::FaceY() const
+{
+    return m_FaceY.data();
+}
+
+const float* Mesh::FaceZ() const
+{
+    return m_FaceZ.data();
+}
+
+void Mesh::ComputeNormals(const float* x, const float* y, const float* z, float* nx, float* ny, float* nz, const Executor& executor)
+{
+    ParallelFor(TriangleCount(), kMeshChunkSize, executor, [this, x, y, z](size_t begin, size_t end) {
+        size_t t = begin;
+
+        for (; t + SimdFloat::Width <= end; t += SimdFloat::Width)
+            FaceNormalLanes<SimdFloat>(m_Indices.data(), x, y, z, t, m_FaceX.data(), m_FaceY.data(), m_FaceZ.data());
+
+        for (; t < end; t++)
+            FaceNormalLanes<ScalarFloat>(m_Indices.data(), x, y, z, t, m_FaceX.data(), m_FaceY.data(), m_FaceZ.data());
+    });
+
+    // Each vertex sums its own triangles, so no two tasks write the same vertex
+    ParallelFor(m_VertexCount, kMeshChunkSize, executor, [this, nx, ny, nz](size_t begin, size_t end) {
+        for (size_t v = begin; v < end; v++)
+        {
+            float sx = 0.f, sy = 0.f, sz = 0.f;
+
+            for (uint32_t k = m_CornerStart[v]; k < m_CornerStart[v + 1]; k++)
+            {
+                uint32_t t = m_Corners[k] / 3;
+                sx += m_FaceX[t];
+                sy += m_FaceY[t];
+                sz += m_FaceZ[t];
+            }
+
+            nx[v] = sx;
+            ny[v] = sy;
+            nz[v] = sz;
+        }
+
+        NormalizeRange(nx, ny, nz, begin, end);
+    });
+}
+
+void Mesh::ComputeTangents(const float* x, const float* y, const float* z, const float* nx, const float* ny, const float* nz,
+    const float* u, const float* v, float* tx, float* ty, float* tz, float* tw, const Executor& executor)
+{
+    ParallelFor(TriangleCount(), kMeshChunkSize, executor, [this, x, y, z, u, v](size_t begin, size_t end) {
+        size_t t = begin;
+
+        for (; t + SimdFloat::Width <= end; t += SimdFloat::Width)
+            FaceTangentLanes<SimdFloat>(m_Indices.data(), x, y, z, u, v, t, m_TangentX.data(), m_TangentY.data(), m_TangentZ.data(),
+                m_TangentSign.data());
+
+        for (; t < end; t++)
+            FaceTangentLanes<ScalarFloat>(m_Indices.data(), x, y, z, u, v, t, m_TangentX.data(), m_TangentY.data(), m_TangentZ.data(),
+                m_TangentSign.data());
+    });
+
+    ParallelFor(m_VertexCount, kMeshChunkSize, executor, [this, x, y, z, nx, ny, nz, tx, ty, tz, tw](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            const float n[3] = {nx[i], ny[i], nz[i]};
+            float sign = 0.f;
+            float sx = 0.f, sy = 0.f, sz = 0.f;
+
+            for (uint32_t k = m_CornerStart[i]; k < m_CornerStart[i + 1]; k++)
+            {
+                uint32_t corner = m_Corners[k];
+                uint32_t t = corner / 3;
+
+                if (m_TangentSign[t] == 0.f || (sign != 0.f && m_TangentSign[t] != sign))
+                    continue;
+
+                sign = m_TangentSign[t];
+
+                float ox = m_TangentX[t], oy = m_TangentY[t], oz = m_TangentZ[t];
+                ProjectNormalize(n, ox, oy, oz);
+
+                // The corner's angle between its two edges, in the plane of the normal
+                uint32_t previous = m_Indices[(3 * t) + ((corner + 2) % 3)];
+                uint32_t following = m_Indices[(3 * t) + ((corner + 1) % 3)];
+
+                float e1x = x[previous] - x[i], e1y = y[previous] - y[i], e1z = z[previous] - z[i];
+                float e2x = x[following] - x[i], e2y = y[following] - y[i], e2z = z[following] - z[i];
+                ProjectNormalize(n, e1x, e1y, e1z);
+                ProjectNormalize(n, e2x, e2y, e2z);
+
+                float cosine = (e1x * e2x) + (e1y * e2y) + (e1z * e2z);
+                // Not libm's acos, so deterministic builds give the same bits everywhere
+                float angle = SimdMath::Acos(ScalarFloat{std::fmin(std::fmax(cosine, -1.f), 1.f)}).v;
+
+                sx += ox * angle;
+                sy += oy * angle;
+                sz += oz * angle;
+            }
+
+            tx[i] = sx;
+            ty[i] = sy;
+            tz[i] = sz;
+            tw[i] = sign < 0.f ? -1.f : 1.f;
+        }
+
+        NormalizeRange(tx, ty, tz, begin, end);
+    });
+}
+
+void NormalizeSoA(float* x, float* y, float* z, size_t count, const Executor& executor)
+{
+    ParallelFor(count, kMeshChunkSize, executor, [x, y, z](size_t begin, size_t end) { NormalizeRange(x, y, z, begin, end); });
+}
@@ -5,6 +5,55 @@
 
 #include "FMaths/Vector3.h"
 #include "FMaths/Vector4.h"
+#include "FMaths/Matrix4x4.h"
+
+#include "Kernels.h"
+#include "SimdMath.h"
+
+namespace
+{
+
+template<typename F>
+QuaternionLanes<F> AxisAngleLanes(const Vector3Lanes<F>& axis, F r)
+{
+    // Angle is halved, as actual applied rotation = 2*r
+    F s, c;
+    SimdMath::SinCos(r * F::Set(0.5f), s, c);
+
+    // Match Vector3::Normalized, leaving axes which are already unit length untouched
+    F one = F::Set(1.f);
+    F len2 = MulAdd(axis.x, axis.x, MulAdd(axis.y, axis.y, axis.z * axis.z));
+    auto unit = Abs(len2 - one) <= F::Set(__FLT_EPSILON__);
+    F scale = s * Select(unit, one, InvSqrt(len2));
+
+    return {axis.x * scale, axis.y * scale, axis.z * scale, c};
+}
+
+template<typename F>
+QuaternionLanes<F> EulerLanes(const Vector3Lanes<F>& e)
+{
+    F half = F::Set(0.5f);
+    F sx, cx, sy, cy, sz, cz;
+
+    SimdMath::SinCos(e.x * half, sx, cx);
+    SimdMath::SinCos(e.y * half, sy, cy);
+    SimdMath::SinCos(e.z * half, sz, cz);
+
+    // Expanded qz * qy * qx
+    F cycz = cy * cz;
+    F sysz = sy * sz;
+    F sycz = sy * cz;
+    F cysz = cy * sz;
+
+    return {
+        (sx * cycz) - (cx * sysz),
+        (cx * sycz) + (sx * cysz),
+        (cx * cysz) - (sx * sycz),
+        (cx * cycz) + (sx * sysz)
+    };
+}
+
+} // namespace
 
 Quaternion::Quaternion():
     x(0.f), y(0.f), z(0.f), w(1.f)
@@ -16,18 +65,7 @@ Quaternion::Quaternion(float x, float y, float z, float w):
 
 Quaternion::Quaternion(const Vector3& axis, float r)
 {
-    // Angle is halved, as actual applied rotation = 2*r
-    r *= 0.5f;
-
-    float sinr, cosr;
-    sincosf(r, &sinr, &cosr);
-
-    Vector3 uv = axis.Normalized() * sinr;
-
-    x = uv.x;
-    y = uv.y;
-    z = uv.z;
-    w = cosr;
+    AxisAngleLanes(Vector3Lanes<ScalarFloat>::Load(&axis), ScalarFloat{r}).Store(this);
 }
 
 Quaternion::Quaternion(const Vector4 & v):
@@ -38,14 +76,63 @@ Quaternion::Quaternion(const Quaternion & q):
     x(q.x), y(q.y), z(q.z), w(q.w)
 {}
 
+Quaternion Quaternion::FromMatrix(const Matrix4x4& m)
+{
+    Quaternion q;
+    FromMatrices(&m, &q, 1);
+
+    return q;
+}
+
+void Quaternion::FromMatrices(const Matrix4x4* m, Quaternion* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        ShepperdQuaternion(MatrixLanes<SimdFloat>::Load(m + i).m).Store(out + i);
+
+    for (; i < count; i++)
+        ShepperdQuaternion(MatrixLanes<ScalarFloat>::Load(m + i).m).Store(out + i);
+}
+
+Quaternion Quaternion::FromEuler(const Vector3& euler)
+{
+    Quaternion q;
+    EulerLanes(Vector3Lanes<ScalarFloat>::Load(&euler)).Store(&q);
+
+    return q;
+}
+
+void Quaternion::FromEulers(const Vector3* euler, Quaternion* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        EulerLanes(Vector3Lanes<SimdFloat>::Load(euler + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = FromEuler(euler[i]);
+}
+
+void Quaternion::FromAxisAngles(const Vector3* axes, const float* r, Quaternion* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        AxisAngleLanes(Vector3Lanes<SimdFloat>::Load(axes + i), SimdFloat::Load(r + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = Quaternion(axes[i], r[i]);
+}
+
 float Quaternion::Magnitude() const
 {
-    return sqrtf((x * x) + (y * y) + (z * z) + (w * w));
+    return sqrtf(MagnitudeSquared());
 }
 
 float Quaternion::MagnitudeSquared() const
 {
-    return (x * x) + (y * y) + (z * z) + (w * w);
+    return Dot(*this);
 }
 
 Quaternion& Quaternion::Normalize()
@@ -64,6 +151,30 @@ Quaternion Quaternion::Normalized() const
     return (*this) * (1.f / Magnitude());
 }
 
+void Quaternion::Renormalize(Quaternion* q, size_t count)
+{
+    auto renormalize = [](auto lanes) {
+        using F = decltype(lanes.x);
+
+        F len2 = MulAdd(lanes.w, lanes.w, MulAdd(lanes.z, lanes.z, MulAdd(lanes.y, lanes.y, lanes.x * lanes.x)));
+        F scale = F::Set(0.5f) * (F::Set(3.f) - len2);
+
+        lanes.x = lanes.x * scale;
+        lanes.y = lanes.y * scale;
+        lanes.z = lanes.z * scale;
+        lanes.w = lanes.w * scale;
+        return lanes;
+    };
+
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        renormalize(QuaternionLanes<SimdFloat>::Load(q + i)).Store(q + i);
+
+    for (; i < count; i++)
+        renormalize(QuaternionLanes<ScalarFloat>::Load(q + i)).Store(q + i);
+}
+
 bool Quaternion::IsNormalized() const
 {
     return fabsf(MagnitudeSquared() - 1) <= __FLT_EPSILON__;
@@ -71,19 +182,18 @@ bool Quaternion::IsNormalized() const
 
 float Quaternion::Dot(const Quaternion& q) const
 {
-    return (x * q.x) + (y * q.y) + (z * q.z) + (w * q.w);
+    return MulAdd(w, q.w, MulAdd(z, q.z, MulAdd(y, q.y, x * q.x)));
 }
 
 Vector3 Quaternion::Apply(const Vector3& v) const
 {
-    // Unit quaternions are easier to inverse
-    if (!IsNormalized())
-        return Normalized().Apply(v);
+    // Unit quaternions are easier to inverse, normalize once as
+    // rounding can leave Normalized() just outside IsNormalized()
+    Quaternion q = Normalized();
 
     Quaternion vQ(v.x, v.y, v.z, 0.f);
-    // q * p * q^-1 negates scalar part
-    // if q is unit quaterion then q = q^-1
-    vQ = ((*this) * vQ) * (*this);
+    // q * p * q^-1, for a unit quaternion q^-1 is the conjugate
+    vQ = (q * vQ) * Quaternion(-q.x, -q.y, -q.z, q.w);
 
     return Vector3(vQ.x, vQ.y, vQ.z);
 }
@@ -94,6 +204,29 @@ Vector4 Quaternion::Apply(const Vector4 & v) const
     return Vector4(Apply(Vector3(v)), v.w);
 }
 
+void Quaternion::Apply(const Vector3* v, Vector3* out, size_t count) const
+{
+    size_t i = 0;
+
+    QuaternionLanes<SimdFloat> q = {SimdFloat::Set(x), SimdFloat::Set(y), SimdFloat::Set(z), SimdFloat::Set(w)};
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        ApplyLanes(q, Vector3Lanes<SimdFloat>::Load(v + i)).Store(out + i);
+
+    for (; i < count; i++)
+        ApplyLanes(QuaternionLanes<ScalarFloat>::Load(this), Vector3Lanes<ScalarFloat>::Load(v + i)).Store(out + i);
+}
+
+void Quaternion::Apply(const Quaternion* q, const Vector3* v, Vector3* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        ApplyLanes(QuaternionLanes<SimdFloat>::Load(q + i), Vector3Lanes<SimdFloat>::Load(v + i)).Store(out + i);
+
+    for (; i < count; i++)
+        ApplyLanes(QuaternionLanes<ScalarFloat>::Load(q + i), Vector3Lanes<ScalarFloat>::Load(v + i)).Store(out + i);
+}
+
 Quaternion Quaternion::operator*(float s) const
 {
     return Quaternion(x * s, y * s, z * s, w * s);
@@ -200,6 +333,18 @@ bool Quaternion::operator!=(const Quaternion & q) const
     return (x != q.x) || (y != q.y) || (z != q.z) || (w != q.w);
 }
 
+bool Quaternion::ApproxEqual(const Quaternion& q, float epsilon) const
+{
+    return ::ApproxEqual(x, q.x, epsilon) && ::ApproxEqual(y, q.y, epsilon) &&
+           ::ApproxEqual(z, q.z, epsilon) && ::ApproxEqual(w, q.w, epsilon);
+}
+
+bool Quaternion::UlpEqual(const Quaternion& q, uint32_t maxUlps) const
+{
+    return ::UlpEqual(x, q.x, maxUlps) && ::UlpEqual(y, q.y, maxUlps) &&
+           ::UlpEqual(z, q.z, maxUlps) && ::UlpEqual(w, q.w, maxUlps);
+}
+
 float& Quaternion::operator[](size_t i)
 {
     assert(i < 4);
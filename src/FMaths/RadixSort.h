@@ -0,0 +1,98 @@
+/**
+ * @file RadixSort.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal parallel stable radix sort of integer keys carrying uint32_t values
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FMaths/Async.h"
+
+/**
+ * @brief Bits sorted per pass, so a million buckets take two passes and 30 bit codes three
+ */
+constexpr uint32_t kRadixBits = 11;
+constexpr size_t kRadixDigits = size_t(1) << kRadixBits;
+
+/**
+ * @brief Sort keys and values together by the low bits of each key, least significant digit first
+ *
+ * Every pass histograms each chunk of chunkSize keys in its own task, then
+ * scatters each chunk after every earlier chunk's keys of the same digit, so
+ * the sort is stable and the result doesn't depend on the executor. Passes in
+ * which every key has the same digit are skipped.
+ *
+ * @param scratchKeys, scratchValues Resized to keys' size, swapped with keys and values after each pass
+ * @param histogram Resized to a digit count per chunk
+ */
+template<typename Key>
+void RadixSort(std::vector<Key>& keys, std::vector<uint32_t>& values, uint32_t bits, size_t chunkSize, const Executor& executor,
+    std::vector<Key>& scratchKeys, std::vector<uint32_t>& scratchValues, std::vector<uint32_t>& histogram)
+{
+    size_t count = keys.size();
+    size_t chunks = (count + chunkSize - 1) / chunkSize;
+
+    scratchKeys.resize(count);
+    scratchValues.resize(count);
+    histogram.resize(chunks * kRadixDigits);
+
+    for (uint32_t shift = 0; shift < bits; shift += kRadixBits)
+    {
+        ParallelFor(count, chunkSize, executor, [&keys, &histogram, shift, chunkSize](size_t begin, size_t end) {
+            uint32_t* h = histogram.data() + ((begin / chunkSize) * kRadixDigits);
+            std::fill(h, h + kRadixDigits, 0u);
+
+            for (size_t i = begin; i < end; i++)
+                h[static_cast<size_t>(keys[i] >> shift) & (kRadixDigits - 1)]++;
+        });
+
+        // Digit major so each chunk writes after every earlier chunk's keys of the same digit
+        uint32_t sum = 0;
+        bool constant = false;
+
+        for (size_t digit = 0; digit < kRadixDigits; digit++)
+        {
+            uint32_t first = sum;
+
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+            {
+                uint32_t n = histogram[(chunk * kRadixDigits) + digit];
+                histogram[(chunk * kRadixDigits) + digit] = sum;
+                sum += n;
+            }
+
+            constant = constant || (sum - first == count && count > 0);
+        }
+
+        // The scatter would copy every key to where it already is
+        if (constant)
+            continue;
+
+        ParallelFor(count, chunkSize, executor, [&keys, &values, &scratchKeys, &scratchValues, &histogram, shift, chunkSize](size_t begin, size_t end) {
+            uint32_t* next = histogram.data() + ((begin / chunkSize) * kRadixDigits);
+
+            for (size_t i = begin; i < end; i++)
+            {
+                uint32_t slot = next[static_cast<size_t>(keys[i] >> shift) & (kRadixDigits - 1)]++;
+                scratchKeys[slot] = keys[i];
+                scratchValues[slot] = values[i];
+            }
+        });
+
+        keys.swap(scratchKeys);
+        values.swap(scratchValues);
+    }
+}
+
+#endif
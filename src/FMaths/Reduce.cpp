@@ -0,0 +1,412 @@
+#include "FMaths/Reduce.h"
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Simd.h"
+
+namespace
+{
+
+size_t ChunkCount(size_t count)
+{
+    return (count + kReduceChunkSize - 1) / kReduceChunkSize;
+}
+
+// NaN loses against any number, as with Min and Max on lanes
+float MinIgnoreNaN(float a, float b) { return a < b ? a : b; }
+float MaxIgnoreNaN(float a, float b) { return a > b ? a : b; }
+
+/**
+ * @brief Per component min and max over [begin, end)
+ *
+ * @param load Called as load(F (&c)[N], i) to fill lanes with elements i to i + W
+ */
+template<size_t N, typename Load>
+void MinMaxChunk(size_t begin, size_t end, Load load, float* min, float* max)
+{
+    // Element i always lands in lane i % kReduceLanes, whatever the lane type
+    constexpr size_t kBlocks = kReduceLanes / SimdFloat::Width;
+
+    SimdFloat lo[kBlocks][N], hi[kBlocks][N];
+    for (size_t b = 0; b < kBlocks; b++)
+        for (size_t k = 0; k < N; k++)
+        {
+            lo[b][k] = SimdFloat::Set(INFINITY);
+            hi[b][k] = SimdFloat::Set(-INFINITY);
+        }
+
+    size_t i = begin;
+    for (; i + kReduceLanes <= end; i += kReduceLanes)
+        for (size_t b = 0; b < kBlocks; b++)
+        {
+            SimdFloat c[N];
+            load(c, i + (b * SimdFloat::Width));
+
+            // Second operand wins when the first is NaN
+            for (size_t k = 0; k < N; k++)
+            {
+                lo[b][k] = Min(c[k], lo[b][k]);
+                hi[b][k] = Max(c[k], hi[b][k]);
+            }
+        }
+
+    for (size_t k = 0; k < N; k++)
+    {
+        float lanes[2][kReduceLanes];
+        for (size_t b = 0; b < kBlocks; b++)
+        {
+            lo[b][k].Store(lanes[0] + (b * SimdFloat::Width));
+            hi[b][k].Store(lanes[1] + (b * SimdFloat::Width));
+        }
+
+        min[k] = INFINITY;
+        max[k] = -INFINITY;
+        for (size_t lane = 0; lane < kReduceLanes; lane++)
+        {
+            min[k] = MinIgnoreNaN(lanes[0][lane], min[k]);
+            max[k] = MaxIgnoreNaN(lanes[1][lane], max[k]);
+        }
+    }
+
+    for (; i < end; i++)
+    {
+        ScalarFloat c[N];
+        load(c, i);
+
+        for (size_t k = 0; k < N; k++)
+        {
+            min[k] = MinIgnoreNaN(c[k].v, min[k]);
+            max[k] = MaxIgnoreNaN(c[k].v, max[k]);
+        }
+    }
+}
+
+/**
+ * @brief Per component sum over [begin, end), float lanes folded into double in lane order
+ */
+template<size_t N, typename Load>
+void SumChunk(size_t begin, size_t end, Load load, double* sum)
+{
+    constexpr size_t kBlocks = kReduceLanes / SimdFloat::Width;
+
+    SimdFloat acc[kBlocks][N];
+    for (size_t b = 0; b < kBlocks; b++)
+        for (size_t k = 0; k < N; k++)
+            acc[b][k] = SimdFloat::Set(0.f);
+
+    size_t i = begin;
+    for (; i + kReduceLanes <= end; i += kReduceLanes)
+        for (size_t b = 0; b < kBlocks; b++)
+        {
+            SimdFloat c[N];
+            load(c, i + (b * SimdFloat::Width));
+
+            for (size_t k = 0; k < N; k++)
+                acc[b][k] = acc[b][k] + c[k];
+        }
+
+    for (size_t k = 0; k < N; k++)
+    {
+        float lanes[kReduceLanes];
+        for (size_t b = 0; b < kBlocks; b++)
+            acc[b][k].Store(lanes + (b * SimdFloat::Width));
+
+        sum[k] = 0.0;
+        for (size_t lane = 0; lane < kReduceLanes; lane++)
+            sum[k] += lanes[lane];
+    }
+
+    for (; i < end; i++)
+    {
+        ScalarFloat c[N];
+        load(c, i);
+
+        for (size_t k = 0; k < N; k++)
+            sum[k] += c[k].v;
+    }
+}
+
+template<size_t N, typename Load>
+void ReduceMinMax(size_t count, const Executor& executor, Load load, float* min, float* max)
+{
+    std::vector<float> partial(ChunkCount(count) * 2 * N);
+    ParallelFor(count, kReduceChunkSize, executor, [&](size_t begin, size_t end) {
+        size_t chunk = begin / kReduceChunkSize;
+
+        MinMaxChunk<N>(begin, end, load, &partial[chunk * 2 * N], &partial[(chunk * 2 * N) + N]);
+    });
+
+    for (size_t k = 0; k < N; k++)
+    {
+        min[k] = INFINITY;
+        max[k] = -INFINITY;
+    }
+
+    for (size_t chunk = 0; chunk < ChunkCount(count); chunk++)
+        for (size_t k = 0; k < N; k++)
+        {
+            min[k] = MinIgnoreNaN(partial[(chunk * 2 * N) + k], min[k]);
+            max[k] = MaxIgnoreNaN(partial[(chunk * 2 * N) + N + k], max[k]);
+        }
+}
+
+template<size_t N, typename Load>
+void ReduceSum(size_t count, const Executor& executor, Load load, double* sum)
+{
+    std::vector<double> partial(ChunkCount(count) * N);
+    ParallelFor(count, kReduceChunkSize, executor, [&](size_t begin, size_t end) {
+        size_t chunk = begin / kReduceChunkSize;
+
+        SumChunk<N>(begin, end, load, &partial[chunk * N]);
+    });
+
+    // Chunk order, whichever thread finished first
+    for (size_t k = 0; k < N; k++)
+        sum[k] = 0.0;
+
+    for (size_t chunk = 0; chunk < ChunkCount(count); chunk++)
+        for (size_t k = 0; k < N; k++)
+            sum[k] += partial[(chunk * N) + k];
+}
+
+/**
+ * @brief Loads consecutive elements of N packed floats
+ */
+template<size_t N>
+auto Points(const float* p)
+{
+    return [p](auto& c, size_t i) { LoadComponents(p + (i * N), c); };
+}
+
+template<typename F>
+using LaneOf = std::remove_reference_t<decltype(std::declval<F&>()[0])>;
+
+template<size_t N>
+void MeanOf(const float* p, size_t count, const Executor& executor, double* mean)
+{
+    ReduceSum<N>(count, executor, Points<N>(p), mean);
+
+    for (size_t k = 0; k < N; k++)
+        mean[k] = (count == 0) ? 0.0 : mean[k] / static_cast<double>(count);
+}
+
+/**
+ * @brief Eigen decomposition of a symmetric matrix by cyclic Jacobi rotations
+ *
+ * @param a Symmetric matrix, destroyed
+ * @param v Set to the eigenvectors, v[k][i] is component k of vector i
+ * @param w Set to the eigenvalues
+ */
+void SymmetricEigen(double (&a)[3][3], double (&v)[3][3], double (&w)[3])
+{
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++)
+            v[i][j] = (i == j) ? 1.0 : 0.0;
+
+    const size_t pairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+    // Converges quadratically, a handful of sweeps reach double precision
+    for (size_t sweep = 0; sweep < 32; sweep++)
+    {
+        double off = (a[0][1] * a[0][1]) + (a[0][2] * a[0][2]) + (a[1][2] * a[1][2]);
+        double diag = (a[0][0] * a[0][0]) + (a[1][1] * a[1][1]) + (a[2][2] * a[2][2]);
+        if (off <= 1e-30 * diag || off == 0.0)
+            break;
+
+        for (const size_t (&pq)[2] : pairs)
+        {
+            size_t p = pq[0], q = pq[1];
+            if (a[p][q] == 0.0)
+                continue;
+
+            // Rotation which zeroes a[p][q]
+            double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+            double t = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt((theta * theta) + 1.0));
+            double c = 1.0 / sqrt((t * t) + 1.0);
+            double s = t * c;
+
+            for (size_t k = 0; k < 3; k++)
+            {
+                double akp = a[k][p], akq = a[k][q];
+                a[k][p] = (c * akp) - (s * akq);
+                a[k][q] = (s * akp) + (c * akq);
+            }
+
+            for (size_t k = 0; k < 3; k++)
+            {
+                double apk = a[p][k], aqk = a[q][k];
+                a[p][k] = (c * apk) - (s * aqk);
+                a[q][k] = (s * apk) + (c * aqk);
+            }
+
+            for (size_t k = 0; k < 3; k++)
+            {
+                double vkp = v[k][p], vkq = v[k][q];
+                v[k][p] = (c * vkp) - (s * vkq);
+                v[k][q] = (s * vkp) + (c * vkq);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < 3; i++)
+        w[i] = a[i][i];
+}
+
+} // namespace
+
+void MinMax(const Vector3* points, size_t count, Vector3& min, Vector3& max, const Executor& executor)
+{
+    float lo[3], hi[3];
+    ReduceMinMax<3>(count, executor, Points<3>(reinterpret_cast<const float*>(points)), lo, hi);
+
+    min = Vector3(lo[0], lo[1], lo[2]);
+    max = Vector3(hi[0], hi[1], hi[2]);
+}
+
+void MinMax(const Vector4* points, size_t count, Vector4& min, Vector4& max, const Executor& executor)
+{
+    float lo[4], hi[4];
+    ReduceMinMax<4>(count, executor, Points<4>(reinterpret_cast<const float*>(points)), lo, hi);
+
+    min = Vector4(lo[0], lo[1], lo[2], lo[3]);
+    max = Vector4(hi[0], hi[1], hi[2], hi[3]);
+}
+
+AABB Bounds(const Vector3* points, size_t count, const Executor& executor)
+{
+    AABB res;
+    MinMax(points, count, res.min, res.max, executor);
+
+    return res;
+}
+
+Vector3 Sum(const Vector3* points, size_t count, const Executor& executor)
+{
+    double sum[3];
+    ReduceSum<3>(count, executor, Points<3>(reinterpret_cast<const float*>(points)), sum);
+
+    return Vector3(static_cast<float>(sum[0]), static_cast<float>(sum[1]), static_cast<float>(sum[2]));
+}
+
+Vector4 Sum(const Vector4* points, size_t count, const Executor& executor)
+{
+    double sum[4];
+    ReduceSum<4>(count, executor, Points<4>(reinterpret_cast<const float*>(points)), sum);
+
+    return Vector4(static_cast<float>(sum[0]), static_cast<float>(sum[1]), static_cast<float>(sum[2]), static_cast<float>(sum[3]));
+}
+
+Vector3 Mean(const Vector3* points, size_t count, const Executor& executor)
+{
+    double mean[3];
+    MeanOf<3>(reinterpret_cast<const float*>(points), count, executor, mean);
+
+    return Vector3(static_cast<float>(mean[0]), static_cast<float>(mean[1]), static_cast<float>(mean[2]));
+}
+
+Vector4 Mean(const Vector4* points, size_t count, const Executor& executor)
+{
+    double mean[4];
+    MeanOf<4>(reinterpret_cast<const float*>(points), count, executor, mean);
+
+    return Vector4(static_cast<float>(mean[0]), static_cast<float>(mean[1]), static_cast<float>(mean[2]), static_cast<float>(mean[3]));
+}
+
+Matrix3x3 Covariance(const Vector3* points, size_t count, Vector3* mean, const Executor& executor)
+{
+    const float* p = reinterpret_cast<const float*>(points);
+
+    double centre[3];
+    MeanOf<3>(p, count, executor, centre);
+    Vector3 m(static_cast<float>(centre[0]), static_cast<float>(centre[1]), static_cast<float>(centre[2]));
+
+    if (mean)
+        *mean = m;
+
+    // xx, xy, xz, yy, yz, zz of offsets from the mean
+    double sum[6];
+    ReduceSum<6>(count, executor, [p, m](auto& c, size_t i) {
+        using F = LaneOf<decltype(c)>;
+
+        F d[3];
+        LoadComponents(p + (i * 3), d);
+        for (size_t k = 0; k < 3; k++)
+            d[k] = d[k] - F::Set(m[k]);
+
+        c[0] = d[0] * d[0];
+        c[1] = d[0] * d[1];
+        c[2] = d[0] * d[2];
+        c[3] = d[1] * d[1];
+        c[4] = d[1] * d[2];
+        c[5] = d[2] * d[2];
+    }, sum);
+
+    double n = (count == 0) ? 1.0 : static_cast<double>(count);
+    float xx = static_cast<float>(sum[0] / n), xy = static_cast<float>(sum[1] / n), xz = static_cast<float>(sum[2] / n);
+    float yy = static_cast<float>(sum[3] / n), yz = static_cast<float>(sum[4] / n), zz = static_cast<float>(sum[5] / n);
+
+    return Matrix3x3(Vector3(xx, xy, xz), Vector3(xy, yy, yz), Vector3(xz, yz, zz));
+}
+
+OBB FitOBB(const Vector3* points, size_t count, const Executor& executor)
+{
+    if (count == 0)
+        return OBB();
+
+    Vector3 mean;
+    Matrix3x3 cov = Covariance(points, count, &mean, executor);
+
+    double a[3][3], v[3][3], w[3];
+    for (size_t col = 0; col < 3; col++)
+        for (size_t row = 0; row < 3; row++)
+            a[row][col] = cov[col][row];
+
+    SymmetricEigen(a, v, w);
+
+    // Largest variance first
+    size_t order[3] = {0, 1, 2};
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = i + 1; j < 3; j++)
+            if (w[order[j]] > w[order[i]])
+                std::swap(order[i], order[j]);
+
+    Vector3 axes[3];
+    for (size_t i = 0; i < 2; i++)
+        axes[i] = Vector3(
+            static_cast<float>(v[0][order[i]]),
+            static_cast<float>(v[1][order[i]]),
+            static_cast<float>(v[2][order[i]])
+        ).Normalized();
+
+    // Rebuilt so the basis is right handed and orthonormal in float
+    axes[1] = (axes[1] - (axes[0] * axes[0].Dot(axes[1]))).Normalized();
+    axes[2] = axes[0].Cross(axes[1]);
+
+    const float* p = reinterpret_cast<const float*>(points);
+    float lo[3], hi[3];
+    ReduceMinMax<3>(count, executor, [p, mean, &axes](auto& c, size_t i) {
+        using F = LaneOf<decltype(c)>;
+
+        F d[3];
+        LoadComponents(p + (i * 3), d);
+        for (size_t k = 0; k < 3; k++)
+            d[k] = d[k] - F::Set(mean[k]);
+
+        for (size_t k = 0; k < 3; k++)
+            c[k] = MulAdd(d[0], F::Set(axes[k].x), MulAdd(d[1], F::Set(axes[k].y), d[2] * F::Set(axes[k].z)));
+    }, lo, hi);
+
+    OBB res;
+    res.centre = mean;
+    for (size_t k = 0; k < 3; k++)
+    {
+        res.axes[k] = axes[k];
+        res.centre += axes[k] * ((lo[k] + hi[k]) * 0.5f);
+        res.halfExtents[k] = (hi[k] - lo[k]) * 0.5f;
+    }
+
+    return res;
+}
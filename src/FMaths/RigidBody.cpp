@@ -0,0 +1,443 @@
+#include "FMaths/RigidBody.h"
+
+#include <cassert>
+
+#include "Kernels.h"
+
+namespace
+{
+
+/**
+ * @brief Integrated state in lanes, position, orientation, velocity then angular velocity
+ */
+enum State
+{
+    P = 0,
+    Q = 3,
+    V = 7,
+    W = 10,
+    StateCount = 13
+};
+
+/**
+ * @brief Array pointers of a RigidBodyArray, in State order for the integrated state
+ */
+struct Streams
+{
+    float* state[StateCount];
+    const float* force[3];
+    const float* torque[3];
+    const float* invMass;
+    const float* inv[3];
+};
+
+Streams GetStreams(RigidBodyArray& b)
+{
+    assert(b.qx.size() == b.Size() && b.wz.size() == b.Size() && b.tz.size() == b.Size() && b.iz.size() == b.Size());
+
+    return {
+        {b.px.data(), b.py.data(), b.pz.data(), b.qx.data(), b.qy.data(), b.qz.data(), b.qw.data(),
+         b.vx.data(), b.vy.data(), b.vz.data(), b.wx.data(), b.wy.data(), b.wz.data()},
+        {b.fx.data(), b.fy.data(), b.fz.data()},
+        {b.tx.data(), b.ty.data(), b.tz.data()},
+        b.invMass.data(),
+        {b.ix.data(), b.iy.data(), b.iz.data()}
+    };
+}
+
+/**
+ * @brief Call kernel(F(), i) for W bodies at a time, chunk by chunk through ParallelFor
+ */
+template<typename Fn>
+void ForEachBody(size_t count, const Executor& executor, Fn kernel)
+{
+    ParallelFor(count, kIntegrateChunkSize, executor, [&kernel](size_t begin, size_t end) {
+        size_t i = begin;
+
+        for (; i + SimdFloat::Width <= end; i += SimdFloat::Width)
+            kernel(SimdFloat(), i);
+
+        for (; i < end; i++)
+            kernel(ScalarFloat(), i);
+    });
+}
+
+/**
+ * @brief Rotate v by q, which must be unit length
+ */
+template<typename F>
+void Rotate(F x, F y, F z, F w, const F (&v)[3], F (&out)[3])
+{
+    F two = F::Set(2.f);
+
+    F tx = two * ((y * v[2]) - (z * v[1]));
+    F ty = two * ((z * v[0]) - (x * v[2]));
+    F tz = two * ((x * v[1]) - (y * v[0]));
+
+    out[0] = v[0] + MulAdd(w, tx, (y * tz) - (z * ty));
+    out[1] = v[1] + MulAdd(w, ty, (z * tx) - (x * tz));
+    out[2] = v[2] + MulAdd(w, tz, (x * ty) - (y * tx));
+}
+
+template<typename F>
+F Dot4(const F* a, const F* b)
+{
+    return MulAdd(a[3], b[3], MulAdd(a[2], b[2], MulAdd(a[1], b[1], a[0] * b[0])));
+}
+
+/**
+ * @brief dq/dt = (w, 0) q / 2
+ */
+template<typename F>
+void Spin(const F (&s)[StateCount], F* dq)
+{
+    F half = F::Set(0.5f);
+    F hx = s[W] * half, hy = s[W + 1] * half, hz = s[W + 2] * half;
+    F x = s[Q], y = s[Q + 1], z = s[Q + 2], w = s[Q + 3];
+
+    dq[0] = MulAdd(hx, w, (hy * z) - (hz * y));
+    dq[1] = MulAdd(hy, w, (hz * x) - (hx * z));
+    dq[2] = MulAdd(hz, w, (hx * y) - (hy * x));
+    dq[3] = -MulAdd(hz, z, MulAdd(hy, y, hx * x));
+}
+
+/**
+ * @brief One Newton step of 1/sqrt from 1, q (3 - |q|^2) / 2
+ */
+template<typename F>
+void Renormalize(F* q)
+{
+    F scale = MulAdd(Dot4(q, q), F::Set(-0.5f), F::Set(1.5f));
+
+    for (size_t k = 0; k < 4; k++)
+        q[k] = q[k] * scale;
+}
+
+/**
+ * @brief R diag(inv) R^T v, by rotating v into body space and back
+ */
+template<typename F>
+void ApplyInverseInertia(F x, F y, F z, F w, const F (&inv)[3], const F (&v)[3], F (&out)[3])
+{
+    F body[3];
+    Rotate(-x, -y, -z, w, v, body);
+
+    for (size_t k = 0; k < 3; k++)
+        body[k] = body[k] * inv[k];
+
+    Rotate(x, y, z, w, body, out);
+}
+
+template<typename F>
+void Load(const Streams& b, size_t i, F (&s)[StateCount])
+{
+    for (size_t k = 0; k < StateCount; k++)
+        s[k] = F::Load(b.state[k] + i);
+}
+
+template<typename F>
+void Store(const Streams& b, size_t i, const F (&s)[StateCount])
+{
+    for (size_t k = 0; k < StateCount; k++)
+        s[k].Store(b.state[k] + i);
+}
+
+/**
+ * @brief Linear acceleration, gravity only for bodies with mass
+ */
+template<typename F>
+void Acceleration(const Streams& b, size_t i, const Vector3& gravity, F invMass, F (&a)[3])
+{
+    auto dynamic = invMass > F::Set(0.f);
+    F zero = F::Set(0.f);
+
+    for (size_t k = 0; k < 3; k++)
+        a[k] = MulAdd(F::Load(b.force[k] + i), invMass, Select(dynamic, F::Set(gravity[k]), zero));
+}
+
+template<typename F>
+void EulerLanes(const Streams& b, size_t i, const Vector3& gravity, F dt)
+{
+    F s[StateCount];
+    Load(b, i, s);
+
+    F a[3], torque[3], inv[3];
+    Acceleration(b, i, gravity, F::Load(b.invMass + i), a);
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        torque[k] = F::Load(b.torque[k] + i);
+        inv[k] = F::Load(b.inv[k] + i);
+    }
+
+    F alpha[3];
+    ApplyInverseInertia(s[Q], s[Q + 1], s[Q + 2], s[Q + 3], inv, torque, alpha);
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        s[V + k] = MulAdd(a[k], dt, s[V + k]);
+        s[W + k] = MulAdd(alpha[k], dt, s[W + k]);
+        s[P + k] = MulAdd(s[V + k], dt, s[P + k]);
+    }
+
+    F dq[4];
+    Spin(s, dq);
+
+    for (size_t k = 0; k < 4; k++)
+        s[Q + k] = MulAdd(dq[k], dt, s[Q + k]);
+
+    Renormalize(s + Q);
+    Store(b, i, s);
+}
+
+/**
+ * @brief Time derivative of the state for RK4
+ *
+ * @param moment Principal moments in body space, 0 where the inverse is 0
+ */
+template<typename F>
+void Derivative(const F (&s)[StateCount], const F (&a)[3], const F (&torque)[3], const F (&inv)[3], const F (&moment)[3], F (&d)[StateCount])
+{
+    for (size_t k = 0; k < 3; k++)
+    {
+        d[P + k] = s[V + k];
+        d[V + k] = a[k];
+    }
+
+    Spin(s, d + Q);
+
+    // Mid step orientations drift off unit length, rotate by the unit one
+    F scale = InvSqrt(Dot4(s + Q, s + Q));
+    F x = s[Q] * scale, y = s[Q + 1] * scale, z = s[Q + 2] * scale, w = s[Q + 3] * scale;
+
+    // Euler's equations in body space, I dw/dt = torque - w x Iw
+    F omega[3] = {s[W], s[W + 1], s[W + 2]};
+    F wb[3], tb[3];
+    Rotate(-x, -y, -z, w, omega, wb);
+    Rotate(-x, -y, -z, w, torque, tb);
+
+    F lb[3] = {moment[0] * wb[0], moment[1] * wb[1], moment[2] * wb[2]};
+
+    F db[3] = {
+        inv[0] * (tb[0] - ((wb[1] * lb[2]) - (wb[2] * lb[1]))),
+        inv[1] * (tb[1] - ((wb[2] * lb[0]) - (wb[0] * lb[2]))),
+        inv[2] * (tb[2] - ((wb[0] * lb[1]) - (wb[1] * lb[0])))
+    };
+
+    F dw[3];
+    Rotate(x, y, z, w, db, dw);
+
+    for (size_t k = 0; k < 3; k++)
+        d[W + k] = dw[k];
+}
+
+template<typename F>
+void RK4Lanes(const Streams& b, size_t i, const Vector3& gravity, F dt)
+{
+    F s[StateCount];
+    Load(b, i, s);
+
+    F zero = F::Set(0.f);
+    F one = F::Set(1.f);
+
+    F a[3], torque[3], inv[3], moment[3];
+    Acceleration(b, i, gravity, F::Load(b.invMass + i), a);
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        torque[k] = F::Load(b.torque[k] + i);
+        inv[k] = F::Load(b.inv[k] + i);
+        moment[k] = Select(inv[k] > zero, one / inv[k], zero);
+    }
+
+    F halfDt = dt * F::Set(0.5f);
+    F sixthDt = dt * F::Set(1.f / 6.f);
+    F two = F::Set(2.f);
+
+    F k1[StateCount], k2[StateCount], k3[StateCount], k4[StateCount], t[StateCount];
+
+    Derivative(s, a, torque, inv, moment, k1);
+
+    for (size_t k = 0; k < StateCount; k++)
+        t[k] = MulAdd(k1[k], halfDt, s[k]);
+
+    Derivative(t, a, torque, inv, moment, k2);
+
+    for (size_t k = 0; k < StateCount; k++)
+        t[k] = MulAdd(k2[k], halfDt, s[k]);
+
+    Derivative(t, a, torque, inv, moment, k3);
+
+    for (size_t k = 0; k < StateCount; k++)
+        t[k] = MulAdd(k3[k], dt, s[k]);
+
+    Derivative(t, a, torque, inv, moment, k4);
+
+    for (size_t k = 0; k < StateCount; k++)
+        s[k] = MulAdd(MulAdd(two, k2[k] + k3[k], k1[k] + k4[k]), sixthDt, s[k]);
+
+    Renormalize(s + Q);
+    Store(b, i, s);
+}
+
+/**
+ * @brief Identity with the upper 3x3 block from t, t[col][row]
+ */
+template<typename F>
+MatrixLanes<F> Block(const F (&t)[3][3])
+{
+    F zero = F::Set(0.f);
+    MatrixLanes<F> res;
+
+    for (size_t col = 0; col < 3; col++)
+    {
+        for (size_t row = 0; row < 3; row++)
+            res.m[col][row] = t[col][row];
+
+        res.m[col][3] = zero;
+        res.m[3][col] = zero;
+    }
+
+    res.m[3][3] = F::Set(1.f);
+    return res;
+}
+
+} // namespace
+
+// RigidBodyArray
+
+void RigidBodyArray::Push(const Vector3& position, const Quaternion& orientation, float invMass, const Vector3& invInertia,
+    const Vector3& velocity, const Vector3& angularVelocity)
+{
+    px.push_back(position.x); py.push_back(position.y); pz.push_back(position.z);
+    qx.push_back(orientation.x); qy.push_back(orientation.y); qz.push_back(orientation.z); qw.push_back(orientation.w);
+    vx.push_back(velocity.x); vy.push_back(velocity.y); vz.push_back(velocity.z);
+    wx.push_back(angularVelocity.x); wy.push_back(angularVelocity.y); wz.push_back(angularVelocity.z);
+    fx.push_back(0.f); fy.push_back(0.f); fz.push_back(0.f);
+    tx.push_back(0.f); ty.push_back(0.f); tz.push_back(0.f);
+    this->invMass.push_back(invMass);
+    ix.push_back(invInertia.x); iy.push_back(invInertia.y); iz.push_back(invInertia.z);
+}
+
+void RigidBodyArray::Clear()
+{
+    for (std::vector<float>* a : {&px, &py, &pz, &qx, &qy, &qz, &qw, &vx, &vy, &vz, &wx, &wy, &wz,
+        &fx, &fy, &fz, &tx, &ty, &tz, &invMass, &ix, &iy, &iz})
+        a->clear();
+}
+
+void RigidBodyArray::Reserve(size_t n)
+{
+    for (std::vector<float>* a : {&px, &py, &pz, &qx, &qy, &qz, &qw, &vx, &vy, &vz, &wx, &wy, &wz,
+        &fx, &fy, &fz, &tx, &ty, &tz, &invMass, &ix, &iy, &iz})
+        a->reserve(n);
+}
+
+size_t RigidBodyArray::Size() const
+{
+    return px.size();
+}
+
+void RigidBodyArray::ClearForces()
+{
+    for (std::vector<float>* a : {&fx, &fy, &fz, &tx, &ty, &tz})
+        a->assign(a->size(), 0.f);
+}
+
+Vector3 RigidBodyArray::Position(size_t i) const
+{
+    assert(i < Size());
+    return Vector3(px[i], py[i], pz[i]);
+}
+
+Quaternion RigidBodyArray::Orientation(size_t i) const
+{
+    assert(i < Size());
+    return Quaternion(qx[i], qy[i], qz[i], qw[i]);
+}
+
+Vector3 RigidBodyArray::Velocity(size_t i) const
+{
+    assert(i < Size());
+    return Vector3(vx[i], vy[i], vz[i]);
+}
+
+Vector3 RigidBodyArray::AngularVelocity(size_t i) const
+{
+    assert(i < Size());
+    return Vector3(wx[i], wy[i], wz[i]);
+}
+
+// Integrators
+
+void IntegrateEuler(RigidBodyArray& bodies, const Vector3& gravity, float dt, const Executor& executor)
+{
+    Streams streams = GetStreams(bodies);
+
+    ForEachBody(bodies.Size(), executor, [&](auto lane, size_t i) {
+        using F = decltype(lane);
+        EulerLanes(streams, i, gravity, F::Set(dt));
+    });
+}
+
+void IntegrateRK4(RigidBodyArray& bodies, const Vector3& gravity, float dt, const Executor& executor)
+{
+    Streams streams = GetStreams(bodies);
+
+    ForEachBody(bodies.Size(), executor, [&](auto lane, size_t i) {
+        using F = decltype(lane);
+        RK4Lanes(streams, i, gravity, F::Set(dt));
+    });
+}
+
+// Inertia
+
+void WorldInverseInertia(const RigidBodyArray& bodies, Matrix4x4* out, const Executor& executor)
+{
+    ForEachBody(bodies.Size(), executor, [&](auto lane, size_t i) {
+        using F = decltype(lane);
+
+        QuaternionLanes<F> q = {F::Load(bodies.qx.data() + i), F::Load(bodies.qy.data() + i), F::Load(bodies.qz.data() + i), F::Load(bodies.qw.data() + i)};
+        F inv[3] = {F::Load(bodies.ix.data() + i), F::Load(bodies.iy.data() + i), F::Load(bodies.iz.data() + i)};
+
+        F r[3][3];
+        RotationLanes(q, r);
+
+        // Sum over principal axes k of inv[k] r_k r_k^T
+        F t[3][3];
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+            {
+                F acc = (r[0][row] * inv[0]) * r[0][col];
+                acc = MulAdd(r[1][row] * inv[1], r[1][col], acc);
+                t[col][row] = MulAdd(r[2][row] * inv[2], r[2][col], acc);
+            }
+
+        Block(t).Store(out + i);
+    });
+}
+
+void RotateInertia(const Quaternion* q, const Matrix4x4* local, Matrix4x4* out, size_t count, const Executor& executor)
+{
+    ForEachBody(count, executor, [&](auto lane, size_t i) {
+        using F = decltype(lane);
+
+        MatrixLanes<F> m = MatrixLanes<F>::Load(local + i);
+
+        F r[3][3];
+        RotationLanes(QuaternionLanes<F>::Load(q + i), r);
+
+        // R M, then (R M) R^T
+        F rm[3][3];
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+                rm[col][row] = MulAdd(r[2][row], m.m[col][2], MulAdd(r[1][row], m.m[col][1], r[0][row] * m.m[col][0]));
+
+        F t[3][3];
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+                t[col][row] = MulAdd(rm[2][row], r[2][col], MulAdd(rm[1][row], r[1][col], rm[0][row] * r[0][col]));
+
+        Block(t).Store(out + i);
+    });
+}
@@ -0,0 +1,594 @@
+/**
+ * @file Simd.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal SIMD lane types used by the batch kernels
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+// Deterministic builds rely on every operation being a single IEEE rounding
+#ifdef FMATHS_DETERMINISTIC
+    #if defined(FMATHS_FMA)
+        #error "FMATHS_DETERMINISTIC can't be combined with FMATHS_FMA"
+    #endif
+
+    #if defined(__FAST_MATH__) || (FLT_EVAL_METHOD != 0)
+        #error "FMATHS_DETERMINISTIC needs strict single precision arithmetic, without -ffast-math or x87"
+    #endif
+#endif
+
+#if defined(FMATHS_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #include <immintrin.h>
+    #define FMATHS_SIMD_SSE
+
+    #if defined(__AVX__)
+        #define FMATHS_SIMD_AVX
+    #endif
+#endif
+
+/**
+ * @brief a * b + c, fused into a single rounding when built with FMATHS_FMA
+ */
+inline float MulAdd(float a, float b, float c)
+{
+#ifdef FMATHS_FMA
+    return fmaf(a, b, c);
+#else
+    return (a * b) + c;
+#endif
+}
+
+/**
+ * @brief Single lane fallback, used for loop tails and when SIMD is disabled
+ *
+ * Every lane type exposes the same interface so kernels can be written once
+ * as templates and instantiated for each width.
+ */
+struct ScalarFloat
+{
+    static constexpr size_t Width = 1;
+
+    struct Mask
+    {
+        bool v;
+
+        Mask operator&(Mask m) const { return {v && m.v}; }
+        Mask operator|(Mask m) const { return {v || m.v}; }
+        Mask operator~() const { return {!v}; }
+    };
+
+    float v;
+
+    static ScalarFloat Load(const float* p) { return {*p}; }
+    static ScalarFloat Set(float s) { return {s}; }
+    static ScalarFloat Gather(const float* p, size_t) { return {*p}; }
+    void Store(float* p) const { *p = v; }
+    void Scatter(float* p, size_t) const { *p = v; }
+
+    /**
+     * @brief Split W pairs a0 b0 a1 b1 ... into a and b
+     */
+    static void LoadInterleaved(const float* p, ScalarFloat& a, ScalarFloat& b) { a = {p[0]}; b = {p[1]}; }
+
+    /**
+     * @brief Inverse of LoadInterleaved
+     */
+    static void StoreInterleaved(float* p, ScalarFloat a, ScalarFloat b) { p[0] = a.v; p[1] = b.v; }
+
+    /**
+     * @brief Split W triples a0 b0 c0 a1 b1 c1 ... into a, b and c
+     */
+    static void LoadInterleaved(const float* p, ScalarFloat& a, ScalarFloat& b, ScalarFloat& c)
+    {
+        a = {p[0]};
+        b = {p[1]};
+        c = {p[2]};
+    }
+
+    static void StoreInterleaved(float* p, ScalarFloat a, ScalarFloat b, ScalarFloat c)
+    {
+        p[0] = a.v;
+        p[1] = b.v;
+        p[2] = c.v;
+    }
+
+    /**
+     * @brief Split W quads into a, b, c and d
+     */
+    static void LoadInterleaved(const float* p, ScalarFloat& a, ScalarFloat& b, ScalarFloat& c, ScalarFloat& d)
+    {
+        a = {p[0]};
+        b = {p[1]};
+        c = {p[2]};
+        d = {p[3]};
+    }
+
+    static void StoreInterleaved(float* p, ScalarFloat a, ScalarFloat b, ScalarFloat c, ScalarFloat d)
+    {
+        p[0] = a.v;
+        p[1] = b.v;
+        p[2] = c.v;
+        p[3] = d.v;
+    }
+
+    /**
+     * @brief Non-temporal store, bypassing the cache. p must be aligned to the lane width
+     */
+    void Stream(float* p) const { *p = v; }
+
+    ScalarFloat operator+(ScalarFloat b) const { return {v + b.v}; }
+    ScalarFloat operator-(ScalarFloat b) const { return {v - b.v}; }
+    ScalarFloat operator*(ScalarFloat b) const { return {v * b.v}; }
+    ScalarFloat operator/(ScalarFloat b) const { return {v / b.v}; }
+    ScalarFloat operator-() const { return {-v}; }
+
+    Mask operator<(ScalarFloat b) const { return {v < b.v}; }
+    Mask operator<=(ScalarFloat b) const { return {v <= b.v}; }
+    Mask operator>(ScalarFloat b) const { return {v > b.v}; }
+    Mask operator>=(ScalarFloat b) const { return {v >= b.v}; }
+    Mask operator==(ScalarFloat b) const { return {v == b.v}; }
+    Mask operator!=(ScalarFloat b) const { return {v != b.v}; }
+};
+
+// Returns b when either operand is NaN, matching minps/maxps
+inline ScalarFloat Min(ScalarFloat a, ScalarFloat b) { return {a.v < b.v ? a.v : b.v}; }
+inline ScalarFloat Max(ScalarFloat a, ScalarFloat b) { return {a.v > b.v ? a.v : b.v}; }
+inline ScalarFloat Abs(ScalarFloat a) { return {fabsf(a.v)}; }
+inline ScalarFloat Sqrt(ScalarFloat a) { return {sqrtf(a.v)}; }
+
+inline ScalarFloat MulAdd(ScalarFloat a, ScalarFloat b, ScalarFloat c) { return {MulAdd(a.v, b.v, c.v)}; }
+
+/**
+ * @brief 1 / sqrt(a), full precision
+ */
+inline ScalarFloat InvSqrt(ScalarFloat a) { return {1.f / sqrtf(a.v)}; }
+
+/**
+ * @brief Hardware reciprocal square root estimate, ~12 bits
+ *
+ * The bits differ between CPU vendors, so deterministic builds never use it.
+ */
+inline ScalarFloat InvSqrtEstimate(ScalarFloat a)
+{
+#ifdef FMATHS_SIMD_SSE
+    // Same instruction as the wide lanes so tails match the blocks
+    return {_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a.v)))};
+#else
+    return {1.f / sqrtf(a.v)};
+#endif
+}
+
+/**
+ * @brief Round to nearest, ties to even
+ */
+inline ScalarFloat Round(ScalarFloat a) { return {nearbyintf(a.v)}; }
+
+/**
+ * @brief Per lane a if mask is set, otherwise b
+ */
+inline ScalarFloat Select(ScalarFloat::Mask m, ScalarFloat a, ScalarFloat b) { return m.v ? a : b; }
+
+/**
+ * @brief Pack mask lanes into the low bits of an integer
+ */
+inline uint32_t MaskBits(ScalarFloat::Mask m) { return m.v ? 1u : 0u; }
+
+/**
+ * @brief True if any lane's bits differ, so NaNs with the same payload match and 0 doesn't match -0
+ */
+inline bool BitsDiffer(ScalarFloat a, ScalarFloat b)
+{
+    uint32_t x, y;
+    memcpy(&x, &a.v, sizeof(x));
+    memcpy(&y, &b.v, sizeof(y));
+    return x != y;
+}
+
+#ifdef FMATHS_SIMD_SSE
+
+/**
+ * @brief 4 lane SSE float
+ */
+struct Float4
+{
+    static constexpr size_t Width = 4;
+
+    struct Mask
+    {
+        __m128 v;
+
+        Mask operator&(Mask m) const { return {_mm_and_ps(v, m.v)}; }
+        Mask operator|(Mask m) const { return {_mm_or_ps(v, m.v)}; }
+        Mask operator~() const { return {_mm_xor_ps(v, _mm_castsi128_ps(_mm_set1_epi32(-1)))}; }
+    };
+
+    __m128 v;
+
+    static Float4 Load(const float* p) { return {_mm_loadu_ps(p)}; }
+    static Float4 Set(float s) { return {_mm_set1_ps(s)}; }
+    static Float4 Gather(const float* p, size_t stride) { return {_mm_setr_ps(p[0], p[stride], p[stride * 2], p[stride * 3])}; }
+    void Store(float* p) const { _mm_storeu_ps(p, v); }
+
+    void Scatter(float* p, size_t stride) const
+    {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, v);
+
+        for (size_t i = 0; i < 4; i++)
+            p[i * stride] = lanes[i];
+    }
+
+    static void LoadInterleaved(const float* p, Float4& a, Float4& b)
+    {
+        __m128 lo = _mm_loadu_ps(p);
+        __m128 hi = _mm_loadu_ps(p + 4);
+
+        a = {_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0))};
+        b = {_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1))};
+    }
+
+    static void StoreInterleaved(float* p, Float4 a, Float4 b)
+    {
+        _mm_storeu_ps(p, _mm_unpacklo_ps(a.v, b.v));
+        _mm_storeu_ps(p + 4, _mm_unpackhi_ps(a.v, b.v));
+    }
+
+    static void LoadInterleaved(const float* p, Float4& a, Float4& b, Float4& c)
+    {
+        // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+        __m128 r0 = _mm_loadu_ps(p);
+        __m128 r1 = _mm_loadu_ps(p + 4);
+        __m128 r2 = _mm_loadu_ps(p + 8);
+
+        __m128 t0 = _mm_shuffle_ps(r1, r2, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+        __m128 t1 = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+
+        a = {_mm_shuffle_ps(r0, t0, _MM_SHUFFLE(2, 0, 3, 0))};
+        b = {_mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0))};
+        c = {_mm_shuffle_ps(t1, r2, _MM_SHUFFLE(3, 0, 3, 1))};
+    }
+
+    static void StoreInterleaved(float* p, Float4 a, Float4 b, Float4 c)
+    {
+        __m128 ab0 = _mm_unpacklo_ps(a.v, b.v); // x0 y0 x1 y1
+        __m128 ab1 = _mm_unpackhi_ps(a.v, b.v); // x2 y2 x3 y3
+        __m128 ca0 = _mm_shuffle_ps(c.v, a.v, _MM_SHUFFLE(1, 1, 0, 0)); // z0 z0 x1 x1
+        __m128 bc1 = _mm_shuffle_ps(b.v, c.v, _MM_SHUFFLE(1, 1, 1, 1)); // y1 y1 z1 z1
+        __m128 ca2 = _mm_shuffle_ps(c.v, a.v, _MM_SHUFFLE(3, 3, 2, 2)); // z2 z2 x3 x3
+        __m128 bc3 = _mm_shuffle_ps(b.v, c.v, _MM_SHUFFLE(3, 3, 3, 3)); // y3 y3 z3 z3
+
+        _mm_storeu_ps(p, _mm_shuffle_ps(ab0, ca0, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(p + 4, _mm_shuffle_ps(bc1, ab1, _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(p + 8, _mm_shuffle_ps(ca2, bc3, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+
+    static void LoadInterleaved(const float* p, Float4& a, Float4& b, Float4& c, Float4& d)
+    {
+        __m128 r0 = _mm_loadu_ps(p);
+        __m128 r1 = _mm_loadu_ps(p + 4);
+        __m128 r2 = _mm_loadu_ps(p + 8);
+        __m128 r3 = _mm_loadu_ps(p + 12);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        a = {r0};
+        b = {r1};
+        c = {r2};
+        d = {r3};
+    }
+
+    static void StoreInterleaved(float* p, Float4 a, Float4 b, Float4 c, Float4 d)
+    {
+        _MM_TRANSPOSE4_PS(a.v, b.v, c.v, d.v);
+
+        _mm_storeu_ps(p, a.v);
+        _mm_storeu_ps(p + 4, b.v);
+        _mm_storeu_ps(p + 8, c.v);
+        _mm_storeu_ps(p + 12, d.v);
+    }
+
+    void Stream(float* p) const { _mm_stream_ps(p, v); }
+
+    Float4 operator+(Float4 b) const { return {_mm_add_ps(v, b.v)}; }
+    Float4 operator-(Float4 b) const { return {_mm_sub_ps(v, b.v)}; }
+    Float4 operator*(Float4 b) const { return {_mm_mul_ps(v, b.v)}; }
+    Float4 operator/(Float4 b) const { return {_mm_div_ps(v, b.v)}; }
+    Float4 operator-() const { return {_mm_xor_ps(v, _mm_set1_ps(-0.f))}; }
+
+    Mask operator<(Float4 b) const { return {_mm_cmplt_ps(v, b.v)}; }
+    Mask operator<=(Float4 b) const { return {_mm_cmple_ps(v, b.v)}; }
+    Mask operator>(Float4 b) const { return {_mm_cmpgt_ps(v, b.v)}; }
+    Mask operator>=(Float4 b) const { return {_mm_cmpge_ps(v, b.v)}; }
+    Mask operator==(Float4 b) const { return {_mm_cmpeq_ps(v, b.v)}; }
+    Mask operator!=(Float4 b) const { return {_mm_cmpneq_ps(v, b.v)}; }
+};
+
+inline Float4 Min(Float4 a, Float4 b) { return {_mm_min_ps(a.v, b.v)}; }
+inline Float4 Max(Float4 a, Float4 b) { return {_mm_max_ps(a.v, b.v)}; }
+inline Float4 Abs(Float4 a) { return {_mm_andnot_ps(_mm_set1_ps(-0.f), a.v)}; }
+inline Float4 Sqrt(Float4 a) { return {_mm_sqrt_ps(a.v)}; }
+
+inline Float4 InvSqrt(Float4 a) { return {_mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(a.v))}; }
+inline Float4 InvSqrtEstimate(Float4 a) { return {_mm_rsqrt_ps(a.v)}; }
+
+inline Float4 Round(Float4 a)
+{
+    // Conversion rounds to nearest even, anything at or above 2^23 is already whole
+    __m128 rounded = _mm_cvtepi32_ps(_mm_cvtps_epi32(a.v));
+    __m128 whole = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), a.v), _mm_set1_ps(8388608.f));
+
+    return {_mm_or_ps(_mm_and_ps(whole, a.v), _mm_andnot_ps(whole, rounded))};
+}
+
+inline Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+{
+#ifdef FMATHS_FMA
+    return {_mm_fmadd_ps(a.v, b.v, c.v)};
+#else
+    return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+#endif
+}
+
+inline Float4 Select(Float4::Mask m, Float4 a, Float4 b)
+{
+    return {_mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v))};
+}
+
+inline uint32_t MaskBits(Float4::Mask m) { return static_cast<uint32_t>(_mm_movemask_ps(m.v)); }
+
+inline bool BitsDiffer(Float4 a, Float4 b)
+{
+    __m128i equal = _mm_cmpeq_epi32(_mm_castps_si128(a.v), _mm_castps_si128(b.v));
+    return _mm_movemask_epi8(equal) != 0xFFFF;
+}
+
+/**
+ * @brief Transpose 4 rows of 4 in place
+ */
+inline void Transpose(Float4& a, Float4& b, Float4& c, Float4& d) { _MM_TRANSPOSE4_PS(a.v, b.v, c.v, d.v); }
+
+#endif
+
+#ifdef FMATHS_SIMD_AVX
+
+/**
+ * @brief 8 lane AVX float
+ */
+struct Float8
+{
+    static constexpr size_t Width = 8;
+
+    struct Mask
+    {
+        __m256 v;
+
+        Mask operator&(Mask m) const { return {_mm256_and_ps(v, m.v)}; }
+        Mask operator|(Mask m) const { return {_mm256_or_ps(v, m.v)}; }
+        Mask operator~() const { return {_mm256_xor_ps(v, _mm256_castsi256_ps(_mm256_set1_epi32(-1)))}; }
+    };
+
+    __m256 v;
+
+    static Float8 Load(const float* p) { return {_mm256_loadu_ps(p)}; }
+    static Float8 Set(float s) { return {_mm256_set1_ps(s)}; }
+    void Store(float* p) const { _mm256_storeu_ps(p, v); }
+
+    static Float8 Gather(const float* p, size_t stride)
+    {
+        return {_mm256_setr_ps(
+            p[0], p[stride], p[stride * 2], p[stride * 3],
+            p[stride * 4], p[stride * 5], p[stride * 6], p[stride * 7]
+        )};
+    }
+
+    void Scatter(float* p, size_t stride) const
+    {
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, v);
+
+        for (size_t i = 0; i < 8; i++)
+            p[i * stride] = lanes[i];
+    }
+
+    static void LoadInterleaved(const float* p, Float8& a, Float8& b)
+    {
+        __m256 first = _mm256_loadu_ps(p);
+        __m256 second = _mm256_loadu_ps(p + 8);
+
+        // Pair up 128 bit halves so the in-lane shuffle yields elements in order
+        __m256 lo = _mm256_permute2f128_ps(first, second, 0x20);
+        __m256 hi = _mm256_permute2f128_ps(first, second, 0x31);
+
+        a = {_mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0))};
+        b = {_mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1))};
+    }
+
+    static void StoreInterleaved(float* p, Float8 a, Float8 b)
+    {
+        __m256 lo = _mm256_unpacklo_ps(a.v, b.v);
+        __m256 hi = _mm256_unpackhi_ps(a.v, b.v);
+
+        _mm256_storeu_ps(p, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    // Triples and quads are split as two SSE halves, the shuffles do not cross 128 bit lanes cheaply
+
+    static void LoadInterleaved(const float* p, Float8& a, Float8& b, Float8& c)
+    {
+        Float4 a0, b0, c0, a1, b1, c1;
+        Float4::LoadInterleaved(p, a0, b0, c0);
+        Float4::LoadInterleaved(p + 12, a1, b1, c1);
+
+        a = Combine(a0, a1);
+        b = Combine(b0, b1);
+        c = Combine(c0, c1);
+    }
+
+    static void StoreInterleaved(float* p, Float8 a, Float8 b, Float8 c)
+    {
+        Float4::StoreInterleaved(p, a.Low(), b.Low(), c.Low());
+        Float4::StoreInterleaved(p + 12, a.High(), b.High(), c.High());
+    }
+
+    static void LoadInterleaved(const float* p, Float8& a, Float8& b, Float8& c, Float8& d)
+    {
+        Float4 a0, b0, c0, d0, a1, b1, c1, d1;
+        Float4::LoadInterleaved(p, a0, b0, c0, d0);
+        Float4::LoadInterleaved(p + 16, a1, b1, c1, d1);
+
+        a = Combine(a0, a1);
+        b = Combine(b0, b1);
+        c = Combine(c0, c1);
+        d = Combine(d0, d1);
+    }
+
+    static void StoreInterleaved(float* p, Float8 a, Float8 b, Float8 c, Float8 d)
+    {
+        Float4::StoreInterleaved(p, a.Low(), b.Low(), c.Low(), d.Low());
+        Float4::StoreInterleaved(p + 16, a.High(), b.High(), c.High(), d.High());
+    }
+
+    void Stream(float* p) const { _mm256_stream_ps(p, v); }
+
+    static Float8 Combine(Float4 lo, Float4 hi) { return {_mm256_insertf128_ps(_mm256_castps128_ps256(lo.v), hi.v, 1)}; }
+    Float4 Low() const { return {_mm256_castps256_ps128(v)}; }
+    Float4 High() const { return {_mm256_extractf128_ps(v, 1)}; }
+
+    Float8 operator+(Float8 b) const { return {_mm256_add_ps(v, b.v)}; }
+    Float8 operator-(Float8 b) const { return {_mm256_sub_ps(v, b.v)}; }
+    Float8 operator*(Float8 b) const { return {_mm256_mul_ps(v, b.v)}; }
+    Float8 operator/(Float8 b) const { return {_mm256_div_ps(v, b.v)}; }
+    Float8 operator-() const { return {_mm256_xor_ps(v, _mm256_set1_ps(-0.f))}; }
+
+    Mask operator<(Float8 b) const { return {_mm256_cmp_ps(v, b.v, _CMP_LT_OQ)}; }
+    Mask operator<=(Float8 b) const { return {_mm256_cmp_ps(v, b.v, _CMP_LE_OQ)}; }
+    Mask operator>(Float8 b) const { return {_mm256_cmp_ps(v, b.v, _CMP_GT_OQ)}; }
+    Mask operator>=(Float8 b) const { return {_mm256_cmp_ps(v, b.v, _CMP_GE_OQ)}; }
+    Mask operator==(Float8 b) const { return {_mm256_cmp_ps(v, b.v, _CMP_EQ_OQ)}; }
+    Mask operator!=(Float8 b) const { return {_mm256_cmp_ps(v, b.v, _CMP_NEQ_UQ)}; }
+};
+
+inline Float8 Min(Float8 a, Float8 b) { return {_mm256_min_ps(a.v, b.v)}; }
+inline Float8 Max(Float8 a, Float8 b) { return {_mm256_max_ps(a.v, b.v)}; }
+inline Float8 Abs(Float8 a) { return {_mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v)}; }
+inline Float8 Sqrt(Float8 a) { return {_mm256_sqrt_ps(a.v)}; }
+
+inline Float8 InvSqrt(Float8 a) { return {_mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(a.v))}; }
+inline Float8 InvSqrtEstimate(Float8 a) { return {_mm256_rsqrt_ps(a.v)}; }
+inline Float8 Round(Float8 a) { return {_mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)}; }
+
+inline Float8 MulAdd(Float8 a, Float8 b, Float8 c)
+{
+#ifdef FMATHS_FMA
+    return {_mm256_fmadd_ps(a.v, b.v, c.v)};
+#else
+    return {_mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v)};
+#endif
+}
+
+inline Float8 Select(Float8::Mask m, Float8 a, Float8 b) { return {_mm256_blendv_ps(b.v, a.v, m.v)}; }
+
+inline uint32_t MaskBits(Float8::Mask m) { return static_cast<uint32_t>(_mm256_movemask_ps(m.v)); }
+
+inline bool BitsDiffer(Float8 a, Float8 b)
+{
+    // Integer compares need AVX2, a test of the xor doesn't
+    __m256i x = _mm256_castps_si256(_mm256_xor_ps(a.v, b.v));
+    return !_mm256_testz_si256(x, x);
+}
+
+#endif
+
+/**
+ * @brief Round towards negative infinity
+ */
+template<typename F>
+F Floor(F a)
+{
+    F r = Round(a);
+    return Select(r > a, r - F::Set(1.f), r);
+}
+
+/**
+ * @brief True if every lane of the mask is set
+ */
+template<typename F>
+bool All(typename F::Mask m)
+{
+    return MaskBits(m) == ((1u << F::Width) - 1);
+}
+
+/**
+ * @brief LoadInterleaved into an array of 3 or 4 components
+ */
+template<typename F>
+void LoadComponents(const float* p, F (&c)[3]) { F::LoadInterleaved(p, c[0], c[1], c[2]); }
+
+template<typename F>
+void LoadComponents(const float* p, F (&c)[4]) { F::LoadInterleaved(p, c[0], c[1], c[2], c[3]); }
+
+template<typename F>
+void StoreComponents(float* p, const F (&c)[3]) { F::StoreInterleaved(p, c[0], c[1], c[2]); }
+
+template<typename F>
+void StoreComponents(float* p, const F (&c)[4]) { F::StoreInterleaved(p, c[0], c[1], c[2], c[3]); }
+
+/**
+ * @brief Store, or stream past the cache when NonTemporal
+ */
+template<bool NonTemporal, typename F>
+void Put(F v, float* p)
+{
+    if constexpr (NonTemporal)
+        v.Stream(p);
+    else
+        v.Store(p);
+}
+
+/**
+ * @brief Order non-temporal stores before any later store, call after a streamed loop
+ */
+inline void StreamFence()
+{
+#ifdef FMATHS_SIMD_SSE
+    _mm_sfence();
+#endif
+}
+
+inline bool IsAligned(const void* p, size_t alignment)
+{
+    return (reinterpret_cast<uintptr_t>(p) % alignment) == 0;
+}
+
+/**
+ * @brief Lanes a horizontal sum accumulates in before folding them in order
+ *
+ * Fixed rather than SimdFloat::Width, so sums round the same way whichever
+ * lane type a build uses. Loop over kReduceLanes / F::Width lane types.
+ */
+constexpr size_t kReduceLanes = 8;
+
+/**
+ * @brief Widest lane type available for this build
+ */
+#if defined(FMATHS_SIMD_AVX)
+using SimdFloat = Float8;
+#elif defined(FMATHS_SIMD_SSE)
+using SimdFloat = Float4;
+#else
+using SimdFloat = ScalarFloat;
+#endif
+
+#endif
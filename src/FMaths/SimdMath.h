@@ -0,0 +1,224 @@
+/**
+ * @file SimdMath.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Internal lane implementations of the FastMath approximations
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SIMDMATH_H
+#define SIMDMATH_H
+
+#include "Simd.h"
+
+// Polynomials are the single precision minimax fits from the Cephes library,
+// every lane type evaluates them in the same order so results match across widths.
+
+namespace SimdMath
+{
+
+constexpr float kPi = 3.14159265358979f;
+constexpr float kHalfPi = 1.57079632679490f;
+constexpr float kQuarterPi = 0.78539816339745f;
+constexpr float kTwoOverPi = 0.63661977236758f;
+
+// pi / 2 split so q * kPiA is exact for q < 2^15
+constexpr float kPiA = 1.5703125f;
+constexpr float kPiB = 4.837512969970703125e-4f;
+constexpr float kPiC = 7.54978995489188216e-8f;
+
+/**
+ * @brief Reduce x to r in [-pi/4, pi/4] where x = r + q * pi/2
+ *
+ * @param quadrant Set to q mod 4
+ */
+template<typename F>
+F Reduce(F x, F& quadrant)
+{
+    F q = Round(x * F::Set(kTwoOverPi));
+
+    F r = x - (q * F::Set(kPiA));
+    r = r - (q * F::Set(kPiB));
+    r = r - (q * F::Set(kPiC));
+
+    quadrant = q - (F::Set(4.f) * Floor(q * F::Set(0.25f)));
+    return r;
+}
+
+/**
+ * @brief sin(r) for r in [-pi/4, pi/4]
+ */
+template<typename F>
+F SinPoly(F r, F r2)
+{
+    F p = MulAdd(F::Set(-1.9515295891e-4f), r2, F::Set(8.3321608736e-3f));
+    p = MulAdd(p, r2, F::Set(-1.6666654611e-1f));
+    return MulAdd(p * r2, r, r);
+}
+
+/**
+ * @brief cos(r) for r in [-pi/4, pi/4]
+ */
+template<typename F>
+F CosPoly(F r2)
+{
+    F p = MulAdd(F::Set(2.443315711809948e-5f), r2, F::Set(-1.388731625493765e-3f));
+    p = MulAdd(p, r2, F::Set(4.166664568298827e-2f));
+    return MulAdd(p * r2, r2, MulAdd(F::Set(-0.5f), r2, F::Set(1.f)));
+}
+
+template<typename F>
+void SinCos(F x, F& s, F& c)
+{
+    F quadrant;
+    F r = Reduce(x, quadrant);
+    F r2 = r * r;
+
+    F sr = SinPoly(r, r2);
+    F cr = CosPoly(r2);
+
+    // Quadrants 1 and 3 swap sin and cos, sin is negated in 2 and 3, cos in 1 and 2
+    F one = F::Set(1.f);
+    F two = F::Set(2.f);
+    F three = F::Set(3.f);
+
+    auto swap = (quadrant == one) | (quadrant == three);
+    auto negS = quadrant >= two;
+    auto negC = (quadrant == one) | (quadrant == two);
+
+    F sv = Select(swap, cr, sr);
+    F cv = Select(swap, sr, cr);
+
+    s = Select(negS, -sv, sv);
+    c = Select(negC, -cv, cv);
+}
+
+template<typename F>
+F Sin(F x)
+{
+    F s, c;
+    SinCos(x, s, c);
+    return s;
+}
+
+template<typename F>
+F Cos(F x)
+{
+    F s, c;
+    SinCos(x, s, c);
+    return c;
+}
+
+template<typename F>
+F Tan(F x)
+{
+    F quadrant;
+    F r = Reduce(x, quadrant);
+    F r2 = r * r;
+
+    F p = MulAdd(F::Set(9.38540185543e-3f), r2, F::Set(3.11992232697e-3f));
+    p = MulAdd(p, r2, F::Set(2.44301354525e-2f));
+    p = MulAdd(p, r2, F::Set(5.34112807005e-2f));
+    p = MulAdd(p, r2, F::Set(1.33387994085e-1f));
+    p = MulAdd(p, r2, F::Set(3.33331568548e-1f));
+    F t = MulAdd(p * r2, r, r);
+
+    // tan(r + pi/2) = -1 / tan(r)
+    auto odd = (quadrant == F::Set(1.f)) | (quadrant == F::Set(3.f));
+    return Select(odd, F::Set(-1.f) / t, t);
+}
+
+/**
+ * @brief atan(t) for t in [0, 1]
+ */
+template<typename F>
+F AtanUnit(F t)
+{
+    // Above tan(pi/8) use atan(t) = pi/4 + atan((t - 1) / (t + 1))
+    F one = F::Set(1.f);
+    auto high = t > F::Set(0.4142135623730950f);
+
+    F x = Select(high, (t - one) / (t + one), t);
+    F offset = Select(high, F::Set(kQuarterPi), F::Set(0.f));
+
+    F z = x * x;
+    F p = MulAdd(F::Set(8.05374449538e-2f), z, F::Set(-1.38776856032e-1f));
+    p = MulAdd(p, z, F::Set(1.99777106478e-1f));
+    p = MulAdd(p, z, F::Set(-3.33329491539e-1f));
+
+    return MulAdd(p * z, x, x) + offset;
+}
+
+template<typename F>
+F Atan2(F y, F x)
+{
+    F zero = F::Set(0.f);
+    F ax = Abs(x);
+    F ay = Abs(y);
+
+    // Work on the octant where the ratio is at most 1, then unfold
+    F hi = Max(ax, ay);
+    F lo = Min(ax, ay);
+    F a = AtanUnit(lo / hi);
+
+    a = Select(ay > ax, F::Set(kHalfPi) - a, a);
+    a = Select(x < zero, F::Set(kPi) - a, a);
+    a = Select(y < zero, -a, a);
+
+    // atan2(0, 0) is 0 rather than the NaN from 0 / 0
+    return Select(hi == zero, zero, a);
+}
+
+template<typename F>
+F Acos(F x)
+{
+    F one = F::Set(1.f);
+    F half = F::Set(0.5f);
+    F a = Abs(x);
+
+    // Near |x| = 1 use asin(sqrt((1 - |x|) / 2)) to keep precision
+    auto big = a > half;
+    F z = Select(big, half * (one - a), a * a);
+    F s = Select(big, Sqrt(z), a);
+
+    F p = MulAdd(F::Set(4.2163199048e-2f), z, F::Set(2.4181311049e-2f));
+    p = MulAdd(p, z, F::Set(4.5470025998e-2f));
+    p = MulAdd(p, z, F::Set(7.4953002686e-2f));
+    p = MulAdd(p, z, F::Set(1.6666752422e-1f));
+    F asinS = MulAdd(p * z, s, s);
+
+    F zero = F::Set(0.f);
+    F bigResult = asinS + asinS;
+    bigResult = Select(x < zero, F::Set(kPi) - bigResult, bigResult);
+
+    F smallResult = F::Set(kHalfPi) - Select(x < zero, -asinS, asinS);
+    return Select(big, bigResult, smallResult);
+}
+
+/**
+ * @brief Hardware estimate refined with one Newton-Raphson step
+ *
+ * +inf for 0 and denormals, which the estimate flushes, and 0 for +inf.
+ * Deterministic builds take the full precision square root and divide instead.
+ */
+template<typename F>
+F InvSqrtFast(F x)
+{
+#ifdef FMATHS_DETERMINISTIC
+    return InvSqrt(x);
+#else
+    F y = InvSqrtEstimate(x);
+    F halfX = F::Set(0.5f) * x;
+    F refined = y * (F::Set(1.5f) - (halfX * y * y));
+
+    // 0, denormals and infinity make the step 0 * inf, their estimate is already exact
+    return Select((y == F::Set(INFINITY)) | (y == F::Set(0.f)), y, refined);
+#endif
+}
+
+} // namespace SimdMath
+
+#endif
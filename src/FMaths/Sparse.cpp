@@ -0,0 +1,530 @@
+#include "FMaths/Sparse.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#include "Simd.h"
+
+namespace
+{
+
+constexpr uint32_t kNoColor = UINT32_MAX;
+
+size_t ChunkCount(size_t count)
+{
+    return (count + kSparseChunkSize - 1) / kSparseChunkSize;
+}
+
+/**
+ * @brief Sum of per chunk partials k of stride, in chunk order
+ */
+double Total(const std::vector<double>& partial, size_t k, size_t stride)
+{
+    double sum = 0.0;
+    for (size_t c = k; c < partial.size(); c += stride)
+        sum += partial[c];
+
+    return sum;
+}
+
+/**
+ * @brief Sum of a[i] b[i] over [begin, end), float lanes folded into double in lane order
+ */
+double Dot(const float* a, const float* b, size_t begin, size_t end)
+{
+    // Element i always lands in lane (i - begin) % kReduceLanes, whatever the lane type
+    constexpr size_t kBlocks = kReduceLanes / SimdFloat::Width;
+
+    SimdFloat acc[kBlocks];
+    for (size_t k = 0; k < kBlocks; k++)
+        acc[k] = SimdFloat::Set(0.f);
+
+    size_t i = begin;
+    for (; i + kReduceLanes <= end; i += kReduceLanes)
+        for (size_t k = 0; k < kBlocks; k++)
+        {
+            size_t j = i + (k * SimdFloat::Width);
+            acc[k] = MulAdd(SimdFloat::Load(a + j), SimdFloat::Load(b + j), acc[k]);
+        }
+
+    float lanes[kReduceLanes];
+    for (size_t k = 0; k < kBlocks; k++)
+        acc[k].Store(lanes + (k * SimdFloat::Width));
+
+    double sum = 0.0;
+    for (size_t lane = 0; lane < kReduceLanes; lane++)
+        sum += lanes[lane];
+
+    for (; i < end; i++)
+        sum += a[i] * b[i];
+
+    return sum;
+}
+
+/**
+ * @brief out = s a + b over [begin, end)
+ */
+template<typename F>
+void ScaleAdd(size_t& i, size_t end, float s, const float* a, const float* b, float* out)
+{
+    F scale = F::Set(s);
+
+    for (; i + F::Width <= end; i += F::Width)
+        MulAdd(scale, F::Load(a + i), F::Load(b + i)).Store(out + i);
+}
+
+void ScaleAdd(size_t begin, size_t end, float s, const float* a, const float* b, float* out)
+{
+    size_t i = begin;
+    ScaleAdd<SimdFloat>(i, end, s, a, b, out);
+    ScaleAdd<ScalarFloat>(i, end, s, a, b, out);
+}
+
+/**
+ * @brief Sum of blocks times the vectors of their columns, m[k] x[columns[k]] for k in [first, last)
+ *
+ * With null columns every block multiplies x itself, for a single block applied to one vector.
+ */
+void BlockProduct(const float* values, const uint32_t* columns, uint32_t first, uint32_t last, const float* x, float (&out)[3])
+{
+    // One accumulator per block column, so consecutive blocks don't wait on each other
+#ifdef FMATHS_SIMD_SSE
+    Float4 acc[3] = {Float4::Set(0.f), Float4::Set(0.f), Float4::Set(0.f)};
+
+    for (uint32_t k = first; k < last; k++)
+    {
+        const float* block = values + (12 * k);
+        const float* v = x + (3 * (columns ? columns[k] : 0));
+
+        for (size_t col = 0; col < 3; col++)
+            acc[col] = MulAdd(Float4::Load(block + (4 * col)), Float4::Set(v[col]), acc[col]);
+    }
+
+    float lanes[4];
+    ((acc[0] + acc[1]) + acc[2]).Store(lanes);
+
+    for (size_t row = 0; row < 3; row++)
+        out[row] = lanes[row];
+#else
+    float acc[3][3] = {};
+
+    for (uint32_t k = first; k < last; k++)
+    {
+        const float* block = values + (12 * k);
+        const float* v = x + (3 * (columns ? columns[k] : 0));
+
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+                acc[col][row] = MulAdd(block[(4 * col) + row], v[col], acc[col][row]);
+    }
+
+    for (size_t row = 0; row < 3; row++)
+        out[row] = (acc[0][row] + acc[1][row]) + acc[2][row];
+#endif
+}
+
+void RowProduct(const BlockSparseMatrix& a, size_t row, const float* x, float (&out)[3])
+{
+    const uint32_t* start = a.RowStart();
+    BlockProduct(a.Values(), a.Columns(), start[row], start[row + 1], x, out);
+}
+
+/**
+ * @brief Inverse of each row's diagonal block in the padded block layout, zero where there's none
+ */
+std::vector<float> InverseDiagonal(const BlockSparseMatrix& a, const Executor& executor)
+{
+    std::vector<float> inverse(12 * a.BlockRows(), 0.f);
+
+    ParallelFor(a.BlockRows(), kSparseChunkSize, executor, [&a, &inverse](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            size_t k = a.Find(i, i);
+            if (k == a.BlockCount())
+                continue;
+
+            const float* m = a.Values() + (12 * k);
+            auto at = [m](size_t row, size_t col) { return m[(4 * col) + row]; };
+
+            // Cofactors, the inverse's columns are their rows over the determinant
+            float c[3][3] = {
+                {(at(1, 1) * at(2, 2)) - (at(1, 2) * at(2, 1)), (at(1, 2) * at(2, 0)) - (at(1, 0) * at(2, 2)), (at(1, 0) * at(2, 1)) - (at(1, 1) * at(2, 0))},
+                {(at(0, 2) * at(2, 1)) - (at(0, 1) * at(2, 2)), (at(0, 0) * at(2, 2)) - (at(0, 2) * at(2, 0)), (at(0, 1) * at(2, 0)) - (at(0, 0) * at(2, 1))},
+                {(at(0, 1) * at(1, 2)) - (at(0, 2) * at(1, 1)), (at(0, 2) * at(1, 0)) - (at(0, 0) * at(1, 2)), (at(0, 0) * at(1, 1)) - (at(0, 1) * at(1, 0))}
+            };
+
+            float det = (at(0, 0) * c[0][0]) + (at(0, 1) * c[0][1]) + (at(0, 2) * c[0][2]);
+            float invDet = 1.f / det;
+
+            if (det == 0.f || !std::isfinite(invDet))
+                continue;
+
+            float* out = inverse.data() + (12 * i);
+            for (size_t col = 0; col < 3; col++)
+                for (size_t row = 0; row < 3; row++)
+                    out[(4 * col) + row] = c[col][row] * invDet;
+        }
+    });
+
+    return inverse;
+}
+
+/**
+ * @brief x_i += D_i^-1 (b_i - (a x)_i) for one row, reading x from in and writing out
+ */
+void RelaxRow(const BlockSparseMatrix& a, const float* inverse, size_t i, const float* b, const float* in, float* out)
+{
+    float ax[3], r[3], d[3];
+    RowProduct(a, i, in, ax);
+
+    for (size_t k = 0; k < 3; k++)
+        r[k] = b[(3 * i) + k] - ax[k];
+
+    BlockProduct(inverse + (12 * i), nullptr, 0, 1, r, d);
+
+    for (size_t k = 0; k < 3; k++)
+        out[(3 * i) + k] = in[(3 * i) + k] + d[k];
+}
+
+} // namespace
+
+// BlockSparseMatrix
+
+BlockSparseMatrix::BlockSparseMatrix():
+    m_BlockRows(0), m_RowStart(1, 0), m_ColorStart(1, 0)
+{}
+
+BlockSparseMatrix::BlockSparseMatrix(size_t blockRows, const BlockEntry* entries, size_t count):
+    m_BlockRows(blockRows), m_RowStart(blockRows + 1, 0)
+{
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [entries](uint32_t a, uint32_t b) {
+        return entries[a].row != entries[b].row ? entries[a].row < entries[b].row : entries[a].col < entries[b].col;
+    });
+
+    for (size_t n = 0; n < count; n++)
+    {
+        const BlockEntry& e = entries[order[n]];
+        assert(e.row < blockRows && e.col < blockRows);
+
+        bool repeat = n > 0 && entries[order[n - 1]].row == e.row && entries[order[n - 1]].col == e.col;
+
+        if (!repeat)
+        {
+            m_Columns.push_back(e.col);
+            m_Values.resize(m_Values.size() + 12, 0.f);
+            m_RowStart[e.row + 1]++;
+        }
+
+        AddBlock(m_Columns.size() - 1, e.block);
+    }
+
+    for (size_t i = 0; i < blockRows; i++)
+        m_RowStart[i + 1] += m_RowStart[i];
+
+    // Greedy coloring in row order, stamped with the row to avoid clearing
+    std::vector<uint32_t> color(blockRows, kNoColor);
+    std::vector<size_t> used;
+    size_t colors = 0;
+
+    for (size_t i = 0; i < blockRows; i++)
+    {
+        for (uint32_t k = m_RowStart[i]; k < m_RowStart[i + 1]; k++)
+            if (m_Columns[k] != i && color[m_Columns[k]] != kNoColor)
+                used[color[m_Columns[k]]] = i + 1;
+
+        uint32_t c = 0;
+        while (c < colors && used[c] == i + 1)
+            c++;
+
+        if (c == colors)
+        {
+            colors++;
+            used.push_back(0);
+        }
+
+        color[i] = c;
+    }
+
+    // Counting sort of rows by color
+    m_ColorStart.assign(colors + 1, 0);
+    for (uint32_t c : color)
+        m_ColorStart[c + 1]++;
+
+    for (size_t c = 0; c < colors; c++)
+        m_ColorStart[c + 1] += m_ColorStart[c];
+
+    m_ColorRows.resize(blockRows);
+    std::vector<uint32_t> next(m_ColorStart.begin(), m_ColorStart.end() - 1);
+
+    for (size_t i = 0; i < blockRows; i++)
+        m_ColorRows[next[color[i]]++] = static_cast<uint32_t>(i);
+}
+
+size_t BlockSparseMatrix::BlockRows() const
+{
+    return m_BlockRows;
+}
+
+size_t BlockSparseMatrix::BlockCount() const
+{
+    return m_Columns.size();
+}
+
+size_t BlockSparseMatrix::Find(size_t row, size_t col) const
+{
+    const uint32_t* first = m_Columns.data() + m_RowStart[row];
+    const uint32_t* last = m_Columns.data() + m_RowStart[row + 1];
+    const uint32_t* it = std::lower_bound(first, last, col);
+
+    return (it != last && *it == col) ? static_cast<size_t>(it - m_Columns.data()) : BlockCount();
+}
+
+Matrix3x3 BlockSparseMatrix::Block(size_t index) const
+{
+    const float* v = m_Values.data() + (12 * index);
+    return Matrix3x3(Vector3(v[0], v[1], v[2]), Vector3(v[4], v[5], v[6]), Vector3(v[8], v[9], v[10]));
+}
+
+void BlockSparseMatrix::SetBlock(size_t index, const Matrix3x3& block)
+{
+    float* v = m_Values.data() + (12 * index);
+
+    for (size_t col = 0; col < 3; col++)
+        for (size_t row = 0; row < 3; row++)
+            v[(4 * col) + row] = block[col][row];
+}
+
+void BlockSparseMatrix::AddBlock(size_t index, const Matrix3x3& block)
+{
+    float* v = m_Values.data() + (12 * index);
+
+    for (size_t col = 0; col < 3; col++)
+        for (size_t row = 0; row < 3; row++)
+            v[(4 * col) + row] += block[col][row];
+}
+
+void BlockSparseMatrix::ZeroBlocks()
+{
+    std::fill(m_Values.begin(), m_Values.end(), 0.f);
+}
+
+const uint32_t* BlockSparseMatrix::RowStart() const
+{
+    return m_RowStart.data();
+}
+
+const uint32_t* BlockSparseMatrix::Columns() const
+{
+    return m_Columns.data();
+}
+
+const float* BlockSparseMatrix::Values() const
+{
+    return m_Values.data();
+}
+
+size_t BlockSparseMatrix::ColorCount() const
+{
+    return m_ColorStart.size() - 1;
+}
+
+const uint32_t* BlockSparseMatrix::ColorStart() const
+{
+    return m_ColorStart.data();
+}
+
+const uint32_t* BlockSparseMatrix::ColorRows() const
+{
+    return m_ColorRows.data();
+}
+
+// Solvers
+
+void Multiply(const BlockSparseMatrix& a, const Vector3* x, Vector3* out, const Executor& executor)
+{
+    assert(static_cast<const void*>(x) != static_cast<const void*>(out));
+
+    const float* xs = reinterpret_cast<const float*>(x);
+    float* outs = reinterpret_cast<float*>(out);
+
+    ParallelFor(a.BlockRows(), kSparseChunkSize, executor, [&a, xs, outs](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            float ax[3];
+            RowProduct(a, i, xs, ax);
+
+            for (size_t k = 0; k < 3; k++)
+                outs[(3 * i) + k] = ax[k];
+        }
+    });
+}
+
+SolveResult ConjugateGradient(const BlockSparseMatrix& a, const Vector3* b, Vector3* x, size_t maxIterations, float tolerance,
+    const Executor& executor)
+{
+    size_t n = a.BlockRows();
+    const float* bs = reinterpret_cast<const float*>(b);
+    float* xs = reinterpret_cast<float*>(x);
+
+    std::vector<float> inverse = InverseDiagonal(a, executor);
+    std::vector<float> r(3 * n), z(3 * n), p(3 * n), ap(3 * n);
+
+    // Up to three dot products per pass, chunk by chunk
+    std::vector<double> partial(3 * ChunkCount(n));
+
+    // r = b - a x, z = M^-1 r, p = z
+    ParallelFor(n, kSparseChunkSize, executor, [&](size_t begin, size_t end) {
+        size_t chunk = begin / kSparseChunkSize;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            float ax[3], zi[3], ri[3];
+            RowProduct(a, i, xs, ax);
+
+            for (size_t k = 0; k < 3; k++)
+                ri[k] = r[(3 * i) + k] = bs[(3 * i) + k] - ax[k];
+
+            BlockProduct(inverse.data() + (12 * i), nullptr, 0, 1, ri, zi);
+
+            for (size_t k = 0; k < 3; k++)
+                z[(3 * i) + k] = p[(3 * i) + k] = zi[k];
+        }
+
+        partial[(3 * chunk)] = Dot(r.data(), z.data(), 3 * begin, 3 * end);
+        partial[(3 * chunk) + 1] = Dot(r.data(), r.data(), 3 * begin, 3 * end);
+        partial[(3 * chunk) + 2] = Dot(bs, bs, 3 * begin, 3 * end);
+    });
+
+    double rz = Total(partial, 0, 3);
+    double rr = Total(partial, 1, 3);
+    double bb = Total(partial, 2, 3);
+
+    if (bb == 0.0)
+    {
+        std::fill(xs, xs + (3 * n), 0.f);
+        return {0, 0.f};
+    }
+
+    SolveResult result = {0, static_cast<float>(std::sqrt(rr / bb))};
+
+    while (result.iterations < maxIterations && result.residual > tolerance)
+    {
+        // ap = a p
+        ParallelFor(n, kSparseChunkSize, executor, [&](size_t begin, size_t end) {
+            size_t chunk = begin / kSparseChunkSize;
+
+            for (size_t i = begin; i < end; i++)
+            {
+                float api[3];
+                RowProduct(a, i, p.data(), api);
+
+                for (size_t k = 0; k < 3; k++)
+                    ap[(3 * i) + k] = api[k];
+            }
+
+            partial[3 * chunk] = Dot(p.data(), ap.data(), 3 * begin, 3 * end);
+        });
+
+        double pap = Total(partial, 0, 3);
+
+        // Not positive definite, or p is already zero
+        if (!(pap > 0.0))
+            break;
+
+        float alpha = static_cast<float>(rz / pap);
+
+        // x += alpha p, r -= alpha ap, z = M^-1 r
+        ParallelFor(n, kSparseChunkSize, executor, [&](size_t begin, size_t end) {
+            size_t chunk = begin / kSparseChunkSize;
+
+            ScaleAdd(3 * begin, 3 * end, alpha, p.data(), xs, xs);
+            ScaleAdd(3 * begin, 3 * end, -alpha, ap.data(), r.data(), r.data());
+
+            for (size_t i = begin; i < end; i++)
+            {
+                float zi[3];
+                BlockProduct(inverse.data() + (12 * i), nullptr, 0, 1, r.data() + (3 * i), zi);
+
+                for (size_t k = 0; k < 3; k++)
+                    z[(3 * i) + k] = zi[k];
+            }
+
+            partial[3 * chunk] = Dot(r.data(), z.data(), 3 * begin, 3 * end);
+            partial[(3 * chunk) + 1] = Dot(r.data(), r.data(), 3 * begin, 3 * end);
+        });
+
+        double rzNext = Total(partial, 0, 3);
+        rr = Total(partial, 1, 3);
+
+        result.iterations++;
+        result.residual = static_cast<float>(std::sqrt(rr / bb));
+
+        if (result.residual <= tolerance)
+            break;
+
+        float beta = static_cast<float>(rzNext / rz);
+        rz = rzNext;
+
+        // p = z + beta p
+        ParallelFor(n, kSparseChunkSize, executor, [&](size_t begin, size_t end) {
+            ScaleAdd(3 * begin, 3 * end, beta, p.data(), z.data(), p.data());
+        });
+    }
+
+    return result;
+}
+
+void Jacobi(const BlockSparseMatrix& a, const Vector3* b, Vector3* x, size_t iterations, const Executor& executor)
+{
+    size_t n = a.BlockRows();
+    const float* bs = reinterpret_cast<const float*>(b);
+    float* xs = reinterpret_cast<float*>(x);
+
+    std::vector<float> inverse = InverseDiagonal(a, executor);
+    std::vector<float> scratch(3 * n);
+
+    float* in = xs;
+    float* out = scratch.data();
+
+    for (size_t iteration = 0; iteration < iterations; iteration++)
+    {
+        ParallelFor(n, kSparseChunkSize, executor, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                RelaxRow(a, inverse.data(), i, bs, in, out);
+        });
+
+        std::swap(in, out);
+    }
+
+    if (in != xs)
+        memcpy(xs, in, 3 * n * sizeof(float));
+}
+
+void GaussSeidel(const BlockSparseMatrix& a, const Vector3* b, Vector3* x, size_t iterations, const Executor& executor)
+{
+    const float* bs = reinterpret_cast<const float*>(b);
+    float* xs = reinterpret_cast<float*>(x);
+
+    std::vector<float> inverse = InverseDiagonal(a, executor);
+    const uint32_t* colorStart = a.ColorStart();
+    const uint32_t* colorRows = a.ColorRows();
+
+    for (size_t iteration = 0; iteration < iterations; iteration++)
+    {
+        // Rows of a color don't read each other, so each is updated in place
+        for (size_t c = 0; c < a.ColorCount(); c++)
+        {
+            const uint32_t* rows = colorRows + colorStart[c];
+
+            ParallelFor(colorStart[c + 1] - colorStart[c], kSparseChunkSize, executor, [&](size_t begin, size_t end) {
+                for (size_t k = begin; k < end; k++)
+                    RelaxRow(a, inverse.data(), rows[k], bs, xs, xs);
+            });
+        }
+    }
+}
@@ -0,0 +1,276 @@
+#include "FMaths/SpatialHash.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#include "Hash.h"
+#include "RadixSort.h"
+#include "Simd.h"
+
+namespace
+{
+
+size_t ChunkCount(size_t count)
+{
+    return (count + kGridChunkSize - 1) / kGridChunkSize;
+}
+
+void Cell(const Vector3& p, float invCell, int32_t (&cell)[3])
+{
+    cell[0] = QuantizeCell(p.x, invCell);
+    cell[1] = QuantizeCell(p.y, invCell);
+    cell[2] = QuantizeCell(p.z, invCell);
+}
+
+/**
+ * @brief Linear rather than mixed hash, so cells next to each other along x take consecutive buckets
+ *
+ * A row of cells then sorts into one run of slots, which queries read in one
+ * go. The odd multipliers spread rows along y and z over the table.
+ */
+uint32_t Bucket(int32_t x, int32_t y, int32_t z, uint32_t bits)
+{
+    uint32_t h = static_cast<uint32_t>(x) + (static_cast<uint32_t>(y) * 0x9E3779B1u) + (static_cast<uint32_t>(z) * 0x85EBCA77u);
+    return static_cast<uint32_t>(h & ((uint64_t(1) << bits) - 1));
+}
+
+/**
+ * @brief Append slots in [begin, end), other than skip, whose squared distance from p is at most r2
+ *
+ * Runs whole lane groups past end, into the arrays' padding, and drops those lanes.
+ */
+void FilterLanes(size_t begin, size_t end, const float* x, const float* y, const float* z, const float (&p)[3], float r2, size_t skip,
+    std::vector<uint32_t>& out)
+{
+    SimdFloat px = SimdFloat::Set(p[0]), py = SimdFloat::Set(p[1]), pz = SimdFloat::Set(p[2]), radius2 = SimdFloat::Set(r2);
+
+    for (size_t s = begin; s < end; s += SimdFloat::Width)
+    {
+        SimdFloat dx = SimdFloat::Load(x + s) - px;
+        SimdFloat dy = SimdFloat::Load(y + s) - py;
+        SimdFloat dz = SimdFloat::Load(z + s) - pz;
+
+        uint32_t bits = MaskBits(MulAdd(dz, dz, MulAdd(dy, dy, dx * dx)) <= radius2);
+
+        if (end - s < SimdFloat::Width)
+            bits &= (1u << (end - s)) - 1;
+
+        for (size_t lane = 0; bits != 0; lane++, bits >>= 1)
+            if ((bits & 1) && s + lane != skip)
+                out.push_back(static_cast<uint32_t>(s + lane));
+    }
+}
+
+} // namespace
+
+SpatialHashGrid::SpatialHashGrid(float cellSize):
+    m_CellSize(cellSize), m_InvCellSize(1.f / cellSize), m_Count(0), m_BucketBits(0), m_BucketStart(2, 0)
+{
+    assert(cellSize > 0.f);
+}
+
+void SpatialHashGrid::Build(const Vector3* points, size_t count, const Executor& executor)
+{
+    assert(count < UINT32_MAX);
+
+    m_Count = count;
+    m_BucketBits = 0;
+    while ((size_t(1) << m_BucketBits) < count)
+        m_BucketBits++;
+
+    m_Keys.resize(count);
+    m_Indices.resize(count);
+
+    ParallelFor(count, kGridChunkSize, executor, [this, points](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            int32_t cell[3];
+            Cell(points[i], m_InvCellSize, cell);
+
+            m_Keys[i] = Bucket(cell[0], cell[1], cell[2], m_BucketBits);
+            m_Indices[i] = static_cast<uint32_t>(i);
+        }
+    });
+
+    // Stable, so a bucket's points stay in index order
+    RadixSort(m_Keys, m_Indices, m_BucketBits, kGridChunkSize, executor, m_ScratchKeys, m_ScratchIndices, m_Histogram);
+
+    size_t buckets = size_t(1) << m_BucketBits;
+    m_BucketStart.resize(buckets + 1);
+    // Padded so a bucket at the end can be read a whole lane group at a time
+    m_X.resize(count + SimdFloat::Width - 1);
+    m_Y.resize(count + SimdFloat::Width - 1);
+    m_Z.resize(count + SimdFloat::Width - 1);
+
+    // Each slot starting a bucket fills the starts of the empty buckets before it
+    ParallelFor(count, kGridChunkSize, executor, [this, points, count, buckets](size_t begin, size_t end) {
+        for (size_t s = begin; s < end; s++)
+        {
+            size_t first = s == 0 ? 0 : m_Keys[s - 1] + 1;
+            for (size_t b = first; b <= m_Keys[s]; b++)
+                m_BucketStart[b] = static_cast<uint32_t>(s);
+
+            if (s + 1 == count)
+                for (size_t b = m_Keys[s] + 1; b <= buckets; b++)
+                    m_BucketStart[b] = static_cast<uint32_t>(count);
+
+            const Vector3& p = points[m_Indices[s]];
+            m_X[s] = p.x;
+            m_Y[s] = p.y;
+            m_Z[s] = p.z;
+        }
+    });
+
+    if (count == 0)
+        std::fill(m_BucketStart.begin(), m_BucketStart.end(), 0u);
+}
+
+size_t SpatialHashGrid::Count() const
+{
+    return m_Count;
+}
+
+float SpatialHashGrid::CellSize() const
+{
+    return m_CellSize;
+}
+
+size_t SpatialHashGrid::BucketCount() const
+{
+    return m_BucketStart.size() - 1;
+}
+
+const float* SpatialHashGrid::X() const
+{
+    return m_X.data();
+}
+
+const float* SpatialHashGrid::Y() const
+{
+    return m_Y.data();
+}
+
+const float* SpatialHashGrid::Z() const
+{
+    return m_Z.data();
+}
+
+const uint32_t* SpatialHashGrid::Indices() const
+{
+    return m_Indices.data();
+}
+
+void SpatialHashGrid::CollectRanges(const int32_t (&lo)[3], const int32_t (&hi)[3], std::vector<uint32_t>& ranges) const
+{
+    ranges.clear();
+
+    int64_t cells = 1;
+    for (size_t k = 0; k < 3; k++)
+        cells *= std::min<int64_t>(int64_t(hi[k]) - lo[k] + 1, int64_t(BucketCount()) + 1);
+
+    // Hashing more cells than there are buckets would only find the same buckets again
+    if (cells > int64_t(BucketCount()))
+    {
+        ranges.push_back(0);
+        ranges.push_back(static_cast<uint32_t>(m_Count));
+        return;
+    }
+
+    for (int32_t z = lo[2]; z <= hi[2]; z++)
+        for (int32_t y = lo[1]; y <= hi[1]; y++)
+            for (int32_t x = lo[0]; x <= hi[0]; x++)
+                ranges.push_back(Bucket(x, y, z, m_BucketBits));
+
+    std::sort(ranges.begin(), ranges.end());
+    ranges.erase(std::unique(ranges.begin(), ranges.end()), ranges.end());
+
+    // Consecutive buckets are consecutive slots, each run becomes one begin, end pair
+    size_t buckets = ranges.size();
+
+    for (size_t k = 0; k < buckets;)
+    {
+        uint32_t first = ranges[k];
+        while (k + 1 < buckets && ranges[k + 1] == ranges[k] + 1)
+            k++;
+
+        ranges.push_back(m_BucketStart[first]);
+        ranges.push_back(m_BucketStart[ranges[k] + 1]);
+        k++;
+    }
+
+    ranges.erase(ranges.begin(), ranges.begin() + buckets);
+}
+
+void SpatialHashGrid::Filter(const std::vector<uint32_t>& ranges, const Vector3& p, float radius, size_t skip,
+    std::vector<uint32_t>& out) const
+{
+    const float position[3] = {p.x, p.y, p.z};
+    float r2 = radius * radius;
+
+    for (size_t k = 0; k < ranges.size(); k += 2)
+        FilterLanes(ranges[k], ranges[k + 1], m_X.data(), m_Y.data(), m_Z.data(), position, r2, skip, out);
+}
+
+void SpatialHashGrid::Query(const Vector3& p, float radius, std::vector<uint32_t>& out) const
+{
+    if (m_Count == 0 || !(radius >= 0.f))
+        return;
+
+    int32_t lo[3], hi[3];
+    Cell(p - Vector3(radius, radius, radius), m_InvCellSize, lo);
+    Cell(p + Vector3(radius, radius, radius), m_InvCellSize, hi);
+
+    std::vector<uint32_t> ranges;
+    CollectRanges(lo, hi, ranges);
+    Filter(ranges, p, radius, SIZE_MAX, out);
+}
+
+void SpatialHashGrid::FindNeighbors(float radius, std::vector<uint32_t>& offsets, std::vector<uint32_t>& neighbors,
+    const Executor& executor) const
+{
+    offsets.assign(m_Count + 1, 0);
+    neighbors.clear();
+
+    if (m_Count == 0 || !(radius >= 0.f))
+        return;
+
+    std::vector<std::vector<uint32_t>> found(ChunkCount(m_Count));
+
+    ParallelFor(m_Count, kGridChunkSize, executor, [this, radius, &offsets, &found](size_t begin, size_t end) {
+        size_t chunk = begin / kGridChunkSize;
+
+        std::vector<uint32_t>& out = found[chunk];
+        std::vector<uint32_t> ranges;
+        int32_t lastLo[3] = {}, lastHi[3] = {};
+        bool cached = false;
+
+        for (size_t s = begin; s < end; s++)
+        {
+            Vector3 p(m_X[s], m_Y[s], m_Z[s]);
+            int32_t lo[3], hi[3];
+            Cell(p - Vector3(radius, radius, radius), m_InvCellSize, lo);
+            Cell(p + Vector3(radius, radius, radius), m_InvCellSize, hi);
+
+            // Sorted neighbours usually share their cells, and so their slot ranges
+            if (!cached || !std::equal(lo, lo + 3, lastLo) || !std::equal(hi, hi + 3, lastHi))
+            {
+                CollectRanges(lo, hi, ranges);
+                std::copy(lo, lo + 3, lastLo);
+                std::copy(hi, hi + 3, lastHi);
+                cached = true;
+            }
+
+            size_t before = out.size();
+            Filter(ranges, p, radius, s, out);
+            offsets[s + 1] = static_cast<uint32_t>(out.size() - before);
+        }
+    });
+
+    for (size_t s = 0; s < m_Count; s++)
+        offsets[s + 1] += offsets[s];
+
+    neighbors.reserve(offsets[m_Count]);
+    for (const std::vector<uint32_t>& chunk : found)
+        neighbors.insert(neighbors.end(), chunk.begin(), chunk.end());
+}
@@ -0,0 +1,289 @@
+#include "FMaths/SpatialSort.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "FMaths/Reduce.h"
+#include "Kernels.h"
+#include "RadixSort.h"
+#include "Simd.h"
+
+#ifdef FMATHS_BMI2
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+
+template<typename Code>
+struct CurveCode;
+
+/**
+ * @brief 10 bits per axis, spread to every third bit
+ */
+template<>
+struct CurveCode<uint32_t>
+{
+    static constexpr uint32_t kAxisBits = 10;
+
+    static uint32_t Spread(uint32_t x)
+    {
+#ifdef FMATHS_BMI2
+        return _pdep_u32(x, 0x09249249u);
+#else
+        x &= 0x3FFu;
+        x = (x | (x << 16)) & 0x030000FFu;
+        x = (x | (x << 8)) & 0x0300F00Fu;
+        x = (x | (x << 4)) & 0x030C30C3u;
+        x = (x | (x << 2)) & 0x09249249u;
+        return x;
+#endif
+    }
+};
+
+/**
+ * @brief 21 bits per axis
+ */
+template<>
+struct CurveCode<uint64_t>
+{
+    static constexpr uint32_t kAxisBits = 21;
+
+    static uint64_t Spread(uint32_t v)
+    {
+#ifdef FMATHS_BMI2
+        return _pdep_u64(v, 0x1249249249249249ull);
+#else
+        uint64_t x = v & 0x1FFFFFu;
+        x = (x | (x << 32)) & 0x001F00000000FFFFull;
+        x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+        x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+        x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+        x = (x | (x << 2)) & 0x1249249249249249ull;
+        return x;
+#endif
+    }
+};
+
+template<typename Code>
+Code Morton(uint32_t x, uint32_t y, uint32_t z)
+{
+    using C = CurveCode<Code>;
+    return C::Spread(x) | (C::Spread(y) << 1) | (C::Spread(z) << 2);
+}
+
+/**
+ * @brief Skilling's transpose, "Programming the Hilbert curve", 2004, over W cells at once
+ *
+ * Undoes the curve's rotations and reflections a bit level at a time, then
+ * Gray codes the result, which leaves the Hilbert index with its bits
+ * transposed across the axes. Interleaving them, x most significant in each
+ * triple, gives the index. Written without branches on the coordinates, so
+ * the lane loops vectorize.
+ *
+ * @param c Cells by axis then lane, within the curve's grid
+ */
+template<typename Code, size_t W>
+void HilbertTranspose(uint32_t (&c)[3][W])
+{
+    constexpr uint32_t bits = CurveCode<Code>::kAxisBits;
+
+    for (uint32_t level = bits - 1; level > 0; level--)
+    {
+        uint32_t p = (1u << level) - 1;
+
+        for (size_t i = 0; i < 3; i++)
+            for (size_t lane = 0; lane < W; lane++)
+            {
+                // Invert the low bits of c[0] if this bit of c[i] is set, else exchange them with c[i]'s
+                uint32_t invert = p & (0u - ((c[i][lane] >> level) & 1u));
+                uint32_t t = (c[0][lane] ^ c[i][lane]) & p & ~invert;
+
+                c[0][lane] ^= t ^ invert;
+                c[i][lane] ^= t;
+            }
+    }
+
+    for (size_t lane = 0; lane < W; lane++)
+    {
+        c[1][lane] ^= c[0][lane];
+        c[2][lane] ^= c[1][lane];
+
+        uint32_t t = 0;
+        for (uint32_t level = bits - 1; level > 0; level--)
+            t ^= ((1u << level) - 1) & (0u - ((c[2][lane] >> level) & 1u));
+
+        c[0][lane] ^= t;
+        c[1][lane] ^= t;
+        c[2][lane] ^= t;
+    }
+}
+
+template<typename Code>
+Code Hilbert(uint32_t x, uint32_t y, uint32_t z)
+{
+    constexpr uint32_t mask = (1u << CurveCode<Code>::kAxisBits) - 1;
+    uint32_t c[3][1] = {{x & mask}, {y & mask}, {z & mask}};
+
+    HilbertTranspose<Code, 1>(c);
+    return Morton<Code>(c[2][0], c[1][0], c[0][0]);
+}
+
+/**
+ * @brief Per axis scale from points to cells
+ */
+template<typename Code>
+void CellScale(const AABB& bounds, float (&scale)[3])
+{
+    constexpr float cells = float(1u << CurveCode<Code>::kAxisBits);
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        float extent = bounds.max[k] - bounds.min[k];
+        scale[k] = extent > 0.f ? cells / extent : 0.f;
+    }
+}
+
+/**
+ * @brief Cells of F::Width points in lanes, clamped to the grid with NaN going to 0
+ */
+template<typename F>
+void QuantizeLanes(const Vector3* p, const float (&min)[3], const float (&scale)[3], float top, float (&cells)[3][F::Width])
+{
+    Vector3Lanes<F> v = Vector3Lanes<F>::Load(p);
+    const F lanes[3] = {v.x, v.y, v.z};
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        // Max returns its second operand for NaN
+        F c = (lanes[k] - F::Set(min[k])) * F::Set(scale[k]);
+        Min(Max(c, F::Set(0.f)), F::Set(top)).Store(cells[k]);
+    }
+}
+
+template<typename F, typename Code, bool UseHilbert>
+void EncodeLanes(const Vector3* points, size_t i, const float (&min)[3], const float (&scale)[3], Code* codes)
+{
+    constexpr size_t W = F::Width;
+    constexpr float top = float((1u << CurveCode<Code>::kAxisBits) - 1);
+
+    float cells[3][W];
+    QuantizeLanes<F>(points + i, min, scale, top, cells);
+
+    // Truncation is floor, the cells are clamped to be non-negative
+    uint32_t c[3][W];
+    for (size_t k = 0; k < 3; k++)
+        for (size_t lane = 0; lane < W; lane++)
+            c[k][lane] = static_cast<uint32_t>(static_cast<int32_t>(cells[k][lane]));
+
+    if (UseHilbert)
+    {
+        HilbertTranspose<Code, W>(c);
+
+        for (size_t lane = 0; lane < W; lane++)
+            codes[i + lane] = Morton<Code>(c[2][lane], c[1][lane], c[0][lane]);
+    }
+    else
+    {
+        for (size_t lane = 0; lane < W; lane++)
+            codes[i + lane] = Morton<Code>(c[0][lane], c[1][lane], c[2][lane]);
+    }
+}
+
+template<typename Code, bool UseHilbert>
+void EncodeRange(const Vector3* points, size_t begin, size_t end, const float (&min)[3], const float (&scale)[3], Code* codes)
+{
+    size_t i = begin;
+
+    for (; i + SimdFloat::Width <= end; i += SimdFloat::Width)
+        EncodeLanes<SimdFloat, Code, UseHilbert>(points, i, min, scale, codes);
+
+    for (; i < end; i++)
+        EncodeLanes<ScalarFloat, Code, UseHilbert>(points, i, min, scale, codes);
+}
+
+template<typename Code>
+void Encode(const Vector3* points, size_t count, const AABB& bounds, SpaceCurve curve, Code* codes, const Executor& executor)
+{
+    const float min[3] = {bounds.min.x, bounds.min.y, bounds.min.z};
+    float scale[3];
+    CellScale<Code>(bounds, scale);
+
+    ParallelFor(count, kSortChunkSize, executor, [points, curve, codes, &min, &scale](size_t begin, size_t end) {
+        if (curve == SpaceCurve::Hilbert)
+            EncodeRange<Code, true>(points, begin, end, min, scale, codes);
+        else
+            EncodeRange<Code, false>(points, begin, end, min, scale, codes);
+    });
+}
+
+template<typename Code>
+void Sort(const Code* codes, size_t count, uint32_t* permutation, const Executor& executor)
+{
+    assert(count < UINT32_MAX);
+
+    std::vector<Code> keys(codes, codes + count), scratchKeys;
+    std::vector<uint32_t> values(count), scratchValues, histogram;
+
+    for (size_t i = 0; i < count; i++)
+        values[i] = static_cast<uint32_t>(i);
+
+    RadixSort(keys, values, 3 * CurveCode<Code>::kAxisBits, kSortChunkSize, executor, scratchKeys, scratchValues, histogram);
+    std::copy(values.begin(), values.end(), permutation);
+}
+
+} // namespace
+
+uint32_t Morton30(uint32_t x, uint32_t y, uint32_t z)
+{
+    return Morton<uint32_t>(x & 0x3FFu, y & 0x3FFu, z & 0x3FFu);
+}
+
+uint64_t Morton63(uint32_t x, uint32_t y, uint32_t z)
+{
+    return Morton<uint64_t>(x & 0x1FFFFFu, y & 0x1FFFFFu, z & 0x1FFFFFu);
+}
+
+uint32_t Hilbert30(uint32_t x, uint32_t y, uint32_t z)
+{
+    return Hilbert<uint32_t>(x, y, z);
+}
+
+uint64_t Hilbert63(uint32_t x, uint32_t y, uint32_t z)
+{
+    return Hilbert<uint64_t>(x, y, z);
+}
+
+void EncodePoints(const Vector3* points, size_t count, const AABB& bounds, SpaceCurve curve, uint32_t* codes, const Executor& executor)
+{
+    Encode(points, count, bounds, curve, codes, executor);
+}
+
+void EncodePoints(const Vector3* points, size_t count, const AABB& bounds, SpaceCurve curve, uint64_t* codes, const Executor& executor)
+{
+    Encode(points, count, bounds, curve, codes, executor);
+}
+
+void SortCodes(const uint32_t* codes, size_t count, uint32_t* permutation, const Executor& executor)
+{
+    Sort(codes, count, permutation, executor);
+}
+
+void SortCodes(const uint64_t* codes, size_t count, uint32_t* permutation, const Executor& executor)
+{
+    Sort(codes, count, permutation, executor);
+}
+
+void SpatialSort(Vector3* points, size_t count, uint32_t* permutation, SpaceCurve curve, const Executor& executor)
+{
+    if (count == 0)
+        return;
+
+    std::vector<uint32_t> codes(count);
+    EncodePoints(points, count, Bounds(points, count, executor), curve, codes.data(), executor);
+    SortCodes(codes.data(), count, permutation, executor);
+
+    std::vector<Vector3> original(points, points + count);
+    Permute(original.data(), permutation, count, points, executor);
+}
@@ -0,0 +1,449 @@
+#include "FMaths/SphericalHarmonics.h"
+
+#include <cassert>
+
+#include "FMaths/Quaternion.h"
+#include "FMaths/Matrix4x4.h"
+
+#include "Kernels.h"
+
+static_assert(sizeof(SH2) == sizeof(float) * 3 * 4, "SH2 must be tightly packed");
+static_assert(sizeof(SH3) == sizeof(float) * 3 * 9, "SH3 must be tightly packed");
+
+namespace
+{
+
+// Normalization constants of the real basis
+constexpr float kBand0 = 0.282094791773878f;  // 1 / (2 sqrt(pi))
+constexpr float kBand1 = 0.488602511902920f;  // sqrt(3 / (4 pi))
+constexpr float kBand2 = 1.092548430592079f;  // sqrt(15 / (4 pi))
+constexpr float kBand2Zonal = 0.315391565252520f;  // sqrt(5 / (16 pi))
+constexpr float kBand2Sectoral = 0.546274215296040f;  // sqrt(15 / (16 pi))
+
+constexpr float kPi = 3.14159265358979f;
+
+/**
+ * @brief Basis functions of the first Order bands at W unit directions
+ */
+template<size_t Order, typename F>
+void BasisLanes(const Vector3Lanes<F>& d, F (&y)[Order * Order])
+{
+    y[0] = F::Set(kBand0);
+
+    F k1 = F::Set(kBand1);
+    y[1] = k1 * d.y;
+    y[2] = k1 * d.z;
+    y[3] = k1 * d.x;
+
+    if constexpr (Order == 3)
+    {
+        F k2 = F::Set(kBand2);
+        y[4] = k2 * (d.x * d.y);
+        y[5] = k2 * (d.y * d.z);
+        y[6] = F::Set(kBand2Zonal) * MulAdd(F::Set(3.f), d.z * d.z, F::Set(-1.f));
+        y[7] = k2 * (d.x * d.z);
+        y[8] = F::Set(kBand2Sectoral) * ((d.x * d.x) - (d.y * d.y));
+    }
+}
+
+/**
+ * @brief Coefficients of W functions in lanes, c[coefficient][channel]
+ */
+template<typename F, size_t Order>
+struct SHLanes
+{
+    static constexpr size_t Count = Order * Order;
+    static constexpr size_t Stride = Count * 3;
+
+    F c[Count][3];
+
+    static SHLanes Load(const SphericalHarmonics<Order>* p)
+    {
+        const float* f = reinterpret_cast<const float*>(p);
+        SHLanes res;
+
+        for (size_t k = 0; k < Count; k++)
+            for (size_t ch = 0; ch < 3; ch++)
+                res.c[k][ch] = F::Gather(f + (k * 3) + ch, Stride);
+
+        return res;
+    }
+
+    void Store(SphericalHarmonics<Order>* p) const
+    {
+        float* f = reinterpret_cast<float*>(p);
+
+        for (size_t k = 0; k < Count; k++)
+            for (size_t ch = 0; ch < 3; ch++)
+                c[k][ch].Scatter(f + (k * 3) + ch, Stride);
+    }
+};
+
+/**
+ * @brief Per band linear maps which rotate coefficients
+ */
+struct SHRotation
+{
+    float band1[3][3];
+    float band2[5][5];
+};
+
+/**
+ * @brief Directions band 2 is sampled at to build its rotation, and the inverse
+ * of the basis evaluated there
+ *
+ * Any band 2 function is fixed by its values at 5 suitable directions, so
+ * rotating is resampling at the rotated directions and solving back.
+ */
+struct Band2Samples
+{
+    Vector3 directions[5];
+    float inverse[5][5];
+
+    Band2Samples()
+    {
+        constexpr float s = 0.707106781186548f;
+        Vector3 dirs[5] = {
+            Vector3(1.f, 0.f, 0.f),
+            Vector3(0.f, 0.f, 1.f),
+            Vector3(s, s, 0.f),
+            Vector3(s, 0.f, s),
+            Vector3(0.f, s, s)
+        };
+
+        // Gauss-Jordan on [A | I] in double, A[i][j] is basis j at direction i
+        double a[5][10] = {};
+        for (size_t i = 0; i < 5; i++)
+        {
+            directions[i] = dirs[i];
+
+            ScalarFloat y[9];
+            BasisLanes<3>(Vector3Lanes<ScalarFloat>::Load(&dirs[i]), y);
+
+            for (size_t j = 0; j < 5; j++)
+                a[i][j] = y[4 + j].v;
+
+            a[i][5 + i] = 1.0;
+        }
+
+        for (size_t col = 0; col < 5; col++)
+        {
+            size_t pivot = col;
+            for (size_t row = col + 1; row < 5; row++)
+                if (fabs(a[row][col]) > fabs(a[pivot][col]))
+                    pivot = row;
+
+            for (size_t j = 0; j < 10; j++)
+            {
+                double t = a[col][j];
+                a[col][j] = a[pivot][j];
+                a[pivot][j] = t;
+            }
+
+            double inv = 1.0 / a[col][col];
+            for (size_t j = 0; j < 10; j++)
+                a[col][j] *= inv;
+
+            for (size_t row = 0; row < 5; row++)
+            {
+                if (row == col)
+                    continue;
+
+                double f = a[row][col];
+                for (size_t j = 0; j < 10; j++)
+                    a[row][j] -= f * a[col][j];
+            }
+        }
+
+        for (size_t i = 0; i < 5; i++)
+            for (size_t j = 0; j < 5; j++)
+                inverse[i][j] = static_cast<float>(a[i][5 + j]);
+    }
+};
+
+/**
+ * @brief Maps taking f to f', where f'(R d) = f(d)
+ */
+SHRotation MakeRotation(const Matrix4x4& m)
+{
+    SHRotation rot = {};
+
+    // Band 1 is a vector in (y, z, x) order that rotates with R
+    constexpr size_t axis[3] = {1, 2, 0};
+    for (size_t j = 0; j < 3; j++)
+        for (size_t k = 0; k < 3; k++)
+            rot.band1[j][k] = m[axis[k]][axis[j]];
+
+    static const Band2Samples samples;
+
+    // b[i][k] is basis k at R^T n_i, the direction that R takes onto sample i
+    Vector3 col0 = Vector3(m[0]), col1 = Vector3(m[1]), col2 = Vector3(m[2]);
+
+    float b[5][5];
+    for (size_t i = 0; i < 5; i++)
+    {
+        const Vector3& n = samples.directions[i];
+        Vector3 d(col0.Dot(n), col1.Dot(n), col2.Dot(n));
+
+        ScalarFloat y[9];
+        BasisLanes<3>(Vector3Lanes<ScalarFloat>::Load(&d), y);
+
+        for (size_t k = 0; k < 5; k++)
+            b[i][k] = y[4 + k].v;
+    }
+
+    for (size_t j = 0; j < 5; j++)
+        for (size_t k = 0; k < 5; k++)
+        {
+            float sum = 0.f;
+            for (size_t i = 0; i < 5; i++)
+                sum = MulAdd(samples.inverse[j][i], b[i][k], sum);
+
+            rot.band2[j][k] = sum;
+        }
+
+    return rot;
+}
+
+template<typename F, size_t Order>
+SHLanes<F, Order> RotateLanes(const SHLanes<F, Order>& in, const SHRotation& rot)
+{
+    SHLanes<F, Order> out;
+
+    for (size_t ch = 0; ch < 3; ch++)
+    {
+        out.c[0][ch] = in.c[0][ch];
+
+        for (size_t j = 0; j < 3; j++)
+        {
+            F acc = F::Set(0.f);
+            for (size_t k = 0; k < 3; k++)
+                acc = MulAdd(F::Set(rot.band1[j][k]), in.c[1 + k][ch], acc);
+
+            out.c[1 + j][ch] = acc;
+        }
+
+        if constexpr (Order == 3)
+        {
+            for (size_t j = 0; j < 5; j++)
+            {
+                F acc = F::Set(0.f);
+                for (size_t k = 0; k < 5; k++)
+                    acc = MulAdd(F::Set(rot.band2[j][k]), in.c[4 + k][ch], acc);
+
+                out.c[4 + j][ch] = acc;
+            }
+        }
+    }
+
+    return out;
+}
+
+/**
+ * @brief Coefficients broadcast into every lane
+ */
+template<typename F, size_t Order>
+SHLanes<F, Order> Broadcast(const SphericalHarmonics<Order>& sh)
+{
+    SHLanes<F, Order> res;
+
+    for (size_t k = 0; k < Order * Order; k++)
+        for (size_t ch = 0; ch < 3; ch++)
+            res.c[k][ch] = F::Set(sh.coefficients[k][ch]);
+
+    return res;
+}
+
+template<typename F, size_t Order>
+Vector3Lanes<F> EvaluateLanes(const SHLanes<F, Order>& sh, const Vector3Lanes<F>& d)
+{
+    F y[Order * Order];
+    BasisLanes<Order>(d, y);
+
+    Vector3Lanes<F> res = {F::Set(0.f), F::Set(0.f), F::Set(0.f)};
+    for (size_t k = 0; k < Order * Order; k++)
+    {
+        res.x = MulAdd(y[k], sh.c[k][0], res.x);
+        res.y = MulAdd(y[k], sh.c[k][1], res.y);
+        res.z = MulAdd(y[k], sh.c[k][2], res.z);
+    }
+
+    return res;
+}
+
+/**
+ * @brief Accumulate weighted samples into per lane sums
+ */
+template<typename F, size_t Order>
+void ProjectLanes(SHLanes<F, Order>& acc, const Vector3Lanes<F>& d, const Vector3Lanes<F>& radiance, F weight)
+{
+    F y[Order * Order];
+    BasisLanes<Order>(d, y);
+
+    for (size_t k = 0; k < Order * Order; k++)
+    {
+        F wy = y[k] * weight;
+
+        acc.c[k][0] = MulAdd(wy, radiance.x, acc.c[k][0]);
+        acc.c[k][1] = MulAdd(wy, radiance.y, acc.c[k][1]);
+        acc.c[k][2] = MulAdd(wy, radiance.z, acc.c[k][2]);
+    }
+}
+
+} // namespace
+
+template<size_t Order>
+SphericalHarmonics<Order>::SphericalHarmonics()
+{}
+
+template<size_t Order>
+void SphericalHarmonics<Order>::AddSample(const Vector3& direction, const Vector3& radiance, float weight)
+{
+    SHLanes<ScalarFloat, Order> acc = SHLanes<ScalarFloat, Order>::Load(this);
+
+    ProjectLanes(acc, Vector3Lanes<ScalarFloat>::Load(&direction), Vector3Lanes<ScalarFloat>::Load(&radiance), ScalarFloat{weight});
+    acc.Store(this);
+}
+
+template<size_t Order>
+void SphericalHarmonics<Order>::AddSamples(const Vector3* directions, const Vector3* radiance, const float* weights, size_t count)
+{
+    size_t i = 0;
+
+    if (count >= kReduceLanes)
+    {
+        // kReduceLanes sums per coefficient whatever the lane type, so every build rounds alike
+        constexpr size_t kBlocks = kReduceLanes / SimdFloat::Width;
+
+        SHLanes<SimdFloat, Order> acc[kBlocks];
+        for (size_t b = 0; b < kBlocks; b++)
+            acc[b] = Broadcast<SimdFloat>(SphericalHarmonics());
+
+        for (; i + kReduceLanes <= count; i += kReduceLanes)
+            for (size_t b = 0; b < kBlocks; b++)
+            {
+                size_t j = i + (b * SimdFloat::Width);
+                ProjectLanes(acc[b], Vector3Lanes<SimdFloat>::Load(directions + j), Vector3Lanes<SimdFloat>::Load(radiance + j), SimdFloat::Load(weights + j));
+            }
+
+        // Fold the lanes in order
+        for (size_t k = 0; k < Count; k++)
+            for (size_t ch = 0; ch < 3; ch++)
+            {
+                float lanes[kReduceLanes];
+                for (size_t b = 0; b < kBlocks; b++)
+                    acc[b].c[k][ch].Store(lanes + (b * SimdFloat::Width));
+
+                for (size_t lane = 0; lane < kReduceLanes; lane++)
+                    coefficients[k][ch] += lanes[lane];
+            }
+    }
+
+    for (; i < count; i++)
+        AddSample(directions[i], radiance[i], weights[i]);
+}
+
+template<size_t Order>
+Vector3 SphericalHarmonics<Order>::Evaluate(const Vector3& direction) const
+{
+    Vector3 res;
+    EvaluateLanes(Broadcast<ScalarFloat>(*this), Vector3Lanes<ScalarFloat>::Load(&direction)).Store(&res);
+
+    return res;
+}
+
+template<size_t Order>
+void SphericalHarmonics<Order>::Evaluate(const Vector3* directions, Vector3* out, size_t count) const
+{
+    size_t i = 0;
+
+    SHLanes<SimdFloat, Order> sh = Broadcast<SimdFloat>(*this);
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        EvaluateLanes(sh, Vector3Lanes<SimdFloat>::Load(directions + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = Evaluate(directions[i]);
+}
+
+template<size_t Order>
+SphericalHarmonics<Order>& SphericalHarmonics<Order>::ConvolveCosine()
+{
+    // Ramamoorthi and Hanrahan, the clamped cosine's zonal coefficients scaled by sqrt(4pi / (2l + 1))
+    constexpr float band[3] = {kPi, 2.f * kPi / 3.f, kPi / 4.f};
+
+    for (size_t k = 0; k < Count; k++)
+    {
+        size_t l = (k == 0) ? 0 : ((k < 4) ? 1 : 2);
+        coefficients[k] *= band[l];
+    }
+
+    return *this;
+}
+
+template<size_t Order>
+SphericalHarmonics<Order> SphericalHarmonics<Order>::Rotated(const Quaternion& q) const
+{
+    // Columns of the rotation are the rotated axes
+    Vector3 x = q.Apply(Vector3(1.f, 0.f, 0.f));
+    Vector3 y = q.Apply(Vector3(0.f, 1.f, 0.f));
+    Vector3 z = q.Apply(Vector3(0.f, 0.f, 1.f));
+
+    return Rotated(Matrix4x4(Vector4(x, 0.f), Vector4(y, 0.f), Vector4(z, 0.f), Vector4(0.f, 0.f, 0.f, 1.f)));
+}
+
+template<size_t Order>
+SphericalHarmonics<Order> SphericalHarmonics<Order>::Rotated(const Matrix4x4& m) const
+{
+    SphericalHarmonics res;
+    Rotate(this, &res, 1, m);
+
+    return res;
+}
+
+template<size_t Order>
+void SphericalHarmonics<Order>::Rotate(const SphericalHarmonics* in, SphericalHarmonics* out, size_t count, const Matrix4x4& m)
+{
+    SHRotation rot = MakeRotation(m);
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        RotateLanes(SHLanes<SimdFloat, Order>::Load(in + i), rot).Store(out + i);
+
+    for (; i < count; i++)
+        RotateLanes(SHLanes<ScalarFloat, Order>::Load(in + i), rot).Store(out + i);
+}
+
+template<size_t Order>
+SphericalHarmonics<Order> SphericalHarmonics<Order>::operator+(const SphericalHarmonics& sh) const
+{
+    SphericalHarmonics res(*this);
+    return res += sh;
+}
+
+template<size_t Order>
+SphericalHarmonics<Order>& SphericalHarmonics<Order>::operator+=(const SphericalHarmonics& sh)
+{
+    for (size_t k = 0; k < Count; k++)
+        coefficients[k] += sh.coefficients[k];
+
+    return *this;
+}
+
+template<size_t Order>
+SphericalHarmonics<Order> SphericalHarmonics<Order>::operator*(float s) const
+{
+    SphericalHarmonics res(*this);
+    return res *= s;
+}
+
+template<size_t Order>
+SphericalHarmonics<Order>& SphericalHarmonics<Order>::operator*=(float s)
+{
+    for (size_t k = 0; k < Count; k++)
+        coefficients[k] *= s;
+
+    return *this;
+}
+
+template struct SphericalHarmonics<2>;
+template struct SphericalHarmonics<3>;
@@ -0,0 +1,251 @@
+#include "FMaths/TransformStream.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "Simd.h"
+
+namespace
+{
+
+size_t Floats(InstanceFormat format)
+{
+    return format == InstanceFormat::Full4x4 ? 16 : 12;
+}
+
+/**
+ * @brief Push r, joining it to the last range if at most gap instances apart
+ */
+void Append(std::vector<DirtyRange>& out, const DirtyRange& r, size_t gap)
+{
+    if (!out.empty() && r.begin <= out.back().end + gap)
+        out.back().end = std::max(out.back().end, r.end);
+    else
+        out.push_back(r);
+}
+
+/**
+ * @brief Merge two sorted range lists into out, which can't be either of them
+ */
+void Union(const std::vector<DirtyRange>& a, const std::vector<DirtyRange>& b, size_t gap, std::vector<DirtyRange>& out)
+{
+    out.clear();
+    size_t i = 0, j = 0;
+
+    while (i < a.size() || j < b.size())
+    {
+        if (j == b.size() || (i < a.size() && a[i].begin < b[j].begin))
+            Append(out, a[i++], gap);
+        else
+            Append(out, b[j++], gap);
+    }
+}
+
+/**
+ * @brief Bitwise compare of two matrices, stopping at the first lanes that differ
+ */
+bool Differs(const float* a, const float* b)
+{
+    for (size_t k = 0; k < 16; k += SimdFloat::Width)
+        if (BitsDiffer(SimdFloat::Load(a + k), SimdFloat::Load(b + k)))
+            return true;
+
+    return false;
+}
+
+void Encode(InstanceFormat format, const Matrix4x4* m, float* out, size_t begin, size_t end)
+{
+    const float* src = reinterpret_cast<const float*>(m + begin);
+
+    if (format == InstanceFormat::Full4x4)
+    {
+        memcpy(out + (16 * begin), src, 16 * sizeof(float) * (end - begin));
+        return;
+    }
+
+    float* dst = out + (12 * begin);
+
+    for (size_t i = begin; i < end; i++, src += 16, dst += 12)
+    {
+#ifdef FMATHS_SIMD_SSE
+        Float4 c0 = Float4::Load(src);
+        Float4 c1 = Float4::Load(src + 4);
+        Float4 c2 = Float4::Load(src + 8);
+        Float4 c3 = Float4::Load(src + 12);
+        Transpose(c0, c1, c2, c3);
+
+        c0.Store(dst);
+        c1.Store(dst + 4);
+        c2.Store(dst + 8);
+#else
+        for (size_t row = 0; row < 3; row++)
+            for (size_t col = 0; col < 4; col++)
+                dst[(row * 4) + col] = src[(col * 4) + row];
+#endif
+    }
+}
+
+} // namespace
+
+TransformStream::TransformStream(InstanceFormat format, size_t bufferCount, size_t mergeGap):
+    m_Format(format), m_MergeGap(mergeGap), m_Count(0), m_Index(0), m_Invalid(true)
+{
+    // Checked before anything is sized from bufferCount - 1, which would wrap
+    assert(bufferCount >= 1);
+
+    m_Index = bufferCount - 1;
+    m_Buffers.resize(bufferCount);
+    m_History.resize(bufferCount - 1);
+}
+
+void TransformStream::Update(const Matrix4x4* matrices, size_t count, const Executor& executor)
+{
+    bool invalid = m_Invalid || count != m_Count;
+
+    if (invalid)
+    {
+        m_Count = count;
+        m_Previous.resize(16 * count);
+
+        for (std::vector<float>& buffer : m_Buffers)
+            buffer.resize(Floats(m_Format) * count);
+
+        // Every other buffer is missing everything too
+        for (std::vector<DirtyRange>& ranges : m_History)
+        {
+            ranges.clear();
+            if (count != 0)
+                ranges.push_back({0, count});
+        }
+    }
+
+    // Instances this buffer missed while the others were written
+    m_Pending.clear();
+    for (const std::vector<DirtyRange>& ranges : m_History)
+    {
+        Union(m_Pending, ranges, 0, m_Scratch);
+        m_Pending.swap(m_Scratch);
+    }
+
+    m_Index = (m_Index + 1) % m_Buffers.size();
+    m_ChunkRanges.resize((count + kStreamChunkSize - 1) / kStreamChunkSize);
+
+    float* previous = m_Previous.data();
+    float* buffer = m_Buffers[m_Index].data();
+
+    // Diff then encode each chunk while its matrices are in cache
+    ParallelFor(count, kStreamChunkSize, executor, [this, matrices, previous, buffer, invalid](size_t begin, size_t end) {
+        std::vector<DirtyRange>& changed = m_ChunkRanges[begin / kStreamChunkSize];
+        changed.clear();
+
+        const float* src = reinterpret_cast<const float*>(matrices);
+
+        if (invalid)
+        {
+            memcpy(previous + (16 * begin), src + (16 * begin), 16 * sizeof(float) * (end - begin));
+            changed.push_back({begin, end});
+        }
+        else
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                if (Differs(previous + (16 * i), src + (16 * i)))
+                {
+                    memcpy(previous + (16 * i), src + (16 * i), 16 * sizeof(float));
+                    Append(changed, {i, i + 1}, 0);
+                }
+            }
+        }
+
+        // Both lists are sorted by begin, done skips what's already encoded where they overlap
+        auto pending = std::upper_bound(m_Pending.begin(), m_Pending.end(), begin,
+            [](size_t i, const DirtyRange& r) { return i < r.end; });
+        auto local = changed.begin();
+        size_t done = begin;
+
+        while (true)
+        {
+            bool morePending = pending != m_Pending.end() && pending->begin < end;
+            bool moreLocal = local != changed.end();
+
+            if (!morePending && !moreLocal)
+                break;
+
+            const DirtyRange& r = (!moreLocal || (morePending && pending->begin < local->begin)) ? *pending++ : *local++;
+            size_t first = std::max(r.begin, done);
+            size_t last = std::min(r.end, end);
+
+            if (first < last)
+            {
+                Encode(m_Format, matrices, buffer, first, last);
+                done = last;
+            }
+        }
+    });
+
+    // Chunk lists in order are sorted, ranges meet across chunk boundaries
+    m_Scratch.clear();
+    for (const std::vector<DirtyRange>& ranges : m_ChunkRanges)
+        for (const DirtyRange& r : ranges)
+            Append(m_Scratch, r, 0);
+
+    Union(m_Scratch, m_Pending, m_MergeGap, m_Dirty);
+
+    m_Changed.clear();
+    for (const DirtyRange& r : m_Scratch)
+        Append(m_Changed, r, m_MergeGap);
+
+    if (!m_History.empty())
+    {
+        std::rotate(m_History.begin(), m_History.begin() + 1, m_History.end());
+        m_History.back().assign(m_Scratch.begin(), m_Scratch.end());
+    }
+
+    m_Invalid = false;
+}
+
+void TransformStream::Invalidate()
+{
+    m_Invalid = true;
+}
+
+const float* TransformStream::Buffer() const
+{
+    return m_Buffers[m_Index].data();
+}
+
+size_t TransformStream::BufferIndex() const
+{
+    return m_Index;
+}
+
+size_t TransformStream::BufferCount() const
+{
+    return m_Buffers.size();
+}
+
+size_t TransformStream::Count() const
+{
+    return m_Count;
+}
+
+InstanceFormat TransformStream::Format() const
+{
+    return m_Format;
+}
+
+size_t TransformStream::Stride() const
+{
+    return Floats(m_Format) * sizeof(float);
+}
+
+const std::vector<DirtyRange>& TransformStream::DirtyRanges() const
+{
+    return m_Dirty;
+}
+
+const std::vector<DirtyRange>& TransformStream::ChangedRanges() const
+{
+    return m_Changed;
+}
@@ -6,34 +6,16 @@
 #include "FMaths/Vector3.h"
 #include "FMaths/Vector4.h"
 
-Vector2::Vector2():
-    x(0), y(0)
-{}
-
-Vector2::Vector2(float x, float y):
-    x(x), y(y)
-{}
-
-Vector2::Vector2(const Vector2 & v):
-    x(v.x), y(v.y)
-{}
-
-Vector2::Vector2(const Vector3 & v):
-    x(v.x), y(v.y)
-{}
-
-Vector2::Vector2(const Vector4 & v):
-    x(v.x), y(v.y)
-{}
+#include "Simd.h"
 
 float Vector2::Length() const
 {
-    return sqrtf((x * x) + (y * y));
+    return sqrtf(LengthSquared());
 }
 
 float Vector2::LengthSquared() const
 {
-    return (x * x) + (y * y);
+    return Dot(*this);
 }
 
 Vector2& Vector2::Normalize()
@@ -59,7 +41,7 @@ bool Vector2::IsNormalized() const
 
 float Vector2::Dot(const Vector2& v) const
 {
-    return (x * v.x) + (y * v.y);
+    return MulAdd(y, v.y, x * v.x);
 }
 
 Vector2 Vector2::operator+(const Vector2& v) const
@@ -124,15 +106,6 @@ bool Vector2::operator!=(const Vector2& v) const
     return (x != v.x) || (y != v.y);
 }
 
-Vector2& Vector2::operator=(const Vector2& v)
-{
-    assert(this != &v);
-
-    x = v.x;
-    y = v.y;
-    return *this;
-}
-
 float & Vector2::operator[](size_t i)
 {
     assert(i < 2);
@@ -6,34 +6,49 @@
 #include "FMaths/Vector2.h"
 #include "FMaths/Vector4.h"
 
-Vector3::Vector3():
-    x(0), y(0), z(0)
-{}
+#include "Kernels.h"
+#include "Hash.h"
 
-Vector3::Vector3(float x, float y, float z):
-    x(x), y(y), z(z)
-{}
+namespace
+{
+
+template<typename F>
+F DotLanes(const Vector3Lanes<F>& a, const Vector3Lanes<F>& b)
+{
+    return MulAdd(a.z, b.z, MulAdd(a.y, b.y, a.x * b.x));
+}
 
-Vector3::Vector3(const Vector2 & v, float z):
-    x(v.x), y(v.y), z(z)
-{}
+template<typename F>
+Vector3Lanes<F> NormalizeLanes(const Vector3Lanes<F>& v)
+{
+    // Same rule as IsNormalized, dividing rather than scaling by a reciprocal to match operator/
+    F len2 = DotLanes(v, v);
+    auto unit = Abs(len2 - F::Set(1.f)) <= F::Set(__FLT_EPSILON__);
+    F len = Select(unit, F::Set(1.f), Sqrt(len2));
 
-Vector3::Vector3(const Vector3& v):
-    x(v.x), y(v.y), z(v.z)
-{}
+    return {Select(unit, v.x, v.x / len), Select(unit, v.y, v.y / len), Select(unit, v.z, v.z / len)};
+}
 
-Vector3::Vector3(const Vector4& v):
-    x(v.x), y(v.y), z(v.z)
-{}
+template<typename F>
+Vector3Lanes<F> CrossLanes(const Vector3Lanes<F>& a, const Vector3Lanes<F>& b)
+{
+    return {
+        (a.y * b.z) - (a.z * b.y),
+        (a.z * b.x) - (a.x * b.z),
+        (a.x * b.y) - (a.y * b.x)
+    };
+}
+
+} // namespace
 
 float Vector3::Length() const
 {
-    return sqrtf(x*x + y*y + z*z);
+    return sqrtf(LengthSquared());
 }
 
 float Vector3::LengthSquared() const
 {
-    return x*x + y*y + z*z;
+    return Dot(*this);
 }
 
 Vector3& Vector3::Normalize()
@@ -63,9 +78,42 @@ bool Vector3::IsNormalized() const
     return fabsf(LengthSquared() - 1) <= __FLT_EPSILON__;
 }
 
+void Vector3::Normalize(Vector3* v, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        NormalizeLanes(Vector3Lanes<SimdFloat>::Load(v + i)).Store(v + i);
+
+    for (; i < count; i++)
+        v[i].Normalize();
+}
+
+void Vector3::Dot(const Vector3* a, const Vector3* b, float* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        DotLanes(Vector3Lanes<SimdFloat>::Load(a + i), Vector3Lanes<SimdFloat>::Load(b + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = a[i].Dot(b[i]);
+}
+
+void Vector3::Cross(const Vector3* a, const Vector3* b, Vector3* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + SimdFloat::Width <= count; i += SimdFloat::Width)
+        CrossLanes(Vector3Lanes<SimdFloat>::Load(a + i), Vector3Lanes<SimdFloat>::Load(b + i)).Store(out + i);
+
+    for (; i < count; i++)
+        out[i] = a[i].Cross(b[i]);
+}
+
 float Vector3::Dot(const Vector3& v) const
 {
-    return (x * v.x) + (y * v.y) + (z * v.z);
+    return MulAdd(z, v.z, MulAdd(y, v.y, x * v.x));
 }
 
 Vector3 Vector3::Cross(const Vector3 & v) const
@@ -144,14 +192,20 @@ bool Vector3::operator!=(const Vector3 & v) const
     return (x != v.x) || (y != v.y) || (z != v.z);
 }
 
-Vector3& Vector3::operator=(const Vector3& v)
+bool Vector3::ApproxEqual(const Vector3& v, float epsilon) const
 {
-    assert(this != &v);
+    return ::ApproxEqual(x, v.x, epsilon) && ::ApproxEqual(y, v.y, epsilon) && ::ApproxEqual(z, v.z, epsilon);
+}
 
-    x = v.x;
-    y = v.y;
-    z = v.z;
-    return *this;
+bool Vector3::UlpEqual(const Vector3& v, uint32_t maxUlps) const
+{
+    return ::UlpEqual(x, v.x, maxUlps) && ::UlpEqual(y, v.y, maxUlps) && ::UlpEqual(z, v.z, maxUlps);
+}
+
+size_t Vector3::QuantizedHash(float cellSize) const
+{
+    float inv = 1.f / cellSize;
+    return static_cast<size_t>(HashCell(QuantizeCell(x, inv), QuantizeCell(y, inv), QuantizeCell(z, inv)));
 }
 
 float& Vector3::operator[](size_t i)
@@ -6,34 +6,17 @@
 #include "FMaths/Vector2.h"
 #include "FMaths/Vector3.h"
 
-Vector4::Vector4():
-    x(0), y(0), z(0), w(0)
-{}
-
-Vector4::Vector4(float x, float y, float z, float w):
-    x(x), y(y), z(z), w(w)
-{}
-
-Vector4::Vector4(const Vector2 & v, float z, float w):
-    x(v.x), y(v.y), z(z), w(w)
-{}
-
-Vector4::Vector4(const Vector3 & v, float w):
-    x(v.x), y(v.y), z(v.z), w(w)
-{}
-
-Vector4::Vector4(const Vector4& v):
-    x(v.x), y(v.y), z(v.z), w(v.w)
-{}
+#include "Simd.h"
+#include "Hash.h"
 
 float Vector4::Length() const
 {
-    return sqrtf((x * x) + (y * y) + (z * z) + (w * w));
+    return sqrtf(LengthSquared());
 }
 
 float Vector4::LengthSquared() const
 {
-    return (x * x) + (y * y) + (z * z) + (w * w);
+    return Dot(*this);
 }
 
 bool Vector4::IsNormalized() const
@@ -59,7 +42,7 @@ Vector4 Vector4::Normalized() const
 
 float Vector4::Dot(const Vector4& v) const
 {
-    return (x * v.x) + (y * v.y) + (z * v.z) + (w * v.w);
+    return MulAdd(w, v.w, MulAdd(z, v.z, MulAdd(y, v.y, x * v.x)));
 }
 
 Vector4 Vector4::Cross(const Vector4 & v) const
@@ -141,16 +124,22 @@ bool Vector4::operator!=(const Vector4& v) const
     return (x != v.x) || (y != v.y) || (z != v.z) || (w != v.w);
 }
 
-Vector4& Vector4::operator=(const Vector4& v)
+bool Vector4::ApproxEqual(const Vector4& v, float epsilon) const
 {
-    // avoid self assignment
-    assert(this != &v);
-        
-    x = v.x;
-    y = v.y;
-    z = v.z;
-    w = v.w;
-    return *this;
+    return ::ApproxEqual(x, v.x, epsilon) && ::ApproxEqual(y, v.y, epsilon) &&
+           ::ApproxEqual(z, v.z, epsilon) && ::ApproxEqual(w, v.w, epsilon);
+}
+
+bool Vector4::UlpEqual(const Vector4& v, uint32_t maxUlps) const
+{
+    return ::UlpEqual(x, v.x, maxUlps) && ::UlpEqual(y, v.y, maxUlps) &&
+           ::UlpEqual(z, v.z, maxUlps) && ::UlpEqual(w, v.w, maxUlps);
+}
+
+size_t Vector4::QuantizedHash(float cellSize) const
+{
+    float inv = 1.f / cellSize;
+    return static_cast<size_t>(HashCell(QuantizeCell(x, inv), QuantizeCell(y, inv), QuantizeCell(z, inv), QuantizeCell(w, inv)));
 }
 
 float & Vector4::operator[](size_t i)
@@ -0,0 +1,192 @@
+#include "FMaths/Weld.h"
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+#include "Hash.h"
+
+namespace
+{
+
+constexpr uint32_t kEmpty = UINT32_MAX;
+constexpr size_t kPrefetchDistance = 16;
+
+/**
+ * @brief Occupied grid cell, heading a chain of the unique vertices inside it
+ */
+struct Cell
+{
+    int32_t x = 0, y = 0, z = 0;
+    uint32_t head = kEmpty;
+};
+
+/**
+ * @brief Open addressed table of cells, linear probing
+ */
+class CellTable
+{
+public:
+    explicit CellTable(size_t count)
+    {
+        // At most half full, so probes stay short
+        size_t capacity = 16;
+        while (capacity < count * 2)
+            capacity <<= 1;
+
+        m_Cells.resize(capacity);
+        m_Mask = capacity - 1;
+    }
+
+    /**
+     * @brief Start pulling the slot for x, y, z into cache
+     */
+    void Prefetch(int32_t x, int32_t y, int32_t z) const
+    {
+        __builtin_prefetch(&m_Cells[static_cast<size_t>(HashCell(x, y, z)) & m_Mask]);
+    }
+
+    /**
+     * @brief The cell at x, y, z, or the empty slot where it would go
+     */
+    Cell& Find(int32_t x, int32_t y, int32_t z)
+    {
+        size_t i = static_cast<size_t>(HashCell(x, y, z)) & m_Mask;
+
+        while (m_Cells[i].head != kEmpty && (m_Cells[i].x != x || m_Cells[i].y != y || m_Cells[i].z != z))
+            i = (i + 1) & m_Mask;
+
+        return m_Cells[i];
+    }
+
+private:
+    std::vector<Cell> m_Cells;
+    size_t m_Mask;
+};
+
+/**
+ * @brief Bit pattern of v with -0 folded onto +0, so positions compare equal exactly when their keys do
+ */
+int32_t ExactKey(float v)
+{
+    int32_t bits = 0;
+    if (v != 0.f)
+        memcpy(&bits, &v, sizeof(bits));
+
+    return bits;
+}
+
+/**
+ * @brief Merge only identical positions, keyed on their bits rather than cells so any spacing stays linear
+ */
+size_t WeldExact(const Vector3* vertices, size_t count, uint32_t* remap, Vector3* unique)
+{
+    CellTable table(count);
+    size_t uniqueCount = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (i + kPrefetchDistance < count)
+        {
+            const Vector3& ahead = vertices[i + kPrefetchDistance];
+            table.Prefetch(ExactKey(ahead.x), ExactKey(ahead.y), ExactKey(ahead.z));
+        }
+
+        Vector3 p = vertices[i];
+
+        // NaN equals nothing, as with the distance test
+        if (p.x != p.x || p.y != p.y || p.z != p.z)
+        {
+            unique[uniqueCount] = p;
+            remap[i] = static_cast<uint32_t>(uniqueCount++);
+            continue;
+        }
+
+        int32_t x = ExactKey(p.x), y = ExactKey(p.y), z = ExactKey(p.z);
+        Cell& cell = table.Find(x, y, z);
+
+        if (cell.head == kEmpty)
+        {
+            cell.x = x;
+            cell.y = y;
+            cell.z = z;
+            cell.head = static_cast<uint32_t>(uniqueCount++);
+            unique[cell.head] = p;
+        }
+
+        remap[i] = cell.head;
+    }
+
+    return uniqueCount;
+}
+
+} // namespace
+
+size_t WeldVertices(const Vector3* vertices, size_t count, float tolerance, uint32_t* remap, Vector3* unique)
+{
+    assert(count < kEmpty);
+
+    if (!(tolerance > 0.f))
+        return WeldExact(vertices, count, remap, unique);
+
+    float tolerance2 = tolerance * tolerance;
+    float offset = tolerance;
+    // Cells twice the tolerance keep chains short on dense meshes, the
+    // sphere then touches at most two cells along each axis
+    float inv = 0.5f / tolerance;
+
+    CellTable table(count);
+    std::vector<uint32_t> next(count);
+    size_t uniqueCount = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // Table lookups are cache misses for large meshes, request them ahead of time
+        if (i + kPrefetchDistance < count)
+        {
+            const Vector3& ahead = vertices[i + kPrefetchDistance];
+            table.Prefetch(QuantizeCell(ahead.x, inv), QuantizeCell(ahead.y, inv), QuantizeCell(ahead.z, inv));
+        }
+
+        Vector3 p = vertices[i];
+
+        int32_t lo[3], hi[3];
+        for (size_t axis = 0; axis < 3; axis++)
+        {
+            lo[axis] = QuantizeCell(p[axis] - offset, inv);
+            hi[axis] = QuantizeCell(p[axis] + offset, inv);
+        }
+
+        // Earliest unique vertex within tolerance, from every cell the tolerance sphere touches
+        uint32_t match = kEmpty;
+
+        for (int32_t x = lo[0]; x <= hi[0]; x++)
+            for (int32_t y = lo[1]; y <= hi[1]; y++)
+                for (int32_t z = lo[2]; z <= hi[2]; z++)
+                    for (uint32_t u = table.Find(x, y, z).head; u != kEmpty; u = next[u])
+                        if (u < match && (unique[u] - p).LengthSquared() <= tolerance2)
+                            match = u;
+
+        if (match == kEmpty)
+        {
+            match = static_cast<uint32_t>(uniqueCount++);
+            unique[match] = p;
+
+            int32_t x = QuantizeCell(p.x, inv);
+            int32_t y = QuantizeCell(p.y, inv);
+            int32_t z = QuantizeCell(p.z, inv);
+
+            Cell& cell = table.Find(x, y, z);
+            cell.x = x;
+            cell.y = y;
+            cell.z = z;
+
+            next[match] = cell.head;
+            cell.head = match;
+        }
+
+        remap[i] = match;
+    }
+
+    return uniqueCount;
+}
@@ -0,0 +1,331 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Animation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+// Not a multiple of any lane width, so the scalar tail runs too
+constexpr size_t kJoints = 37;
+constexpr float kDuration = 4.f;
+
+struct Track
+{
+    std::vector<float> times;
+    std::vector<Vector3> translations;
+    std::vector<Quaternion> rotations;
+    std::vector<Vector3> scales;
+};
+
+std::vector<Track> RandomTracks(unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::uniform_int_distribution<size_t> keys(0, 9);
+
+    std::vector<Track> tracks(kJoints);
+
+    for (Track& track : tracks)
+    {
+        // Uneven spacing, some tracks empty or with a single key
+        size_t count = keys(rng);
+        float t = dist(rng) * 0.25f;
+
+        for (size_t k = 0; k < count; k++)
+        {
+            track.times.push_back(t);
+            track.translations.emplace_back(dist(rng) * 5.f, dist(rng) * 5.f, dist(rng) * 5.f);
+            track.rotations.emplace_back(Vector3(dist(rng), dist(rng), dist(rng) + 2.f), dist(rng) * 6.f);
+            track.scales.emplace_back(1.f + dist(rng) * 0.5f, 1.f + dist(rng) * 0.5f, 1.f + dist(rng) * 0.5f);
+
+            t += 0.05f + (dist(rng) + 1.f) * 0.4f;
+        }
+    }
+
+    return tracks;
+}
+
+AnimationClip MakeClip(const std::vector<Track>& tracks)
+{
+    AnimationClip clip(tracks.size(), kDuration);
+
+    // Set out of order and replace some tracks, so the offsets are rewritten
+    for (size_t j = tracks.size(); j-- > 0;)
+    {
+        const Track& track = tracks[j];
+        clip.SetTranslations(j, track.times.data(), track.translations.data(), track.times.size());
+        clip.SetRotations(j, track.times.data(), track.rotations.data(), track.times.size());
+
+        if (j % 3 == 0)
+            clip.SetScales(j, track.times.data(), track.scales.data(), track.times.size());
+    }
+
+    for (size_t j = 0; j < tracks.size(); j++)
+        clip.SetScales(j, tracks[j].times.data(), tracks[j].scales.data(), tracks[j].times.size());
+
+    return clip;
+}
+
+/**
+ * @brief Binary search and interpolate one joint the straightforward way
+ */
+void NaiveSample(const Track& track, float time, Vector3& translation, Quaternion& rotation, Vector3& scale)
+{
+    if (track.times.empty())
+    {
+        translation = Vector3();
+        rotation = Quaternion();
+        scale = Vector3(1.f, 1.f, 1.f);
+        return;
+    }
+
+    size_t last = track.times.size() - 1;
+    size_t b = static_cast<size_t>(std::upper_bound(track.times.begin(), track.times.end(), time) - track.times.begin());
+
+    if (b == 0 || b > last)
+    {
+        size_t k = (b == 0) ? 0 : last;
+        translation = track.translations[k];
+        rotation = track.rotations[k];
+        scale = track.scales[k];
+        return;
+    }
+
+    size_t a = b - 1;
+    float alpha = (time - track.times[a]) / (track.times[b] - track.times[a]);
+
+    translation = track.translations[a] + ((track.translations[b] - track.translations[a]) * alpha);
+    scale = track.scales[a] + ((track.scales[b] - track.scales[a]) * alpha);
+
+    Quaternion qa = track.rotations[a];
+    Quaternion qb = track.rotations[b];
+    if (qa.Dot(qb) < 0.f)
+        qb = qb * -1.f;
+
+    rotation = qa + ((qb - qa) * alpha);
+    rotation.Normalize();
+}
+
+void CheckApprox(const Vector3& a, const Vector3& b, float margin = 1e-4f)
+{
+    CHECK(a.x == Approx(b.x).margin(margin));
+    CHECK(a.y == Approx(b.y).margin(margin));
+    CHECK(a.z == Approx(b.z).margin(margin));
+}
+
+void CheckPose(const Pose& pose, const std::vector<Track>& tracks, float time)
+{
+    REQUIRE(pose.JointCount() == tracks.size());
+
+    for (size_t j = 0; j < tracks.size(); j++)
+    {
+        Vector3 translation, scale;
+        Quaternion rotation;
+        NaiveSample(tracks[j], time, translation, rotation, scale);
+
+        CheckApprox(pose.Translation(j), translation);
+        CheckApprox(pose.Scale(j), scale);
+
+        Quaternion q = pose.Rotation(j);
+        CHECK(q.Dot(rotation) == Approx(1.f).margin(1e-5));
+        CHECK(q.Magnitude() == Approx(1.f).margin(1e-5));
+    }
+}
+
+bool BitwiseEqual(const Pose& a, const Pose& b)
+{
+    const std::vector<float>* fa[] = {&a.tx, &a.ty, &a.tz, &a.rx, &a.ry, &a.rz, &a.rw, &a.sx, &a.sy, &a.sz};
+    const std::vector<float>* fb[] = {&b.tx, &b.ty, &b.tz, &b.rx, &b.ry, &b.rz, &b.rw, &b.sx, &b.sy, &b.sz};
+
+    for (size_t k = 0; k < 10; k++)
+        if (fa[k]->size() != fb[k]->size() || std::memcmp(fa[k]->data(), fb[k]->data(), fa[k]->size() * sizeof(float)) != 0)
+            return false;
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Clips store each joint's tracks contiguously", "[Animation]")
+{
+    std::vector<Track> tracks = RandomTracks(1);
+    AnimationClip clip = MakeClip(tracks);
+
+    CHECK(clip.JointCount() == kJoints);
+    CHECK(clip.duration == kDuration);
+
+    for (size_t j = 0; j < kJoints; j++)
+    {
+        REQUIRE(clip.rotations.KeyCount(j) == tracks[j].times.size());
+
+        for (size_t k = 0; k < tracks[j].times.size(); k++)
+        {
+            size_t i = clip.rotations.offsets[j] + k;
+            CHECK(clip.rotations.times[i] == tracks[j].times[k]);
+            CHECK(clip.rotations.w[i] == tracks[j].rotations[k].w);
+            CHECK(clip.scales.x[clip.scales.offsets[j] + k] == tracks[j].scales[k].x);
+        }
+    }
+
+    CHECK(clip.translations.times.size() == clip.translations.x.size());
+    CHECK(clip.translations.w.empty());
+}
+
+TEST_CASE("Sampling matches a binary search and interpolation per joint", "[Animation]")
+{
+    std::vector<Track> tracks = RandomTracks(2);
+    AnimationClip clip = MakeClip(tracks);
+
+    PoseSampler sampler(clip);
+    Pose pose;
+
+    // Forward playback, including before the start and past the end, which clamp to the clip
+    for (float time = -0.5f; time < kDuration + 1.f; time += 1.f / 60.f)
+    {
+        sampler.Sample(time, pose);
+        CheckPose(pose, tracks, std::clamp(time, 0.f, kDuration));
+    }
+
+    // Backwards and random jumps search again
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-1.f, kDuration + 1.f);
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        float time = dist(rng);
+        sampler.Sample(time, pose);
+        CheckPose(pose, tracks, std::clamp(time, 0.f, kDuration));
+    }
+
+    // Looping wraps back to the start, and negative times wrap from the end
+    for (float time = -kDuration; time < 3.f * kDuration; time += 0.1f)
+    {
+        float local = std::fmod(time, kDuration);
+        if (local < 0.f)
+            local += kDuration;
+
+        sampler.Sample(time, pose, true);
+        CheckPose(pose, tracks, local);
+    }
+}
+
+TEST_CASE("Clip time is clamped or wrapped to the duration", "[Animation]")
+{
+    AnimationClip clip(1, 2.f);
+
+    REQUIRE(clip.ClipTime(-1.f, false) == 0.f);
+    REQUIRE(clip.ClipTime(0.5f, false) == 0.5f);
+    REQUIRE(clip.ClipTime(3.f, false) == 2.f);
+
+    REQUIRE(clip.ClipTime(2.5f, true) == 0.5f);
+    REQUIRE(clip.ClipTime(-0.5f, true) == 1.5f);
+    REQUIRE(clip.ClipTime(4.f, true) == 0.f);
+
+    REQUIRE(std::isnan(clip.ClipTime(NAN, false)));
+    REQUIRE(std::isnan(clip.ClipTime(NAN, true)));
+    REQUIRE(AnimationClip(1, 0.f).ClipTime(1.f, true) == 0.f);
+
+    // A key past the end is never reached, playback holds at the duration
+    const float times[] = {0.f, 2.f, 3.f};
+    const Vector3 keys[] = {Vector3(0.f, 0.f, 0.f), Vector3(2.f, 0.f, 0.f), Vector3(3.f, 0.f, 0.f)};
+    clip.SetTranslations(0, times, keys, 3);
+
+    PoseSampler sampler(clip);
+    Pose pose;
+
+    sampler.Sample(2.5f, pose);
+    REQUIRE(pose.Translation(0).x == 2.f);
+
+    sampler.Sample(2.5f, pose, true);
+    REQUIRE(pose.Translation(0).x == Approx(0.5f));
+}
+
+TEST_CASE("Cursors give the same pose as a fresh search", "[Animation]")
+{
+    std::vector<Track> tracks = RandomTracks(4);
+    AnimationClip clip = MakeClip(tracks);
+
+    PoseSampler playing(clip);
+    Pose a, b;
+
+    for (float time = -0.25f; time < kDuration + 0.5f; time += 0.01f)
+    {
+        playing.Sample(time, a);
+
+        PoseSampler fresh(clip);
+        fresh.Sample(time, b);
+
+        CHECK(BitwiseEqual(a, b));
+    }
+
+    playing.Reset();
+    playing.Sample(1.f, a);
+
+    PoseSampler fresh(clip);
+    fresh.Sample(1.f, b);
+    CHECK(BitwiseEqual(a, b));
+
+    // A key time gives the key exactly
+    playing.Sample(tracks[0].times.empty() ? 0.f : tracks[0].times[0], a);
+    if (!tracks[0].times.empty())
+        CHECK(a.tx[0] == tracks[0].translations[0].x);
+
+    Pose nan;
+    playing.Sample(NAN, nan);
+    for (size_t j = 0; j < kJoints; j++)
+        CHECK(nan.Rotation(j).Magnitude() == Approx(1.f).margin(1e-5));
+}
+
+TEST_CASE("Local matrices compose translation, rotation and scale", "[Animation]")
+{
+    std::vector<Track> tracks = RandomTracks(5);
+    AnimationClip clip = MakeClip(tracks);
+
+    PoseSampler sampler(clip);
+    Pose pose;
+    sampler.Sample(1.3f, pose);
+
+    std::vector<Matrix4x4> local(kJoints);
+    LocalMatrices(pose, local.data());
+
+    for (size_t j = 0; j < kJoints; j++)
+    {
+        Quaternion q = pose.Rotation(j);
+        Matrix4x4 expected = Matrix4x4::Translate(pose.Translation(j)) * Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w)) *
+            Matrix4x4::Scale(pose.Scale(j));
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                CHECK(local[j][col][row] == Approx(expected[col][row]).margin(1e-5));
+    }
+
+    // A chain, a second root and a branch
+    std::vector<int32_t> parents(kJoints);
+    for (size_t j = 0; j < kJoints; j++)
+        parents[j] = static_cast<int32_t>(j) - 1;
+
+    parents[10] = -1;
+    parents[20] = 12;
+
+    std::vector<Matrix4x4> model(kJoints);
+    ModelMatrices(local.data(), parents.data(), kJoints, model.data());
+
+    for (size_t j = 0; j < kJoints; j++)
+    {
+        Matrix4x4 expected = local[j];
+        for (int32_t p = parents[j]; p >= 0; p = parents[p])
+            expected = local[p] * expected;
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                CHECK(model[j][col][row] == Approx(expected[col][row]).margin(1e-3));
+    }
+}
@@ -0,0 +1,228 @@
+#include <catch2/catch_test_macros.hpp>
+#include <FMaths/Async.h>
+#include <FMaths/Geometry.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Quaternion.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Not a multiple of the chunk size, so the last chunk is short
+constexpr size_t kCount = (3 * BatchPipeline::kDefaultChunkSize) + 77;
+
+std::vector<Matrix4x4> RandomMatrices(std::mt19937& rng, size_t count)
+{
+    std::uniform_real_distribution<float> dist(-2.f, 2.f);
+    std::vector<Matrix4x4> res(count);
+
+    for (Matrix4x4& m : res)
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                m[col][row] = dist(rng);
+
+    return res;
+}
+
+std::vector<Vector3> RandomVectors(std::mt19937& rng, size_t count)
+{
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+    std::vector<Vector3> res(count);
+
+    for (Vector3& v : res)
+        v = Vector3(dist(rng), dist(rng), dist(rng));
+
+    return res;
+}
+
+} // namespace
+
+TEST_CASE("Async kernels match the synchronous ones", "[Async]")
+{
+    std::mt19937 rng(3);
+    std::vector<Matrix4x4> a = RandomMatrices(rng, kCount), b = RandomMatrices(rng, kCount);
+    std::vector<Vector3> v = RandomVectors(rng, kCount);
+    std::vector<Quaternion> q(kCount);
+    for (size_t i = 0; i < kCount; i++)
+        q[i] = Quaternion::FromEuler(v[(i * 7) % kCount]);
+
+    std::vector<Matrix4x4> product(kCount), inverse(kCount);
+    std::vector<Vector3> rotated(kCount), rotatedEach(kCount);
+    Matrix4x4::Multiply(a.data(), b.data(), product.data(), kCount);
+    Matrix4x4::Inverse(a.data(), inverse.data(), kCount);
+    q[0].Apply(v.data(), rotated.data(), kCount);
+    Quaternion::Apply(q.data(), v.data(), rotatedEach.data(), kCount);
+
+    ThreadPool pool(4);
+
+    for (const Executor& executor : {InlineExecutor(), pool.GetExecutor()})
+    {
+        std::vector<Matrix4x4> asyncProduct(kCount), asyncInverse(kCount);
+        std::vector<Vector3> asyncRotated(kCount), asyncRotatedEach(kCount);
+
+        std::vector<BatchHandle> handles = {
+            MultiplyAsync(a.data(), b.data(), asyncProduct.data(), kCount, executor),
+            InverseAsync(a.data(), asyncInverse.data(), kCount, executor),
+            ApplyAsync(q[0], v.data(), asyncRotated.data(), kCount, executor),
+            ApplyAsync(q.data(), v.data(), asyncRotatedEach.data(), kCount, executor),
+        };
+
+        for (const BatchHandle& handle : handles)
+        {
+            handle.Wait();
+            REQUIRE(handle.Ready());
+        }
+
+        for (size_t i = 0; i < kCount; i++)
+        {
+            REQUIRE(asyncProduct[i] == product[i]);
+            REQUIRE(asyncInverse[i] == inverse[i]);
+            REQUIRE(asyncRotated[i] == rotated[i]);
+            REQUIRE(asyncRotatedEach[i] == rotatedEach[i]);
+        }
+    }
+}
+
+TEST_CASE("Pipelined stages", "[Async]")
+{
+    std::mt19937 rng(4);
+    std::vector<Vector3> v = RandomVectors(rng, kCount);
+    Quaternion q = Quaternion::FromEuler(Vector3(0.5f, 1.2f, -0.3f));
+    Plane plane(Vector3(0.f, 1.f, 0.f), Vector3(0.f, 2.f, 0.f));
+
+    // Transform, cull against a plane, then pack the survivors' heights
+    std::vector<Vector3> rotated(kCount);
+    std::vector<uint8_t> visible(kCount);
+    std::vector<float> packed(kCount);
+
+    ThreadPool pool(3);
+    BatchHandle handle = BatchPipeline(kCount, 500)
+        .Then(ApplyStage(q, v.data(), rotated.data()))
+        .Then([&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                visible[i] = plane.SignedDistance(rotated[i]) >= 0.f;
+        })
+        .Then([&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                packed[i] = visible[i] ? rotated[i].y : 0.f;
+        })
+        .Run(pool.GetExecutor());
+
+    handle.Wait();
+
+    std::vector<Vector3> reference(kCount);
+    q.Apply(v.data(), reference.data(), kCount);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        const Vector3& expected = reference[i];
+        bool inside = plane.SignedDistance(expected) >= 0.f;
+
+        REQUIRE(rotated[i] == expected);
+        REQUIRE(visible[i] == inside);
+        REQUIRE(packed[i] == (inside ? expected.y : 0.f));
+    }
+}
+
+TEST_CASE("Chaining batches", "[Async]")
+{
+    std::mt19937 rng(5);
+    std::vector<Matrix4x4> a = RandomMatrices(rng, kCount), b = RandomMatrices(rng, kCount);
+    std::vector<Matrix4x4> product(kCount), inverse(kCount), expected(kCount);
+
+    Matrix4x4::Multiply(a.data(), b.data(), expected.data(), kCount);
+    Matrix4x4::Inverse(expected.data(), expected.data(), kCount);
+
+    ThreadPool pool(4);
+    Executor executor = pool.GetExecutor();
+
+    // The second batch reads every element the first writes, so must wait for all of them
+    BatchHandle first = BatchPipeline(kCount).Then(MultiplyStage(a.data(), b.data(), product.data())).Run(executor);
+    BatchHandle second = BatchPipeline(kCount).Then(InverseStage(product.data(), inverse.data())).Run(executor, first);
+
+    std::atomic<int> continuations(0);
+    second.Then([&]() { continuations++; });
+
+    second.Wait();
+    REQUIRE(first.Ready());
+
+    for (size_t i = 0; i < kCount; i++)
+        REQUIRE(inverse[i] == expected[i]);
+
+    // Continuations run once, immediately when already complete
+    second.Then([&]() { continuations++; });
+    REQUIRE(continuations == 2);
+}
+
+TEST_CASE("Continuations added while others run are queued", "[Async]")
+{
+    ThreadPool pool(1);
+    std::atomic<bool> started(false), release(false), secondRan(false);
+    std::vector<int> order;
+
+    BatchHandle handle = BatchPipeline(1).Run(pool.GetExecutor());
+    handle.Then([&]() {
+        started = true;
+        while (!release)
+            std::this_thread::yield();
+        order.push_back(1);
+    });
+
+    while (!started)
+        std::this_thread::yield();
+
+    // Every chunk is done but the first continuation hasn't returned, so this one must wait for it
+    REQUIRE_FALSE(handle.Ready());
+    handle.Then([&]() {
+        order.push_back(2);
+        secondRan = true;
+    });
+    REQUIRE_FALSE(secondRan);
+
+    release = true;
+    handle.Wait();
+    REQUIRE(secondRan);
+    REQUIRE(order == std::vector<int>{1, 2});
+}
+
+TEST_CASE("ParallelFor covers every element once", "[Async]")
+{
+    ThreadPool pool(4);
+    std::vector<int> visits(kCount, 0);
+    std::vector<size_t> chunkEnd((kCount + 99) / 100, 0);
+
+    // Catch's assertions aren't thread safe, so only record from the tasks
+    ParallelFor(kCount, 100, pool.GetExecutor(), [&](size_t begin, size_t end) {
+        chunkEnd[begin / 100] = end;
+
+        for (size_t i = begin; i < end; i++)
+            visits[i]++;
+    });
+
+    for (size_t i = 0; i < kCount; i++)
+        REQUIRE(visits[i] == 1);
+
+    for (size_t c = 0; c < chunkEnd.size(); c++)
+        REQUIRE(chunkEnd[c] == std::min(kCount, (c + 1) * 100));
+
+    ParallelFor(0, 100, pool.GetExecutor(), [](size_t, size_t) { FAIL("Ran with nothing to do"); });
+}
+
+TEST_CASE("Empty batches complete", "[Async]")
+{
+    REQUIRE(BatchHandle().Ready());
+
+    BatchHandle handle = BatchPipeline(0).Then([](size_t, size_t) { FAIL("Stage ran on an empty batch"); }).Run(InlineExecutor());
+    REQUIRE(handle.Ready());
+
+    ThreadPool pool(1);
+    BatchHandle after = BatchPipeline(0).Run(pool.GetExecutor(), handle);
+    after.Wait();
+    REQUIRE(after.Ready());
+}
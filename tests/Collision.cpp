@@ -0,0 +1,262 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Collision.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+Quaternion RandomRotation(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+    Vector3 axis;
+    do
+        axis = Vector3(dist(rng), dist(rng), dist(rng));
+    while (axis.LengthSquared() < 0.01f);
+
+    return Quaternion(axis.Normalized(), dist(rng) * 3.14159265f);
+}
+
+OBB ToOBB(const Vector3& centre, const Quaternion& q, const Vector3& halfExtents)
+{
+    return OBB(centre, q.Apply(Vector3(1.f, 0.f, 0.f)), q.Apply(Vector3(0.f, 1.f, 0.f)), q.Apply(Vector3(0.f, 0.f, 1.f)), halfExtents);
+}
+
+bool Equal(const Contact& a, const Contact& b)
+{
+    return a.distance == b.distance && a.normal.x == b.normal.x && a.normal.y == b.normal.y && a.normal.z == b.normal.z &&
+           a.pointA.x == b.pointA.x && a.pointA.y == b.pointA.y && a.pointA.z == b.pointA.z && a.pointB.x == b.pointB.x &&
+           a.pointB.y == b.pointB.y && a.pointB.z == b.pointB.z;
+}
+
+} // namespace
+
+TEST_CASE("GJK finds distances and EPA penetration of rounded shapes", "[Collision]")
+{
+    ConvexShape a = ConvexShape::Sphere(1.f);
+    ConvexShape b = ConvexShape::Sphere(0.5f);
+    b.SetTransform(Vector3(3.f, 0.f, 0.f), Quaternion());
+
+    Contact c = Collide(a, b);
+    CHECK(c.distance == Approx(1.5f));
+    CHECK(c.normal.x == Approx(1.f));
+    CHECK(c.pointA.x == Approx(1.f));
+    CHECK(c.pointB.x == Approx(2.5f));
+    CHECK_FALSE(Overlap(a, b));
+
+    // Overlapping radii, the cores are still apart
+    b.SetTransform(Vector3(0.f, 1.2f, 0.f), Quaternion());
+    c = Collide(a, b);
+    CHECK(c.distance == Approx(-0.3f));
+    CHECK(c.normal.y == Approx(1.f));
+    CHECK(Overlap(a, b));
+
+    // Capsules crossing at right angles, the closest points are their centres
+    ConvexShape capsule = ConvexShape::Capsule(2.f, 0.25f);
+    ConvexShape other = ConvexShape::Capsule(2.f, 0.25f);
+    other.SetTransform(Vector3(0.f, 0.f, 1.f), Quaternion(Vector3(0.f, 0.f, 1.f), 1.57079633f));
+
+    c = Collide(capsule, other);
+    CHECK(c.distance == Approx(0.5f));
+    CHECK(c.normal.z == Approx(1.f));
+    CHECK(c.pointA.z == Approx(0.25f));
+
+    // Coincident segment cores have no volume, so the depth is the radii
+    other.SetTransform(Vector3(), Quaternion());
+    c = Collide(capsule, other);
+    CHECK(c.distance == Approx(-0.5f));
+    CHECK(std::fabs(c.normal.y) < 0.01f);
+
+    // As do coincident spheres
+    ConvexShape unit = ConvexShape::Sphere(1.f);
+    c = Collide(unit, unit);
+    CHECK(c.distance == Approx(-2.f));
+    CHECK(c.pointA.x - c.pointB.x == Approx(2.f * c.normal.x));
+
+    // Overlapping cores go through EPA, the radii are added to its depth exactly
+    ConvexShape rounded = ConvexShape::Box(Vector3(1.f, 1.f, 1.f), 0.25f);
+    ConvexShape cube = ConvexShape::Box(Vector3(1.f, 1.f, 1.f));
+    cube.SetTransform(Vector3(1.5f, 0.f, 0.f), Quaternion());
+
+    c = Collide(rounded, cube);
+    CHECK(c.distance == Approx(-0.75f));
+    CHECK(c.normal.x == Approx(1.f));
+    CHECK(c.pointA.x == Approx(1.25f));
+    CHECK(c.pointB.x == Approx(0.5f));
+
+    // A box against a sphere over one face
+    ConvexShape box = ConvexShape::Box(Vector3(1.f, 2.f, 3.f));
+    ConvexShape sphere = ConvexShape::Sphere(0.5f);
+    sphere.SetTransform(Vector3(0.f, 2.25f, 0.f), Quaternion());
+
+    c = Collide(box, sphere);
+    CHECK(c.distance == Approx(-0.25f).margin(1e-3));
+    CHECK(c.normal.y == Approx(1.f).margin(1e-3));
+    CHECK(c.pointA.y == Approx(2.f).margin(1e-3));
+
+    sphere.SetTransform(Vector3(2.f, 3.f, 0.f), Quaternion());
+    c = Collide(box, sphere);
+    CHECK(c.distance == Approx(std::sqrt(2.f) - 0.5f));
+
+    // A tetrahedron hull
+    const Vector3 points[] = {Vector3(0.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f)};
+    ConvexShape hull = ConvexShape::Hull(points, 4);
+    sphere.SetTransform(Vector3(1.f, 1.f, 1.f), Quaternion());
+
+    // Distance from the slanted face x + y + z = 1
+    c = Collide(hull, sphere);
+    CHECK(c.distance == Approx((2.f / std::sqrt(3.f)) - 0.5f));
+    CHECK(c.normal.x == Approx(1.f / std::sqrt(3.f)));
+
+    sphere.SetTransform(Vector3(-1.f, -1.f, -1.f), Quaternion());
+    CHECK(Collide(hull, sphere).distance == Approx(std::sqrt(3.f) - 0.5f));
+    CHECK(Collide(sphere, hull).normal.x == Approx(1.f / std::sqrt(3.f)));
+}
+
+TEST_CASE("EPA and SAT agree on the penetration of boxes", "[Collision]")
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(-1.5f, 1.5f);
+    std::uniform_real_distribution<float> size(0.3f, 1.f);
+
+    size_t overlapping = 0;
+
+    for (size_t k = 0; k < 200; k++)
+    {
+        Vector3 ea(size(rng), size(rng), size(rng)), eb(size(rng), size(rng), size(rng));
+        Vector3 pa(position(rng), position(rng), position(rng)), pb(position(rng), position(rng), position(rng));
+        Quaternion qa = RandomRotation(rng), qb = RandomRotation(rng);
+
+        ConvexShape a = ConvexShape::Box(ea);
+        ConvexShape b = ConvexShape::Box(eb);
+        a.SetTransform(pa, qa);
+        b.SetTransform(pb, qb);
+
+        Contact gjk = Collide(a, b);
+        Contact sat = Collide(ToOBB(pa, qa, ea), ToOBB(pb, qb, eb));
+
+        // SAT's separation is a lower bound on the distance
+        CHECK(Overlap(a, b) == (sat.distance < 0.f));
+        CHECK(sat.distance <= gjk.distance + 1e-3f);
+
+        // EPA's depth is the minimum, SAT's at most 5% deeper from preferring face axes
+        if (sat.distance < 0.f)
+        {
+            overlapping++;
+            CHECK(gjk.distance <= (sat.distance * 0.95f) + 1e-3f);
+        }
+
+        // The normal separates a from b, and the witness points are gjk.distance apart along it
+        CHECK(gjk.normal.Dot(pb - pa) >= -1e-3f);
+        CHECK((gjk.pointB - gjk.pointA).Dot(gjk.normal) == Approx(gjk.distance).margin(2e-3));
+
+        CHECK(sat.normal.Dot(pb - pa) >= 0.f);
+        CHECK(sat.normal.Length() == Approx(1.f));
+    }
+
+    CHECK(overlapping > 20);
+    CHECK(overlapping < 180);
+}
+
+TEST_CASE("Batched narrowphases match single pairs on any executor", "[Collision]")
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> position(-4.f, 4.f);
+    std::uniform_real_distribution<float> size(0.2f, 1.f);
+    std::uniform_int_distribution<uint32_t> pick(0, 99);
+
+    std::vector<Vector3> hullPoints(12);
+    for (Vector3& p : hullPoints)
+        p = Vector3(size(rng), size(rng), size(rng)) - Vector3(0.6f, 0.6f, 0.6f);
+
+    std::vector<ConvexShape> shapes;
+    std::vector<OBB> boxes;
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        Vector3 p(position(rng), position(rng), position(rng));
+        Quaternion q = RandomRotation(rng);
+        Vector3 e(size(rng), size(rng), size(rng));
+
+        switch (i % 4)
+        {
+        case 0:
+            shapes.push_back(ConvexShape::Sphere(e.x));
+            break;
+        case 1:
+            shapes.push_back(ConvexShape::Capsule(e.y, e.x * 0.5f));
+            break;
+        case 2:
+            shapes.push_back(ConvexShape::Box(e, 0.05f));
+            break;
+        default:
+            shapes.push_back(ConvexShape::Hull(hullPoints.data(), hullPoints.size()));
+            break;
+        }
+
+        // Both transforms place the shape the same way
+        ConvexShape byMatrix = shapes.back();
+        byMatrix.SetTransform(Matrix4x4::Translate(p) * Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w)));
+        shapes.back().SetTransform(p, q);
+
+        for (size_t k = 0; k < 3; k++)
+        {
+            CHECK(byMatrix.axes[k].x == Approx(shapes.back().axes[k].x).margin(1e-5));
+            CHECK(byMatrix.axes[k].y == Approx(shapes.back().axes[k].y).margin(1e-5));
+            CHECK(byMatrix.axes[k].z == Approx(shapes.back().axes[k].z).margin(1e-5));
+        }
+
+        CHECK(byMatrix.position.x == p.x);
+
+        boxes.push_back(ToOBB(p, q, e));
+    }
+
+    // More pairs than a chunk, not a multiple of it or of the lanes
+    const size_t count = 1000;
+    std::vector<ShapePair> pairs(count);
+    for (ShapePair& pair : pairs)
+    {
+        pair.a = pick(rng);
+        do
+            pair.b = pick(rng);
+        while (pair.b == pair.a);
+    }
+
+    ThreadPool pool(3);
+    std::vector<Contact> inline_(count), pooled(count);
+
+    Collide(shapes.data(), pairs.data(), count, inline_.data());
+    Collide(shapes.data(), pairs.data(), count, pooled.data(), pool.GetExecutor());
+
+    size_t overlaps = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        CHECK(Equal(inline_[i], pooled[i]));
+        CHECK(Equal(inline_[i], Collide(shapes[pairs[i].a], shapes[pairs[i].b])));
+        CHECK(Overlap(shapes[pairs[i].a], shapes[pairs[i].b]) == (inline_[i].distance <= 0.f));
+        overlaps += inline_[i].distance <= 0.f;
+    }
+
+    CHECK(overlaps > 0);
+
+    Collide(boxes.data(), pairs.data(), count, inline_.data());
+    Collide(boxes.data(), pairs.data(), count, pooled.data(), pool.GetExecutor());
+
+    for (size_t i = 0; i < count; i++)
+    {
+        CHECK(Equal(inline_[i], pooled[i]));
+
+        // Lanes and the scalar path only differ by rounding
+        Contact single = Collide(boxes[pairs[i].a], boxes[pairs[i].b]);
+        CHECK(inline_[i].distance == Approx(single.distance).margin(1e-4));
+        CHECK(inline_[i].normal.Dot(single.normal) == Approx(1.f).margin(1e-4));
+    }
+
+    Collide(shapes.data(), pairs.data(), 0, inline_.data());
+}
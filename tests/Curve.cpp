@@ -0,0 +1,255 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Curve.h>
+#include <FMaths/Vector2.h>
+#include <FMaths/Vector3.h>
+#include <FMaths/Vector4.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+// Not a multiple of any lane width, so the scalar tail runs too
+constexpr size_t kCount = 37;
+
+template<typename V>
+bool BitwiseEqual(const V& a, const V& b)
+{
+    return std::memcmp(&a, &b, sizeof(V)) == 0;
+}
+
+void CheckApprox(const Vector3& a, const Vector3& b, float margin = 1e-5f)
+{
+    CHECK(a.x == Approx(b.x).margin(margin));
+    CHECK(a.y == Approx(b.y).margin(margin));
+    CHECK(a.z == Approx(b.z).margin(margin));
+}
+
+void CheckRotation(const Quaternion& a, const Quaternion& b, float margin = 1e-5f)
+{
+    // q and -q are the same rotation
+    CHECK(std::fabs(a.Dot(b)) == Approx(1.f).margin(margin));
+}
+
+template<typename V>
+std::vector<V> RandomPoints(size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+    std::vector<V> res(count);
+
+    for (V& p : res)
+    {
+        float* f = reinterpret_cast<float*>(&p);
+        for (size_t k = 0; k < sizeof(V) / sizeof(float); k++)
+            f[k] = dist(rng);
+    }
+
+    return res;
+}
+
+template<typename V>
+void CheckBatchesMatchScalar()
+{
+    std::vector<V> points = RandomPoints<V>(10, 5);
+
+    std::mt19937 rng(6);
+    std::uniform_real_distribution<float> dist(-0.5f, 8.f);
+
+    std::vector<float> u(kCount);
+    for (float& f : u)
+        f = dist(rng);
+    u[3] = NAN;
+
+    for (CurveBasis basis : {CurveBasis::Hermite, CurveBasis::Bezier, CurveBasis::CatmullRom, CurveBasis::BSpline})
+    {
+        Spline<V> spline(basis, points.data(), points.size());
+        std::vector<V> out(kCount);
+
+        spline.Evaluate(u.data(), out.data(), kCount);
+        for (size_t i = 0; i < kCount; i++)
+            CHECK(BitwiseEqual(out[i], spline.Evaluate(u[i])));
+
+        const CubicCurve<V>& segment = spline.Segment(0);
+        std::vector<float> t(kCount);
+        for (size_t i = 0; i < kCount; i++)
+            t[i] = static_cast<float>(i) / (kCount - 1);
+
+        segment.Evaluate(t.data(), out.data(), kCount);
+        for (size_t i = 0; i < kCount; i++)
+            CHECK(BitwiseEqual(out[i], segment.Evaluate(t[i])));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Curve bases match their textbook forms", "[Curve]")
+{
+    Vector3 p0(0.f, 0.f, 0.f), p1(1.f, 2.f, 0.f), p2(3.f, 2.f, 1.f), p3(4.f, 0.f, -1.f);
+
+    CubicCurve<Vector3> hermite(CurveBasis::Hermite, p0, p1, p2, p3);
+    CubicCurve<Vector3> bezier(CurveBasis::Bezier, p0, p1, p2, p3);
+    CubicCurve<Vector3> catmull(CurveBasis::CatmullRom, p0, p1, p2, p3);
+    CubicCurve<Vector3> bspline(CurveBasis::BSpline, p0, p1, p2, p3);
+
+    for (float t = 0.f; t <= 1.f; t += 0.125f)
+    {
+        float s = 1.f - t;
+        float t2 = t * t, t3 = t2 * t;
+
+        Vector3 h = (p0 * (2.f * t3 - 3.f * t2 + 1.f)) + (p1 * (t3 - 2.f * t2 + t)) + (p2 * (-2.f * t3 + 3.f * t2)) + (p3 * (t3 - t2));
+        Vector3 b = (p0 * (s * s * s)) + (p1 * (3.f * s * s * t)) + (p2 * (3.f * s * t2)) + (p3 * t3);
+        Vector3 c = ((p1 * 2.f) + ((p2 - p0) * t) + (((p0 * 2.f) - (p1 * 5.f) + (p2 * 4.f) - p3) * t2) + ((p3 - p0 + ((p1 - p2) * 3.f)) * t3)) * 0.5f;
+        Vector3 bs = ((p0 * (s * s * s)) + (p1 * (3.f * t3 - 6.f * t2 + 4.f)) + (p2 * (-3.f * t3 + 3.f * t2 + 3.f * t + 1.f)) + (p3 * t3)) * (1.f / 6.f);
+
+        CheckApprox(hermite.Evaluate(t), h);
+        CheckApprox(bezier.Evaluate(t), b);
+        CheckApprox(catmull.Evaluate(t), c);
+        CheckApprox(bspline.Evaluate(t), bs);
+    }
+
+    // End points and tangents
+    CheckApprox(hermite.Tangent(0.f), p1);
+    CheckApprox(hermite.Tangent(1.f), p3);
+    CheckApprox(bezier.Evaluate(1.f), p3);
+    CheckApprox(bezier.Tangent(0.f), (p1 - p0) * 3.f);
+    CheckApprox(catmull.Evaluate(0.f), p1);
+    CheckApprox(catmull.Evaluate(1.f), p2);
+    CheckApprox(catmull.Tangent(1.f), (p3 - p1) * 0.5f);
+}
+
+TEST_CASE("Batched curve evaluation is bitwise identical to single evaluation", "[Curve]")
+{
+    CheckBatchesMatchScalar<Vector2>();
+    CheckBatchesMatchScalar<Vector3>();
+    CheckBatchesMatchScalar<Vector4>();
+}
+
+TEST_CASE("Splines join their segments and clamp the parameter", "[Curve]")
+{
+    std::vector<Vector3> points = RandomPoints<Vector3>(10, 7);
+
+    Spline<Vector3> catmull(CurveBasis::CatmullRom, points.data(), points.size());
+    Spline<Vector3> bezier(CurveBasis::Bezier, points.data(), points.size());
+    Spline<Vector3> hermite(CurveBasis::Hermite, points.data(), points.size());
+
+    CHECK(catmull.SegmentCount() == 7);
+    CHECK(bezier.SegmentCount() == 3);
+    CHECK(hermite.SegmentCount() == 4);
+
+    // Catmull-Rom passes through every inner point
+    for (size_t i = 0; i < 7; i++)
+        CheckApprox(catmull.Evaluate(static_cast<float>(i)), points[i + 1]);
+
+    CheckApprox(catmull.Evaluate(7.f), points[8]);
+    CHECK(BitwiseEqual(catmull.Evaluate(-3.f), catmull.Evaluate(0.f)));
+    CHECK(BitwiseEqual(catmull.Evaluate(100.f), catmull.Evaluate(7.f)));
+
+    for (size_t i = 0; i <= 3; i++)
+        CheckApprox(bezier.Evaluate(static_cast<float>(i)), points[i * 3]);
+}
+
+TEST_CASE("Forward differencing tracks direct evaluation", "[Curve]")
+{
+    std::vector<Vector3> points = RandomPoints<Vector3>(6, 8);
+    Spline<Vector3> spline(CurveBasis::CatmullRom, points.data(), points.size(), 0);
+
+    const size_t samples = 1000;
+    std::vector<Vector3> uniform((spline.SegmentCount() * samples) + 1);
+    spline.EvaluateUniform(uniform.data(), samples);
+
+    for (size_t i = 0; i < uniform.size(); i++)
+        CheckApprox(uniform[i], spline.Evaluate(static_cast<float>(i) / samples), 1e-3f);
+
+    CHECK(BitwiseEqual(uniform.back(), spline.Segment(spline.SegmentCount() - 1).Evaluate(1.f)));
+}
+
+TEST_CASE("Arc length tables give constant speed sampling", "[Curve]")
+{
+    // Quarter circles of radius 2 as Bezier segments, kappa puts the mid point on the circle
+    const float r = 2.f;
+    const float k = 0.5522847498f * r;
+
+    Vector2 points[] = {
+        Vector2(r, 0.f), Vector2(r, k), Vector2(k, r),
+        Vector2(0.f, r), Vector2(-k, r), Vector2(-r, k),
+        Vector2(-r, 0.f)
+    };
+
+    Spline<Vector2> arc(CurveBasis::Bezier, points, 7, 64);
+    CHECK(arc.Length() == Approx(3.14159265f * r).epsilon(1e-3));
+
+    CHECK(arc.ParameterAtDistance(-1.f) == 0.f);
+    CHECK(arc.ParameterAtDistance(100.f) == 2.f);
+    CHECK(arc.ParameterAtDistance(arc.Length() * 0.5f) == Approx(1.f).margin(1e-3));
+
+    // Equal steps along the arc are equal angles
+    const size_t count = 21;
+    std::vector<float> s(count);
+    for (size_t i = 0; i < count; i++)
+        s[i] = arc.Length() * static_cast<float>(i) / (count - 1);
+
+    std::vector<Vector2> out(count);
+    arc.EvaluateAtDistance(s.data(), out.data(), count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        float angle = 3.14159265f * static_cast<float>(i) / (count - 1);
+        CHECK(std::atan2(out[i].y, out[i].x) == Approx(angle).margin(2e-3));
+    }
+
+    // A straight line has an exact table
+    Vector3 line[] = {Vector3(-1.f, 0.f, 0.f), Vector3(0.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f), Vector3(2.f, 0.f, 0.f), Vector3(3.f, 0.f, 0.f)};
+    Spline<Vector3> straight(CurveBasis::CatmullRom, line, 5);
+
+    CHECK(straight.Length() == Approx(2.f));
+    CHECK(straight.ParameterAtDistance(1.5f) == Approx(1.5f));
+}
+
+TEST_CASE("Slerp and squad interpolate rotations", "[Curve]")
+{
+    const float pi = 3.14159265f;
+    Vector3 axis(0.f, 0.f, 1.f);
+
+    Quaternion a;
+    Quaternion b(axis, pi / 2.f);
+
+    CheckRotation(Slerp(a, b, 0.5f), Quaternion(axis, pi / 4.f));
+    CheckRotation(Slerp(a, b * -1.f, 0.5f), Quaternion(axis, pi / 4.f));
+    CheckRotation(Slerp(a, a, 0.3f), a);
+
+    // Evenly spaced keys about one axis need no correction, squad is slerp
+    Quaternion q0(axis, 0.f), q1(axis, 0.5f), q2(axis, 1.f), q3(axis, 1.5f);
+    Quaternion s1 = SquadControl(q0, q1, q2);
+    Quaternion s2 = SquadControl(q1, q2, q3);
+
+    CheckRotation(s1, q1);
+    CheckRotation(Squad(q1, q2, s1, s2, 0.25f), Quaternion(axis, 0.625f));
+
+    // Uneven keys about different axes still hit the keys and stay unit length
+    Quaternion k0(Vector3(1.f, 0.f, 0.f), 0.3f), k1(Vector3(0.f, 1.f, 0.f), 1.2f), k2(Vector3(1.f, 1.f, 0.f), -0.4f), k3(Vector3(0.f, 1.f, 1.f), 2.f);
+    Quaternion c1 = SquadControl(k0, k1, k2);
+    Quaternion c2 = SquadControl(k1, k2, k3);
+
+    CheckRotation(Squad(k1, k2, c1, c2, 0.f), k1);
+    CheckRotation(Squad(k1, k2, c1, c2, 1.f), k2);
+
+    std::vector<float> t(kCount);
+    for (size_t i = 0; i < kCount; i++)
+        t[i] = static_cast<float>(i) / (kCount - 1);
+
+    std::vector<Quaternion> out(kCount);
+    Squad(k1, k2, c1, c2, t.data(), out.data(), kCount);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        CHECK(BitwiseEqual(out[i], Squad(k1, k2, c1, c2, t[i])));
+        CHECK(out[i].Magnitude() == Approx(1.f).margin(1e-5));
+    }
+}
@@ -0,0 +1,240 @@
+#include <catch2/catch_test_macros.hpp>
+#include <FMaths/FastMath.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Mesh.h>
+#include <FMaths/Quaternion.h>
+#include <FMaths/Reduce.h>
+#include <FMaths/SphericalHarmonics.h>
+#include <FMaths/Vector3.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <vector>
+
+// Only built with FMATHS_DETERMINISTIC, where every platform and SIMD width
+// must reproduce these bits. If a deliberate change to a kernel moves them,
+// update the reference from the failure message.
+
+namespace
+{
+
+// Not a multiple of any lane width or kReduceChunkSize, so tails run too
+constexpr size_t kCount = 5003;
+
+#ifdef FMATHS_COMPENSATED
+constexpr uint64_t kReference = 0xf5a340f3917fc031ull;
+#else
+constexpr uint64_t kReference = 0x130d5fc09fa1f351ull;
+#endif
+
+constexpr uint64_t kMeshReference = 0x976a3cf55f9d2430ull;
+
+/**
+ * @brief Linear congruential generator, std distributions differ between standard libraries
+ */
+struct Generator
+{
+    uint64_t state;
+
+    /**
+     * @brief Uniform in [lo, hi), from 24 random bits so the conversion is exact
+     */
+    float Next(float lo, float hi)
+    {
+        state = (state * 6364136223846793005ull) + 1442695040888963407ull;
+        float unit = static_cast<float>(state >> 40) * 0x1p-24f;
+
+        return lo + ((hi - lo) * unit);
+    }
+
+    Vector3 NextVector(float lo, float hi)
+    {
+        float x = Next(lo, hi);
+        float y = Next(lo, hi);
+        return Vector3(x, y, Next(lo, hi));
+    }
+};
+
+/**
+ * @brief FNV-1a over the bits of count floats
+ */
+struct Hash
+{
+    uint64_t value = 0xcbf29ce484222325ull;
+
+    void Add(const void* p, size_t count)
+    {
+        const float* f = static_cast<const float*>(p);
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t bits;
+            memcpy(&bits, f + i, sizeof(bits));
+
+            for (size_t b = 0; b < 4; b++)
+            {
+                value ^= (bits >> (b * 8)) & 0xff;
+                value *= 0x100000001b3ull;
+            }
+        }
+    }
+
+    template<typename T>
+    void Add(const std::vector<T>& v)
+    {
+        Add(v.data(), v.size() * (sizeof(T) / sizeof(float)));
+    }
+
+    template<typename T, size_t N>
+    void Add(const T (&v)[N])
+    {
+        Add(v, N * (sizeof(T) / sizeof(float)));
+    }
+
+    template<typename T>
+    void Add(const T& v)
+    {
+        Add(&v, sizeof(T) / sizeof(float));
+    }
+};
+
+} // namespace
+
+TEST_CASE("Results match the reference bits", "[Deterministic]")
+{
+    Generator gen{42};
+    Hash hash;
+
+    std::vector<float> x(kCount), y(kCount), out(kCount), out2(kCount);
+
+    // Transcendentals
+    for (size_t i = 0; i < kCount; i++)
+    {
+        x[i] = gen.Next(-100.f, 100.f);
+        y[i] = gen.Next(-1.f, 1.f);
+    }
+
+    Sin(x.data(), out.data(), kCount);
+    hash.Add(out);
+    SinCos(x.data(), out.data(), out2.data(), kCount);
+    hash.Add(out);
+    hash.Add(out2);
+    Tan(x.data(), out.data(), kCount);
+    hash.Add(out);
+    Atan2(y.data(), x.data(), out.data(), kCount);
+    hash.Add(out);
+    Acos(y.data(), out.data(), kCount);
+    hash.Add(out);
+
+    for (float& v : x)
+        v = fabsf(v) + 1e-3f;
+
+    InvSqrt(x.data(), out.data(), kCount);
+    hash.Add(out);
+
+    // Vectors and rotations
+    std::vector<Vector3> v(kCount), rotated(kCount);
+    std::vector<Quaternion> q(kCount);
+    for (size_t i = 0; i < kCount; i++)
+    {
+        v[i] = gen.NextVector(-50.f, 50.f);
+        q[i] = Quaternion(gen.NextVector(-1.f, 1.f).Normalized(), gen.Next(-10.f, 10.f));
+
+        hash.Add(v[i].Length());
+        hash.Add(v[i].Normalized());
+    }
+
+    Quaternion::Apply(q.data(), v.data(), rotated.data(), kCount);
+    hash.Add(rotated);
+    q[0].Apply(v.data(), rotated.data(), kCount);
+    hash.Add(rotated);
+
+    // Matrices
+    std::vector<Matrix4x4> a(kCount), b(kCount), m(kCount);
+    for (size_t i = 0; i < kCount; i++)
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+            {
+                a[i][col][row] = gen.Next(-2.f, 2.f);
+                b[i][col][row] = gen.Next(-2.f, 2.f);
+            }
+
+    Matrix4x4::Multiply(a.data(), b.data(), m.data(), kCount);
+    hash.Add(m);
+    Matrix4x4::Inverse(a.data(), m.data(), kCount);
+    hash.Add(m);
+
+    hash.Add(Matrix4x4::Perspective(1.1f, 16.f, 9.f, 0.1f, 100.f));
+    hash.Add(Matrix4x4::PerspectiveReverseZ(0.9f, 4.f, 3.f, 0.01f, INFINITY));
+
+    // Reductions
+    hash.Add(Sum(v.data(), kCount));
+    hash.Add(Covariance(v.data(), kCount));
+    hash.Add(Bounds(v.data(), kCount));
+
+    OBB box = FitOBB(rotated.data(), kCount);
+    hash.Add(box.centre);
+    hash.Add(box.axes);
+    hash.Add(box.halfExtents);
+
+    std::vector<Vector3> directions(kCount);
+    for (size_t i = 0; i < kCount; i++)
+        directions[i] = v[i].Normalized();
+
+    SH3 sh;
+    sh.AddSamples(directions.data(), rotated.data(), x.data(), kCount);
+    hash.Add(sh.coefficients);
+
+    INFO("Got 0x" << std::hex << hash.value);
+    REQUIRE(hash.value == kReference);
+}
+
+TEST_CASE("Mesh normals and tangents match the reference bits", "[Deterministic]")
+{
+    Generator gen{7};
+    Hash hash;
+
+    // Jittered, wavy grid whose right half has mirrored texture coordinates
+    const uint32_t columns = 23, rows = 19;
+    const size_t vertices = (columns + 1) * (rows + 1);
+
+    std::vector<uint32_t> indices;
+    for (uint32_t j = 0; j < rows; j++)
+        for (uint32_t i = 0; i < columns; i++)
+        {
+            uint32_t a = (j * (columns + 1)) + i, b = a + 1, c = a + columns + 2, d = a + columns + 1;
+            indices.insert(indices.end(), {a, b, c, a, c, d});
+        }
+
+    std::vector<float> x(vertices), y(vertices), z(vertices), u(vertices), v(vertices);
+    for (uint32_t j = 0; j <= rows; j++)
+        for (uint32_t i = 0; i <= columns; i++)
+        {
+            size_t k = (j * (columns + 1)) + i;
+            x[k] = static_cast<float>(i) + gen.Next(-0.2f, 0.2f);
+            y[k] = static_cast<float>(j) + gen.Next(-0.2f, 0.2f);
+            z[k] = gen.Next(-0.5f, 0.5f);
+            u[k] = (i <= columns / 2 ? static_cast<float>(i) : static_cast<float>(columns - i)) * 0.1f;
+            v[k] = static_cast<float>(j) * 0.1f + gen.Next(-0.01f, 0.01f);
+        }
+
+    Mesh mesh(indices.data(), indices.size() / 3, vertices);
+
+    std::vector<float> nx(vertices), ny(vertices), nz(vertices);
+    mesh.ComputeNormals(x.data(), y.data(), z.data(), nx.data(), ny.data(), nz.data());
+    hash.Add(nx);
+    hash.Add(ny);
+    hash.Add(nz);
+
+    std::vector<float> tx(vertices), ty(vertices), tz(vertices), tw(vertices);
+    mesh.ComputeTangents(x.data(), y.data(), z.data(), nx.data(), ny.data(), nz.data(), u.data(), v.data(), tx.data(), ty.data(),
+        tz.data(), tw.data());
+    hash.Add(tx);
+    hash.Add(ty);
+    hash.Add(tz);
+    hash.Add(tw);
+
+    INFO("Got 0x" << std::hex << hash.value);
+    REQUIRE(hash.value == kMeshReference);
+}
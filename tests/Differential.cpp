@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Differential.h"
+
+#include <vector>
+
+using namespace Differential;
+
+namespace
+{
+
+// Not a multiple of any lane width, so every backend runs its tail too
+constexpr size_t kCount = 37;
+constexpr size_t kRounds = 16;
+
+void RequireAgreement(const std::optional<Mismatch>& mismatch)
+{
+    if (mismatch)
+        FAIL(*mismatch);
+}
+
+} // namespace
+
+TEST_CASE("Batched Multiply matches operator*", "[Differential]")
+{
+    Generator gen(1);
+
+    for (Range range : kRanges)
+        for (size_t round = 0; round < kRounds; round++)
+        {
+            std::vector<Matrix4x4> a, b;
+            for (size_t i = 0; i < kCount; i++)
+            {
+                a.push_back(gen.Matrix(range));
+                b.push_back(gen.Matrix(range));
+            }
+
+            for (Backend backend : Backends())
+                RequireAgreement(CheckMultiply(backend, a.data(), b.data(), kCount));
+        }
+}
+
+TEST_CASE("Batched Inverse matches Inverse", "[Differential]")
+{
+    Generator gen(2);
+
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        std::vector<Matrix4x4> m;
+        for (Range range : kRanges)
+            m.push_back(gen.Matrix(range));
+
+        // Near singular down to exactly singular, plus an all zero matrix
+        for (float eps : {1e-3f, 1e-6f, 1e-20f, 0.f})
+            m.push_back(gen.NearSingular(eps));
+
+        m.push_back(Matrix4x4(0.f));
+        m.push_back(Matrix4x4::Identity());
+
+        for (Backend backend : Backends())
+            RequireAgreement(CheckInverse(backend, m.data(), m.size()));
+    }
+}
+
+TEST_CASE("Batched Apply matches Apply", "[Differential]")
+{
+    Generator gen(3);
+
+    for (Range range : kRanges)
+        for (size_t round = 0; round < kRounds; round++)
+        {
+            std::vector<Quaternion> q;
+            std::vector<Vector3> v;
+
+            for (size_t i = 0; i < kCount; i++)
+            {
+                // Mostly unit rotations, some which need normalizing first
+                q.push_back(gen.Rotation((i % 4 == 0) ? 8.f : 0.f));
+                v.push_back(gen.Vector(range));
+            }
+
+            for (Backend backend : Backends())
+                RequireAgreement(CheckApply(backend, q.data(), v.data(), kCount));
+
+            // One rotation for the whole batch
+            std::vector<Vector3> out(kCount);
+            q[1].Apply(v.data(), out.data(), kCount);
+
+            for (size_t i = 0; i < kCount; i++)
+            {
+                Vector3 expected = q[1].Apply(v[i]);
+                float scale = fabsf(v[i].x) + fabsf(v[i].y) + fabsf(v[i].z);
+
+                for (size_t axis = 0; axis < 3; axis++)
+                    REQUIRE(Agree(expected[axis], out[i][axis], scale, kApplyUlps));
+            }
+        }
+}
+
+TEST_CASE("Apply rotates by the conjugate", "[Differential]")
+{
+    // A quarter turn about z takes x to y
+    Quaternion q(Vector3(0.f, 0.f, 1.f), 1.57079632679f);
+    Vector3 v = q.Apply(Vector3(1.f, 0.f, 0.f));
+
+    REQUIRE(fabsf(v.x) < 1e-6f);
+    REQUIRE(fabsf(v.y - 1.f) < 1e-6f);
+    REQUIRE(fabsf(v.z) < 1e-6f);
+}
@@ -0,0 +1,368 @@
+/**
+ * @file Differential.h
+ * @author Peter Garrod (p.glgarrod@gmail.com)
+ * @brief Differential checks of the batch kernels against the scalar reference functions
+ * @version 0.1
+ * @date 19-10-2026
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef DIFFERENTIAL_H
+#define DIFFERENTIAL_H
+
+#include <FMaths/Compare.h>
+#include <FMaths/Vector3.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Quaternion.h>
+
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <vector>
+
+// Internal lane kernels, built with the library's definitions so each width matches what it ships
+#include "Kernels.h"
+
+// Shared by the Differential test and the Fuzz target
+
+namespace Differential
+{
+
+/**
+ * @brief A route through the batch kernels
+ *
+ * Library is the public batch API, the others instantiate the lane kernels at one width.
+ */
+enum class Backend
+{
+    Library,
+    Scalar,
+    SSE,
+    AVX
+};
+
+inline const char* Name(Backend backend)
+{
+    switch (backend)
+    {
+    case Backend::Library: return "Library";
+    case Backend::Scalar: return "Scalar";
+    case Backend::SSE: return "SSE";
+    case Backend::AVX: return "AVX";
+    }
+
+    return "Unknown";
+}
+
+/**
+ * @brief Every backend compiled into this binary
+ */
+inline std::vector<Backend> Backends()
+{
+    std::vector<Backend> backends = {Backend::Library, Backend::Scalar};
+
+#ifdef FMATHS_SIMD_SSE
+    backends.push_back(Backend::SSE);
+#endif
+#ifdef FMATHS_SIMD_AVX
+    backends.push_back(Backend::AVX);
+#endif
+
+    return backends;
+}
+
+// Allowed error in units of eps * scale, where scale bounds the magnitude of the intermediate terms
+#ifdef FMATHS_COMPENSATED
+constexpr uint32_t kMultiplyUlps = 4; // lanes accumulate normally, the reference is compensated
+#else
+constexpr uint32_t kMultiplyUlps = 0; // same operations in the same order
+#endif
+constexpr uint32_t kInverseUlps = 0;
+constexpr uint32_t kApplyUlps = 8;
+
+/**
+ * @brief Whether actual is within ulps of expected
+ *
+ * With ulps = 0 results must be identical, NaN included. Otherwise only finite
+ * references are compared, as kernels using different formulas may overflow differently.
+ */
+inline bool Agree(float expected, float actual, float scale, uint32_t ulps)
+{
+    if (ulps == 0)
+        return (expected == actual) || (std::isnan(expected) && std::isnan(actual));
+
+    if (!std::isfinite(expected) || !std::isfinite(scale))
+        return true;
+
+    if (!std::isfinite(actual))
+        return false;
+
+    return (UlpDistance(expected, actual) <= ulps) || (fabsf(expected - actual) <= ulps * __FLT_EPSILON__ * scale);
+}
+
+struct Mismatch
+{
+    const char* kernel;
+    Backend backend;
+    size_t index;
+    size_t component;
+    float expected;
+    float actual;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Mismatch& m)
+{
+    return os << m.kernel << " [" << Name(m.backend) << "] element " << m.index << " component " << m.component
+              << ": expected " << m.expected << ", got " << m.actual
+              << " (" << UlpDistance(m.expected, m.actual) << " ulp)";
+}
+
+/**
+ * @brief Run kernel over count elements in blocks of F, finishing with single lanes
+ */
+template<typename F, typename Kernel>
+void Run(size_t count, Kernel kernel)
+{
+    size_t i = 0;
+
+    for (; i + F::Width <= count; i += F::Width)
+        kernel(F(), i);
+
+    for (; i < count; i++)
+        kernel(ScalarFloat(), i);
+}
+
+template<typename Kernel>
+void Dispatch(Backend backend, size_t count, Kernel kernel)
+{
+    switch (backend)
+    {
+    case Backend::Scalar:
+        Run<ScalarFloat>(count, kernel);
+        break;
+#ifdef FMATHS_SIMD_SSE
+    case Backend::SSE:
+        Run<Float4>(count, kernel);
+        break;
+#endif
+#ifdef FMATHS_SIMD_AVX
+    case Backend::AVX:
+        Run<Float8>(count, kernel);
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+inline void Multiply(Backend backend, const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out, size_t count)
+{
+    if (backend == Backend::Library)
+        return Matrix4x4::Multiply(a, b, out, count);
+
+    Dispatch(backend, count, [&](auto lanes, size_t i) {
+        using F = decltype(lanes);
+        MultiplyLanes(MatrixLanes<F>::Load(a + i), MatrixLanes<F>::Load(b + i)).Store(out + i);
+    });
+}
+
+inline void Inverse(Backend backend, const Matrix4x4* m, Matrix4x4* out, size_t count)
+{
+    if (backend == Backend::Library)
+        return Matrix4x4::Inverse(m, out, count);
+
+    Dispatch(backend, count, [&](auto lanes, size_t i) {
+        using F = decltype(lanes);
+        InverseLanes(MatrixLanes<F>::Load(m + i)).Store(out + i);
+    });
+}
+
+inline void Apply(Backend backend, const Quaternion* q, const Vector3* v, Vector3* out, size_t count)
+{
+    if (backend == Backend::Library)
+        return Quaternion::Apply(q, v, out, count);
+
+    Dispatch(backend, count, [&](auto lanes, size_t i) {
+        using F = decltype(lanes);
+        ApplyLanes(QuaternionLanes<F>::Load(q + i), Vector3Lanes<F>::Load(v + i)).Store(out + i);
+    });
+}
+
+/**
+ * @brief Compare batched a[i] * b[i] against operator*
+ */
+inline std::optional<Mismatch> CheckMultiply(Backend backend, const Matrix4x4* a, const Matrix4x4* b, size_t count)
+{
+    std::vector<Matrix4x4> out(count);
+    Multiply(backend, a, b, out.data(), count);
+
+    // The library falls back to operator* when compensated, so is always exact
+    uint32_t ulps = (backend == Backend::Library) ? 0 : kMultiplyUlps;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Matrix4x4 expected = a[i] * b[i];
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+            {
+                float scale = 0.f;
+                for (size_t k = 0; k < 4; k++)
+                    scale += fabsf(a[i][k][row] * b[i][col][k]);
+
+                if (!Agree(expected[col][row], out[i][col][row], scale, ulps))
+                    return Mismatch{"Multiply", backend, i, (col * 4) + row, expected[col][row], out[i][col][row]};
+            }
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Compare batched inverses against Matrix4x4::Inverse
+ */
+inline std::optional<Mismatch> CheckInverse(Backend backend, const Matrix4x4* m, size_t count)
+{
+    std::vector<Matrix4x4> out(count);
+    Inverse(backend, m, out.data(), count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Matrix4x4 expected = m[i].Inverse();
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                if (!Agree(expected[col][row], out[i][col][row], 0.f, kInverseUlps))
+                    return Mismatch{"Inverse", backend, i, (col * 4) + row, expected[col][row], out[i][col][row]};
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Compare batched rotations against Quaternion::Apply
+ */
+inline std::optional<Mismatch> CheckApply(Backend backend, const Quaternion* q, const Vector3* v, size_t count)
+{
+    std::vector<Vector3> out(count);
+    Apply(backend, q, v, out.data(), count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // Rotation preserves length, |x| + |y| + |z| bounds it without overflowing early
+        float scale = fabsf(v[i].x) + fabsf(v[i].y) + fabsf(v[i].z);
+
+        // Outside this the reference normalizes to 0 or infinity rather than a rotation,
+        // and intermediate terms of either formula reach a few times |v| so may overflow
+        if (!std::isnormal(q[i].MagnitudeSquared()) || !std::isfinite(4.f * scale))
+            continue;
+
+        Vector3 expected = q[i].Apply(v[i]);
+
+        for (size_t axis = 0; axis < 3; axis++)
+            if (!Agree(expected[axis], out[i][axis], scale, kApplyUlps))
+                return Mismatch{"Apply", backend, i, axis, expected[axis], out[i][axis]};
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Magnitudes the generator draws from
+ */
+enum class Range
+{
+    Unit,       // [-1, 1]
+    Wide,       // 2^-20 to 2^20
+    Denormal,   // below FLT_MIN
+    Huge,       // 2^40 to 2^62, products stay finite
+    Mixed       // any of the above per element, to provoke cancellation
+};
+
+constexpr Range kRanges[] = {Range::Unit, Range::Wide, Range::Denormal, Range::Huge, Range::Mixed};
+
+/**
+ * @brief Deterministic source of adversarial inputs
+ */
+class Generator
+{
+public:
+    explicit Generator(uint32_t seed):
+        m_Rng(seed)
+    {}
+
+    float Value(Range range)
+    {
+        float sign = (Uniform(0.f, 1.f) < 0.5f) ? -1.f : 1.f;
+
+        switch (range)
+        {
+        case Range::Unit: return Uniform(-1.f, 1.f);
+        case Range::Wide: return sign * exp2f(Uniform(-20.f, 20.f));
+        case Range::Denormal: return sign * Uniform(0.f, 1.f) * __FLT_MIN__;
+        case Range::Huge: return sign * exp2f(Uniform(40.f, 62.f));
+        case Range::Mixed: return Value(kRanges[m_Rng() % 4]);
+        }
+
+        return 0.f;
+    }
+
+    Matrix4x4 Matrix(Range range)
+    {
+        Matrix4x4 m;
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                m[col][row] = Value(range);
+
+        return m;
+    }
+
+    /**
+     * @brief Last column a combination of the others, plus noise of size eps
+     *
+     * With eps = 0 the determinant is 0 up to rounding.
+     */
+    Matrix4x4 NearSingular(float eps)
+    {
+        Matrix4x4 m = Matrix(Range::Unit);
+        float a = Uniform(-2.f, 2.f);
+        float b = Uniform(-2.f, 2.f);
+
+        for (size_t row = 0; row < 4; row++)
+            m[3][row] = (m[0][row] * a) + (m[1][row] * b) + (eps * Uniform(-1.f, 1.f));
+
+        return m;
+    }
+
+    /**
+     * @brief Quaternion scaled away from unit length by up to 2^spread either way
+     */
+    Quaternion Rotation(float spread)
+    {
+        Quaternion q(Uniform(-1.f, 1.f), Uniform(-1.f, 1.f), Uniform(-1.f, 1.f), Uniform(-1.f, 1.f));
+        q.Normalize();
+
+        return q * exp2f(Uniform(-spread, spread));
+    }
+
+    Vector3 Vector(Range range)
+    {
+        return Vector3(Value(range), Value(range), Value(range));
+    }
+
+private:
+    float Uniform(float lo, float hi)
+    {
+        return std::uniform_real_distribution<float>(lo, hi)(m_Rng);
+    }
+
+    std::mt19937 m_Rng;
+};
+
+} // namespace Differential
+
+#endif
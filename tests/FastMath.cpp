@@ -0,0 +1,169 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/FastMath.h>
+#include <FMaths/Quaternion.h>
+#include <FMaths/Vector3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using Catch::Approx;
+
+/**
+ * @brief Distance from reference in units of the float spacing at the reference
+ */
+static double UlpError(float value, double reference)
+{
+    float r = static_cast<float>(fabs(reference));
+    double ulp = nextafterf(r, INFINITY) - r;
+
+    return fabs(value - reference) / ulp;
+}
+
+static std::vector<float> Range(float min, float max, size_t count)
+{
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; i++)
+        values[i] = min + ((max - min) * static_cast<float>(i) / static_cast<float>(count - 1));
+
+    return values;
+}
+
+TEST_CASE("Sin and cos error bounds", "[FastMath]")
+{
+    std::vector<float> x = Range(-10.f, 10.f, 100003);
+    std::vector<float> s(x.size()), c(x.size());
+    SinCos(x.data(), s.data(), c.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        REQUIRE(UlpError(s[i], sin(static_cast<double>(x[i]))) <= 2.0);
+        REQUIRE(UlpError(c[i], cos(static_cast<double>(x[i]))) <= 2.0);
+
+        // Batched and scalar forms agree exactly
+        REQUIRE(s[i] == Sin(x[i]));
+        REQUIRE(c[i] == Cos(x[i]));
+    }
+
+    x = Range(-8192.f, 8192.f, 100003);
+    Sin(x.data(), s.data(), x.size());
+    Cos(x.data(), c.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        REQUIRE(fabs(s[i] - sin(static_cast<double>(x[i]))) <= ldexp(1.0, -23));
+        REQUIRE(fabs(c[i] - cos(static_cast<double>(x[i]))) <= ldexp(1.0, -23));
+    }
+}
+
+TEST_CASE("Tan, atan2, acos and inverse sqrt error bounds", "[FastMath]")
+{
+    std::vector<float> x = Range(-1.5f, 1.5f, 100003);
+    std::vector<float> out(x.size());
+    Tan(x.data(), out.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        double reference = tan(static_cast<double>(x[i]));
+        REQUIRE(fabs(out[i] - reference) <= ldexp(fabs(reference), -22));
+    }
+
+    // The documented range, with a float right beside a zero of tan
+    x = Range(-8192.f, 8192.f, 100003);
+    x.push_back(-6198.36f);
+    out.resize(x.size());
+    Tan(x.data(), out.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        double reference = tan(static_cast<double>(x[i]));
+        if (fabs(reference) < 1e4)
+            REQUIRE(fabs(out[i] - reference) <= ldexp(std::max(1.0, fabs(reference)), -22));
+    }
+
+    x = Range(-1.f, 1.f, 100003);
+    Acos(x.data(), out.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+        REQUIRE(UlpError(out[i], acos(static_cast<double>(x[i]))) <= 2.0);
+
+    x = Range(1e-20f, 1e4f, 100003);
+    InvSqrt(x.data(), out.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+        REQUIRE(UlpError(out[i], 1.0 / sqrt(static_cast<double>(x[i]))) <= 4.0);
+
+    CHECK(std::isinf(InvSqrt(0.f)));
+    CHECK(InvSqrt(INFINITY) == 0.f);
+
+    // Every lane and the tail, with 0 and infinity mixed among ordinary values
+    x.assign(19, 4.f);
+    x[1] = x[9] = x[18] = 0.f;
+    x[5] = INFINITY;
+    InvSqrt(x.data(), out.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        if (x[i] == 0.f)
+            CHECK(std::isinf(out[i]));
+        else if (std::isinf(x[i]))
+            CHECK(out[i] == 0.f);
+        else
+            CHECK(out[i] == Approx(0.5f));
+    }
+
+    // Sweep a circle with radii spanning several magnitudes
+    std::vector<float> y(x.size());
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        float angle = -3.14159f + (6.28318f * static_cast<float>(i) / static_cast<float>(x.size()));
+        float radius = ldexpf(1.f, static_cast<int>(i % 40) - 20);
+
+        x[i] = cosf(angle) * radius;
+        y[i] = sinf(angle) * radius;
+    }
+
+    Atan2(y.data(), x.data(), out.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); i++)
+        REQUIRE(UlpError(out[i], atan2(static_cast<double>(y[i]), static_cast<double>(x[i]))) <= 4.0);
+
+    REQUIRE(Atan2(0.f, 0.f) == 0.f);
+    REQUIRE(Atan2(1.f, 0.f) == Approx(1.5707963f));
+    REQUIRE(Atan2(0.f, -1.f) == Approx(3.1415927f));
+}
+
+TEST_CASE("Batched quaternion constructors", "[FastMath]")
+{
+    std::vector<Vector3> axes;
+    std::vector<float> angles;
+    std::vector<Vector3> eulers;
+
+    for (size_t i = 0; i < 21; i++)
+    {
+        float f = static_cast<float>(i);
+        axes.push_back(Vector3(sinf(f), cosf(f * 2.f), 0.5f + f));
+        angles.push_back(f * 0.7f - 7.f);
+        eulers.push_back(Vector3(f * 0.3f - 3.f, f * -0.2f + 1.f, f * 0.45f));
+    }
+
+    std::vector<Quaternion> fromAxis(axes.size()), fromEuler(axes.size());
+    Quaternion::FromAxisAngles(axes.data(), angles.data(), fromAxis.data(), axes.size());
+    Quaternion::FromEulers(eulers.data(), fromEuler.data(), eulers.size());
+
+    for (size_t i = 0; i < axes.size(); i++)
+    {
+        Quaternion expected(axes[i], angles[i]);
+        Quaternion composed = Quaternion(Vector3(0.f, 0.f, 1.f), eulers[i].z)
+            * Quaternion(Vector3(0.f, 1.f, 0.f), eulers[i].y)
+            * Quaternion(Vector3(1.f, 0.f, 0.f), eulers[i].x);
+
+        for (size_t j = 0; j < 4; j++)
+        {
+            REQUIRE(fromAxis[i][j] == Approx(expected[j]).margin(1e-6));
+            REQUIRE(fromEuler[i][j] == Approx(composed[j]).margin(1e-6));
+            REQUIRE(Quaternion::FromEuler(eulers[i])[j] == Approx(composed[j]).margin(1e-6));
+        }
+    }
+}
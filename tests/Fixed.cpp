@@ -0,0 +1,259 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Fixed.h>
+#include <FMaths/FixedVector.h>
+#include <FMaths/FixedMatrix4x4.h>
+#include <FMaths/FixedQuaternion.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Quaternion.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+// Not a multiple of any lane width, so the scalar tail runs too
+constexpr size_t kCount = 37;
+
+template<typename T>
+std::vector<FixedVector3<T>> RandomVectors(size_t count, float range, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-range, range);
+    std::vector<FixedVector3<T>> res(count);
+
+    for (FixedVector3<T>& v : res)
+        v = FixedVector3<T>(dist(rng), dist(rng), dist(rng));
+
+    return res;
+}
+
+template<typename T>
+void CheckBatchesMatchScalar()
+{
+    // Large enough that some products and sums saturate
+    std::vector<FixedVector3<T>> a = RandomVectors<T>(kCount, 300.f, 1);
+    std::vector<FixedVector3<T>> b = RandomVectors<T>(kCount, 300.f, 2);
+
+    std::vector<T> dot(kCount);
+    FixedVector3<T>::Dot(a.data(), b.data(), dot.data(), kCount);
+
+    std::vector<FixedVector3<T>> cross(kCount);
+    FixedVector3<T>::Cross(a.data(), b.data(), cross.data(), kCount);
+
+    std::vector<FixedVector3<T>> normalized = a;
+    FixedVector3<T>::Normalize(normalized.data(), kCount);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        CHECK(dot[i] == a[i].Dot(b[i]));
+        CHECK(cross[i] == a[i].Cross(b[i]));
+        CHECK(normalized[i] == a[i].Normalized());
+    }
+
+    std::vector<FixedMatrix4x4<T>> ma(kCount), mb(kCount), product(kCount);
+    for (size_t i = 0; i < kCount; i++)
+    {
+        ma[i] = FixedMatrix4x4<T>::Translate(a[i]) * FixedMatrix4x4<T>::Scale(FixedVector3<T>(T(2), T(0.5), T(-3)));
+        mb[i] = FixedMatrix4x4<T>(FixedVector4<T>(a[i]), FixedVector4<T>(b[i]), FixedVector4<T>(a[i] - b[i]), FixedVector4<T>(b[i], T(0)));
+    }
+
+    FixedMatrix4x4<T>::Multiply(ma.data(), mb.data(), product.data(), kCount);
+
+    for (size_t i = 0; i < kCount; i++)
+        CHECK(product[i] == ma[i] * mb[i]);
+
+    std::vector<FixedQuaternion<T>> q(kCount);
+    for (size_t i = 0; i < kCount; i++)
+        q[i] = FixedQuaternion<T>(b[i], T(0.01) * a[i].x);
+
+    std::vector<FixedVector3<T>> one(kCount), each(kCount);
+    q[0].Apply(a.data(), one.data(), kCount);
+    FixedQuaternion<T>::Apply(q.data(), a.data(), each.data(), kCount);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        CHECK(one[i] == q[0].Apply(a[i]));
+        CHECK(each[i] == q[i].Apply(a[i]));
+    }
+}
+
+template<typename T>
+void CheckConversionsMatchScalar()
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-40000.f, 40000.f);
+
+    std::vector<Vector3> v(kCount);
+    for (Vector3& p : v)
+        p = Vector3(dist(rng), dist(rng) * 1e-4f, dist(rng) * 1e-9f);
+
+    v[3] = Vector3(NAN, INFINITY, -INFINITY);
+    v[4] = Vector3(-0.f, 1e30f, -1e30f);
+
+    std::vector<FixedVector3<T>> f(kCount);
+    std::vector<Vector3> back(kCount);
+
+    FixedVector3<T>::FromFloat(v.data(), f.data(), kCount);
+    FixedVector3<T>::ToFloat(f.data(), back.data(), kCount);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        CHECK(f[i] == FixedVector3<T>(v[i]));
+        CHECK(back[i] == f[i].ToFloat());
+    }
+
+    CHECK(f[3].x == T());
+    CHECK(f[3].y == T::Highest());
+    CHECK(f[3].z == T::Lowest());
+}
+
+} // namespace
+
+TEST_CASE("Fixed point arithmetic saturates and rounds to nearest", "[Fixed]")
+{
+    CHECK(Q16(1.5f).raw == 3 << 15);
+    CHECK(Q16(-2).raw == -(2 << 16));
+    CHECK(static_cast<float>(Q16(0.25f)) == 0.25f);
+
+    CHECK(Q16::Highest() + Q16::Epsilon() == Q16::Highest());
+    CHECK(Q16::Lowest() - Q16::Epsilon() == Q16::Lowest());
+    CHECK(-Q16::Lowest() == Q16::Highest());
+    CHECK(Q16(30000) * Q16(2) == Q16::Highest());
+    CHECK(Q16(30000) * Q16(-2) == Q16::Lowest());
+    CHECK(Q16(40000.f) == Q16::Highest());
+    CHECK(Q16(NAN) == Q16());
+
+    // Ties round towards +infinity
+    CHECK((Q16::Epsilon() * Q16(0.5f)).raw == 1);
+    CHECK((-Q16::Epsilon() * Q16(0.5f)).raw == 0);
+
+    CHECK((Q16(1) / Q16(3)).raw == 21845);
+    CHECK((Q16(2) / Q16(3)).raw == 43691);
+    CHECK(Q16(1) / Q16() == Q16::Highest());
+    CHECK(Q16(-1) / Q16() == Q16::Lowest());
+    CHECK(Q16() / Q16() == Q16());
+
+    CHECK(Q32(1.5).raw == int64_t(3) << 31);
+    CHECK(Q32(2000000000) * Q32(2) == Q32::Highest());
+    CHECK((Q32(1) / Q32(3)).raw == 1431655765);
+}
+
+TEST_CASE("Fixed point square roots are within a unit of the exact value", "[Fixed]")
+{
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int32_t> dist(1, INT32_MAX);
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        Q16 x = Q16::FromRaw(dist(rng));
+        double d = static_cast<double>(x);
+
+        CHECK(std::fabs(static_cast<double>(x.Sqrt()) - std::sqrt(d)) <= 1.0 / 65536);
+
+        // Saturates for tiny inputs
+        double inv = std::min(1.0 / std::sqrt(d), static_cast<double>(Q16::Highest()));
+        CHECK(std::fabs(static_cast<double>(x.InvSqrt()) - inv) <= 1.0 / 65536);
+    }
+
+    CHECK(Q16(-4).Sqrt() == Q16());
+    CHECK(Q16().InvSqrt() == Q16::Highest());
+    CHECK(Q16(4).Sqrt() == Q16(2));
+    CHECK(Q32(4).InvSqrt() == Q32(0.5));
+}
+
+TEST_CASE("Fixed point SinCos matches the C library", "[Fixed]")
+{
+    for (double a = -100.0; a <= 100.0; a += 0.0137)
+    {
+        Q16 s16, c16;
+        SinCos(Q16(a), s16, c16);
+
+        // Error in the input conversion grows with the angle's resolution, not its size
+        double x16 = static_cast<double>(Q16(a));
+        CHECK(std::fabs(static_cast<double>(s16) - std::sin(x16)) <= 4.0 / 65536);
+        CHECK(std::fabs(static_cast<double>(c16) - std::cos(x16)) <= 4.0 / 65536);
+
+        Q32 s32, c32;
+        SinCos(Q32(a), s32, c32);
+
+        double x32 = static_cast<double>(Q32(a));
+        CHECK(std::fabs(static_cast<double>(s32) - std::sin(x32)) <= 1e-8);
+        CHECK(std::fabs(static_cast<double>(c32) - std::cos(x32)) <= 1e-8);
+    }
+}
+
+TEST_CASE("Fixed point normalize keeps the precision of small vectors", "[Fixed]")
+{
+    Vector3Q16 v(Q16::FromRaw(3), Q16::FromRaw(4), Q16());
+    v.Normalize();
+
+    CHECK(v.x == Q16(0.6f));
+    CHECK(v.y == Q16(0.8f));
+    CHECK(v.IsNormalized());
+
+    CHECK(Vector3Q16().Normalized() == Vector3Q16());
+    CHECK(Vector3Q16(Q16(20000), Q16(20000), Q16(20000)).Normalized().IsNormalized());
+    CHECK(Vector3Q16(Q16(3), Q16(4), Q16()).Length() == Q16(5));
+
+    Vector4Q32 w(Q32(1), Q32(-2), Q32(3), Q32(-4));
+    CHECK(w.Normalized().IsNormalized());
+    CHECK(static_cast<double>(w.Length()) == Approx(std::sqrt(30.0)));
+}
+
+TEST_CASE("Fixed point batches are bitwise identical to the scalar functions", "[Fixed]")
+{
+    CheckBatchesMatchScalar<Q16>();
+    CheckBatchesMatchScalar<Q32>();
+
+    CheckConversionsMatchScalar<Q16>();
+    CheckConversionsMatchScalar<Q32>();
+}
+
+TEST_CASE("Fixed point matrices and quaternions agree with float", "[Fixed]")
+{
+    Quaternion rotation(Vector3(1.f, 2.f, -0.5f), 0.8f);
+    Matrix4x4 m = Matrix4x4::Translate(Vector3(3.f, -1.f, 2.f)) * Matrix4x4::QuatRotate(Vector4(rotation.x, rotation.y, rotation.z, rotation.w)) *
+        Matrix4x4::Scale(Vector3(2.f, 1.f, 0.5f));
+
+    Matrix4x4Q16 m16(m);
+    Matrix4x4Q32 m32(m);
+
+    Matrix4x4 inv16 = m16.Inverse().ToFloat();
+    Matrix4x4 inv32 = m32.Inverse().ToFloat();
+    Matrix4x4 inv = m.Inverse();
+
+    Matrix4x4 identity16 = (m16 * m16.Inverse()).ToFloat();
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+        {
+            CHECK(inv16[col][row] == Approx(inv[col][row]).margin(1e-3));
+            CHECK(inv32[col][row] == Approx(inv[col][row]).margin(1e-5));
+            CHECK(identity16[col][row] == Approx((col == row) ? 1.f : 0.f).margin(1e-3));
+        }
+
+    CHECK(Matrix4x4Q16().Inverse() == Matrix4x4Q16::Identity());
+
+    Vector3 v(5.f, -7.f, 0.25f);
+    Vector3 expected = rotation.Apply(v);
+
+    QuaternionQ16 q16(Vector3Q16(Q16(1), Q16(2), Q16(-0.5f)), Q16(0.8f));
+    QuaternionQ32 q32(rotation);
+
+    Vector3 r16 = q16.Apply(Vector3Q16(v)).ToFloat();
+    Vector3 r32 = q32.Apply(Vector3Q32(v)).ToFloat();
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        CHECK(r16[k] == Approx(expected[k]).margin(1e-3));
+        CHECK(r32[k] == Approx(expected[k]).margin(1e-5));
+    }
+
+    CHECK(q16.IsNormalized());
+    CHECK((q16 * QuaternionQ16()) == q16);
+}
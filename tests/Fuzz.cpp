@@ -0,0 +1,78 @@
+// Differential fuzz target, interprets the input as raw floats so any bit pattern can reach the kernels
+
+#include "Differential.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+using namespace Differential;
+
+namespace
+{
+
+// Enough elements for a full AVX block and a tail
+constexpr size_t kMaxCount = 19;
+
+void Report(const std::optional<Mismatch>& mismatch)
+{
+    if (!mismatch)
+        return;
+
+    std::cerr << *mismatch << std::endl;
+    std::abort();
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    // Each element takes two matrices, the first doubles as a quaternion and vector
+    size_t count = size / (2 * sizeof(Matrix4x4));
+    count = (count < kMaxCount) ? count : kMaxCount;
+
+    if (count == 0)
+        return 0;
+
+    std::vector<Matrix4x4> a(count), b(count);
+    std::vector<Quaternion> q(count);
+    std::vector<Vector3> v(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        std::memcpy(reinterpret_cast<float*>(&a[i]), data + (2 * i * sizeof(Matrix4x4)), sizeof(Matrix4x4));
+        std::memcpy(reinterpret_cast<float*>(&b[i]), data + (((2 * i) + 1) * sizeof(Matrix4x4)), sizeof(Matrix4x4));
+
+        q[i] = Quaternion(a[i][0]);
+        v[i] = Vector3(a[i][1]);
+    }
+
+    for (Backend backend : Backends())
+    {
+        Report(CheckMultiply(backend, a.data(), b.data(), count));
+        Report(CheckInverse(backend, a.data(), count));
+        Report(CheckApply(backend, q.data(), v.data(), count));
+    }
+
+    return 0;
+}
+
+#ifdef FMATHS_FUZZ_REPLAY
+// Without libFuzzer, replay the inputs given on the command line
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::ifstream file(argv[i], std::ios::binary);
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+        std::printf("%s: ok\n", argv[i]);
+    }
+
+    return 0;
+}
+#endif
@@ -0,0 +1,169 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Geometry.h>
+
+#include <vector>
+
+using Catch::Approx;
+
+TEST_CASE("Ray triangle intersection", "[Geometry]")
+{
+    Triangle tri(Vector3(-1.f, -1.f, 0.f), Vector3(1.f, -1.f, 0.f), Vector3(0.f, 1.f, 0.f));
+    float t = 0.f;
+
+    REQUIRE(tri.Intersect(Ray(Vector3(0.f, 0.f, 5.f), Vector3(0.f, 0.f, -1.f)), t));
+    REQUIRE(t == Approx(5.f));
+
+    // Two sided
+    REQUIRE(tri.Intersect(Ray(Vector3(0.f, 0.f, -2.f), Vector3(0.f, 0.f, 1.f)), t));
+    REQUIRE(t == Approx(2.f));
+
+    REQUIRE_FALSE(tri.Intersect(Ray(Vector3(5.f, 0.f, 5.f), Vector3(0.f, 0.f, -1.f)), t));
+    REQUIRE_FALSE(tri.Intersect(Ray(Vector3(0.f, 0.f, 5.f), Vector3(0.f, 0.f, 1.f)), t));
+}
+
+TEST_CASE("Ray AABB intersection", "[Geometry]")
+{
+    AABB box(Vector3(-1.f, -1.f, -1.f), Vector3(1.f, 1.f, 1.f));
+    float t = -1.f;
+
+    REQUIRE(box.Intersect(Ray(Vector3(-5.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f)), t));
+    REQUIRE(t == Approx(4.f));
+
+    REQUIRE(box.Intersect(Ray(Vector3(0.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f)), t));
+    REQUIRE(t == 0.f);
+
+    REQUIRE_FALSE(box.Intersect(Ray(Vector3(-5.f, 3.f, 0.f), Vector3(1.f, 0.f, 0.f)), t));
+
+    // Lying in a face, along an edge, and parallel to a face just outside
+    const Ray grazing[] = {
+        Ray(Vector3(-5.f, 1.f, 0.f), Vector3(1.f, 0.f, 0.f)),
+        Ray(Vector3(-5.f, 1.f, -1.f), Vector3(1.f, 0.f, 0.f)),
+        Ray(Vector3(-5.f, 1.0001f, 0.f), Vector3(1.f, 0.f, 0.f)),
+    };
+
+    REQUIRE(box.Intersect(grazing[0], t));
+    REQUIRE(t == Approx(4.f));
+    REQUIRE(box.Intersect(grazing[1], t));
+    REQUIRE(t == Approx(4.f));
+    REQUIRE_FALSE(box.Intersect(grazing[2], t));
+
+    // The lanes agree, with every box of a packet and the tail the same
+    AABBArray boxes;
+    for (size_t i = 0; i < 11; i++)
+        boxes.Push(box);
+
+    uint32_t mask = 0;
+    float dist[11];
+
+    REQUIRE(IntersectRay(grazing[0], boxes, &mask, dist) == 11);
+    REQUIRE(dist[10] == Approx(4.f));
+    REQUIRE(IntersectRay(grazing[1], boxes, &mask, dist) == 11);
+    REQUIRE(IntersectRay(grazing[2], boxes, &mask, dist) == 0);
+}
+
+TEST_CASE("Batched queries match scalar", "[Geometry]")
+{
+    // Grid of triangles and boxes along x, some of which the ray misses
+    std::vector<Triangle> tris;
+    TriangleArray triArray;
+    AABBArray boxArray;
+
+    for (size_t i = 0; i < 37; i++)
+    {
+        float x = static_cast<float>(i);
+        float y = (i % 3 == 0) ? 10.f : 0.f;
+
+        Triangle tri(Vector3(x, y - 1.f, -1.f), Vector3(x, y + 1.f, -1.f), Vector3(x, y, 1.f));
+        tris.push_back(tri);
+        triArray.Push(tri);
+        boxArray.Push(AABB(Vector3(x - 0.25f, y - 0.5f, -0.5f), Vector3(x + 0.25f, y + 0.5f, 0.5f)));
+    }
+
+    Ray ray(Vector3(-10.f, 0.1f, 0.1f), Vector3(1.f, 0.f, 0.f));
+
+    std::vector<uint32_t> mask(2);
+    std::vector<float> dist(tris.size());
+
+    size_t hits = IntersectRay(ray, triArray, mask.data(), dist.data());
+    size_t expectedHits = 0;
+
+    for (size_t i = 0; i < tris.size(); i++)
+    {
+        float t = 0.f;
+        bool hit = tris[i].Intersect(ray, t);
+        bool batchHit = (mask[i / 32] >> (i % 32)) & 1;
+
+        REQUIRE(hit == batchHit);
+        if (hit)
+            REQUIRE(dist[i] == Approx(t));
+
+        expectedHits += hit;
+    }
+
+    REQUIRE(hits == expectedHits);
+
+    hits = IntersectRay(ray, boxArray, mask.data(), dist.data());
+    for (size_t i = 0; i < tris.size(); i++)
+    {
+        float t = 0.f;
+        bool hit = boxArray[i].Intersect(ray, t);
+        bool batchHit = (mask[i / 32] >> (i % 32)) & 1;
+
+        REQUIRE(hit == batchHit);
+        if (hit)
+            REQUIRE(dist[i] == Approx(t));
+    }
+
+    REQUIRE(hits == expectedHits);
+
+    TrianglePacket8 packet(tris.data(), 5);
+    float packetDist[8];
+    uint32_t packetMask = IntersectRay(ray, packet, packetDist);
+
+    REQUIRE(packetMask == (mask[0] & 0x1f));
+}
+
+TEST_CASE("Closest point on triangle", "[Geometry]")
+{
+    Triangle tri(Vector3(0.f, 0.f, 0.f), Vector3(2.f, 0.f, 0.f), Vector3(0.f, 2.f, 0.f));
+
+    // One query per Voronoi region plus the face
+    std::vector<Vector3> points = {
+        Vector3(-1.f, -1.f, 1.f),   // v0
+        Vector3(3.f, -1.f, 0.f),    // v1
+        Vector3(-1.f, 3.f, 0.f),    // v2
+        Vector3(1.f, -1.f, 0.f),    // edge v0 v1
+        Vector3(-1.f, 1.f, 0.f),    // edge v0 v2
+        Vector3(2.f, 2.f, 0.f),     // edge v1 v2
+        Vector3(0.5f, 0.5f, 3.f),   // face
+    };
+
+    std::vector<Vector3> expected = {
+        Vector3(0.f, 0.f, 0.f),
+        Vector3(2.f, 0.f, 0.f),
+        Vector3(0.f, 2.f, 0.f),
+        Vector3(1.f, 0.f, 0.f),
+        Vector3(0.f, 1.f, 0.f),
+        Vector3(1.f, 1.f, 0.f),
+        Vector3(0.5f, 0.5f, 0.f),
+    };
+
+    TriangleArray triArray;
+    for (size_t i = 0; i < points.size(); i++)
+        triArray.Push(tri);
+
+    std::vector<Vector3> batch(points.size());
+    ClosestPoints(points.data(), triArray, batch.data());
+
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        Vector3 scalar = tri.ClosestPoint(points[i]);
+
+        for (size_t axis = 0; axis < 3; axis++)
+        {
+            REQUIRE(scalar[axis] == Approx(expected[i][axis]).margin(1e-6));
+            REQUIRE(batch[i][axis] == Approx(expected[i][axis]).margin(1e-6));
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#include <catch2/catch_test_macros.hpp>
+#include <FMaths/Layout.h>
+#include <FMaths/Matrix4x4.h>
+#include <FMaths/Vector3.h>
+#include <FMaths/Vector4.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+// Counts around the SIMD and block widths, plus one past the streaming threshold for every type
+const size_t kCounts[] = {0, 1, 3, 4, 7, 8, 9, 17, 64, 67, 200, (kStreamThreshold / sizeof(Vector3)) + 4};
+
+struct AlignedFree
+{
+    void operator()(float* p) const { std::free(p); }
+};
+
+// 32 byte aligned so large outputs take the non-temporal path
+std::unique_ptr<float[], AlignedFree> AlignedFloats(size_t count)
+{
+    size_t bytes = ((count * sizeof(float)) + 31) & ~size_t(31);
+    return std::unique_ptr<float[], AlignedFree>(static_cast<float*>(std::aligned_alloc(32, bytes == 0 ? 32 : bytes)));
+}
+
+float Value(size_t i, size_t k)
+{
+    return static_cast<float>((i * 16) + k) * 0.5f;
+}
+
+} // namespace
+
+TEST_CASE("Vector SoA round trip", "[Layout]")
+{
+    for (size_t count : kCounts)
+    {
+        std::vector<Vector3> v3(count), back3(count);
+        std::vector<Vector4> v4(count), back4(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            v3[i] = Vector3(Value(i, 0), Value(i, 1), Value(i, 2));
+            v4[i] = Vector4(Value(i, 0), Value(i, 1), Value(i, 2), Value(i, 3));
+        }
+
+        auto x = AlignedFloats(count), y = AlignedFloats(count), z = AlignedFloats(count), w = AlignedFloats(count);
+
+        ToSoA(v3.data(), count, x.get(), y.get(), z.get());
+
+        bool same = true;
+        for (size_t i = 0; i < count; i++)
+            same = same && x[i] == v3[i].x && y[i] == v3[i].y && z[i] == v3[i].z;
+
+        REQUIRE(same);
+
+        FromSoA(x.get(), y.get(), z.get(), count, back3.data());
+        REQUIRE(back3 == v3);
+
+        ToSoA(v4.data(), count, x.get(), y.get(), z.get(), w.get());
+        for (size_t i = 0; i < count; i++)
+            same = same && x[i] == v4[i].x && y[i] == v4[i].y && z[i] == v4[i].z && w[i] == v4[i].w;
+
+        REQUIRE(same);
+
+        FromSoA(x.get(), y.get(), z.get(), w.get(), count, back4.data());
+        REQUIRE(back4 == v4);
+    }
+}
+
+TEST_CASE("Vector AoSoA round trip", "[Layout]")
+{
+    for (size_t count : kCounts)
+    {
+        std::vector<Vector3> v3(count), back3(count);
+        std::vector<Vector4> v4(count), back4(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            v3[i] = Vector3(Value(i, 0), Value(i, 1), Value(i, 2));
+            v4[i] = Vector4(Value(i, 0), Value(i, 1), Value(i, 2), Value(i, 3));
+        }
+
+        REQUIRE(AoSoASize(count, 3) % (3 * kAoSoAWidth) == 0);
+
+        auto blocks = AlignedFloats(AoSoASize(count, 4));
+
+        ToAoSoA(v3.data(), count, blocks.get());
+
+        bool same = true;
+        for (size_t i = 0; i < AoSoASize(count, 3) / 3; i++)
+        {
+            const float* block = blocks.get() + ((i / kAoSoAWidth) * 3 * kAoSoAWidth) + (i % kAoSoAWidth);
+            for (size_t k = 0; k < 3; k++)
+                same = same && block[k * kAoSoAWidth] == (i < count ? v3[i][k] : 0.f);
+        }
+
+        REQUIRE(same);
+
+        FromAoSoA(blocks.get(), count, back3.data());
+        REQUIRE(back3 == v3);
+
+        ToAoSoA(v4.data(), count, blocks.get());
+        for (size_t i = 0; i < count; i++)
+        {
+            const float* block = blocks.get() + ((i / kAoSoAWidth) * 4 * kAoSoAWidth) + (i % kAoSoAWidth);
+            for (size_t k = 0; k < 4; k++)
+                same = same && block[k * kAoSoAWidth] == v4[i][k];
+        }
+
+        REQUIRE(same);
+
+        FromAoSoA(blocks.get(), count, back4.data());
+        REQUIRE(back4 == v4);
+    }
+}
+
+TEST_CASE("Matrix SoA and AoSoA round trip", "[Layout]")
+{
+    for (size_t count : kCounts)
+    {
+        std::vector<Matrix4x4> m(count), back(count);
+        for (size_t i = 0; i < count; i++)
+            for (size_t k = 0; k < 16; k++)
+                m[i][k / 4][k % 4] = Value(i, k);
+
+        auto soa = AlignedFloats(16 * count);
+        ToSoA(m.data(), count, soa.get());
+
+        bool same = true;
+        for (size_t i = 0; i < count; i++)
+            for (size_t k = 0; k < 16; k++)
+                same = same && soa[(k * count) + i] == m[i][k / 4][k % 4];
+
+        REQUIRE(same);
+
+        FromSoA(soa.get(), count, back.data());
+        REQUIRE(back == m);
+
+        auto blocks = AlignedFloats(AoSoASize(count, 16));
+        ToAoSoA(m.data(), count, blocks.get());
+
+        for (size_t i = 0; i < AoSoASize(count, 16) / 16; i++)
+        {
+            const float* block = blocks.get() + ((i / kAoSoAWidth) * 16 * kAoSoAWidth) + (i % kAoSoAWidth);
+            for (size_t k = 0; k < 16; k++)
+                same = same && block[k * kAoSoAWidth] == (i < count ? m[i][k / 4][k % 4] : 0.f);
+        }
+
+        REQUIRE(same);
+
+        std::fill(back.begin(), back.end(), Matrix4x4());
+        FromAoSoA(blocks.get(), count, back.data());
+        REQUIRE(back == m);
+    }
+}
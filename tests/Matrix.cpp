@@ -1,5 +1,14 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Matrix3x3.h>
 #include <FMaths/Matrix4x4.h>
+#include <FMaths/Quaternion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using Catch::Approx;
 
 TEST_CASE("Accessing variables", "[Matrix4x4]")
 {
@@ -9,4 +18,421 @@ TEST_CASE("Accessing variables", "[Matrix4x4]")
     REQUIRE(((float*)&mat)[5] == 1.f);
     REQUIRE(((float*)&mat)[10] == 1.f);
     REQUIRE(((float*)&mat)[15] == 1.f);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Quaternion round trip through rotation matrix", "[Matrix4x4]")
+{
+    std::vector<Quaternion> rotations = {
+        Quaternion(),
+        Quaternion(Vector3(1.f, 0.f, 0.f), 3.14159265f), // w pivot is 0, needs x pivot
+        Quaternion(Vector3(0.f, 1.f, 0.f), 3.14159265f),
+        Quaternion(Vector3(0.f, 0.f, 1.f), 3.14159265f),
+        Quaternion(Vector3(1.f, 2.f, 3.f), 0.7f),
+        Quaternion(Vector3(-3.f, 1.f, 0.5f), 2.5f),
+        Quaternion(Vector3(0.2f, -1.f, 0.1f), -1.2f),
+        Quaternion(Vector3(1.f, 1.f, 1.f), 4.f),
+        Quaternion(Vector3(0.f, 1.f, 1.f), 6.f),
+    };
+
+    std::vector<Matrix4x4> matrices;
+    for (const Quaternion& q : rotations)
+        matrices.push_back(Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w)));
+
+    std::vector<Quaternion> batch(rotations.size());
+    Quaternion::FromMatrices(matrices.data(), batch.data(), matrices.size());
+
+    for (size_t i = 0; i < rotations.size(); i++)
+    {
+        // q and -q are the same rotation
+        REQUIRE(fabsf(Quaternion::FromMatrix(matrices[i]).Dot(rotations[i])) == Approx(1.f));
+        REQUIRE(fabsf(batch[i].Dot(rotations[i])) == Approx(1.f));
+    }
+}
+
+TEST_CASE("Decompose translation, rotation and scale", "[Matrix4x4]")
+{
+    Vector3 translation(1.f, -2.f, 3.f);
+    Quaternion rotation(Vector3(1.f, 2.f, 0.5f), 1.1f);
+
+    std::vector<Vector3> scales = {
+        Vector3(1.f, 1.f, 1.f),
+        Vector3(2.f, 0.5f, 3.f),
+        Vector3(-1.f, 1.f, 1.f),
+        Vector3(1.f, 0.f, 1.f),
+    };
+
+    std::vector<Matrix4x4> matrices;
+    for (const Vector3& s : scales)
+        matrices.push_back(
+            Matrix4x4::Translate(translation)
+            * Matrix4x4::QuatRotate(Vector4(rotation.x, rotation.y, rotation.z, rotation.w))
+            * Matrix4x4::Scale(s)
+        );
+
+    // Pad past a full SIMD block so both paths run
+    while (matrices.size() < 11)
+        matrices.push_back(matrices[matrices.size() % 3]);
+
+    std::vector<Vector3> t(matrices.size()), s(matrices.size());
+    std::vector<Quaternion> r(matrices.size());
+    Matrix4x4::Decompose(matrices.data(), t.data(), r.data(), s.data(), matrices.size());
+
+    for (size_t i = 0; i < matrices.size(); i++)
+    {
+        Vector3 ti, si;
+        Quaternion ri;
+        bool valid = matrices[i].Decompose(ti, ri, si);
+
+        Vector3 expected = scales[i < scales.size() ? i : i % 3];
+        REQUIRE(valid == (i != 3));
+
+        for (size_t axis = 0; axis < 3; axis++)
+        {
+            REQUIRE(ti[axis] == Approx(translation[axis]));
+            REQUIRE(t[i][axis] == Approx(translation[axis]));
+            REQUIRE(si[axis] == Approx(expected[axis]).margin(1e-6));
+            REQUIRE(s[i][axis] == Approx(expected[axis]).margin(1e-6));
+        }
+
+        if (valid)
+        {
+            REQUIRE(fabsf(ri.Dot(rotation)) == Approx(1.f));
+            REQUIRE(fabsf(r[i].Dot(rotation)) == Approx(1.f));
+        }
+        else
+        {
+            REQUIRE(ri == Quaternion());
+            REQUIRE(r[i] == Quaternion());
+        }
+    }
+}
+
+TEST_CASE("Matrix vector multiplication", "[Matrix4x4]")
+{
+    Matrix4x4 m = Matrix4x4::Translate(Vector3(1.f, 2.f, 3.f)) * Matrix4x4::Scale(Vector3(2.f, 3.f, 4.f));
+    Vector4 v = m * Vector4(1.f, 1.f, 1.f, 1.f);
+
+    REQUIRE(v == Vector4(3.f, 5.f, 7.f, 1.f));
+}
+
+TEST_CASE("Compensated multiplication limits drift", "[Matrix4x4]")
+{
+    Quaternion q(Vector3(1.f, 2.f, 3.f), 0.01f);
+    Matrix4x4 step = Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w));
+
+    // Reference chain in double precision from the same float step matrix
+    double ref[4][4], next[4][4];
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+            ref[col][row] = col == row ? 1.0 : 0.0;
+
+    Matrix4x4 plain = Matrix4x4::Identity();
+    Matrix4x4 compensated = Matrix4x4::Identity();
+
+    for (size_t n = 0; n < 2000; n++)
+    {
+        plain = plain * step;
+        compensated = compensated.MultiplyCompensated(step);
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+            {
+                next[col][row] = 0.0;
+                for (size_t i = 0; i < 4; i++)
+                    next[col][row] += ref[i][row] * static_cast<double>(step[col][i]);
+            }
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                ref[col][row] = next[col][row];
+    }
+
+    double plainError = 0.0;
+    double compensatedError = 0.0;
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+        {
+            plainError = std::max(plainError, fabs(plain[col][row] - ref[col][row]));
+            compensatedError = std::max(compensatedError, fabs(compensated[col][row] - ref[col][row]));
+        }
+
+    REQUIRE(compensatedError <= plainError);
+    REQUIRE(compensatedError < 1e-5);
+}
+
+/**
+ * @brief Largest deviation of the upper 3x3 from orthonormal
+ */
+static float OrthonormalError(const Matrix4x4& m)
+{
+    float error = 0.f;
+
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++)
+        {
+            float d = Vector3(m[i]).Dot(Vector3(m[j])) - (i == j ? 1.f : 0.f);
+            error = std::max(error, fabsf(d));
+        }
+
+    return error;
+}
+
+TEST_CASE("Orthonormalize drifted rotations", "[Matrix4x4]")
+{
+    std::vector<Matrix4x4> drifted;
+
+    for (size_t i = 0; i < 13; i++)
+    {
+        float f = static_cast<float>(i);
+        Quaternion q(Vector3(f, 1.f, 2.f - f), f * 0.4f);
+        Matrix4x4 m = Matrix4x4::Translate(Vector3(f, 0.f, 0.f)) * Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w));
+
+        // Perturb the basis as accumulated rounding would
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+                m[col][row] += 1e-3f * sinf(f + static_cast<float>(col * 3 + row));
+
+        drifted.push_back(m);
+    }
+
+    std::vector<Matrix4x4> gramSchmidt = drifted;
+    std::vector<Matrix4x4> polar = drifted;
+
+    Matrix4x4::Orthonormalize(gramSchmidt.data(), gramSchmidt.size());
+    Matrix4x4::OrthonormalizePolar(polar.data(), polar.size(), 2);
+
+    for (size_t i = 0; i < drifted.size(); i++)
+    {
+        REQUIRE(OrthonormalError(drifted[i]) > 1e-4f);
+        REQUIRE(OrthonormalError(gramSchmidt[i]) < 1e-6f);
+        REQUIRE(OrthonormalError(polar[i]) < 1e-6f);
+
+        // x keeps its direction and translation is untouched
+        Vector3 x = Vector3(drifted[i][0]).Normalized();
+        REQUIRE(Vector3(gramSchmidt[i][0]).Dot(x) == Approx(1.f));
+        REQUIRE(gramSchmidt[i][3] == drifted[i][3]);
+        REQUIRE(polar[i][3] == drifted[i][3]);
+
+        // Stays close to the drifted basis, and right handed
+        for (size_t col = 0; col < 3; col++)
+            for (size_t row = 0; row < 3; row++)
+                REQUIRE(polar[i][col][row] == Approx(drifted[i][col][row]).margin(5e-3));
+
+        Vector3 z = Vector3(polar[i][0]).Cross(Vector3(polar[i][1]));
+        REQUIRE(z.Dot(Vector3(polar[i][2])) == Approx(1.f));
+
+        Matrix4x4 single = drifted[i];
+        REQUIRE(single.Orthonormalize() == gramSchmidt[i]);
+    }
+}
+
+TEST_CASE("Renormalize drifted quaternions", "[Quaternion]")
+{
+    std::vector<Quaternion> quats;
+
+    for (size_t i = 0; i < 11; i++)
+    {
+        float f = static_cast<float>(i);
+        quats.push_back(Quaternion(Vector3(1.f, f, -f), f) * (1.f + (1e-3f * (f - 5.f))));
+    }
+
+    std::vector<float> before;
+    for (const Quaternion& q : quats)
+        before.push_back(q.MagnitudeSquared() - 1.f);
+
+    Quaternion::Renormalize(quats.data(), quats.size());
+
+    // Error e in |q|^2 becomes roughly 3e^2 / 4
+    for (size_t i = 0; i < quats.size(); i++)
+        REQUIRE(fabsf(quats[i].MagnitudeSquared() - 1.f) <= (0.8f * before[i] * before[i]) + 1e-6f);
+}
+
+TEST_CASE("Approximate matrix and quaternion comparison", "[Matrix4x4]")
+{
+    Matrix4x4 m = Matrix4x4::Translate(Vector3(1.f, 2.f, 3.f));
+    Matrix4x4 inv = m.Inverse().Inverse();
+
+    REQUIRE(m == Matrix4x4::Translate(Vector3(1.f, 2.f, 3.f)));
+    REQUIRE(m.ApproxEqual(inv));
+    REQUIRE(m.UlpEqual(inv));
+
+    Matrix4x4 n = m;
+    n[0][0] = std::nanf("");
+    REQUIRE_FALSE(n == m);
+    REQUIRE_FALSE(n.ApproxEqual(m));
+    REQUIRE(n != m);
+
+    Quaternion q = Quaternion::FromEuler(Vector3(0.3f, 0.2f, 0.1f));
+    Quaternion r = Quaternion::FromMatrix(Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w)));
+
+    REQUIRE(q.ApproxEqual(r));
+    REQUIRE_FALSE(q.ApproxEqual(q * -1.f));
+}
+
+TEST_CASE("Transpose", "[Matrix4x4]")
+{
+    std::vector<Matrix4x4> m(13);
+    for (size_t i = 0; i < m.size(); i++)
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                m[i][col][row] = static_cast<float>((i * 16) + (col * 4) + row);
+
+    Matrix4x4 t = m[1].Transpose();
+    REQUIRE(t[0][1] == m[1][1][0]);
+    REQUIRE(t[3][2] == m[1][2][3]);
+    REQUIRE(t.Transpose() == m[1]);
+
+    std::vector<Matrix4x4> batch(m);
+    Matrix4x4::Transpose(batch.data(), batch.data(), batch.size());
+
+    for (size_t i = 0; i < m.size(); i++)
+        REQUIRE(batch[i] == m[i].Transpose());
+}
+
+namespace
+{
+
+Vector3 Project(const Matrix4x4& m, const Vector3& p)
+{
+    Vector4 clip = m * Vector4(p.x, p.y, p.z, 1.f);
+    return Vector3(clip.x / clip.w, clip.y / clip.w, clip.z / clip.w);
+}
+
+} // namespace
+
+TEST_CASE("View matrices", "[Matrix4x4]")
+{
+    Vector3 eye(3.f, 2.f, -5.f);
+    Vector3 target(-1.f, 0.5f, 4.f);
+    Matrix4x4 view = Matrix4x4::LookAt(eye, target, Vector3(0.f, 1.f, 0.f));
+
+    // Eye to the origin, target straight down -z
+    Vector4 origin = view * Vector4(eye.x, eye.y, eye.z, 1.f);
+    Vector4 ahead = view * Vector4(target.x, target.y, target.z, 1.f);
+    REQUIRE(Vector3(origin).ApproxEqual(Vector3(0.f, 0.f, 0.f)));
+    REQUIRE(Vector3(ahead).ApproxEqual(Vector3(0.f, 0.f, -(target - eye).Length())));
+
+    // Same camera placed with a rotation
+    Quaternion q = Quaternion::FromMatrix(view.Inverse());
+    Matrix4x4 placed = Matrix4x4::View(eye, q);
+    REQUIRE(placed.ApproxEqual(view));
+    REQUIRE(placed.ApproxEqual((Matrix4x4::Translate(eye) * Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w))).Inverse()));
+}
+
+TEST_CASE("Reverse-Z and infinite projections", "[Matrix4x4]")
+{
+    const float near = 0.1f, far = 100.f;
+
+    Matrix4x4 reverse = Matrix4x4::PerspectiveReverseZ(1.2f, 16.f, 9.f, near, far);
+    REQUIRE(Project(reverse, Vector3(0.f, 0.f, -near)).z == Approx(1.f));
+    REQUIRE(Project(reverse, Vector3(0.f, 0.f, -far)).z == Approx(0.f).margin(1e-6));
+
+    Matrix4x4 infinite = Matrix4x4::PerspectiveReverseZ(1.2f, 16.f, 9.f, near, INFINITY);
+    REQUIRE(Project(infinite, Vector3(0.f, 0.f, -near)).z == Approx(1.f));
+    REQUIRE(Project(infinite, Vector3(0.f, 0.f, -1e30f)).z == Approx(0.f).margin(1e-6));
+
+    // The infinite forward projection is the limit of the finite one
+    Matrix4x4 forward = Matrix4x4::Perspective(1.2f, 16.f, 9.f, near, INFINITY);
+    REQUIRE(forward.ApproxEqual(Matrix4x4::Perspective(1.2f, 16.f, 9.f, near, 1e9f)));
+    REQUIRE(Project(forward, Vector3(0.f, 0.f, -near)).z == Approx(-1.f));
+
+    for (size_t col = 0; col < 4; col++)
+        for (size_t row = 0; row < 4; row++)
+            REQUIRE(std::isfinite(infinite[col][row]));
+}
+
+TEST_CASE("Fused view projection", "[Matrix4x4]")
+{
+    std::vector<Matrix4x4> views, projections;
+    for (size_t i = 0; i < 11; i++)
+    {
+        float f = static_cast<float>(i);
+        views.push_back(Matrix4x4::LookAt(Vector3(f, 10.f - f, 3.f), Vector3(-f, 0.f, 1.f), Vector3(0.f, 1.f, 0.f)));
+    }
+
+    // Cascade style orthographic boxes, plus each perspective variant
+    for (size_t i = 0; i < 8; i++)
+    {
+        float extent = 5.f * static_cast<float>(i + 1);
+        projections.push_back(Matrix4x4::Orthographic(Vector3(-extent, -extent * 0.5f, 1.f), Vector3(extent, extent, 50.f + extent)));
+    }
+
+    projections.push_back(Matrix4x4::Perspective(1.f, 4.f, 3.f, 0.5f, 200.f));
+    projections.push_back(Matrix4x4::PerspectiveReverseZ(1.f, 4.f, 3.f, 0.5f, 200.f));
+    projections.push_back(Matrix4x4::PerspectiveReverseZ(1.f, 4.f, 3.f, 0.5f, INFINITY));
+
+    std::vector<Matrix4x4> out(views.size()), inverse(views.size());
+    Matrix4x4::ViewProjection(views.data(), projections.data(), out.data(), inverse.data(), views.size());
+
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        Matrix4x4 inv;
+        Matrix4x4 vp = Matrix4x4::ViewProjection(views[i], projections[i], inv);
+
+        REQUIRE(out[i] == vp);
+        REQUIRE(inverse[i] == inv);
+        REQUIRE(vp.ApproxEqual(projections[i] * views[i]));
+
+        // Round trip a point inside the frustum
+        Vector3 world = Vector3(-1.f, 2.f, 0.5f);
+        Vector3 ndc = Project(vp, world);
+        REQUIRE(Project(inv, ndc).ApproxEqual(world, 1e-3f));
+        REQUIRE((inv * vp).ApproxEqual(Matrix4x4::Identity(), 1e-4f));
+    }
+}
+
+TEST_CASE("2D affine transforms", "[Matrix3x3]")
+{
+    Matrix3x3 t = Matrix3x3::Translate(Vector2(3.f, -2.f));
+    Matrix3x3 r = Matrix3x3::Rotate(1.57079632679f);
+    Matrix3x3 s = Matrix3x3::Scale(Vector2(2.f, 4.f));
+
+    // Scale, then rotate a quarter turn, then translate
+    Matrix3x3 m = t * r * s;
+    Vector2 p = m.TransformPoint(Vector2(1.f, 1.f));
+
+    REQUIRE(p.x == Approx(3.f - 4.f));
+    REQUIRE(p.y == Approx(-2.f + 2.f).margin(1e-6));
+
+    Vector2 d = m.TransformVector(Vector2(1.f, 0.f));
+    REQUIRE(d.x == Approx(0.f).margin(1e-6));
+    REQUIRE(d.y == Approx(2.f));
+
+    REQUIRE((m * m.Inverse()).ApproxEqual(Matrix3x3::Identity()));
+
+    Vector2 back = m.Inverse().TransformPoint(p);
+    REQUIRE(back.x == Approx(1.f));
+    REQUIRE(back.y == Approx(1.f));
+
+    REQUIRE(Matrix3x3(0.f).Inverse() == Matrix3x3::Identity());
+}
+
+TEST_CASE("Batched 2D transforms match scalar", "[Matrix3x3]")
+{
+    Matrix3x3 m = Matrix3x3::Translate(Vector2(0.5f, 7.f)) * Matrix3x3::Rotate(0.3f) * Matrix3x3::Scale(Vector2(1.5f, -2.f));
+
+    std::vector<Vector2> points;
+    std::vector<float> x, y;
+    for (size_t i = 0; i < 37; i++)
+    {
+        points.push_back(Vector2(static_cast<float>(i) * 0.25f, 10.f - static_cast<float>(i)));
+        x.push_back(points.back().x);
+        y.push_back(points.back().y);
+    }
+
+    std::vector<Vector2> out(points.size());
+    m.TransformPoints(points.data(), out.data(), points.size());
+
+    // In place, split co-ordinates
+    m.TransformPoints(x.data(), y.data(), x.data(), y.data(), x.size());
+
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        Vector2 expected = m.TransformPoint(points[i]);
+
+        REQUIRE(out[i] == expected);
+        REQUIRE(x[i] == expected.x);
+        REQUIRE(y[i] == expected.y);
+    }
+}
@@ -0,0 +1,312 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Mesh.h>
+#include <FMaths/Vector3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+/**
+ * @brief Grid of (width + 1) x (height + 1) vertices, two triangles per cell, optionally wrapping in both directions
+ */
+std::vector<uint32_t> GridIndices(uint32_t width, uint32_t height, bool wrap)
+{
+    uint32_t columns = wrap ? width : width + 1;
+    uint32_t rows = wrap ? height : height + 1;
+
+    auto vertex = [columns, rows](uint32_t i, uint32_t j) { return ((j % rows) * columns) + (i % columns); };
+
+    std::vector<uint32_t> indices;
+    for (uint32_t j = 0; j < height; j++)
+        for (uint32_t i = 0; i < width; i++)
+        {
+            const uint32_t quad[] = {vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j), vertex(i + 1, j + 1), vertex(i, j + 1)};
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+
+    return indices;
+}
+
+struct Soa
+{
+    explicit Soa(size_t n):
+        x(n), y(n), z(n)
+    {}
+
+    Vector3 operator[](size_t i) const { return Vector3(x[i], y[i], z[i]); }
+
+    std::vector<float> x, y, z;
+};
+
+/**
+ * @brief Scattered area weighted normals through Vector3
+ */
+std::vector<Vector3> ReferenceNormals(const std::vector<uint32_t>& indices, const Soa& p)
+{
+    std::vector<Vector3> normals(p.x.size());
+    for (size_t t = 0; t < indices.size(); t += 3)
+    {
+        Vector3 n = (p[indices[t + 1]] - p[indices[t]]).Cross(p[indices[t + 2]] - p[indices[t]]);
+        for (size_t k = 0; k < 3; k++)
+            normals[indices[t + k]] += n;
+    }
+
+    for (Vector3& n : normals)
+        n = n.Normalized();
+
+    return normals;
+}
+
+/**
+ * @brief MikkTSpace's per corner rule, written directly
+ */
+std::vector<Vector3> ReferenceTangents(const std::vector<uint32_t>& indices, const Soa& p, const Soa& n, const std::vector<float>& u,
+    const std::vector<float>& v)
+{
+    auto project = [](const Vector3& a, const Vector3& normal) {
+        Vector3 r = a - (normal * normal.Dot(a));
+        return r.LengthSquared() > 0.f ? r.Normalized() : r;
+    };
+
+    std::vector<Vector3> tangents(p.x.size());
+    for (size_t t = 0; t < indices.size(); t += 3)
+    {
+        uint32_t i0 = indices[t], i1 = indices[t + 1], i2 = indices[t + 2];
+        Vector3 d1 = p[i1] - p[i0], d2 = p[i2] - p[i0];
+        float t21u = u[i1] - u[i0], t21v = v[i1] - v[i0], t31u = u[i2] - u[i0], t31v = v[i2] - v[i0];
+        float area = (t21u * t31v) - (t21v * t31u);
+
+        Vector3 s = ((d1 * t31v) - (d2 * t21v)).Normalized() * (area > 0.f ? 1.f : -1.f);
+
+        for (size_t k = 0; k < 3; k++)
+        {
+            uint32_t c = indices[t + k], previous = indices[t + ((k + 2) % 3)], following = indices[t + ((k + 1) % 3)];
+            Vector3 e1 = project(p[previous] - p[c], n[c]), e2 = project(p[following] - p[c], n[c]);
+            float angle = std::acos(std::fmin(std::fmax(e1.Dot(e2), -1.f), 1.f));
+
+            tangents[c] += project(s, n[c]) * angle;
+        }
+    }
+
+    for (Vector3& t : tangents)
+        t = t.Normalized();
+
+    return tangents;
+}
+
+} // namespace
+
+TEST_CASE("Vertex normals are the normalized area weighted sum of their triangles", "[Mesh]")
+{
+    // Closed torus, so every vertex has a full fan
+    const uint32_t width = 96, height = 48;
+    const float major = 2.f, minor = 0.5f, pi = 3.14159265f;
+
+    std::vector<uint32_t> indices = GridIndices(width, height, true);
+    Mesh mesh(indices.data(), indices.size() / 3, width * height);
+
+    CHECK(mesh.TriangleCount() == 2 * width * height);
+    CHECK(mesh.VertexCount() == width * height);
+    CHECK(mesh.CornerStart()[mesh.VertexCount()] == indices.size());
+
+    // Six corners around every vertex of a wrapped grid, in triangle order
+    for (size_t v = 0; v < mesh.VertexCount(); v++)
+    {
+        CHECK(mesh.CornerStart()[v + 1] - mesh.CornerStart()[v] == 6);
+        for (uint32_t k = mesh.CornerStart()[v]; k < mesh.CornerStart()[v + 1]; k++)
+        {
+            CHECK(indices[mesh.Corners()[k]] == v);
+            if (k > mesh.CornerStart()[v])
+                CHECK(mesh.Corners()[k - 1] < mesh.Corners()[k]);
+        }
+    }
+
+    Soa p(mesh.VertexCount()), n(mesh.VertexCount());
+    for (uint32_t j = 0; j < height; j++)
+        for (uint32_t i = 0; i < width; i++)
+        {
+            float theta = 2.f * pi * float(i) / float(width), phi = 2.f * pi * float(j) / float(height);
+            size_t k = (j * width) + i;
+
+            p.x[k] = (major + (minor * std::cos(phi))) * std::cos(theta);
+            p.y[k] = (major + (minor * std::cos(phi))) * std::sin(theta);
+            p.z[k] = minor * std::sin(phi);
+        }
+
+    mesh.ComputeNormals(p.x.data(), p.y.data(), p.z.data(), n.x.data(), n.y.data(), n.z.data());
+    std::vector<Vector3> reference = ReferenceNormals(indices, p);
+
+    for (uint32_t j = 0; j < height; j++)
+        for (uint32_t i = 0; i < width; i++)
+        {
+            float theta = 2.f * pi * float(i) / float(width), phi = 2.f * pi * float(j) / float(height);
+            size_t k = (j * width) + i;
+            Vector3 analytic(std::cos(theta) * std::cos(phi), std::sin(theta) * std::cos(phi), std::sin(phi));
+
+            CHECK(n[k].Dot(reference[k]) == Approx(1.f).margin(1e-5));
+            CHECK(n[k].Dot(analytic) > 0.999f);
+        }
+
+    // Face normals point out and are twice the area
+    Vector3 face(mesh.FaceX()[0], mesh.FaceY()[0], mesh.FaceZ()[0]);
+    Vector3 expected = (p[indices[1]] - p[indices[0]]).Cross(p[indices[2]] - p[indices[0]]);
+    CHECK(face.x == Approx(expected.x));
+    CHECK(face.z == Approx(expected.z).margin(1e-6));
+    CHECK(face.x > 0.f);
+
+    // An unreferenced vertex, and one with only a degenerate triangle, get 0
+    const uint32_t flat[] = {0, 0, 1};
+    const float fx[] = {1.f, 1.f, 5.f}, fy[] = {0.f, 0.f, 0.f}, fz[] = {0.f, 0.f, 0.f};
+    float ox[3], oy[3], oz[3];
+
+    Mesh degenerate(flat, 1, 3);
+    degenerate.ComputeNormals(fx, fy, fz, ox, oy, oz);
+    CHECK(ox[0] == 0.f);
+    CHECK(ox[2] == 0.f);
+    CHECK_FALSE(std::isnan(oy[1]));
+}
+
+TEST_CASE("Tangents follow texture space with MikkTSpace's corner weighting", "[Mesh]")
+{
+    const uint32_t width = 40, height = 30;
+    std::vector<uint32_t> indices = GridIndices(width, height, false);
+    size_t count = (width + 1) * (height + 1);
+    Mesh mesh(indices.data(), indices.size() / 3, count);
+
+    Soa p(count), n(count), t(count);
+    std::vector<float> u(count), v(count), w(count);
+
+    // Flat, with u along x, then mirrored
+    for (uint32_t j = 0; j <= height; j++)
+        for (uint32_t i = 0; i <= width; i++)
+        {
+            size_t k = (j * (width + 1)) + i;
+            p.x[k] = float(i) * 0.1f;
+            p.y[k] = float(j) * 0.1f;
+            u[k] = float(i) / float(width);
+            v[k] = float(j) / float(height);
+        }
+
+    mesh.ComputeNormals(p.x.data(), p.y.data(), p.z.data(), n.x.data(), n.y.data(), n.z.data());
+    mesh.ComputeTangents(p.x.data(), p.y.data(), p.z.data(), n.x.data(), n.y.data(), n.z.data(), u.data(), v.data(), t.x.data(),
+        t.y.data(), t.z.data(), w.data());
+
+    for (size_t k = 0; k < count; k++)
+    {
+        CHECK(n.z[k] == Approx(1.f));
+        CHECK(t.x[k] == Approx(1.f));
+        CHECK(w[k] == 1.f);
+    }
+
+    for (float& e : u)
+        e = -e;
+
+    mesh.ComputeTangents(p.x.data(), p.y.data(), p.z.data(), n.x.data(), n.y.data(), n.z.data(), u.data(), v.data(), t.x.data(),
+        t.y.data(), t.z.data(), w.data());
+
+    // Bitangent w cross(n, t) still follows v
+    for (size_t k = 0; k < count; k++)
+    {
+        CHECK(t.x[k] == Approx(-1.f));
+        CHECK(w[k] == -1.f);
+        CHECK((n[k].Cross(t[k]) * w[k]).y == Approx(1.f));
+    }
+
+    // Bent into a wavy sheet with a skewed, stretched mapping
+    for (uint32_t j = 0; j <= height; j++)
+        for (uint32_t i = 0; i <= width; i++)
+        {
+            size_t k = (j * (width + 1)) + i;
+            p.z[k] = 0.3f * std::sin(float(i) * 0.4f) * std::cos(float(j) * 0.3f);
+            u[k] = (float(i) * 0.7f) + (float(j) * 0.2f) + (0.05f * std::sin(float(j)));
+            v[k] = float(j) * (1.f + (0.01f * float(i)));
+        }
+
+    mesh.ComputeNormals(p.x.data(), p.y.data(), p.z.data(), n.x.data(), n.y.data(), n.z.data());
+    mesh.ComputeTangents(p.x.data(), p.y.data(), p.z.data(), n.x.data(), n.y.data(), n.z.data(), u.data(), v.data(), t.x.data(),
+        t.y.data(), t.z.data(), w.data());
+
+    std::vector<Vector3> reference = ReferenceTangents(indices, p, n, u, v);
+
+    for (size_t k = 0; k < count; k++)
+    {
+        CHECK(t[k].Length() == Approx(1.f).margin(1e-5));
+        CHECK(t[k].Dot(n[k]) == Approx(0.f).margin(1e-5));
+        CHECK(t[k].Dot(reference[k]) == Approx(1.f).margin(1e-5));
+        CHECK(w[k] == 1.f);
+    }
+
+    // No texture area, no tangent
+    std::fill(u.begin(), u.end(), 0.5f);
+    mesh.ComputeTangents(p.x.data(), p.y.data(), p.z.data(), n.x.data(), n.y.data(), n.z.data(), u.data(), v.data(), t.x.data(),
+        t.y.data(), t.z.data(), w.data());
+
+    CHECK(t.x[7] == 0.f);
+    CHECK(w[7] == 1.f);
+}
+
+TEST_CASE("Mesh kernels do not depend on chunks or threads", "[Mesh]")
+{
+    // More vertices and triangles than a chunk, not a multiple of the lanes
+    const uint32_t width = 101, height = 53;
+    std::vector<uint32_t> indices = GridIndices(width, height, false);
+    size_t count = (width + 1) * (height + 1);
+    Mesh mesh(indices.data(), indices.size() / 3, count);
+
+    Soa p(count);
+    std::vector<float> u(count), v(count);
+    for (uint32_t j = 0; j <= height; j++)
+        for (uint32_t i = 0; i <= width; i++)
+        {
+            size_t k = (j * (width + 1)) + i;
+            p.x[k] = float(i) + (0.3f * std::sin(float(j)));
+            p.y[k] = float(j);
+            p.z[k] = std::sin(float(i) * 0.2f) * std::cos(float(j) * 0.17f);
+            u[k] = float(i) * 0.01f;
+            v[k] = float(j) * 0.013f;
+        }
+
+    ThreadPool pool(3);
+    Soa n0(count), n1(count), t0(count), t1(count);
+    std::vector<float> w0(count), w1(count);
+
+    mesh.ComputeNormals(p.x.data(), p.y.data(), p.z.data(), n0.x.data(), n0.y.data(), n0.z.data());
+    mesh.ComputeTangents(p.x.data(), p.y.data(), p.z.data(), n0.x.data(), n0.y.data(), n0.z.data(), u.data(), v.data(), t0.x.data(),
+        t0.y.data(), t0.z.data(), w0.data());
+
+    mesh.ComputeNormals(p.x.data(), p.y.data(), p.z.data(), n1.x.data(), n1.y.data(), n1.z.data(), pool.GetExecutor());
+    mesh.ComputeTangents(p.x.data(), p.y.data(), p.z.data(), n1.x.data(), n1.y.data(), n1.z.data(), u.data(), v.data(), t1.x.data(),
+        t1.y.data(), t1.z.data(), w1.data(), pool.GetExecutor());
+
+    CHECK(n0.x == n1.x);
+    CHECK(n0.y == n1.y);
+    CHECK(n0.z == n1.z);
+    CHECK(t0.x == t1.x);
+    CHECK(t0.z == t1.z);
+    CHECK(w0 == w1);
+
+    // Batched normalization matches Vector3, and leaves 0 alone
+    Soa a = p;
+    a.x[3] = a.y[3] = a.z[3] = 0.f;
+    NormalizeSoA(a.x.data(), a.y.data(), a.z.data(), count, pool.GetExecutor());
+
+    for (size_t k = 0; k < count; k++)
+    {
+        if (k == 3 || p[k].LengthSquared() == 0.f)
+            continue;
+
+        Vector3 expected = p[k].Normalized();
+        CHECK(a.x[k] == Approx(expected.x).margin(1e-6));
+        CHECK(a.y[k] == Approx(expected.y).margin(1e-6));
+        CHECK(a.z[k] == Approx(expected.z).margin(1e-6));
+    }
+
+    CHECK(a.x[3] == 0.f);
+    CHECK(a.y[3] == 0.f);
+}
@@ -0,0 +1,154 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Reduce.h>
+#include <FMaths/Quaternion.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+// Several chunks and a partial one
+constexpr size_t kCount = (5 * kReduceChunkSize) + 123;
+
+std::vector<Vector3> Cloud(size_t count, const Vector3& offset)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<Vector3> res(count);
+
+    for (Vector3& p : res)
+        p = offset + Vector3(4.f * dist(rng), 2.f * dist(rng), 0.5f * dist(rng));
+
+    return res;
+}
+
+} // namespace
+
+TEST_CASE("Reductions match a double precision loop", "[Reduce]")
+{
+    std::vector<Vector3> points = Cloud(kCount, Vector3(1000.f, -50.f, 3.f));
+
+    double sum[3] = {}, lo[3] = {INFINITY, INFINITY, INFINITY}, hi[3] = {-INFINITY, -INFINITY, -INFINITY};
+    for (const Vector3& p : points)
+        for (size_t k = 0; k < 3; k++)
+        {
+            sum[k] += p[k];
+            lo[k] = std::min<double>(lo[k], p[k]);
+            hi[k] = std::max<double>(hi[k], p[k]);
+        }
+
+    double mean[3], cov[3][3] = {};
+    for (size_t k = 0; k < 3; k++)
+        mean[k] = sum[k] / kCount;
+
+    for (const Vector3& p : points)
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = 0; j < 3; j++)
+                cov[i][j] += (p[i] - mean[i]) * (p[j] - mean[j]) / kCount;
+
+    AABB box = Bounds(points.data(), kCount);
+    Vector3 total = Sum(points.data(), kCount);
+    Vector3 centroid;
+    Matrix3x3 c = Covariance(points.data(), kCount, &centroid);
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        REQUIRE(box.min[k] == static_cast<float>(lo[k]));
+        REQUIRE(box.max[k] == static_cast<float>(hi[k]));
+        REQUIRE(total[k] == Approx(sum[k]).epsilon(1e-5));
+        REQUIRE(centroid[k] == Approx(mean[k]).epsilon(1e-5));
+        REQUIRE(Mean(points.data(), kCount)[k] == centroid[k]);
+
+        for (size_t j = 0; j < 3; j++)
+            REQUIRE(c[j][k] == Approx(cov[k][j]).margin(1e-4));
+    }
+
+    std::vector<Vector4> points4;
+    for (const Vector3& p : points)
+        points4.push_back(Vector4(p.x, p.y, p.z, -p.x));
+
+    Vector4 lo4, hi4;
+    MinMax(points4.data(), kCount, lo4, hi4);
+    REQUIRE(hi4.w == static_cast<float>(-lo[0]));
+    REQUIRE(Mean(points4.data(), kCount).w == -centroid.x);
+}
+
+TEST_CASE("Results do not depend on thread count", "[Reduce]")
+{
+    std::vector<Vector3> points = Cloud(kCount, Vector3(-3.f, 7.f, 12.f));
+
+    Vector3 sum = Sum(points.data(), kCount);
+    Matrix3x3 cov = Covariance(points.data(), kCount);
+    OBB box = FitOBB(points.data(), kCount);
+
+    for (size_t threads : {1, 2, 3, 8})
+    {
+        ThreadPool pool(threads);
+        Executor executor = pool.GetExecutor();
+
+        REQUIRE(Sum(points.data(), kCount, executor) == sum);
+        REQUIRE(Covariance(points.data(), kCount, nullptr, executor) == cov);
+
+        OBB threaded = FitOBB(points.data(), kCount, executor);
+        REQUIRE(threaded.centre == box.centre);
+        REQUIRE(threaded.halfExtents == box.halfExtents);
+    }
+}
+
+TEST_CASE("Fit an oriented box", "[Reduce]")
+{
+    // Points filling a rotated box, its axes should be recovered
+    Quaternion q = Quaternion::FromEuler(Vector3(0.3f, -0.8f, 1.1f));
+    Vector3 centre(5.f, -2.f, 40.f);
+    std::vector<Vector3> local = Cloud(kCount, Vector3());
+    std::vector<Vector3> points(kCount);
+    q.Apply(local.data(), points.data(), kCount);
+    for (Vector3& p : points)
+        p += centre;
+
+    OBB box = FitOBB(points.data(), kCount);
+
+    Vector3 expectedAxes[3] = {q.Apply(Vector3(1.f, 0.f, 0.f)), q.Apply(Vector3(0.f, 1.f, 0.f)), q.Apply(Vector3(0.f, 0.f, 1.f))};
+    Vector3 expectedExtents(4.f, 2.f, 0.5f);
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        REQUIRE(fabsf(box.axes[k].Dot(expectedAxes[k])) == Approx(1.f).margin(1e-3));
+        REQUIRE(box.halfExtents[k] == Approx(expectedExtents[k]).epsilon(5e-2));
+    }
+
+    REQUIRE(box.axes[0].Cross(box.axes[1]).ApproxEqual(box.axes[2]));
+    REQUIRE(box.centre.ApproxEqual(centre, 1e-2f));
+
+    // Every point inside, up to rounding
+    OBB grown = box;
+    grown.halfExtents += Vector3(1e-4f, 1e-4f, 1e-4f);
+    for (const Vector3& p : points)
+        REQUIRE(grown.Contains(p));
+}
+
+TEST_CASE("Degenerate inputs", "[Reduce]")
+{
+    AABB empty = Bounds(nullptr, 0);
+    REQUIRE(empty.min.x == INFINITY);
+    REQUIRE(empty.max.z == -INFINITY);
+    REQUIRE(Mean(static_cast<const Vector3*>(nullptr), 0) == Vector3());
+
+    // NaN components are skipped
+    std::vector<Vector3> points = {Vector3(1.f, 2.f, 3.f), Vector3(std::nanf(""), -1.f, 0.f), Vector3(-4.f, 5.f, std::nanf(""))};
+    for (size_t i = 0; i < 20; i++)
+        points.push_back(Vector3(0.f, 0.f, 0.f));
+
+    AABB box = Bounds(points.data(), points.size());
+    REQUIRE(box.min == Vector3(-4.f, -1.f, 0.f));
+    REQUIRE(box.max == Vector3(1.f, 5.f, 3.f));
+
+    OBB single = FitOBB(points.data(), 1);
+    REQUIRE(single.centre == points[0]);
+    REQUIRE(single.halfExtents == Vector3());
+}
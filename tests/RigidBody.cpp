@@ -0,0 +1,263 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/RigidBody.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+const Vector3 kGravity(0.f, -9.81f, 0.f);
+
+void CheckApprox(const Vector3& a, const Vector3& b, float margin)
+{
+    CHECK(a.x == Approx(b.x).margin(margin));
+    CHECK(a.y == Approx(b.y).margin(margin));
+    CHECK(a.z == Approx(b.z).margin(margin));
+}
+
+void CheckRotation(const Quaternion& a, const Quaternion& b, float margin)
+{
+    // q and -q are the same rotation
+    CHECK(std::fabs(a.Dot(b)) == Approx(1.f).margin(margin));
+}
+
+Quaternion Conjugate(const Quaternion& q)
+{
+    return Quaternion(-q.x, -q.y, -q.z, q.w);
+}
+
+/**
+ * @brief World space angular momentum, R I R^T w
+ */
+Vector3 AngularMomentum(const RigidBodyArray& bodies, size_t i, const Vector3& moments)
+{
+    Quaternion q = bodies.Orientation(i);
+    Vector3 wb = Conjugate(q).Apply(bodies.AngularVelocity(i));
+    return q.Apply(Vector3(wb.x * moments.x, wb.y * moments.y, wb.z * moments.z));
+}
+
+RigidBodyArray RandomBodies(size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+    RigidBodyArray bodies;
+    bodies.Reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Quaternion q(Vector3(dist(rng), dist(rng), dist(rng) + 2.f), dist(rng) * 3.f);
+        float invMass = (i % 7 == 0) ? 0.f : 1.f + dist(rng) * 0.5f;
+        Vector3 invInertia(1.f + dist(rng) * 0.5f, 1.f + dist(rng) * 0.5f, (i % 5 == 0) ? 0.f : 1.f + dist(rng) * 0.5f);
+
+        bodies.Push(Vector3(dist(rng), dist(rng), dist(rng)) * 10.f, q, invMass, invInertia,
+            Vector3(dist(rng), dist(rng), dist(rng)), Vector3(dist(rng), dist(rng), dist(rng)) * 5.f);
+
+        bodies.fx[i] = dist(rng) * 3.f;
+        bodies.ty[i] = dist(rng) * 3.f;
+    }
+
+    return bodies;
+}
+
+bool Equal(const RigidBodyArray& a, const RigidBodyArray& b)
+{
+    return a.px == b.px && a.py == b.py && a.pz == b.pz &&
+        a.qx == b.qx && a.qy == b.qy && a.qz == b.qz && a.qw == b.qw &&
+        a.vx == b.vx && a.vy == b.vy && a.vz == b.vz &&
+        a.wx == b.wx && a.wy == b.wy && a.wz == b.wz;
+}
+
+} // namespace
+
+TEST_CASE("Semi-implicit Euler matches its closed form under constant acceleration", "[RigidBody]")
+{
+    RigidBodyArray bodies;
+    bodies.Push(Vector3(1.f, 2.f, 3.f), Quaternion(), 0.5f, Vector3(1.f, 1.f, 1.f), Vector3(4.f, 5.f, -1.f));
+    bodies.Push(Vector3(1.f, 2.f, 3.f), Quaternion(), 0.f, Vector3(), Vector3(4.f, 5.f, -1.f));
+
+    // Applies to the dynamic body only
+    bodies.fx = {2.f, 100.f};
+
+    const float dt = 1.f / 64.f;
+    const size_t steps = 64;
+
+    for (size_t i = 0; i < steps; i++)
+        IntegrateEuler(bodies, kGravity, dt);
+
+    // Velocity is updated first, so p_n = p_0 + n dt v_0 + a dt^2 n (n + 1) / 2
+    Vector3 a = kGravity + Vector3(1.f, 0.f, 0.f);
+    float n = static_cast<float>(steps);
+
+    CheckApprox(bodies.Velocity(0), Vector3(4.f, 5.f, -1.f) + (a * (n * dt)), 1e-4f);
+    CheckApprox(bodies.Position(0), Vector3(1.f, 2.f, 3.f) + (Vector3(4.f, 5.f, -1.f) * (n * dt)) + (a * (dt * dt * n * (n + 1.f) * 0.5f)), 1e-4f);
+
+    // Immovable bodies keep their velocity
+    CheckApprox(bodies.Velocity(1), Vector3(4.f, 5.f, -1.f), 0.f);
+    CheckApprox(bodies.Position(1), Vector3(5.f, 7.f, 2.f), 1e-4f);
+    CheckRotation(bodies.Orientation(0), Quaternion(), 0.f);
+
+    bodies.ClearForces();
+    CHECK(bodies.fx[0] == 0.f);
+}
+
+TEST_CASE("Orientations follow a constant angular velocity and stay unit length", "[RigidBody]")
+{
+    Vector3 axis = Vector3(1.f, 2.f, -2.f) / 3.f;
+    Quaternion start(Vector3(0.f, 1.f, 0.f), 0.7f);
+
+    RigidBodyArray euler, rk4;
+    euler.Push(Vector3(), start, 1.f, Vector3(), Vector3(), axis * 2.f);
+    rk4.Push(Vector3(), start, 1.f, Vector3(), Vector3(), axis * 2.f);
+
+    const float dt = 1.f / 60.f;
+
+    for (size_t i = 0; i < 60; i++)
+    {
+        IntegrateEuler(euler, Vector3(), dt);
+        IntegrateRK4(rk4, Vector3(), dt);
+    }
+
+    Quaternion expected = Quaternion(axis, 2.f) * start;
+    CheckRotation(euler.Orientation(0), expected, 1e-5f);
+    CheckRotation(rk4.Orientation(0), expected, 1e-5f);
+
+    // A long run, at a high spin rate for RK4 whose steps barely leave the unit sphere
+    euler.wx[0] = 5.f;
+    rk4.wx[0] = 20.f;
+
+    for (size_t i = 0; i < 10000; i++)
+    {
+        IntegrateEuler(euler, Vector3(), dt);
+        IntegrateRK4(rk4, Vector3(), dt);
+    }
+
+    CHECK(euler.Orientation(0).Magnitude() == Approx(1.f).margin(1e-5));
+    CHECK(rk4.Orientation(0).Magnitude() == Approx(1.f).margin(1e-5));
+}
+
+TEST_CASE("RK4 conserves the angular momentum and energy of a tumbling body", "[RigidBody]")
+{
+    Vector3 moments(1.f, 2.f, 3.f);
+
+    RigidBodyArray bodies;
+    bodies.Push(Vector3(), Quaternion(Vector3(1.f, 1.f, 0.f), 0.4f), 1.f, Vector3(1.f, 0.5f, 1.f / 3.f), Vector3(), Vector3(0.3f, 2.f, 0.5f));
+
+    Vector3 momentum = AngularMomentum(bodies, 0, moments);
+    float energy = 0.5f * momentum.Dot(bodies.AngularVelocity(0));
+
+    // Spinning near the intermediate axis, so the body flips over
+    for (size_t i = 0; i < 2000; i++)
+        IntegrateRK4(bodies, Vector3(), 1.f / 120.f);
+
+    CheckApprox(AngularMomentum(bodies, 0, moments), momentum, 1e-3f);
+    CHECK(0.5f * momentum.Dot(bodies.AngularVelocity(0)) == Approx(energy).epsilon(1e-3));
+
+    // Torque about a locked axis does nothing
+    RigidBodyArray locked;
+    locked.Push(Vector3(), Quaternion(), 1.f, Vector3(1.f, 1.f, 0.f));
+    locked.tz[0] = 10.f;
+
+    IntegrateRK4(locked, Vector3(), 0.1f);
+    IntegrateEuler(locked, Vector3(), 0.1f);
+    CheckApprox(locked.AngularVelocity(0), Vector3(), 0.f);
+}
+
+TEST_CASE("Integration does not depend on lanes, chunks or threads", "[RigidBody]")
+{
+    // Not a multiple of any lane width or the chunk size
+    const size_t count = (kIntegrateChunkSize * 2) + 37;
+    RigidBodyArray inline_ = RandomBodies(count, 1);
+    RigidBodyArray pooled = inline_;
+
+    ThreadPool pool(3);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        IntegrateEuler(inline_, kGravity, 1.f / 60.f);
+        IntegrateRK4(inline_, kGravity, 1.f / 60.f);
+
+        IntegrateEuler(pooled, kGravity, 1.f / 60.f, pool.GetExecutor());
+        IntegrateRK4(pooled, kGravity, 1.f / 60.f, pool.GetExecutor());
+    }
+
+    CHECK(Equal(inline_, pooled));
+
+    // A single body takes the scalar tail
+    RigidBodyArray all = RandomBodies(count, 2);
+    RigidBodyArray start = all;
+
+    IntegrateEuler(all, kGravity, 1.f / 60.f);
+    IntegrateRK4(all, kGravity, 1.f / 60.f);
+
+    for (size_t i = 0; i < count; i += 97)
+    {
+        RigidBodyArray one;
+        one.Push(start.Position(i), start.Orientation(i), start.invMass[i], Vector3(start.ix[i], start.iy[i], start.iz[i]),
+            start.Velocity(i), start.AngularVelocity(i));
+
+        one.fx[0] = start.fx[i];
+        one.ty[0] = start.ty[i];
+
+        IntegrateEuler(one, kGravity, 1.f / 60.f);
+        IntegrateRK4(one, kGravity, 1.f / 60.f);
+
+        CHECK(one.px[0] == all.px[i]);
+        CHECK(one.qw[0] == all.qw[i]);
+        CHECK(one.qx[0] == all.qx[i]);
+        CHECK(one.vy[0] == all.vy[i]);
+        CHECK(one.wz[0] == all.wz[i]);
+    }
+}
+
+TEST_CASE("Inertia tensors rotate as R M R^T", "[RigidBody]")
+{
+    const size_t count = 37;
+    RigidBodyArray bodies = RandomBodies(count, 3);
+
+    std::vector<Matrix4x4> world(count);
+    WorldInverseInertia(bodies, world.data());
+
+    std::vector<Quaternion> q(count);
+    std::vector<Matrix4x4> local(count), rotated(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        q[i] = bodies.Orientation(i);
+        Matrix4x4 r = Matrix4x4::QuatRotate(Vector4(q[i].x, q[i].y, q[i].z, q[i].w));
+        Matrix4x4 expected = r * Matrix4x4::Scale(Vector3(bodies.ix[i], bodies.iy[i], bodies.iz[i])) * r.Transpose();
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                CHECK(world[i][col][row] == Approx(expected[col][row]).margin(1e-5));
+
+        // A symmetric tensor with products of inertia, and junk outside the block
+        local[i] = Matrix4x4(Vector4(2.f, 0.3f, -0.1f, 5.f), Vector4(0.3f, 1.f, 0.2f, 5.f), Vector4(-0.1f, 0.2f, 3.f, 5.f), Vector4(5.f, 5.f, 5.f, 5.f));
+    }
+
+    RotateInertia(q.data(), local.data(), rotated.data(), count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Matrix4x4 r = Matrix4x4::QuatRotate(Vector4(q[i].x, q[i].y, q[i].z, q[i].w));
+        Matrix4x4 block = local[i];
+        block[3] = Vector4(0.f, 0.f, 0.f, 1.f);
+        for (size_t col = 0; col < 3; col++)
+            block[col][3] = 0.f;
+
+        Matrix4x4 expected = r * block * r.Transpose();
+
+        for (size_t col = 0; col < 4; col++)
+            for (size_t row = 0; row < 4; row++)
+                CHECK(rotated[i][col][row] == Approx(expected[col][row]).margin(1e-5));
+    }
+
+    // In place
+    RotateInertia(q.data(), local.data(), local.data(), count);
+    CHECK(local[5] == rotated[5]);
+}
@@ -0,0 +1,256 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/Sparse.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+Matrix3x3 Outer(const Vector3& d, float k)
+{
+    return Matrix3x3(d * (d.x * k), d * (d.y * k), d * (d.z * k));
+}
+
+/**
+ * @brief Implicit cloth system m I + h^2 k sum d d^T over springs to the right, below and diagonally
+ */
+std::vector<BlockEntry> ClothEntries(size_t width, size_t height, float mass, float stiffness)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> jitter(-0.2f, 0.2f);
+
+    std::vector<BlockEntry> entries;
+
+    for (size_t i = 0; i < width * height; i++)
+        entries.push_back({uint32_t(i), uint32_t(i), Matrix3x3(mass)});
+
+    const size_t offsets[][2] = {{1, 0}, {0, 1}, {1, 1}};
+
+    for (size_t y = 0; y < height; y++)
+        for (size_t x = 0; x < width; x++)
+            for (const size_t* o : offsets)
+            {
+                if (x + o[0] >= width || y + o[1] >= height)
+                    continue;
+
+                uint32_t i = uint32_t((y * width) + x);
+                uint32_t j = uint32_t(((y + o[1]) * width) + x + o[0]);
+
+                Vector3 d = Vector3(float(o[0]) + jitter(rng), float(o[1]) + jitter(rng), jitter(rng)).Normalized();
+                Matrix3x3 k = Outer(d, stiffness);
+
+                // Summed with the mass blocks already there
+                entries.push_back({i, i, k});
+                entries.push_back({j, j, k});
+                entries.push_back({i, j, k * -1.f});
+                entries.push_back({j, i, k * -1.f});
+            }
+
+    return entries;
+}
+
+std::vector<Vector3> RandomVectors(size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+    std::vector<Vector3> v(count);
+    for (Vector3& e : v)
+        e = Vector3(dist(rng), dist(rng), dist(rng));
+
+    return v;
+}
+
+float Residual(const BlockSparseMatrix& a, const std::vector<Vector3>& b, const std::vector<Vector3>& x)
+{
+    std::vector<Vector3> ax(x.size());
+    Multiply(a, x.data(), ax.data());
+
+    double rr = 0.0, bb = 0.0;
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        rr += (b[i] - ax[i]).LengthSquared();
+        bb += b[i].LengthSquared();
+    }
+
+    return float(std::sqrt(rr / bb));
+}
+
+bool Equal(const std::vector<Vector3>& a, const std::vector<Vector3>& b)
+{
+    for (size_t i = 0; i < a.size(); i++)
+        if (a[i].x != b[i].x || a[i].y != b[i].y || a[i].z != b[i].z)
+            return false;
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Block sparse matrices sum entries and multiply like dense blocks", "[Sparse]")
+{
+    const size_t width = 7, height = 5, n = width * height;
+    std::vector<BlockEntry> entries = ClothEntries(width, height, 1.f, 10.f);
+    BlockSparseMatrix a(n, entries.data(), entries.size());
+
+    // A diagonal block per particle and two per spring
+    size_t springs = ((width - 1) * height) + (width * (height - 1)) + ((width - 1) * (height - 1));
+    CHECK(a.BlockRows() == n);
+    CHECK(a.BlockCount() == n + (2 * springs));
+    CHECK(a.Find(0, 2) == a.BlockCount());
+
+    // Duplicates are summed into one block
+    Matrix3x3 diagonal(1.f);
+    for (const BlockEntry& e : entries)
+        if (e.row == 0 && e.col == 0 && &e != &entries[0])
+            diagonal = Matrix3x3(diagonal[0] + e.block[0], diagonal[1] + e.block[1], diagonal[2] + e.block[2]);
+
+    CHECK(a.Block(a.Find(0, 0)).ApproxEqual(diagonal, 1e-5f));
+
+    // No row of a color references another row of it
+    std::vector<size_t> color(n);
+    for (size_t c = 0; c < a.ColorCount(); c++)
+        for (uint32_t k = a.ColorStart()[c]; k < a.ColorStart()[c + 1]; k++)
+            color[a.ColorRows()[k]] = c;
+
+    for (size_t i = 0; i < n; i++)
+        for (uint32_t k = a.RowStart()[i]; k < a.RowStart()[i + 1]; k++)
+            CHECK((a.Columns()[k] == i || color[a.Columns()[k]] != color[i]));
+
+    CHECK(a.ColorCount() <= 5);
+
+    std::vector<Vector3> x = RandomVectors(n, 1), ax(n);
+    Multiply(a, x.data(), ax.data());
+
+    for (size_t i = 0; i < n; i++)
+    {
+        Vector3 expected;
+        for (uint32_t k = a.RowStart()[i]; k < a.RowStart()[i + 1]; k++)
+            expected += a.Block(k) * x[a.Columns()[k]];
+
+        CHECK(ax[i].x == Approx(expected.x).margin(1e-4));
+        CHECK(ax[i].y == Approx(expected.y).margin(1e-4));
+        CHECK(ax[i].z == Approx(expected.z).margin(1e-4));
+    }
+
+    // Values change in place
+    a.ZeroBlocks();
+    a.SetBlock(a.Find(3, 3), Matrix3x3(2.f));
+    a.AddBlock(a.Find(3, 3), Matrix3x3(1.f));
+    Multiply(a, x.data(), ax.data());
+
+    CHECK(ax[3].y == Approx(3.f * x[3].y));
+    CHECK(ax[4].y == 0.f);
+}
+
+TEST_CASE("Iterative solvers converge on a cloth system", "[Sparse]")
+{
+    const size_t width = 40, height = 30, n = width * height;
+    std::vector<BlockEntry> entries = ClothEntries(width, height, 1.f, 20.f);
+    BlockSparseMatrix a(n, entries.data(), entries.size());
+
+    std::vector<Vector3> b = RandomVectors(n, 2);
+
+    std::vector<Vector3> x(n);
+    SolveResult result = ConjugateGradient(a, b.data(), x.data(), 200, 1e-5f);
+
+    CHECK(result.iterations > 0);
+    CHECK(result.iterations < 200);
+    CHECK(result.residual <= 1e-5f);
+    CHECK(Residual(a, b, x) < 1e-4f);
+
+    // Already solved
+    CHECK(ConjugateGradient(a, b.data(), x.data(), 200, 1e-3f).iterations == 0);
+
+    // Gauss-Seidel beats Jacobi for the same iterations, both make progress
+    std::vector<Vector3> gs(n), jacobi(n);
+    GaussSeidel(a, b.data(), gs.data(), 20);
+    Jacobi(a, b.data(), jacobi.data(), 20);
+
+    float start = Residual(a, b, std::vector<Vector3>(n));
+    CHECK(Residual(a, b, gs) < start * 0.2f);
+    CHECK(Residual(a, b, jacobi) < start * 0.5f);
+    CHECK(Residual(a, b, gs) < Residual(a, b, jacobi));
+
+    GaussSeidel(a, b.data(), gs.data(), 500);
+    CHECK(Residual(a, b, gs) < 1e-4f);
+
+    // A zero right hand side gives zero
+    std::vector<Vector3> zero(n);
+    CHECK(ConjugateGradient(a, zero.data(), x.data(), 10, 1e-5f).residual == 0.f);
+    CHECK(x[5].x == 0.f);
+}
+
+TEST_CASE("Block relaxation inverts non-symmetric diagonal blocks", "[Sparse]")
+{
+    // Columns of [1 5 0; 0 1 0; 0 0 1], [2 1 0; 0 3 0; 0 0 4] and a diagonally dominant block
+    const Matrix3x3 blocks[] = {
+        Matrix3x3(Vector3(1.f, 0.f, 0.f), Vector3(5.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f)),
+        Matrix3x3(Vector3(2.f, 0.f, 0.f), Vector3(1.f, 3.f, 0.f), Vector3(0.f, 0.f, 4.f)),
+        Matrix3x3(Vector3(5.f, 1.f, -2.f), Vector3(2.f, 6.f, 0.5f), Vector3(-1.f, 3.f, 7.f))
+    };
+
+    const Vector3 expected[] = {Vector3(1.f, 1.f, 1.f), Vector3(1.f, 1.f, 1.f), Vector3(0.5f, -2.f, 3.f)};
+
+    std::vector<BlockEntry> entries;
+    std::vector<Vector3> b;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        entries.push_back({i, i, blocks[i]});
+        b.push_back(blocks[i] * expected[i]);
+    }
+
+    // Block diagonal, so one step of either solver is exact
+    BlockSparseMatrix a(3, entries.data(), entries.size());
+    std::vector<Vector3> jacobi(3), gs(3);
+    Jacobi(a, b.data(), jacobi.data(), 1);
+    GaussSeidel(a, b.data(), gs.data(), 1);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        CHECK(jacobi[i].ApproxEqual(expected[i], 1e-5f));
+        CHECK(gs[i].ApproxEqual(expected[i], 1e-5f));
+    }
+
+    // And stays there
+    Jacobi(a, b.data(), jacobi.data(), 50);
+    GaussSeidel(a, b.data(), gs.data(), 50);
+    CHECK(jacobi[0].ApproxEqual(expected[0], 1e-5f));
+    CHECK(gs[2].ApproxEqual(expected[2], 1e-5f));
+}
+
+TEST_CASE("Sparse operations do not depend on chunks or threads", "[Sparse]")
+{
+    // More rows than a chunk, not a multiple of it
+    const size_t width = 50, height = 45, n = width * height;
+    std::vector<BlockEntry> entries = ClothEntries(width, height, 1.f, 5.f);
+    BlockSparseMatrix a(n, entries.data(), entries.size());
+
+    std::vector<Vector3> b = RandomVectors(n, 3);
+    ThreadPool pool(3);
+
+    std::vector<Vector3> inline_(n), pooled(n);
+    SolveResult r0 = ConjugateGradient(a, b.data(), inline_.data(), 15, 0.f);
+    SolveResult r1 = ConjugateGradient(a, b.data(), pooled.data(), 15, 0.f, pool.GetExecutor());
+
+    CHECK(r0.iterations == r1.iterations);
+    CHECK(r0.residual == r1.residual);
+    CHECK(Equal(inline_, pooled));
+
+    GaussSeidel(a, b.data(), inline_.data(), 3);
+    GaussSeidel(a, b.data(), pooled.data(), 3, pool.GetExecutor());
+    CHECK(Equal(inline_, pooled));
+
+    Jacobi(a, b.data(), inline_.data(), 3);
+    Jacobi(a, b.data(), pooled.data(), 3, pool.GetExecutor());
+    CHECK(Equal(inline_, pooled));
+
+    Multiply(a, b.data(), inline_.data());
+    Multiply(a, b.data(), pooled.data(), pool.GetExecutor());
+    CHECK(Equal(inline_, pooled));
+}
@@ -0,0 +1,152 @@
+#include <catch2/catch_test_macros.hpp>
+#include <FMaths/SpatialHash.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<Vector3> RandomPoints(size_t count, float extent, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-extent, extent);
+
+    std::vector<Vector3> points(count);
+    for (Vector3& p : points)
+        p = Vector3(dist(rng), dist(rng), dist(rng));
+
+    return points;
+}
+
+/**
+ * @brief Original indices of points within radius of p, by the O(n) scan the grid replaces
+ */
+std::vector<uint32_t> BruteForce(const std::vector<Vector3>& points, const Vector3& p, float radius, size_t skip = SIZE_MAX)
+{
+    std::vector<uint32_t> found;
+    for (size_t i = 0; i < points.size(); i++)
+        if (i != skip && (points[i] - p).LengthSquared() <= radius * radius)
+            found.push_back(static_cast<uint32_t>(i));
+
+    return found;
+}
+
+/**
+ * @brief Original indices of slots, sorted
+ */
+std::vector<uint32_t> Original(const SpatialHashGrid& grid, const uint32_t* slots, size_t count)
+{
+    std::vector<uint32_t> found;
+    for (size_t k = 0; k < count; k++)
+        found.push_back(grid.Indices()[slots[k]]);
+
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+} // namespace
+
+TEST_CASE("Grid queries find exactly the points within the radius", "[SpatialHash]")
+{
+    std::vector<Vector3> points = RandomPoints(3000, 10.f, 1);
+
+    // Duplicates and a NaN, which is never found
+    points.push_back(points[5]);
+    points.push_back(Vector3(NAN, 0.f, 0.f));
+
+    SpatialHashGrid grid(1.f);
+    grid.Build(points.data(), points.size());
+
+    CHECK(grid.Count() == points.size());
+    CHECK(grid.BucketCount() >= points.size());
+
+    // Every point lands in a slot once, with its position
+    std::vector<uint32_t> seen(grid.Indices(), grid.Indices() + grid.Count());
+    std::sort(seen.begin(), seen.end());
+    for (size_t i = 0; i < seen.size(); i++)
+        CHECK(seen[i] == i);
+
+    for (size_t s = 0; s < grid.Count(); s++)
+        if (!std::isnan(grid.X()[s]))
+            CHECK(grid.X()[s] == points[grid.Indices()[s]].x);
+
+    std::vector<Vector3> probes = RandomPoints(50, 11.f, 2);
+    probes.push_back(points[5]);
+
+    // Radii under, at and past the cell size, past the grid's extent, and zero
+    for (float radius : {0.f, 0.3f, 1.f, 2.5f, 40.f})
+        for (const Vector3& p : probes)
+        {
+            std::vector<uint32_t> slots;
+            grid.Query(p, radius, slots);
+            CHECK(Original(grid, slots.data(), slots.size()) == BruteForce(points, p, radius));
+        }
+
+    std::vector<uint32_t> slots;
+    grid.Query(points[5], 0.f, slots);
+    CHECK(slots.size() == 2);
+
+    // Far outside the grid
+    slots.clear();
+    grid.Query(Vector3(1e9f, 1e9f, 1e9f), 1.f, slots);
+    CHECK(slots.empty());
+
+    // Nothing in an empty grid
+    grid.Build(points.data(), 0);
+    grid.Query(Vector3(), 100.f, slots);
+    CHECK(slots.empty());
+}
+
+TEST_CASE("Neighbour lists match brute force for every point", "[SpatialHash]")
+{
+    std::vector<Vector3> points = RandomPoints(2000, 6.f, 3);
+
+    SpatialHashGrid grid(0.8f);
+    grid.Build(points.data(), points.size());
+
+    std::vector<uint32_t> offsets, neighbors;
+    grid.FindNeighbors(0.8f, offsets, neighbors);
+
+    REQUIRE(offsets.size() == points.size() + 1);
+    CHECK(offsets.back() == neighbors.size());
+
+    for (size_t s = 0; s < grid.Count(); s++)
+    {
+        uint32_t i = grid.Indices()[s];
+        std::vector<uint32_t> expected = BruteForce(points, points[i], 0.8f, i);
+
+        CHECK(Original(grid, neighbors.data() + offsets[s], offsets[s + 1] - offsets[s]) == expected);
+    }
+}
+
+TEST_CASE("Grid builds and batch queries do not depend on chunks or threads", "[SpatialHash]")
+{
+    // Several chunks, enough buckets for two radix passes, not a multiple of the chunk size
+    const size_t count = (kGridChunkSize * 3) + 7;
+    std::vector<Vector3> points = RandomPoints(count, 20.f, 4);
+
+    SpatialHashGrid inline_(1.f), pooled(1.f);
+    ThreadPool pool(3);
+
+    inline_.Build(points.data(), count);
+    pooled.Build(points.data(), count, pool.GetExecutor());
+
+    CHECK(std::equal(inline_.Indices(), inline_.Indices() + count, pooled.Indices()));
+
+    // Stable, so points sharing a bucket stay in index order
+    std::vector<uint32_t> offsets[2], neighbors[2];
+    inline_.FindNeighbors(1.f, offsets[0], neighbors[0]);
+    pooled.FindNeighbors(1.f, offsets[1], neighbors[1], pool.GetExecutor());
+
+    CHECK(offsets[0] == offsets[1]);
+    CHECK(neighbors[0] == neighbors[1]);
+
+    // Rebuilding with fewer points
+    inline_.Build(points.data(), 10);
+    std::vector<uint32_t> slots;
+    inline_.Query(Vector3(), 100.f, slots);
+    CHECK(slots.size() == 10);
+}
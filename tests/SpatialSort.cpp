@@ -0,0 +1,201 @@
+#include <catch2/catch_test_macros.hpp>
+#include <FMaths/SpatialSort.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Bit by bit interleave, x lowest
+ */
+uint64_t Interleave(uint32_t x, uint32_t y, uint32_t z, uint32_t bits)
+{
+    uint64_t code = 0;
+    for (uint32_t b = 0; b < bits; b++)
+    {
+        code |= uint64_t((x >> b) & 1) << (3 * b);
+        code |= uint64_t((y >> b) & 1) << ((3 * b) + 1);
+        code |= uint64_t((z >> b) & 1) << ((3 * b) + 2);
+    }
+
+    return code;
+}
+
+/**
+ * @brief Whether the codes of a 16^3 corner of the grid are 0 to 4095, consecutive codes in neighbouring cells
+ */
+template<typename Fn>
+bool ContinuousCorner(Fn code)
+{
+    const uint32_t n = 16;
+    std::vector<int> cellOf(n * n * n, -1);
+
+    for (uint32_t z = 0; z < n; z++)
+        for (uint32_t y = 0; y < n; y++)
+            for (uint32_t x = 0; x < n; x++)
+            {
+                uint64_t c = code(x, y, z);
+                if (c >= n * n * n || cellOf[c] != -1)
+                    return false;
+
+                cellOf[c] = int((z * n * n) + (y * n) + x);
+            }
+
+    for (size_t c = 1; c < cellOf.size(); c++)
+    {
+        int a = cellOf[c - 1], b = cellOf[c], side = int(n);
+        int steps = std::abs((a % side) - (b % side)) + std::abs(((a / side) % side) - ((b / side) % side)) +
+                    std::abs((a / (side * side)) - (b / (side * side)));
+
+        if (steps != 1)
+            return false;
+    }
+
+    return true;
+}
+
+std::vector<Vector3> RandomPoints(size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+
+    std::vector<Vector3> points(count);
+    for (Vector3& p : points)
+        p = Vector3(dist(rng), dist(rng) * 0.5f, dist(rng) + 3.f);
+
+    return points;
+}
+
+} // namespace
+
+TEST_CASE("Morton and Hilbert codes interleave and trace the grid", "[SpatialSort]")
+{
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<uint32_t> dist;
+
+    for (size_t k = 0; k < 1000; k++)
+    {
+        uint32_t x = dist(rng), y = dist(rng), z = dist(rng);
+
+        CHECK(Morton30(x, y, z) == Interleave(x & 0x3FF, y & 0x3FF, z & 0x3FF, 10));
+        CHECK(Morton63(x, y, z) == Interleave(x & 0x1FFFFF, y & 0x1FFFFF, z & 0x1FFFFF, 21));
+        CHECK(Hilbert30(x, y, z) < (1u << 30));
+        CHECK(Hilbert63(x, y, z) < (uint64_t(1) << 63));
+    }
+
+    CHECK(Morton30(1, 0, 0) == 1);
+    CHECK(Morton30(0, 0, 1) == 4);
+    CHECK(Morton30(1023, 1023, 1023) == (1u << 30) - 1);
+    CHECK(Morton63(0x1FFFFF, 0x1FFFFF, 0x1FFFFF) == (uint64_t(1) << 63) - 1);
+
+    // The curve starts at the origin, so every corner cube is a whole level of it
+    CHECK(ContinuousCorner([](uint32_t x, uint32_t y, uint32_t z) { return uint64_t(Hilbert30(x, y, z)); }));
+    CHECK(ContinuousCorner([](uint32_t x, uint32_t y, uint32_t z) { return Hilbert63(x, y, z); }));
+    CHECK_FALSE(ContinuousCorner([](uint32_t x, uint32_t y, uint32_t z) { return uint64_t(Morton30(x, y, z)); }));
+
+    CHECK(Hilbert30(1023, 1023, 1023) != Hilbert30(0, 0, 0));
+}
+
+TEST_CASE("Points encode against their bounds", "[SpatialSort]")
+{
+    // More than a chunk, not a multiple of the lanes
+    std::vector<Vector3> points = RandomPoints(5003, 1);
+    AABB bounds(Vector3(-10.f, -5.f, -7.f), Vector3(10.f, 5.f, 13.f));
+
+    std::vector<uint32_t> morton(points.size()), hilbert(points.size());
+    std::vector<uint64_t> wide(points.size());
+
+    EncodePoints(points.data(), points.size(), bounds, SpaceCurve::Morton, morton.data());
+    EncodePoints(points.data(), points.size(), bounds, SpaceCurve::Hilbert, hilbert.data());
+    EncodePoints(points.data(), points.size(), bounds, SpaceCurve::Morton, wide.data());
+
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        uint32_t x = uint32_t(std::floor((points[i].x + 10.f) * (1024.f / 20.f)));
+        uint32_t y = uint32_t(std::floor((points[i].y + 5.f) * (1024.f / 10.f)));
+        uint32_t z = uint32_t(std::floor((points[i].z + 7.f) * (1024.f / 20.f)));
+
+        CHECK(morton[i] == Morton30(x, y, z));
+        CHECK(hilbert[i] == Hilbert30(x, y, z));
+
+        // The 10 bit cells are the top bits of the 21 bit ones
+        CHECK((wide[i] >> 33) == morton[i]);
+    }
+
+    // Outside the bounds is clamped, NaN goes to 0, flat bounds put every point in cell 0
+    const Vector3 edges[] = {Vector3(-100.f, -100.f, -100.f), Vector3(100.f, 100.f, 100.f), Vector3(NAN, 5.f, NAN), Vector3(10.f, 5.f, 13.f)};
+    uint32_t codes[4];
+    EncodePoints(edges, 4, bounds, SpaceCurve::Morton, codes);
+
+    CHECK(codes[0] == 0);
+    CHECK(codes[1] == (1u << 30) - 1);
+    CHECK(codes[2] == Morton30(0, 1023, 0));
+    CHECK(codes[3] == (1u << 30) - 1);
+
+    EncodePoints(edges + 1, 1, AABB(Vector3(), Vector3(0.f, 1.f, 1.f)), SpaceCurve::Morton, codes);
+    CHECK(codes[0] == Morton30(0, 1023, 1023));
+}
+
+TEST_CASE("Sorting orders points along the curve on any executor", "[SpatialSort]")
+{
+    std::vector<Vector3> points = RandomPoints(20011, 2);
+    AABB bounds(Vector3(-10.f, -5.f, -7.f), Vector3(10.f, 5.f, 13.f));
+
+    std::vector<uint64_t> codes(points.size());
+    EncodePoints(points.data(), points.size(), bounds, SpaceCurve::Hilbert, codes.data());
+
+    // Repeat codes so stability shows
+    for (size_t i = 0; i < codes.size(); i += 7)
+        codes[i] = codes[0];
+
+    ThreadPool pool(3);
+    std::vector<uint32_t> order(points.size()), pooled(points.size());
+    SortCodes(codes.data(), codes.size(), order.data());
+    SortCodes(codes.data(), codes.size(), pooled.data(), pool.GetExecutor());
+
+    CHECK(order == pooled);
+
+    for (size_t i = 1; i < order.size(); i++)
+    {
+        CHECK(codes[order[i - 1]] <= codes[order[i]]);
+        if (codes[order[i - 1]] == codes[order[i]])
+            CHECK(order[i - 1] < order[i]);
+    }
+
+    std::vector<Vector3> sorted = points;
+    std::vector<uint32_t> permutation(points.size());
+    SpatialSort(sorted.data(), sorted.size(), permutation.data(), SpaceCurve::Morton, pool.GetExecutor());
+
+    std::vector<uint32_t> seen(points.size(), 0);
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        CHECK(sorted[i].x == points[permutation[i]].x);
+        CHECK(sorted[i].z == points[permutation[i]].z);
+        seen[permutation[i]]++;
+    }
+
+    CHECK(std::count(seen.begin(), seen.end(), 1u) == long(points.size()));
+
+    // Neighbours in the sorted array are far closer than in the original order
+    double before = 0.0, after = 0.0;
+    for (size_t i = 1; i < points.size(); i++)
+    {
+        before += (points[i] - points[i - 1]).Length();
+        after += (sorted[i] - sorted[i - 1]).Length();
+    }
+
+    CHECK(after * 10.0 < before);
+
+    std::vector<float> weights(points.size()), permuted(points.size());
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = float(i);
+
+    Permute(weights.data(), permutation.data(), weights.size(), permuted.data(), pool.GetExecutor());
+    CHECK(permuted[5] == float(permutation[5]));
+
+    SpatialSort(sorted.data(), 0, permutation.data());
+}
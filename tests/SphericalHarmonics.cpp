@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <FMaths/SphericalHarmonics.h>
+#include <FMaths/Quaternion.h>
+#include <FMaths/Matrix4x4.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+
+// Evenly spread unit directions
+std::vector<Vector3> FibonacciSphere(size_t n)
+{
+    std::vector<Vector3> dirs;
+    const float golden = 2.39996322972865f;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        float z = 1.f - ((2.f * static_cast<float>(i) + 1.f) / static_cast<float>(n));
+        float r = sqrtf(1.f - (z * z));
+        float phi = golden * static_cast<float>(i);
+
+        dirs.push_back(Vector3(r * cosf(phi), r * sinf(phi), z));
+    }
+
+    return dirs;
+}
+
+} // namespace
+
+TEST_CASE("Projection and evaluation", "[SphericalHarmonics]")
+{
+    std::vector<Vector3> dirs = FibonacciSphere(4096);
+    std::vector<Vector3> radiance;
+    std::vector<float> weights(dirs.size(), 4.f * 3.14159265f / static_cast<float>(dirs.size()));
+
+    // Linear in the direction, so exactly representable with 2 bands
+    for (const Vector3& d : dirs)
+        radiance.push_back(Vector3(1.f + (0.5f * d.x), 2.f - d.z, 0.25f * d.y));
+
+    SH2 sh;
+    sh.AddSamples(dirs.data(), radiance.data(), weights.data(), dirs.size());
+
+    SH2 scalar;
+    for (size_t i = 0; i < dirs.size(); i++)
+        scalar.AddSample(dirs[i], radiance[i], weights[i]);
+
+    REQUIRE(sh.coefficients[0].ApproxEqual(scalar.coefficients[0], 1e-4f));
+
+    std::vector<Vector3> batch(dirs.size());
+    sh.Evaluate(dirs.data(), batch.data(), dirs.size());
+
+    for (size_t i = 0; i < dirs.size(); i += 97)
+    {
+        Vector3 value = sh.Evaluate(dirs[i]);
+
+        REQUIRE(batch[i] == value);
+        REQUIRE(value.x == Approx(radiance[i].x).margin(1e-3));
+        REQUIRE(value.y == Approx(radiance[i].y).margin(1e-3));
+        REQUIRE(value.z == Approx(radiance[i].z).margin(1e-3));
+    }
+
+    // Constant radiance L gives irradiance pi L on any surface
+    SH3 sky;
+    for (size_t i = 0; i < dirs.size(); i++)
+        sky.AddSample(dirs[i], Vector3(1.f, 1.f, 1.f), weights[i]);
+
+    sky.ConvolveCosine();
+    REQUIRE(sky.Evaluate(Vector3(0.f, 1.f, 0.f)).x == Approx(3.14159265f).epsilon(1e-3));
+}
+
+TEST_CASE("Rotation", "[SphericalHarmonics]")
+{
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+    std::vector<SH3> sh(11);
+    for (SH3& s : sh)
+        for (Vector3& c : s.coefficients)
+            c = Vector3(dist(rng), dist(rng), dist(rng));
+
+    Quaternion q = Quaternion::FromEuler(Vector3(0.4f, -1.1f, 2.3f));
+    Matrix4x4 m = Matrix4x4::QuatRotate(Vector4(q.x, q.y, q.z, q.w));
+
+    std::vector<SH3> rotated(sh.size());
+    SH3::Rotate(sh.data(), rotated.data(), sh.size(), m);
+
+    std::vector<Vector3> dirs = FibonacciSphere(50);
+
+    for (size_t i = 0; i < sh.size(); i++)
+    {
+        SH3 byQuat = sh[i].Rotated(q);
+
+        for (const Vector3& d : dirs)
+        {
+            Vector3 expected = sh[i].Evaluate(d);
+            Vector3 actual = byQuat.Evaluate(q.Apply(d));
+
+            for (size_t ch = 0; ch < 3; ch++)
+            {
+                REQUIRE(actual[ch] == Approx(expected[ch]).margin(1e-5));
+                REQUIRE(rotated[i].Evaluate(q.Apply(d))[ch] == Approx(expected[ch]).margin(1e-5));
+            }
+        }
+    }
+
+    // Band 0 and 1 only
+    SH2 low;
+    for (size_t k = 0; k < SH2::Count; k++)
+        low.coefficients[k] = sh[0].coefficients[k];
+
+    Vector3 d(0.f, 0.6f, 0.8f);
+    REQUIRE(low.Rotated(q).Evaluate(q.Apply(d)).x == Approx(low.Evaluate(d).x).margin(1e-5));
+}
@@ -0,0 +1,195 @@
+#include <catch2/catch_test_macros.hpp>
+#include <FMaths/TransformStream.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<Matrix4x4> RandomMatrices(size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+
+    std::vector<Matrix4x4> m(count);
+    for (Matrix4x4& matrix : m)
+        for (size_t col = 0; col < 4; col++)
+            matrix[col] = Vector4(dist(rng), dist(rng), dist(rng), col == 3 ? 1.f : 0.f);
+
+    return m;
+}
+
+bool SameRanges(const std::vector<DirtyRange>& a, const std::vector<DirtyRange>& b)
+{
+    if (a.size() != b.size())
+        return false;
+
+    for (size_t i = 0; i < a.size(); i++)
+        if (a[i].begin != b[i].begin || a[i].end != b[i].end)
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief Whether the last written buffer holds every matrix in the stream's format
+ */
+bool Matches(const TransformStream& stream, const std::vector<Matrix4x4>& m)
+{
+    const float* buffer = stream.Buffer();
+    size_t floats = stream.Stride() / sizeof(float);
+
+    for (size_t i = 0; i < m.size(); i++)
+    {
+        for (size_t row = 0; row < 4; row++)
+        {
+            for (size_t col = 0; col < 4; col++)
+            {
+                float expected = m[i][col][row];
+
+                if (stream.Format() == InstanceFormat::Full4x4)
+                {
+                    if (buffer[(i * floats) + (col * 4) + row] != expected)
+                        return false;
+                }
+                else if (row < 3 && buffer[(i * floats) + (row * 4) + col] != expected)
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Only changed matrices are reported and re-encoded", "[TransformStream]")
+{
+    std::vector<Matrix4x4> m = RandomMatrices(100, 1);
+    TransformStream stream(InstanceFormat::Affine3x4, 1);
+
+    stream.Update(m.data(), m.size());
+    CHECK(stream.Stride() == 12 * sizeof(float));
+    CHECK(SameRanges(stream.DirtyRanges(), {{0, 100}}));
+    CHECK(Matches(stream, m));
+
+    stream.Update(m.data(), m.size());
+    CHECK(stream.DirtyRanges().empty());
+    CHECK(stream.ChangedRanges().empty());
+
+    m[3][3].x = 5.f;
+    m[4][0].y = 1.f;
+    m[10][2].w = 2.f;
+    m[99][1].z = -1.f;
+
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.ChangedRanges(), {{3, 5}, {10, 11}, {99, 100}}));
+    CHECK(SameRanges(stream.DirtyRanges(), stream.ChangedRanges()));
+    CHECK(Matches(stream, m));
+
+    // Bits, not values, so an unchanged NaN is clean and -0 is a change
+    m[50][1].x = std::numeric_limits<float>::quiet_NaN();
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.ChangedRanges(), {{50, 51}}));
+
+    stream.Update(m.data(), m.size());
+    CHECK(stream.ChangedRanges().empty());
+
+    m[60][0].z = -0.f;
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.ChangedRanges(), {{60, 61}}));
+
+    stream.Invalidate();
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.DirtyRanges(), {{0, 100}}));
+}
+
+TEST_CASE("Each buffer catches up on the frames it missed", "[TransformStream]")
+{
+    std::vector<Matrix4x4> m = RandomMatrices(64, 2);
+    TransformStream stream(InstanceFormat::Full4x4, 3, 2);
+
+    // Every buffer starts out dirty
+    for (size_t i = 0; i < 3; i++)
+    {
+        stream.Update(m.data(), m.size());
+        CHECK(stream.BufferIndex() == i);
+        CHECK(SameRanges(stream.DirtyRanges(), {{0, 64}}));
+        CHECK(Matches(stream, m));
+    }
+
+    m[10][3].x += 1.f;
+    stream.Update(m.data(), m.size());
+    CHECK(stream.BufferIndex() == 0);
+    CHECK(SameRanges(stream.DirtyRanges(), {{10, 11}}));
+
+    // Close enough to the last change to be merged
+    m[13][3].x += 1.f;
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.ChangedRanges(), {{13, 14}}));
+    CHECK(SameRanges(stream.DirtyRanges(), {{10, 14}}));
+
+    m[40][3].x += 1.f;
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.DirtyRanges(), {{10, 14}, {40, 41}}));
+    CHECK(Matches(stream, m));
+
+    // Buffer 0 has frame 3's change but not 4's or 5's
+    stream.Update(m.data(), m.size());
+    CHECK(stream.ChangedRanges().empty());
+    CHECK(SameRanges(stream.DirtyRanges(), {{13, 14}, {40, 41}}));
+    CHECK(Matches(stream, m));
+
+    stream.Update(m.data(), m.size());
+    stream.Update(m.data(), m.size());
+    CHECK(stream.DirtyRanges().empty());
+    CHECK(Matches(stream, m));
+
+    // A new count starts over
+    m.resize(30);
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.DirtyRanges(), {{0, 30}}));
+    stream.Update(m.data(), m.size());
+    CHECK(SameRanges(stream.DirtyRanges(), {{0, 30}}));
+    CHECK(stream.ChangedRanges().empty());
+    CHECK(Matches(stream, m));
+}
+
+TEST_CASE("Streaming does not depend on chunks or threads", "[TransformStream]")
+{
+    // Not a multiple of the chunk size, with a change across a chunk boundary
+    const size_t count = (kStreamChunkSize * 3) + 17;
+    std::vector<Matrix4x4> m = RandomMatrices(count, 3);
+
+    TransformStream inline_(InstanceFormat::Affine3x4, 2);
+    TransformStream pooled(InstanceFormat::Affine3x4, 2);
+    ThreadPool pool(3);
+
+    std::mt19937 rng(4);
+
+    for (size_t frame = 0; frame < 6; frame++)
+    {
+        for (size_t k = 0; k < 50; k++)
+            m[rng() % count][3].y += 1.f;
+
+        m[kStreamChunkSize - 1][0].x += 1.f;
+        m[kStreamChunkSize][0].x += 1.f;
+
+        inline_.Update(m.data(), m.size());
+        pooled.Update(m.data(), m.size(), pool.GetExecutor());
+
+        CHECK(SameRanges(inline_.DirtyRanges(), pooled.DirtyRanges()));
+        CHECK(SameRanges(inline_.ChangedRanges(), pooled.ChangedRanges()));
+        CHECK(Matches(inline_, m));
+        CHECK(Matches(pooled, m));
+
+        bool joined = false;
+        for (const DirtyRange& r : inline_.ChangedRanges())
+            joined = joined || (r.begin < kStreamChunkSize && r.end > kStreamChunkSize);
+
+        CHECK(joined);
+    }
+}
@@ -1,5 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <FMaths/Vector3.h>
+#include <FMaths/Swizzle.h>
+
+#include <vector>
 
 TEST_CASE("Accessing Variables", "[Vector3]")
 {
@@ -8,4 +11,87 @@ TEST_CASE("Accessing Variables", "[Vector3]")
     REQUIRE(vec.x == ((float*)&vec)[0]);
     REQUIRE(vec.y == ((float*)&vec)[1]);
     REQUIRE(vec.z == ((float*)&vec)[2]);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Approximate comparison", "[Vector3]")
+{
+    Vector3 a(1.f, 2.f, 3.f);
+    Vector3 b(1.f + 1e-6f, 2.f, 3.f);
+
+    REQUIRE_FALSE(a == b);
+    REQUIRE(a.ApproxEqual(b));
+    REQUIRE_FALSE(a.ApproxEqual(b, 1e-7f));
+    REQUIRE(a.UlpEqual(b, 16));
+    REQUIRE_FALSE(a.UlpEqual(b, 4));
+
+    // Relative away from 0, absolute near it
+    REQUIRE(Vector3(1e6f, 0.f, 0.f).ApproxEqual(Vector3(1e6f + 1.f, 0.f, 0.f)));
+    REQUIRE(Vector3(1e-9f, 0.f, 0.f).ApproxEqual(Vector3(-1e-9f, 0.f, 0.f)));
+    REQUIRE_FALSE(Vector3(1e-9f, 0.f, 0.f).UlpEqual(Vector3(-1e-9f, 0.f, 0.f)));
+
+    REQUIRE(UlpDistance(0.f, -0.f) == 0);
+    REQUIRE(UlpDistance(-__FLT_DENORM_MIN__, __FLT_DENORM_MIN__) == 2);
+    REQUIRE_FALSE(ApproxEqual(__builtin_inff(), 1e30f));
+    REQUIRE_FALSE(UlpEqual(__builtin_nanf(""), __builtin_nanf("")));
+}
+
+TEST_CASE("Quantized hash", "[Vector3]")
+{
+    REQUIRE(Vector3(0.1f, 0.2f, 0.3f).QuantizedHash(1.f) == Vector3(0.9f, 0.8f, 0.7f).QuantizedHash(1.f));
+    REQUIRE(Vector3(0.1f, 0.2f, 0.3f).QuantizedHash(1.f) != Vector3(1.1f, 0.2f, 0.3f).QuantizedHash(1.f));
+    REQUIRE(Vector3(-0.5f, 0.f, 0.f).QuantizedHash(1.f) != Vector3(0.5f, 0.f, 0.f).QuantizedHash(1.f));
+}
+
+TEST_CASE("Batched products match scalar", "[Vector3]")
+{
+    std::vector<Vector3> a, b;
+    for (size_t i = 0; i < 21; i++)
+    {
+        float f = static_cast<float>(i);
+        a.push_back(Vector3(f, 1.f - f, 0.5f * f));
+        b.push_back(Vector3(2.f, f * f, -f));
+    }
+
+    a[3] = Vector3(0.f, 1.f, 0.f);
+
+    std::vector<float> dot(a.size());
+    std::vector<Vector3> cross(a.size()), normalized(a);
+
+    Vector3::Dot(a.data(), b.data(), dot.data(), a.size());
+    Vector3::Cross(a.data(), b.data(), cross.data(), a.size());
+    Vector3::Normalize(normalized.data() + 1, a.size() - 1);
+
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        REQUIRE(dot[i] == a[i].Dot(b[i]));
+        REQUIRE(cross[i] == a[i].Cross(b[i]));
+
+        if (i > 0)
+            REQUIRE(normalized[i] == a[i].Normalized());
+    }
+}
+
+TEST_CASE("Swizzles and conversions", "[Vector3]")
+{
+    Vector4 v(1.f, 2.f, 3.f, 4.f);
+
+    REQUIRE(Swizzle<2, 1, 0>(v) == Vector3(3.f, 2.f, 1.f));
+    REQUIRE(Swizzle<3, 3>(v) == Vector2(4.f, 4.f));
+    REQUIRE(Swizzle<0, 0, 1, 1>(Vector2(5.f, 6.f)) == Vector4(5.f, 5.f, 6.f, 6.f));
+    REQUIRE(Swizzle<1, 2, 0, 2>(Vector3(7.f, 8.f, 9.f)) == Vector4(8.f, 9.f, 7.f, 9.f));
+
+    SetSwizzle<2, 0>(v, Vector2(10.f, 20.f));
+    REQUIRE(v == Vector4(20.f, 2.f, 10.f, 4.f));
+
+    Vector3 u(1.f, 2.f, 3.f);
+    SetSwizzle<2, 0, 1>(u, u);
+    REQUIRE(u == Vector3(2.f, 3.f, 1.f));
+
+    // Conversions keep the leading components
+    REQUIRE(Vector3(v) == Vector3(20.f, 2.f, 10.f));
+    REQUIRE(Vector4(Vector3(1.f, 2.f, 3.f), 0.f) == Vector4(1.f, 2.f, 3.f, 0.f));
+    REQUIRE(Vector4(Vector2(1.f, 2.f)) == Vector4(1.f, 2.f, 0.f, 1.f));
+    REQUIRE(Vector2(v) == Vector2(20.f, 2.f));
+
+    static_assert(SwizzleDistinct<0, 2, 1>() && !SwizzleDistinct<0, 1, 0>(), "Repeated components are found");
+}
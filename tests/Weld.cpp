@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <FMaths/Weld.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Same rule as WeldVertices, comparing against every unique vertex
+size_t WeldBruteForce(const std::vector<Vector3>& v, float tolerance, std::vector<uint32_t>& remap)
+{
+    std::vector<Vector3> unique;
+    remap.resize(v.size());
+
+    for (size_t i = 0; i < v.size(); i++)
+    {
+        size_t match = 0;
+        while (match < unique.size() && (unique[match] - v[i]).LengthSquared() > tolerance * tolerance)
+            match++;
+
+        if (match == unique.size())
+            unique.push_back(v[i]);
+
+        remap[i] = static_cast<uint32_t>(match);
+    }
+
+    return unique.size();
+}
+
+} // namespace
+
+TEST_CASE("Welding matches brute force", "[Weld]")
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coord(-4.f, 4.f);
+    std::uniform_real_distribution<float> jitter(-1e-3f, 1e-3f);
+
+    // Shared corners with small errors, plus points scattered near each other
+    std::vector<Vector3> v;
+    for (size_t i = 0; i < 500; i++)
+    {
+        Vector3 p(coord(rng), coord(rng), coord(rng));
+        v.push_back(p);
+
+        for (size_t dup = 0; dup < i % 4; dup++)
+            v.push_back(p + Vector3(jitter(rng), jitter(rng), jitter(rng)));
+    }
+
+    std::shuffle(v.begin(), v.end(), rng);
+
+    for (float tolerance : {0.f, 1e-3f, 0.01f, 0.5f})
+    {
+        std::vector<uint32_t> remap(v.size()), expectedRemap;
+        std::vector<Vector3> unique(v.size());
+
+        size_t count = WeldVertices(v.data(), v.size(), tolerance, remap.data(), unique.data());
+
+        REQUIRE(count == WeldBruteForce(v, tolerance, expectedRemap));
+        REQUIRE(remap == expectedRemap);
+
+        for (size_t i = 0; i < v.size(); i++)
+            REQUIRE((unique[remap[i]] - v[i]).Length() <= tolerance * 1.0001f);
+    }
+}
+
+TEST_CASE("Exact welding", "[Weld]")
+{
+    std::vector<Vector3> v = {
+        Vector3(1.f, 2.f, 3.f),
+        Vector3(0.f, 0.f, 0.f),
+        Vector3(1.f, 2.f, 3.f),
+        Vector3(-0.f, 0.f, 0.f),
+        Vector3(1.f, 2.f, 3.0000002f)
+    };
+
+    std::vector<uint32_t> remap(v.size());
+    size_t count = WeldVertices(v.data(), v.size(), 0.f, remap.data(), v.data());
+
+    REQUIRE(count == 3);
+    REQUIRE(remap == std::vector<uint32_t>{0, 1, 0, 1, 2});
+    REQUIRE(v[2] == Vector3(1.f, 2.f, 3.0000002f));
+}
+
+TEST_CASE("Exact welding of a dense unit mesh", "[Weld]")
+{
+    // Every position within one unit, which would share a handful of cells, each repeated 3 times
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<float> coord(0.f, 1.f);
+
+    std::vector<Vector3> v;
+    for (size_t i = 0; i < 100000; i++)
+    {
+        Vector3 p(coord(rng), coord(rng), coord(rng));
+        v.insert(v.end(), {p, p, p});
+    }
+
+    // Distinct values whose squared distance underflows to 0 stay apart
+    v.push_back(Vector3(1e-30f, 0.f, 0.f));
+    v.push_back(Vector3(2e-30f, 0.f, 0.f));
+    v.push_back(Vector3(NAN, 0.f, 0.f));
+    v.push_back(Vector3(NAN, 0.f, 0.f));
+
+    std::shuffle(v.begin(), v.end(), rng);
+
+    std::vector<uint32_t> remap(v.size());
+    std::vector<Vector3> unique(v.size());
+    size_t count = WeldVertices(v.data(), v.size(), 0.f, remap.data(), unique.data());
+
+    REQUIRE(count == 100000 + 4);
+
+    for (size_t i = 0; i < v.size(); i++)
+    {
+        const Vector3& u = unique[remap[i]];
+        if (v[i].x == v[i].x)
+            REQUIRE((u.x == v[i].x && u.y == v[i].y && u.z == v[i].z));
+    }
+}